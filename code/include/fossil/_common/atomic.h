@@ -0,0 +1,111 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_ATOMIC_H
+#define FOSSIL_TEST_ATOMIC_H
+
+#include "common.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Minimal atomic helpers shared by the lock-free parts of Fossil Test. Loads
+// use acquire ordering and stores use release ordering, read-modify-write
+// operations are relaxed unless noted otherwise.
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+static inline uint64_t fossil_atomic_fetch_add_u64(volatile uint64_t *target, uint64_t value) {
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)target, (__int64)value);
+}
+
+static inline uint32_t fossil_atomic_fetch_add_u32(volatile uint32_t *target, uint32_t value) {
+    return (uint32_t)_InterlockedExchangeAdd((volatile long *)target, (long)value);
+}
+
+static inline uint64_t fossil_atomic_load_u64(volatile uint64_t *target) {
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)target, 0, 0);
+}
+
+static inline uint32_t fossil_atomic_load_u32(volatile uint32_t *target) {
+    return (uint32_t)_InterlockedCompareExchange((volatile long *)target, 0, 0);
+}
+
+static inline void fossil_atomic_store_u64(volatile uint64_t *target, uint64_t value) {
+    _InterlockedExchange64((volatile __int64 *)target, (__int64)value);
+}
+
+static inline void fossil_atomic_store_u32(volatile uint32_t *target, uint32_t value) {
+    _InterlockedExchange((volatile long *)target, (long)value);
+}
+
+static inline uint32_t fossil_atomic_exchange_u32(volatile uint32_t *target, uint32_t value) {
+    return (uint32_t)_InterlockedExchange((volatile long *)target, (long)value);
+}
+
+static inline bool fossil_atomic_compare_exchange_u64(volatile uint64_t *target, uint64_t *expected, uint64_t desired) {
+    uint64_t previous = (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)target, (__int64)desired, (__int64)*expected);
+    if (previous == *expected) {
+        return true;
+    }
+    *expected = previous;
+    return false;
+}
+
+#else
+
+static inline uint64_t fossil_atomic_fetch_add_u64(volatile uint64_t *target, uint64_t value) {
+    return __atomic_fetch_add(target, value, __ATOMIC_RELAXED);
+}
+
+static inline uint32_t fossil_atomic_fetch_add_u32(volatile uint32_t *target, uint32_t value) {
+    return __atomic_fetch_add(target, value, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t fossil_atomic_load_u64(volatile uint64_t *target) {
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+}
+
+static inline uint32_t fossil_atomic_load_u32(volatile uint32_t *target) {
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+}
+
+static inline void fossil_atomic_store_u64(volatile uint64_t *target, uint64_t value) {
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+}
+
+static inline void fossil_atomic_store_u32(volatile uint32_t *target, uint32_t value) {
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t fossil_atomic_exchange_u32(volatile uint32_t *target, uint32_t value) {
+    return __atomic_exchange_n(target, value, __ATOMIC_ACQ_REL);
+}
+
+// On failure *expected receives the current value, ordering is acquire-release.
+static inline bool fossil_atomic_compare_exchange_u64(volatile uint64_t *target, uint64_t *expected, uint64_t desired) {
+    return __atomic_compare_exchange_n(target, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -52,6 +52,29 @@ Description:
 #define FOSSIL_TEST_FLOAT_EPSILON 1e-6
 #define FOSSIL_TEST_DOUBLE_EPSILON 1e-9
 
+// Thread local storage for per-thread counters and identifiers
+#if defined(__cplusplus) && __cplusplus >= 201103L
+    #define FOSSIL_TEST_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define FOSSIL_TEST_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define FOSSIL_TEST_THREAD_LOCAL _Thread_local
+#else
+    #define FOSSIL_TEST_THREAD_LOCAL __thread
+#endif
+
+// Branch hints keeping passing assertions inline and failures out of the way
+#if defined(__GNUC__) || defined(__clang__)
+    #define FOSSIL_TEST_LIKELY(x) __builtin_expect(!!(x), 1)
+    #define FOSSIL_TEST_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+    #define FOSSIL_TEST_LIKELY(x) (!!(x))
+    #define FOSSIL_TEST_COLD __declspec(noinline)
+#else
+    #define FOSSIL_TEST_LIKELY(x) (!!(x))
+    #define FOSSIL_TEST_COLD
+#endif
+
 #if __cplusplus >= 201103L || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L)
 /**
  * @brief Definition for xnull pointers in C++11 and later or C23 and later.
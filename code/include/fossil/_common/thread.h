@@ -0,0 +1,89 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_THREAD_H
+#define FOSSIL_TEST_THREAD_H
+
+#include "common.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Minimal thread helpers shared by the parts of Fossil Test that run work in
+// the background. Both functions return 0 on success.
+
+typedef void* (*fossil_thread_function_t)(void *arg);
+
+#ifdef _WIN32
+
+typedef HANDLE fossil_thread_t;
+
+typedef struct {
+    fossil_thread_function_t function;
+    void *arg;
+} fossil_thread_start_t;
+
+static inline DWORD WINAPI fossil_thread_trampoline(LPVOID param) {
+    fossil_thread_start_t start = *(fossil_thread_start_t *)param;
+    free(param);
+    start.function(start.arg);
+    return 0;
+}
+
+static inline int fossil_thread_create(fossil_thread_t *thread, fossil_thread_function_t function, void *arg) {
+    fossil_thread_start_t *start = (fossil_thread_start_t *)malloc(sizeof(fossil_thread_start_t));
+    if (start == NULL) {
+        return -1;
+    }
+    start->function = function;
+    start->arg = arg;
+    *thread = CreateThread(NULL, 0, fossil_thread_trampoline, start, 0, NULL);
+    if (*thread == NULL) {
+        free(start);
+        return -1;
+    }
+    return 0;
+}
+
+static inline int fossil_thread_join(fossil_thread_t thread) {
+    if (WaitForSingleObject(thread, INFINITE) != WAIT_OBJECT_0) {
+        return -1;
+    }
+    CloseHandle(thread);
+    return 0;
+}
+
+#else
+
+typedef pthread_t fossil_thread_t;
+
+static inline int fossil_thread_create(fossil_thread_t *thread, fossil_thread_function_t function, void *arg) {
+    return pthread_create(thread, NULL, function, arg);
+}
+
+static inline int fossil_thread_join(fossil_thread_t thread) {
+    return pthread_join(thread, NULL);
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -29,6 +29,12 @@ Description:
 #include "mockup/network.h"
 #include "mockup/stub.h"
 #include "mockup/output.h"
+#include "mockup/sequence.h"
+#include "mockup/capture.h"
+#include "mockup/vfs.h"
+#include "mockup/route.h"
+#include "mockup/fault.h"
+#include "mockup/server.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -25,6 +25,7 @@ typedef struct fossil_mockup_behavior {
     char *function_name;
     void **args;
     int32_t arg_count;
+    int32_t sequence_id; // id in the interaction log
     struct fossil_mockup_behavior *next; // for chaining behaviors
 } fossil_mockup_behavior_t;
 
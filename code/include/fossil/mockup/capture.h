@@ -0,0 +1,159 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_CAPTURE_H
+#define FOSSIL_MOCK_CAPTURE_H
+
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// FOSSIL_TEST(logger_writes_banner) {
+//     fossil_mockup_capture_t *capture = fossil_mockup_capture_start(1);
+//     run_noisy_component();
+//     fossil_mockup_capture_stop(capture);
+//
+//     ASSUME_ITS_TRUE(fossil_mockup_capture_contains_line(capture, "ready"));
+//     ASSUME_ITS_TRUE(fossil_mockup_capture_match(capture, "^took [0-9]+ ms$"));
+//     fossil_mockup_capture_erase(capture);
+// }
+
+// Captured file descriptor type
+typedef struct fossil_mockup_capture {
+    int target_fd;   // descriptor being redirected, 1 for stdout and 2 for stderr
+    int saved_fd;    // duplicate of the original target, restored on stop
+    int sink_fd;     // memfd or temporary file receiving the bytes
+    char *buffer;    // captured bytes, always NUL-terminated
+    size_t length;
+    size_t capacity;
+    char *scratch;   // reusable line buffer for regex engines without REG_STARTEND
+    size_t scratch_capacity;
+    bool active;
+} fossil_mockup_capture_t;
+
+/**
+ * @brief Start capturing everything written to a file descriptor.
+ *
+ * The descriptor is redirected into an anonymous in-memory file (memfd on
+ * Linux, a temporary file elsewhere), so writers never block no matter how
+ * much they produce. Pending stdio buffers are flushed first.
+ *
+ * @param fd The descriptor to capture, for example 1 for stdout or 2 for stderr.
+ * @return A pointer to the newly created capture object.
+ */
+fossil_mockup_capture_t* fossil_mockup_capture_start(int fd);
+
+/**
+ * @brief Pull bytes written so far into the capture buffer.
+ *
+ * Capturing continues afterwards. The buffer grows geometrically so repeated
+ * collection stays linear in the amount of output.
+ *
+ * @param capture The capture object.
+ * @return The total number of captured bytes.
+ */
+size_t fossil_mockup_capture_collect(fossil_mockup_capture_t *capture);
+
+/**
+ * @brief Stop capturing and restore the original descriptor.
+ *
+ * Collects any remaining bytes. Calling it on a stopped capture does nothing.
+ *
+ * @param capture The capture object.
+ */
+void fossil_mockup_capture_stop(fossil_mockup_capture_t *capture);
+
+/**
+ * @brief Get the captured bytes.
+ *
+ * @param capture The capture object.
+ * @param length  Receives the number of captured bytes, may be NULL.
+ * @return The NUL-terminated capture buffer.
+ */
+const char* fossil_mockup_capture_data(fossil_mockup_capture_t *capture, size_t *length);
+
+/**
+ * @brief Iterate over the captured lines without copying them.
+ *
+ * Start with *offset set to 0. Each call stores the next line, without its
+ * trailing newline, in *line and *length.
+ *
+ * @param capture The capture object.
+ * @param offset  The iteration cursor.
+ * @param line    Receives a pointer into the capture buffer.
+ * @param length  Receives the length of the line.
+ * @return true if a line was produced, false at the end of the output.
+ */
+bool fossil_mockup_capture_next_line(fossil_mockup_capture_t *capture, size_t *offset, const char **line, size_t *length);
+
+/**
+ * @brief Count the captured lines.
+ *
+ * @param capture The capture object.
+ * @return The number of lines, a trailing line without newline included.
+ */
+size_t fossil_mockup_capture_line_count(fossil_mockup_capture_t *capture);
+
+/**
+ * @brief Check whether the captured output contains a piece of text.
+ *
+ * @param capture The capture object.
+ * @param text    The text to search for.
+ * @return true if the text occurs anywhere in the output, false otherwise.
+ */
+bool fossil_mockup_capture_contains(fossil_mockup_capture_t *capture, const char *text);
+
+/**
+ * @brief Check whether the captured output contains an exact line.
+ *
+ * @param capture The capture object.
+ * @param expected_line The line to look for, without newline.
+ * @return true if a line matches exactly, false otherwise.
+ */
+bool fossil_mockup_capture_contains_line(fossil_mockup_capture_t *capture, const char *expected_line);
+
+/**
+ * @brief Check whether any captured line matches a regular expression.
+ *
+ * Uses POSIX extended regular expressions, matched line by line so that '^'
+ * and '$' anchor to line boundaries. On platforms without <regex.h> the
+ * pattern is treated as plain text.
+ *
+ * @param capture The capture object.
+ * @param pattern The regular expression.
+ * @return true if at least one line matches, false otherwise.
+ */
+bool fossil_mockup_capture_match(fossil_mockup_capture_t *capture, const char *pattern);
+
+/**
+ * @brief Discard the captured bytes, capturing continues if active.
+ *
+ * @param capture The capture object.
+ */
+void fossil_mockup_capture_reset(fossil_mockup_capture_t *capture);
+
+/**
+ * @brief Erase the capture object, stopping it first if needed.
+ *
+ * @param capture The capture object.
+ */
+void fossil_mockup_capture_erase(fossil_mockup_capture_t *capture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -24,6 +24,7 @@ extern "C"
 typedef struct fossil_mockup_fake {
     char *function_name;
     void (*fake_function)(void);
+    int32_t sequence_id; // id in the interaction log
     struct fossil_mockup_fake *next; // for chaining fakes
 } fossil_mockup_fake_t;
 
@@ -0,0 +1,184 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_FAULT_H
+#define FOSSIL_MOCK_FAULT_H
+
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// FOSSIL_TEST(client_retries_on_slow_disk) {
+//     fossil_mockup_fault_t *fault = fossil_mockup_fault_create(42);
+//     fossil_mockup_fault_set_latency(fault, FOSSIL_MOCKUP_LATENCY_NORMAL, 2000, 500);
+//     fossil_mockup_fault_set_short_io(fault, 0.25, 512);
+//     fossil_mockup_fault_set_errors(fault, 0.05, 0.05, 0.0);
+//     fossil_mockup_fault_set_virtual_clock(fault, true);
+//
+//     fossil_mockup_file_set_fault(file, fault);
+//     ... exercise the reader, the same seed replays the same faults ...
+//
+//     fossil_mockup_fault_erase(fault);
+// }
+
+// Shape of the delay added to every operation
+typedef enum {
+    FOSSIL_MOCKUP_LATENCY_NONE,
+    FOSSIL_MOCKUP_LATENCY_FIXED,   // always a microseconds
+    FOSSIL_MOCKUP_LATENCY_UNIFORM, // between a and b microseconds
+    FOSSIL_MOCKUP_LATENCY_NORMAL   // mean a, standard deviation b, never negative
+} fossil_mockup_latency_t;
+
+// What an impaired operation should do
+typedef enum {
+    FOSSIL_MOCKUP_FAULT_PASS,      // go ahead, possibly with fewer bytes
+    FOSSIL_MOCKUP_FAULT_AGAIN,     // fail with EAGAIN
+    FOSSIL_MOCKUP_FAULT_INTERRUPT, // fail with EINTR
+    FOSSIL_MOCKUP_FAULT_DROP       // connection lost, every later operation fails too
+} fossil_mockup_fault_action_t;
+
+// Impairment object type, shared by the mocks it is attached to
+typedef struct fossil_mockup_fault {
+    uint64_t seed;
+    uint64_t state;            // PRNG state, rewound by fossil_mockup_fault_reset
+    fossil_mockup_latency_t latency;
+    uint64_t latency_a;
+    uint64_t latency_b;
+    double spike_rate;         // chance of adding spike_us on top of the latency
+    uint64_t spike_us;
+    uint64_t bytes_per_second; // 0 for unlimited
+    double short_rate;         // chance of moving fewer bytes than requested
+    size_t max_chunk;          // never move more than this many bytes, 0 for unlimited
+    double again_rate;
+    double interrupt_rate;
+    double drop_rate;
+    bool virtual_clock;        // advance now_us instead of sleeping
+    bool dropped;
+    uint64_t now_us;           // total injected delay
+    uint64_t operation_count;
+    uint64_t short_count;
+    uint64_t again_count;
+    uint64_t interrupt_count;
+    uint64_t drop_count;
+} fossil_mockup_fault_t;
+
+/**
+ * @brief Create an impairment layer that lets everything through.
+ *
+ * Every decision is drawn from a generator seeded with seed, so a run with
+ * the same seed and the same sequence of operations sees the same faults.
+ *
+ * @param seed The generator seed.
+ * @return A pointer to the newly created impairment object.
+ */
+fossil_mockup_fault_t* fossil_mockup_fault_create(uint64_t seed);
+
+/**
+ * @brief Set the latency added to every operation.
+ *
+ * @param fault The impairment object.
+ * @param kind  The distribution of the delay.
+ * @param a     Fixed delay, lower bound or mean in microseconds.
+ * @param b     Upper bound or standard deviation in microseconds.
+ */
+void fossil_mockup_fault_set_latency(fossil_mockup_fault_t *fault, fossil_mockup_latency_t kind, uint64_t a, uint64_t b);
+
+/**
+ * @brief Add rare latency spikes on top of the base latency.
+ *
+ * @param fault The impairment object.
+ * @param rate  The chance of a spike per operation, from 0 to 1.
+ * @param extra The spike length in microseconds.
+ */
+void fossil_mockup_fault_set_spikes(fossil_mockup_fault_t *fault, double rate, uint64_t extra);
+
+/**
+ * @brief Cap throughput, delaying each operation by the time its bytes take.
+ *
+ * @param fault            The impairment object.
+ * @param bytes_per_second The throughput, 0 removes the cap.
+ */
+void fossil_mockup_fault_set_bandwidth(fossil_mockup_fault_t *fault, uint64_t bytes_per_second);
+
+/**
+ * @brief Make operations move fewer bytes than requested.
+ *
+ * @param fault     The impairment object.
+ * @param rate      The chance of a short read or write, from 0 to 1.
+ * @param max_chunk Upper bound for every read or write, which splits
+ *                  responses into partial packets, 0 for unlimited.
+ */
+void fossil_mockup_fault_set_short_io(fossil_mockup_fault_t *fault, double rate, size_t max_chunk);
+
+/**
+ * @brief Make operations fail.
+ *
+ * @param fault          The impairment object.
+ * @param again_rate     The chance of EAGAIN, from 0 to 1.
+ * @param interrupt_rate The chance of EINTR, from 0 to 1.
+ * @param drop_rate      The chance of losing the connection for good.
+ */
+void fossil_mockup_fault_set_errors(fossil_mockup_fault_t *fault, double again_rate, double interrupt_rate, double drop_rate);
+
+/**
+ * @brief Account delays on a virtual clock instead of sleeping.
+ *
+ * Keeps impaired tests fast while fossil_mockup_fault_now still reports the
+ * time the operations would have taken.
+ *
+ * @param fault   The impairment object.
+ * @param enabled true to stop sleeping.
+ */
+void fossil_mockup_fault_set_virtual_clock(fossil_mockup_fault_t *fault, bool enabled);
+
+/**
+ * @brief Decide the fate of the next operation.
+ *
+ * Applies the delay and returns the action. For FOSSIL_MOCKUP_FAULT_PASS,
+ * *allowed holds how many of the requested bytes may be moved, at least one
+ * when requested is not zero.
+ *
+ * @param fault     The impairment object.
+ * @param requested The number of bytes the operation wants to move.
+ * @param allowed   Receives the number of bytes the operation may move.
+ * @return The action to take.
+ */
+fossil_mockup_fault_action_t fossil_mockup_fault_next(fossil_mockup_fault_t *fault, size_t requested, size_t *allowed);
+
+/**
+ * @brief Get the injected delay so far in microseconds.
+ */
+uint64_t fossil_mockup_fault_now(const fossil_mockup_fault_t *fault);
+
+/**
+ * @brief Rewind the generator, counters and clock to replay a run.
+ *
+ * @param fault The impairment object.
+ */
+void fossil_mockup_fault_reset(fossil_mockup_fault_t *fault);
+
+/**
+ * @brief Erase the impairment object.
+ *
+ * @param fault The impairment object.
+ */
+void fossil_mockup_fault_erase(fossil_mockup_fault_t *fault);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
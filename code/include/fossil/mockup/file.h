@@ -14,18 +14,29 @@ Description:
 #define FOSSIL_MOCK_FILE_H
 
 #include "internal.h"
+#include "fault.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+// Where the bytes of a file mock live
+typedef enum {
+    FOSSIL_MOCKUP_FILE_OWNED,    // heap buffer owned by the mock, NUL-terminated
+    FOSSIL_MOCKUP_FILE_BORROWED, // caller's buffer, copied on the first write
+    FOSSIL_MOCKUP_FILE_MAPPED    // read-only mapping of a fixture file, copied on the first write
+} fossil_mockup_file_storage_t;
+
 // File mock object type
 typedef struct fossil_mockup_file {
     char *filename;
     char *content;
     size_t size;
     size_t position;
+    size_t capacity; // bytes allocated for owned content
+    fossil_mockup_file_storage_t storage;
+    fossil_mockup_fault_t *fault; // optional impairment, not owned
     struct fossil_mockup_file *next; // for chaining files
 } fossil_mockup_file_t;
 
@@ -38,6 +49,30 @@ typedef struct fossil_mockup_file {
  */
 fossil_mockup_file_t* fossil_mockup_file_create(const char *filename, const char *content);
 
+/** 
+ * Create a file mock object over an existing buffer without copying it
+ * 
+ * The buffer may hold binary data and must stay valid until the mock is
+ * erased or first written to, at which point the mock takes a private copy.
+ * 
+ * @param filename The name of the file
+ * @param data The bytes of the file
+ * @param size The number of bytes
+ * @return A pointer to the created file mock object
+ */
+fossil_mockup_file_t* fossil_mockup_file_create_from_buffer(const char *filename, const void *data, size_t size);
+
+/** 
+ * Create a file mock object backed by a fixture file on disk
+ * 
+ * The fixture is memory mapped read-only where the platform allows it, so
+ * large fixtures are paged in on demand instead of being copied up front.
+ * 
+ * @param path The path of the fixture file, also used as the mock filename
+ * @return A pointer to the created file mock object, or NULL if the fixture cannot be opened
+ */
+fossil_mockup_file_t* fossil_mockup_file_create_from_fixture(const char *path);
+
 /** 
  * Read from the mocked file
  * 
@@ -49,9 +84,25 @@ fossil_mockup_file_t* fossil_mockup_file_create(const char *filename, const char
  */
 size_t fossil_mockup_file_read(void *ptr, size_t size, size_t nmemb, fossil_mockup_file_t *file);
 
+/** 
+ * Read from the mocked file without copying
+ * 
+ * Returns a pointer to the bytes at the current position and advances the
+ * position past them, so large files can be streamed in place.
+ * 
+ * @param file Pointer to the file mock object
+ * @param max_size Maximum number of bytes to consume
+ * @param length Receives the number of bytes available at the returned pointer
+ * @return Pointer into the file content, valid until the next write
+ */
+const char* fossil_mockup_file_read_view(fossil_mockup_file_t *file, size_t max_size, size_t *length);
+
 /** 
  * Write to the mocked file
  * 
+ * Storage grows geometrically, so appending in small chunks stays linear.
+ * Writing past the end fills the gap with zero bytes.
+ * 
  * @param ptr Pointer to the buffer containing the data to be written
  * @param size Size of each element to be written
  * @param nmemb Number of elements to be written
@@ -60,6 +111,18 @@ size_t fossil_mockup_file_read(void *ptr, size_t size, size_t nmemb, fossil_mock
  */
 size_t fossil_mockup_file_write(const void *ptr, size_t size, size_t nmemb, fossil_mockup_file_t *file);
 
+/** 
+ * Impair reads and writes on the mocked file
+ * 
+ * Reads and writes are delayed and may move fewer elements than asked for.
+ * Failed calls return 0 with errno set to EAGAIN, EINTR or EIO. The file
+ * does not own the fault object.
+ * 
+ * @param file Pointer to the file mock object
+ * @param fault The impairment layer, or NULL to remove it
+ */
+void fossil_mockup_file_set_fault(fossil_mockup_file_t *file, fossil_mockup_fault_t *fault);
+
 /** 
  * Seek to a position in the mocked file
  * 
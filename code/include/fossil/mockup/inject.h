@@ -20,10 +20,32 @@ extern "C"
 {
 #endif
 
+// Example usage, swapping a real function for one test:
+// static int fake_connect(int fd, const struct sockaddr *addr, socklen_t len) {
+//     errno = ECONNREFUSED;
+//     return -1;
+// }
+//
+// FOSSIL_TEST(client_reports_refused_connection) {
+//     fossil_mockup_inject_t *inject = fossil_mockup_inject_create_function("connect", (fossil_mockup_function_t)fake_connect);
+//     fossil_mockup_inject_patch(inject);
+//     ... code under test calls connect() as usual ...
+//     fossil_mockup_inject_erase(inject); // restores the real connect
+// }
+
+// Generic function pointer, cast to and from the real signature
+typedef void (*fossil_mockup_function_t)(void);
+
 // Injected dependency type
 typedef struct fossil_mockup_inject {
     char *dependency_name;
     void *replacement_object;
+    fossil_mockup_function_t replacement_function;
+    fossil_mockup_function_t original; // the real function, resolved by fossil_mockup_inject_patch
+    uintptr_t *slots;   // GOT entries redirected to the replacement
+    uintptr_t *saved;   // their values before patching
+    size_t slot_count;
+    bool patched;
     struct fossil_mockup_inject *next; // for chaining injected dependencies
 } fossil_mockup_inject_t;
 
@@ -36,6 +58,18 @@ typedef struct fossil_mockup_inject {
  */
 fossil_mockup_inject_t* fossil_mockup_inject_create(const char *dependency_name, void *replacement_object);
 
+/**
+ * Create a new injected dependency replacing a function
+ * 
+ * Function pointers cannot portably pass through void *, use this to create
+ * dependencies for fossil_mockup_inject_patch.
+ * 
+ * @param dependency_name The name of the function to replace
+ * @param replacement The replacement, cast to fossil_mockup_function_t
+ * @return The created injected dependency object
+ */
+fossil_mockup_inject_t* fossil_mockup_inject_create_function(const char *dependency_name, fossil_mockup_function_t replacement);
+
 /**
  * Get the replacement object for the injected dependency
  * 
@@ -44,13 +78,76 @@ fossil_mockup_inject_t* fossil_mockup_inject_create(const char *dependency_name,
  */
 void* fossil_mockup_inject_get_replacement(fossil_mockup_inject_t *inject);
 
+/**
+ * Redirect every call to the dependency to the replacement function
+ * 
+ * Rewrites the GOT/PLT entries that name the dependency in the program and
+ * every loaded shared object, so call sites need no injection code and calls
+ * cost nothing extra once restored. Calls a library makes to its own
+ * functions without going through its PLT cannot be redirected; link with
+ * FOSSIL_MOCK_WRAP for those. Only ELF platforms are supported.
+ * 
+ * @param inject The injected dependency object, made with fossil_mockup_inject_create_function
+ * @return true if at least one call site was redirected, false otherwise
+ */
+bool fossil_mockup_inject_patch(fossil_mockup_inject_t *inject);
+
+/**
+ * Undo fossil_mockup_inject_patch, calls reach the real function again
+ * 
+ * @param inject The injected dependency object
+ */
+void fossil_mockup_inject_restore(fossil_mockup_inject_t *inject);
+
+/**
+ * Get the real function behind a patched dependency
+ * 
+ * Lets a replacement forward to the original, for example to fail only
+ * some calls.
+ * 
+ * @param inject The injected dependency object
+ * @return The real function, or NULL if it could not be resolved
+ */
+fossil_mockup_function_t fossil_mockup_inject_get_original(fossil_mockup_inject_t *inject);
+
 /**
  * Erase the injected dependency object
  * 
+ * A patched dependency is restored first.
+ * 
  * @param inject The injected dependency object to erase
  */
 void fossil_mockup_inject_erase(fossil_mockup_inject_t *inject);
 
+// Link-time interposition. Linking with -Wl,--wrap=<name> sends every call
+// to <name> in the program to __wrap_<name>; FOSSIL_MOCK_WRAP defines that
+// trampoline once, in a test source file, and FOSSIL_MOCK_WRAP_SET swaps the
+// function it forwards to. With no replacement set, calls go to the real
+// function through __real_<name>.
+//
+// FOSSIL_MOCK_WRAP(int, connect, (int fd, const struct sockaddr *addr, socklen_t len), (fd, addr, len))
+// FOSSIL_MOCK_WRAP_SET(connect, fake_connect);
+// FOSSIL_MOCK_WRAP_RESET(connect);
+#define FOSSIL_MOCK_WRAP(return_type, name, params, args) \
+    return_type __real_##name params; \
+    return_type __wrap_##name params; \
+    return_type (*fossil_mock_wrap_##name) params = NULL; \
+    return_type __wrap_##name params { \
+        return (fossil_mock_wrap_##name != NULL ? fossil_mock_wrap_##name : __real_##name) args; \
+    }
+
+// Same as FOSSIL_MOCK_WRAP for functions returning void.
+#define FOSSIL_MOCK_WRAP_VOID(name, params, args) \
+    void __real_##name params; \
+    void __wrap_##name params; \
+    void (*fossil_mock_wrap_##name) params = NULL; \
+    void __wrap_##name params { \
+        (fossil_mock_wrap_##name != NULL ? fossil_mock_wrap_##name : __real_##name) args; \
+    }
+
+#define FOSSIL_MOCK_WRAP_SET(name, replacement) (fossil_mock_wrap_##name = (replacement))
+#define FOSSIL_MOCK_WRAP_RESET(name) (fossil_mock_wrap_##name = NULL)
+
 #ifdef __cplusplus
 }
 #endif
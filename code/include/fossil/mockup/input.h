@@ -14,18 +14,62 @@ Description:
 #define FOSSIL_MOCK_INPUT_H
 
 #include "internal.h"
+#include "file.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+// Example usage:
+// static bool squares(void *context, uint64_t index, void **value) {
+//     static int64_t square;
+//     square = (int64_t)(index * index);
+//     *value = &square;
+//     return index < 1000000;
+// }
+//
+// FOSSIL_TEST(parser_accepts_every_line) {
+//     fossil_mockup_input_t *input = fossil_mockup_input_create("read_line");
+//     fossil_mockup_input_set_lines(input, "fixtures/words.txt");
+//     int64_t count = fossil_mockup_input_count(input);
+//     for (int64_t i = 0; i < count; i++) {
+//         ASSUME_ITS_TRUE(parse((const char *)fossil_mockup_input_get(input)));
+//     }
+//     fossil_mockup_input_erase(input);
+// }
+
+// Produces the value for the index-th call, false once the source is exhausted
+typedef bool (*fossil_mockup_input_generator_t)(void *context, uint64_t index, void **value);
+
+// Where the values returned by fossil_mockup_input_get come from
+typedef enum {
+    FOSSIL_MOCKUP_INPUT_LIST,      // pointers given to fossil_mockup_input_set_inputs
+    FOSSIL_MOCKUP_INPUT_GENERATOR, // a callback asked for every value
+    FOSSIL_MOCKUP_INPUT_RANGE,     // int64_t values start, start + step, ...
+    FOSSIL_MOCKUP_INPUT_LINES,     // NUL-terminated lines of a fixture file
+    FOSSIL_MOCKUP_INPUT_RECORDS    // fixed-size records of a fixture file
+} fossil_mockup_input_source_t;
+
 // Input mock object type
 typedef struct fossil_mockup_input {
     char *function_name;
     void **mocked_inputs;
     int32_t input_count;
     int32_t call_count;
+    fossil_mockup_input_source_t source;
+    fossil_mockup_input_generator_t generator;
+    void *context;               // passed to the generator
+    bool exhausted;              // the generator returned false
+    int64_t range_start;
+    int64_t range_step;
+    int64_t value;               // current range value, returned by pointer
+    fossil_mockup_file_t *file;  // mapped fixture for lines and records
+    size_t cursor;               // offset of the next line or record
+    size_t record_size;
+    char *line;                  // current line, reused by every get
+    size_t line_capacity;
+    size_t length;               // length of the last value in bytes
     struct fossil_mockup_input *next; // for chaining inputs
 } fossil_mockup_input_t;
 
@@ -50,6 +94,77 @@ fossil_mockup_input_t* fossil_mockup_input_create(const char *function_name);
  */
 void fossil_mockup_input_set_inputs(fossil_mockup_input_t *input, int32_t count, ...);
 
+/**
+ * @brief Produce the inputs lazily from a generator callback.
+ *
+ * The generator is called once per get with the zero-based call index and
+ * nothing is materialized up front. Once it returns false every further get
+ * returns NULL until the input is reset.
+ *
+ * @param input     The input mock object.
+ * @param generator The callback producing each value.
+ * @param context   Passed to the generator untouched.
+ */
+void fossil_mockup_input_set_generator(fossil_mockup_input_t *input, fossil_mockup_input_generator_t generator, void *context);
+
+/**
+ * @brief Produce the integers start, start + step, ... short of stop.
+ *
+ * Each get returns a pointer to an int64_t owned by the input mock, valid
+ * until the next get. Like a list, the range starts over once it is used up.
+ *
+ * @param input The input mock object.
+ * @param start The first value.
+ * @param stop  The bound, excluded.
+ * @param step  The distance between values, negative to count down, not zero.
+ */
+void fossil_mockup_input_set_range(fossil_mockup_input_t *input, int64_t start, int64_t stop, int64_t step);
+
+/**
+ * @brief Produce the lines of a fixture file.
+ *
+ * The fixture is mapped rather than read, and each get returns the next line
+ * without its line ending as a NUL-terminated string in a buffer reused by
+ * the next get, so memory stays at the longest line. Starts over at the end.
+ *
+ * @param input The input mock object.
+ * @param path  The path of the fixture file.
+ * @return true on success, false if the fixture cannot be opened.
+ */
+bool fossil_mockup_input_set_lines(fossil_mockup_input_t *input, const char *path);
+
+/**
+ * @brief Produce the fixed-size records of a fixture file.
+ *
+ * Each get returns a pointer straight into the mapped fixture. A trailing
+ * partial record is ignored. Starts over at the end.
+ *
+ * @param input       The input mock object.
+ * @param path        The path of the fixture file.
+ * @param record_size The size of every record in bytes, not zero.
+ * @return true on success, false if the fixture cannot be opened.
+ */
+bool fossil_mockup_input_set_records(fossil_mockup_input_t *input, const char *path, size_t record_size);
+
+/**
+ * @brief Get the number of values the source holds before starting over.
+ *
+ * @param input The input mock object.
+ * @return The count, or -1 for generators whose length is unknown.
+ */
+int64_t fossil_mockup_input_count(const fossil_mockup_input_t *input);
+
+/**
+ * @brief Get the length in bytes of the value returned by the last get.
+ *
+ * Meaningful for lines and records, sizeof(int64_t) for ranges and 0 for
+ * lists and generators.
+ *
+ * @param input The input mock object.
+ * @return The length of the last value.
+ */
+size_t fossil_mockup_input_length(const fossil_mockup_input_t *input);
+
 /**
  * @brief Simulate getting the mocked input for the function call.
  *
@@ -74,7 +189,7 @@ bool fossil_mockup_input_verify_call_count(fossil_mockup_input_t *input, int32_t
 /**
  * @brief Reset the input mock object for reuse.
  *
- * This function resets the input mock object, clearing all the mocked inputs and call counts.
+ * This function resets the call count and rewinds generators, ranges and fixture files.
  *
  * @param input The input mock object to reset.
  */
@@ -38,6 +38,7 @@ typedef struct mockup {
     void **return_values;
     int32_t return_count;
     int32_t call_count;
+    int32_t sequence_id; // id in the interaction log
     bool called;
     struct mockup *next; // for chaining mocks
 } fossil_mockup_t;
@@ -14,6 +14,7 @@ Description:
 #define FOSSIL_MOCK_NETWORK_H
 
 #include "internal.h"
+#include "fault.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -46,15 +47,27 @@ typedef struct fossil_mockup_network {
     char *host;
     char *request;
     char *response;
+    fossil_mockup_fault_t *fault;       // optional impairment, not owned
+    size_t received;                    // bytes of the response handed out by receive
     struct fossil_mockup_network *next; // for chaining network mocks
 } fossil_mockup_network_t;
 
 // Create a new network mock object
 fossil_mockup_network_t* fossil_mockup_network_create(const char *host, const char *request, const char *response);
 
-// Perform a network request using the mocked network
+// Perform a network request using the mocked network. With a fault attached
+// the request is delayed and may fail, returning NULL with errno set to
+// EAGAIN, EINTR or ECONNRESET.
 const char* fossil_mockup_network_request(fossil_mockup_network_t *network, const char *request);
 
+// Read the response of the last successful request like recv(), in as many
+// partial packets as the attached fault decides. Returns the number of bytes
+// copied, 0 once the response is exhausted, or -1 with errno set.
+int64_t fossil_mockup_network_receive(fossil_mockup_network_t *network, void *buffer, size_t capacity);
+
+// Impair the network mock, the fault object is not owned and may be shared
+void fossil_mockup_network_set_fault(fossil_mockup_network_t *network, fossil_mockup_fault_t *fault);
+
 // Erase the network mock object
 void fossil_mockup_network_erase(fossil_mockup_network_t *network);
 
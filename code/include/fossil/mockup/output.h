@@ -25,6 +25,7 @@ typedef struct fossil_mockup_output {
     char *function_name;
     char **captured_outputs;
     int32_t output_count;
+    int32_t output_capacity; // allocated slots in captured_outputs
     int32_t call_count;
     struct fossil_mockup_output *next; // for chaining outputs
 } fossil_mockup_output_t;
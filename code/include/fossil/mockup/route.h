@@ -0,0 +1,211 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_ROUTE_H
+#define FOSSIL_MOCK_ROUTE_H
+
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// fossil_mockup_route_table_t *routes = fossil_mockup_route_table_create();
+// fossil_mockup_response_t *ok = fossil_mockup_response_create("HTTP/1.1 200 OK\r\n\r\n");
+// fossil_mockup_response_t *user = fossil_mockup_response_template("{\"id\": \"{id}\"}\n");
+//
+// fossil_mockup_route_add(routes, FOSSIL_MOCKUP_ROUTE_EXACT, "api", "GET", "/health", ok);
+// fossil_mockup_route_add(routes, FOSSIL_MOCKUP_ROUTE_PREFIX, "api", "GET", "/static/", ok);
+// fossil_mockup_route_add(routes, FOSSIL_MOCKUP_ROUTE_PATTERN, "*", "GET", "/users/:id", user);
+// fossil_mockup_response_release(ok);
+// fossil_mockup_response_release(user);
+//
+// fossil_mockup_route_match_t match;
+// if (fossil_mockup_route_lookup(routes, "api", "GET", "/users/42", 9, &match)) {
+//     char body[64];
+//     fossil_mockup_response_render(match.response, &match, body, sizeof(body));
+// }
+
+enum {
+    FOSSIL_MOCKUP_ROUTE_MAX_CAPTURES = 8
+};
+
+// How a route path is compared with a request path
+typedef enum {
+    FOSSIL_MOCKUP_ROUTE_EXACT,   // whole path, hash lookup
+    FOSSIL_MOCKUP_ROUTE_PREFIX,  // longest matching prefix, trie lookup
+    FOSSIL_MOCKUP_ROUTE_PATTERN  // '/'-separated segments with ':name', '*' and a trailing '**'
+} fossil_mockup_route_kind_t;
+
+// Shared, reference counted response body, details are private to the implementation
+typedef struct fossil_mockup_response fossil_mockup_response_t;
+
+// Route table object type, details are private to the implementation
+typedef struct fossil_mockup_route_table fossil_mockup_route_table_t;
+
+// Named path segment captured by a pattern route, pointing into the request
+typedef struct fossil_mockup_route_capture {
+    const char *name;
+    size_t name_length;
+    const char *value;
+    size_t value_length;
+} fossil_mockup_route_capture_t;
+
+// Result of a successful lookup
+typedef struct fossil_mockup_route_match {
+    const fossil_mockup_response_t *response;
+    fossil_mockup_route_kind_t kind;
+    int32_t capture_count;
+    fossil_mockup_route_capture_t captures[FOSSIL_MOCKUP_ROUTE_MAX_CAPTURES];
+} fossil_mockup_route_match_t;
+
+/**
+ * @brief Create a response holding a copy of body.
+ *
+ * The response starts with one reference owned by the caller.
+ *
+ * @param body The response bytes.
+ * @return A pointer to the newly created response.
+ */
+fossil_mockup_response_t* fossil_mockup_response_create(const char *body);
+
+/**
+ * @brief Create a response that refers to body without copying it.
+ *
+ * The body must outlive every route that uses the response.
+ *
+ * @param body   The response bytes.
+ * @param length The number of bytes.
+ * @return A pointer to the newly created response.
+ */
+fossil_mockup_response_t* fossil_mockup_response_borrow(const char *body, size_t length);
+
+/**
+ * @brief Create a response with "{name}" placeholders.
+ *
+ * The template is split into literal and placeholder parts once, rendering
+ * only copies the parts and the captured values.
+ *
+ * @param body The template text.
+ * @return A pointer to the newly created response.
+ */
+fossil_mockup_response_t* fossil_mockup_response_template(const char *body);
+
+/**
+ * @brief Check whether a response needs rendering.
+ */
+bool fossil_mockup_response_is_template(const fossil_mockup_response_t *response);
+
+/**
+ * @brief Get the bytes of a response without rendering placeholders.
+ *
+ * @param response The response.
+ * @param length   Receives the number of bytes, may be NULL.
+ * @return The response bytes.
+ */
+const char* fossil_mockup_response_body(const fossil_mockup_response_t *response, size_t *length);
+
+/**
+ * @brief Render a response for a match.
+ *
+ * Placeholders without a matching capture render as empty text. Like
+ * snprintf, at most capacity bytes are written and the full length is
+ * returned, so a too small buffer can be detected and grown.
+ *
+ * @param response The response.
+ * @param match    The match providing the captures, may be NULL.
+ * @param buffer   The output buffer.
+ * @param capacity The size of the output buffer.
+ * @return The length of the rendered response.
+ */
+size_t fossil_mockup_response_render(const fossil_mockup_response_t *response, const fossil_mockup_route_match_t *match, char *buffer, size_t capacity);
+
+/**
+ * @brief Drop a reference to a response, freeing it with the last one.
+ */
+void fossil_mockup_response_release(fossil_mockup_response_t *response);
+
+/**
+ * @brief Create an empty route table.
+ *
+ * @return A pointer to the newly created route table.
+ */
+fossil_mockup_route_table_t* fossil_mockup_route_table_create(void);
+
+/**
+ * @brief Add a route.
+ *
+ * The table keeps its own reference to the response, so one response can be
+ * shared by any number of routes. A host of "*" matches every host and an
+ * empty method matches requests that have no method.
+ *
+ * @param table    The route table.
+ * @param kind     How the path is matched.
+ * @param host     The host the route answers for.
+ * @param method   The request method, for example "GET".
+ * @param path     The path, prefix or pattern.
+ * @param response The response to answer with.
+ * @return true if the route was added, false if the pattern is invalid.
+ */
+bool fossil_mockup_route_add(fossil_mockup_route_table_t *table, fossil_mockup_route_kind_t kind, const char *host, const char *method, const char *path, fossil_mockup_response_t *response);
+
+/**
+ * @brief Find the route for a request.
+ *
+ * Exact routes are tried first, then patterns in the order they were added,
+ * then the longest prefix. Routes for the host win over routes for "*".
+ * Patterns are indexed by their first path segment, so only the ones sharing
+ * the request's first segment, and those starting with ':name', '*' or '**',
+ * are matched against it.
+ *
+ * @param table       The route table.
+ * @param host        The host of the request.
+ * @param method      The request method.
+ * @param path        The request path, need not be NUL-terminated.
+ * @param path_length The length of the path.
+ * @param match       Receives the response and captures.
+ * @return true if a route matched, false otherwise.
+ */
+bool fossil_mockup_route_lookup(const fossil_mockup_route_table_t *table, const char *host, const char *method, const char *path, size_t path_length, fossil_mockup_route_match_t *match);
+
+/**
+ * @brief Find the route for a raw request.
+ *
+ * The whole request is first looked up as an exact route with an empty
+ * method, then its first line is split as "METHOD PATH ..." and looked up.
+ *
+ * @param table   The route table.
+ * @param host    The host of the request.
+ * @param request The request bytes, need not be NUL-terminated.
+ * @param length  The length of the request.
+ * @param match   Receives the response and captures.
+ * @return true if a route matched, false otherwise.
+ */
+bool fossil_mockup_route_lookup_request(const fossil_mockup_route_table_t *table, const char *host, const char *request, size_t length, fossil_mockup_route_match_t *match);
+
+/**
+ * @brief Get the number of routes in the table.
+ */
+size_t fossil_mockup_route_count(const fossil_mockup_route_table_t *table);
+
+/**
+ * @brief Erase the route table, releasing every response it references.
+ */
+void fossil_mockup_route_table_erase(fossil_mockup_route_table_t *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,188 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_SEQUENCE_H
+#define FOSSIL_MOCK_SEQUENCE_H
+
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// FOSSIL_SETUP(io_fixture) {
+//     fossil_mockup_sequence_start(0);
+// }
+//
+// FOSSIL_TEARDOWN(io_fixture) {
+//     fossil_mockup_sequence_stop();
+//     ASSUME_ITS_TRUE(fossil_mockup_sequence_verify());
+//     fossil_mockup_sequence_erase();
+// }
+//
+// FOSSIL_TEST(io_writes_in_order) {
+//     fossil_mockup_sequence_expect_order(3, "open", "write", "close");
+//     fossil_mockup_sequence_expect_count("write", 4);
+//     ... exercise the open/write/close mocks ...
+// }
+
+enum {
+    FOSSIL_MOCKUP_SEQUENCE_DEFAULT_CAPACITY = 65536
+};
+
+// One entry in the interaction log
+typedef struct fossil_mockup_sequence_event {
+    uint64_t sequence;      // global position of the interaction
+    uint64_t timestamp;     // monotonic time in nanoseconds
+    int32_t mock_id;        // id handed out by fossil_mockup_sequence_register
+    uint32_t thread_id;     // small per-thread id, starting at 1
+    volatile uint32_t ready; // set once the slot has been fully written
+} fossil_mockup_sequence_event_t;
+
+// Kinds of expectations checked by fossil_mockup_sequence_verify
+typedef enum {
+    FOSSIL_MOCKUP_SEQUENCE_ORDER,
+    FOSSIL_MOCKUP_SEQUENCE_BEFORE,
+    FOSSIL_MOCKUP_SEQUENCE_COUNT
+} fossil_mockup_sequence_kind_t;
+
+// Expectation object type
+typedef struct fossil_mockup_sequence_expect {
+    fossil_mockup_sequence_kind_t kind;
+    int32_t *mock_ids;
+    int32_t id_count;
+    int32_t expected_count;
+    struct fossil_mockup_sequence_expect *next; // for chaining expectations
+} fossil_mockup_sequence_expect_t;
+
+/**
+ * @brief Register a mock name with the interaction log.
+ *
+ * Every mock, spy, stub, fake and behavior object registers its function name
+ * when it is created, so recording only has to store a small integer. Equal
+ * names always map to the same id for the lifetime of the process.
+ *
+ * @param name The function name of the mock.
+ * @return The id used for the name in recorded events.
+ */
+int32_t fossil_mockup_sequence_register(const char *name);
+
+/**
+ * @brief Look up the name registered for an id.
+ *
+ * @param mock_id The id returned by fossil_mockup_sequence_register.
+ * @return The registered name, or NULL for an unknown id.
+ */
+const char* fossil_mockup_sequence_name(int32_t mock_id);
+
+/**
+ * @brief Start recording interactions.
+ *
+ * Allocates a log with room for capacity events and clears any events and
+ * expectations from a previous run. Interactions beyond the capacity are
+ * counted as dropped and make verification fail.
+ *
+ * @param capacity The number of events to reserve, 0 for the default.
+ */
+void fossil_mockup_sequence_start(size_t capacity);
+
+/**
+ * @brief Stop recording interactions; recorded events are kept.
+ */
+void fossil_mockup_sequence_stop(void);
+
+/**
+ * @brief Append an interaction to the log.
+ *
+ * Safe to call from any number of threads at once. When recording is not
+ * active this is a single load and a branch.
+ *
+ * @param mock_id The id of the mock that was called.
+ */
+void fossil_mockup_sequence_record(int32_t mock_id);
+
+/**
+ * @brief Get the number of recorded events.
+ *
+ * @return The number of events in the log, not counting dropped events.
+ */
+size_t fossil_mockup_sequence_count(void);
+
+/**
+ * @brief Get the number of events that did not fit in the log.
+ *
+ * @return The number of dropped events.
+ */
+size_t fossil_mockup_sequence_dropped(void);
+
+/**
+ * @brief Get a recorded event by its position in the log.
+ *
+ * @param index The position of the event.
+ * @return A pointer to the event, or NULL when index is out of range.
+ */
+const fossil_mockup_sequence_event_t* fossil_mockup_sequence_event(size_t index);
+
+/**
+ * @brief Expect the named mocks to be called in the given order.
+ *
+ * The names must appear in the log in this order, other interactions may be
+ * interleaved between them.
+ *
+ * @param count The number of names.
+ * @param ...   The mock function names as const char*.
+ */
+void fossil_mockup_sequence_expect_order(int32_t count, ...);
+
+/**
+ * @brief Expect every call to one mock to happen before any call to another.
+ *
+ * @param first The mock that must be called first.
+ * @param then  The mock that must only be called afterwards.
+ */
+void fossil_mockup_sequence_expect_before(const char *first, const char *then);
+
+/**
+ * @brief Expect a mock to be called an exact number of times.
+ *
+ * @param name           The mock function name.
+ * @param expected_count The expected number of calls.
+ */
+void fossil_mockup_sequence_expect_count(const char *name, int32_t expected_count);
+
+/**
+ * @brief Verify all expectations against the recorded log.
+ *
+ * Intended to be called from a fixture teardown once the test has finished.
+ * Every failed expectation is reported on stderr.
+ *
+ * @return true if every expectation holds and no events were dropped.
+ */
+bool fossil_mockup_sequence_verify(void);
+
+/**
+ * @brief Clear recorded events and expectations, keeping the log allocated.
+ */
+void fossil_mockup_sequence_reset(void);
+
+/**
+ * @brief Stop recording and release the log and all expectations.
+ */
+void fossil_mockup_sequence_erase(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_SERVER_H
+#define FOSSIL_MOCK_SERVER_H
+
+#include "network.h"
+#include "route.h"
+#include "fault.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// FOSSIL_TEST(client_fetches_data) {
+//     fossil_mockup_server_t *server = fossil_mockup_server_create("api.example.com", FOSSIL_MOCKUP_SERVER_TCP, NULL);
+//     fossil_mockup_server_add(server, fossil_mockup_network_create("api.example.com", "GET /data", "Hello, world!\n"));
+//     fossil_mockup_server_start(server);
+//
+//     client_connect("127.0.0.1", fossil_mockup_server_port(server));
+//     ... exercise the client, each request ends with "\n" ...
+//
+//     fossil_mockup_server_erase(server);
+// }
+
+// Socket type the mock server listens on
+typedef enum {
+    FOSSIL_MOCKUP_SERVER_TCP,
+    FOSSIL_MOCKUP_SERVER_UDP,
+    FOSSIL_MOCKUP_SERVER_UNIX
+} fossil_mockup_server_transport_t;
+
+// Mock server object type, details are private to the implementation
+typedef struct fossil_mockup_server fossil_mockup_server_t;
+
+/**
+ * @brief Create a mock server that is not listening yet.
+ *
+ * TCP and UDP servers bind to the loopback interface, unix servers to a socket
+ * path. The host selects which network mocks the server answers for.
+ *
+ * @param host      The host name the server stands in for.
+ * @param transport The socket type to listen on.
+ * @param address   "127.0.0.1:<port>" for TCP and UDP, NULL picks a free
+ *                  loopback port; the socket path for unix servers.
+ * @return A pointer to the newly created server.
+ */
+fossil_mockup_server_t* fossil_mockup_server_create(const char *host, fossil_mockup_server_transport_t transport, const char *address);
+
+/**
+ * @brief Add a scripted response.
+ *
+ * The server takes ownership of the network mock and answers its request
+ * with its response when the mock's host matches the server's host or is
+ * "*". Add responses before starting the server.
+ *
+ * @param server  The mock server.
+ * @param network The network mock holding the request and response.
+ */
+void fossil_mockup_server_add(fossil_mockup_server_t *server, fossil_mockup_network_t *network);
+
+/**
+ * @brief Get the route table the server answers from.
+ *
+ * Network mocks added with fossil_mockup_server_add become exact routes with
+ * an empty method. Method and path routes, prefixes and patterns can be added
+ * to the table directly; requests are matched against the server's host.
+ * Add routes before starting the server.
+ *
+ * @param server The mock server.
+ * @return The server's route table, owned by the server.
+ */
+fossil_mockup_route_table_t* fossil_mockup_server_routes(fossil_mockup_server_t *server);
+
+/**
+ * @brief Impair every reply the server sends.
+ *
+ * Replies are delayed, split into partial writes, deferred as if the socket
+ * were full, or the connection is reset, as decided by the fault object. UDP
+ * replies that fail are dropped and short ones are truncated. The server
+ * does not own the fault object, which must outlive it or be detached with
+ * NULL. Attach it before starting the server.
+ *
+ * @param server The mock server.
+ * @param fault  The impairment layer, or NULL to serve perfectly again.
+ */
+void fossil_mockup_server_set_fault(fossil_mockup_server_t *server, fossil_mockup_fault_t *fault);
+
+/**
+ * @brief Set the response sent for requests without a scripted response.
+ *
+ * Without a default, unmatched requests are counted and get no reply.
+ *
+ * @param server   The mock server.
+ * @param response The fallback response, or NULL to clear it.
+ */
+void fossil_mockup_server_set_default(fossil_mockup_server_t *server, const char *response);
+
+/**
+ * @brief Set the byte sequence that ends each request on a stream.
+ *
+ * Defaults to "\n". Several requests may arrive in one read and are answered
+ * in order, which makes pipelining clients work as expected. A UDP datagram
+ * is always one request, a trailing delimiter is stripped.
+ *
+ * @param server    The mock server.
+ * @param delimiter The request terminator, for example "\r\n\r\n".
+ */
+void fossil_mockup_server_set_delimiter(fossil_mockup_server_t *server, const char *delimiter);
+
+/**
+ * @brief Bind the socket and start serving on a background thread.
+ *
+ * Connections are multiplexed with epoll on Linux and poll elsewhere, so
+ * thousands of concurrent clients are served by a single thread.
+ *
+ * @param server The mock server.
+ * @return true if the server is listening, false otherwise.
+ */
+bool fossil_mockup_server_start(fossil_mockup_server_t *server);
+
+/**
+ * @brief Stop serving and close every connection.
+ *
+ * @param server The mock server.
+ */
+void fossil_mockup_server_stop(fossil_mockup_server_t *server);
+
+/**
+ * @brief Get the port a TCP or UDP server is bound to.
+ */
+uint16_t fossil_mockup_server_port(const fossil_mockup_server_t *server);
+
+/**
+ * @brief Get the socket path of a unix server.
+ */
+const char* fossil_mockup_server_path(const fossil_mockup_server_t *server);
+
+/**
+ * @brief Get the number of requests answered with a scripted response.
+ */
+uint64_t fossil_mockup_server_request_count(const fossil_mockup_server_t *server);
+
+/**
+ * @brief Get the number of requests without a scripted response.
+ */
+uint64_t fossil_mockup_server_unmatched_count(const fossil_mockup_server_t *server);
+
+/**
+ * @brief Get the number of accepted connections.
+ */
+uint64_t fossil_mockup_server_connection_count(const fossil_mockup_server_t *server);
+
+/**
+ * @brief Erase the server, stopping it first and erasing its network mocks.
+ *
+ * @param server The mock server.
+ */
+void fossil_mockup_server_erase(fossil_mockup_server_t *server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,6 +26,7 @@ typedef struct fossil_mockup_spy {
     void **recorded_args;
     int32_t num_args;
     int32_t call_count;
+    int32_t sequence_id; // id in the interaction log
     struct fossil_mockup_spy *next; // for chaining spies
 } fossil_mockup_spy_t;
 
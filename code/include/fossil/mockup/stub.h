@@ -26,6 +26,7 @@ typedef struct fossil_mockup_stub {
     void **return_values;
     int32_t return_count;
     int32_t call_count;
+    int32_t sequence_id; // id in the interaction log
     struct fossil_mockup_stub *next; // for chaining stubs
 } fossil_mockup_stub_t;
 
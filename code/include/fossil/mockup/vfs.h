@@ -0,0 +1,238 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_MOCK_VFS_H
+#define FOSSIL_MOCK_VFS_H
+
+#include "file.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Example usage:
+// FOSSIL_SETUP(config_fixture) {
+//     fossil_mockup_vfs_mount("/etc/app");
+//     fossil_mockup_vfs_add_file("/etc/app/app.conf", "threads=4\n");
+// }
+//
+// FOSSIL_TEARDOWN(config_fixture) {
+//     fossil_mockup_vfs_erase();
+// }
+//
+// Code under test can use the fossil_mockup_vfs_* calls directly, or plain
+// open/fopen/read/write/lseek/stat/mmap when the test binary links against
+// fossil_mock_wrap_dep, which routes those calls through the VFS with the
+// linker's --wrap option for any path below a mount point.
+
+enum {
+    FOSSIL_MOCKUP_VFS_FD_BASE = 1 << 20 // descriptors handed out by the VFS start here
+};
+
+// Node in the virtual file tree, indexed by its normalized path
+typedef struct fossil_mockup_vfs_node {
+    char *path;
+    bool is_directory;
+    bool is_mount;                             // root of a mounted tree
+    uint32_t mode;                             // permission bits
+    fossil_mockup_file_t *file;                // contents, NULL for directories
+    struct fossil_mockup_vfs_node *parent;
+    struct fossil_mockup_vfs_node *children;   // first entry of a directory
+    struct fossil_mockup_vfs_node *sibling;    // next entry in the same directory
+    struct fossil_mockup_vfs_node *next;       // for chaining nodes in a hash bucket
+} fossil_mockup_vfs_node_t;
+
+// Subset of struct stat reported by the VFS
+typedef struct fossil_mockup_vfs_stat {
+    uint64_t size;
+    uint64_t inode;
+    uint32_t mode;
+    bool is_directory;
+} fossil_mockup_vfs_stat_t;
+
+/**
+ * @brief Mount an empty directory tree at a path.
+ *
+ * Every path below a mount point belongs to the VFS, including paths that do
+ * not exist yet, so creating files there never touches the disk.
+ *
+ * @param root The directory to mount, for example "/tmp/app" or "data".
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_mount(const char *root);
+
+/**
+ * @brief Check whether a path lies below a mount point.
+ *
+ * @param path The path to check.
+ * @return true if the VFS handles the path, false otherwise.
+ */
+bool fossil_mockup_vfs_owns(const char *path);
+
+/**
+ * @brief Check whether a descriptor was handed out by the VFS.
+ *
+ * @param fd The descriptor to check.
+ * @return true if the descriptor is open in the VFS, false otherwise.
+ */
+bool fossil_mockup_vfs_is_fd(int fd);
+
+/**
+ * @brief Add a file with text content, creating missing parent directories.
+ *
+ * An existing file has its content replaced.
+ *
+ * @param path    The path of the file, below a mount point.
+ * @param content The initial content.
+ * @return The file mock holding the content, or NULL if the path is not mounted.
+ */
+fossil_mockup_file_t* fossil_mockup_vfs_add_file(const char *path, const char *content);
+
+/**
+ * @brief Look up the node for a path.
+ *
+ * @param path The path to look up.
+ * @return The node, or NULL if it does not exist.
+ */
+fossil_mockup_vfs_node_t* fossil_mockup_vfs_lookup(const char *path);
+
+/**
+ * @brief Create a directory.
+ *
+ * @param path The directory to create; its parent must exist.
+ * @param mode The permission bits.
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_mkdir(const char *path, uint32_t mode);
+
+/**
+ * @brief Open a file with POSIX open flags.
+ *
+ * Supports O_RDONLY, O_WRONLY, O_RDWR, O_CREAT, O_EXCL, O_TRUNC and O_APPEND.
+ *
+ * @param path  The path of the file.
+ * @param flags The open flags.
+ * @param mode  The permission bits used with O_CREAT.
+ * @return A descriptor of at least FOSSIL_MOCKUP_VFS_FD_BASE, or -1 with errno set.
+ */
+int fossil_mockup_vfs_open(const char *path, int flags, uint32_t mode);
+
+/**
+ * @brief Read from the current position of a descriptor.
+ *
+ * @return The number of bytes read, 0 at end of file, or -1 with errno set.
+ */
+ptrdiff_t fossil_mockup_vfs_read(int fd, void *buffer, size_t count);
+
+/**
+ * @brief Write at the current position of a descriptor.
+ *
+ * Writing past the end fills the gap with zero bytes.
+ *
+ * @return The number of bytes written, or -1 with errno set.
+ */
+ptrdiff_t fossil_mockup_vfs_write(int fd, const void *buffer, size_t count);
+
+/**
+ * @brief Read at an offset without moving the descriptor position.
+ */
+ptrdiff_t fossil_mockup_vfs_pread(int fd, void *buffer, size_t count, int64_t offset);
+
+/**
+ * @brief Write at an offset without moving the descriptor position.
+ */
+ptrdiff_t fossil_mockup_vfs_pwrite(int fd, const void *buffer, size_t count, int64_t offset);
+
+/**
+ * @brief Move the position of a descriptor.
+ *
+ * @return The new position, or -1 with errno set.
+ */
+int64_t fossil_mockup_vfs_lseek(int fd, int64_t offset, int whence);
+
+/**
+ * @brief Close a descriptor.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_close(int fd);
+
+/**
+ * @brief Get information about a path.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_stat(const char *path, fossil_mockup_vfs_stat_t *info);
+
+/**
+ * @brief Get information about an open descriptor.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_fstat(int fd, fossil_mockup_vfs_stat_t *info);
+
+/**
+ * @brief Remove a file, or an empty directory.
+ *
+ * Open descriptors keep the content alive until they are closed.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int fossil_mockup_vfs_unlink(const char *path);
+
+/**
+ * @brief Map part of a file into memory.
+ *
+ * Shared mappings point straight at the file content, so no bytes are copied
+ * and writes through the mapping are visible to readers. Private mappings get
+ * their own copy. While a shared mapping is in use the content is pinned, so
+ * writes that would move it to grow the file fail with ENOSPC, and an
+ * unlinked file stays readable through the mapping until it is unmapped.
+ *
+ * @param fd           The descriptor to map.
+ * @param length       The number of bytes to map.
+ * @param offset       The offset of the first mapped byte.
+ * @param private_copy true to map a private copy of the bytes.
+ * @return The mapped address, or NULL with errno set.
+ */
+void* fossil_mockup_vfs_mmap(int fd, size_t length, int64_t offset, bool private_copy);
+
+/**
+ * @brief Release a mapping made by fossil_mockup_vfs_mmap.
+ *
+ * @return 0 on success, -1 if the address is not a VFS mapping.
+ */
+int fossil_mockup_vfs_munmap(void *address);
+
+/**
+ * @brief Open a VFS file as a stdio stream.
+ *
+ * Available with glibc (fopencookie) and on BSD and macOS (funopen). Other
+ * platforms return NULL with errno set to ENOSYS.
+ *
+ * @param path The path of the file.
+ * @param mode The fopen mode string.
+ * @return The stream, or NULL with errno set.
+ */
+FILE* fossil_mockup_vfs_fopen(const char *path, const char *mode);
+
+/**
+ * @brief Close every descriptor, drop every mapping and unmount every tree.
+ */
+void fossil_mockup_vfs_erase(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
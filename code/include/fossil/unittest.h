@@ -21,6 +21,16 @@ extern "C"
 #include "unittest/benchmark.h" // benchmarking functionaility
 #include "unittest/internal.h" // internal header file for fossil test
 #include "unittest/console.h"
+#include "unittest/table.h"   // rows for parameterized tests
+#include "unittest/property.h" // generated cases for property tests
+#include "unittest/fuzz.h"     // coverage guided fuzz targets
+#include "unittest/vector.h"   // bulk array assertions
+#include "unittest/text.h"     // string equality with diffs
+#include "unittest/snapshot.h" // golden file comparisons
+#include "unittest/failure.h"  // failures collected per test case
+#include "unittest/crash.h"    // recovery from crashing test cases
+#include "unittest/impact.h"   // test selection from per case coverage
+#include "unittest/cache.h"    // skipping unchanged passing cases
 
 // =================================================================
 // XTest create and erase commands
@@ -277,6 +287,134 @@ extern "C"
  */
 #define FOSSIL_SONIREO(name) _FOSSIL_TEST(name)
 
+// =================================================================
+// Parameterized test commands
+// =================================================================
+
+/**
+ * @brief Define macro for a test case run once per row of an inline table.
+ * 
+ * The body receives `row`, a pointer to the current element. Every row is
+ * scheduled, reported and counted as a case of its own, so one bad vector
+ * does not hide the rest.
+ * 
+ * Example:
+ * @code
+ * typedef struct { const char *text; int value; } parse_vector;
+ * static const parse_vector parse_vectors[] = {{"1", 1}, {"-7", -7}};
+ * 
+ * FOSSIL_TEST_TABLE(parse_accepts_vectors, parse_vector, parse_vectors) {
+ *     ASSUME_ITS_EQUAL_I32(row->value, parse(row->text));
+ * }
+ * @endcode
+ * 
+ * @param name The name of the test case.
+ * @param type The element type of the table.
+ * @param rows The array holding the rows.
+ */
+#define FOSSIL_TEST_TABLE(name, type, rows) _FOSSIL_TEST_TABLE(name, type, rows)
+
+/**
+ * @brief Define macro for a test case run once per line of a CSV data file.
+ * 
+ * The file is memory mapped and lines are handed out one at a time, blank
+ * lines and lines starting with '#' are skipped. The body receives `row`, a
+ * `const fossil_test_row_t *`, and reads its columns on demand with
+ * fossil_test_row_field, fossil_test_row_i64 and friends.
+ * 
+ * @param name The name of the test case.
+ * @param path The path of the CSV file, relative to the working directory.
+ */
+#define FOSSIL_TEST_CSV(name, path) _FOSSIL_TEST_CSV(name, path)
+
+/**
+ * @brief Define macro for a test case run once per binary record of a data file.
+ * 
+ * The file is memory mapped and the body receives `row`, a pointer of the
+ * record type straight into the mapping.
+ * 
+ * @param name The name of the test case.
+ * @param type The record type, the file holds sizeof(type) byte records.
+ * @param path The path of the data file, relative to the working directory.
+ */
+#define FOSSIL_TEST_RECORDS(name, type, path) _FOSSIL_TEST_RECORDS(name, type, path)
+
+// =================================================================
+// Property test commands
+// =================================================================
+
+/**
+ * @brief Define macro for a property based test case.
+ * 
+ * The body draws its inputs with the fossil_property_* generators and states
+ * what must hold with FOSSIL_PROPERTY_CHECK, assertions in the body or its
+ * helpers end the case the same way. It runs for the given number of
+ * cases spread over every core, so it must not touch shared state. A failure
+ * is shrunk to a minimal counterexample, printed with the seed, and scored
+ * like a failed assumption.
+ * 
+ * Example:
+ * @code
+ * FOSSIL_PROPERTY(addition_commutes, 10000) {
+ *     int64_t a = fossil_property_i64(prop, "a", INT32_MIN, INT32_MAX);
+ *     int64_t b = fossil_property_i64(prop, "b", INT32_MIN, INT32_MAX);
+ *     FOSSIL_PROPERTY_CHECK(a + b == b + a);
+ * }
+ * @endcode
+ * 
+ * @param name The name of the test case.
+ * @param cases The number of cases to generate.
+ */
+#define FOSSIL_PROPERTY(name, cases) _FOSSIL_PROPERTY(name, cases)
+
+/**
+ * @brief Define macro for checking a condition inside a property.
+ * 
+ * Ends the case and marks it failed when the expression is false.
+ * 
+ * @param expression The condition that must hold.
+ */
+#define FOSSIL_PROPERTY_CHECK(expression) _FOSSIL_PROPERTY_CHECK(expression)
+
+/**
+ * @brief Define macro for discarding cases that do not meet a precondition.
+ * 
+ * Discarded cases are neither passed nor failed, a property whose every
+ * case is discarded fails.
+ * 
+ * @param expression The precondition.
+ */
+#define FOSSIL_PROPERTY_REQUIRE(expression) _FOSSIL_PROPERTY_REQUIRE(expression)
+
+// =================================================================
+// Fuzz test commands
+// =================================================================
+
+/**
+ * @brief Define macro for a fuzz target.
+ * 
+ * A normal run replays every file of the target's corpus directory,
+ * FOSSIL_FUZZ_CORPUS/<name>, as a case of its own, or the empty input when
+ * there is no corpus yet. Running the tests with "fuzz <name>" mutates the
+ * corpus in process, keeps inputs that reach new code and stops at the first
+ * input that fails an assumption or crashes, saving it as crash-<hash>.
+ * 
+ * Example:
+ * @code
+ * FOSSIL_FUZZ(parse_header, data, size) {
+ *     header_t header;
+ *     if (parse_header(data, size, &header)) {
+ *         ASSUME_ITS_TRUE(header.length <= size);
+ *     }
+ * }
+ * @endcode
+ * 
+ * @param name The name of the test case.
+ * @param data The name of the input pointer, a const uint8_t *.
+ * @param size The name of the input length.
+ */
+#define FOSSIL_FUZZ(name, data, size) _FOSSIL_FUZZ(name, data, size)
+
 // =================================================================
 // Test pool commands
 // =================================================================
@@ -547,13 +685,14 @@ extern "C"
  * This macro is used to define a test assertion. It checks the given expression
  * and, if the expression evaluates to false, logs the failure with the provided
  * message, file name, line number, and function name. This type of assertion
- * typically halts the test execution upon failure.
+ * ends the test case upon failure, its teardown still runs and the remaining
+ * test cases carry on.
  * 
  * @param expression The expression to be evaluated.
  * @param message The message to log if the assertion fails.
  */
 #define TEST_ASSERT(expression, message) \
-    _fossil_test_assert_class(expression, TEST_ASSERT_AS_CLASS_ASSERT, (char*)message, (char*)__FILE__, __LINE__, (char*)__func__)
+    _FOSSIL_TEST_CHECK(expression, TEST_ASSERT_AS_CLASS_ASSERT, message)
 
 /**
  * @brief Define macros for test expectations with expression and message.
@@ -567,7 +706,7 @@ extern "C"
  * @param message The message to log if the expectation fails.
  */
 #define TEST_EXPECT(expression, message) \
-    _fossil_test_assert_class(expression, TEST_ASSERT_AS_CLASS_EXPECT, (char*)message, (char*)__FILE__, __LINE__, (char*)__func__)
+    _FOSSIL_TEST_CHECK(expression, TEST_ASSERT_AS_CLASS_EXPECT, message)
 
 /**
  * @brief Define macros for test assumptions with expression and message.
@@ -576,13 +715,14 @@ extern "C"
  * and, if the expression evaluates to false, logs the failure with the provided
  * message, file name, line number, and function name. Assumptions are used to
  * validate preconditions for the test and can halt the test execution if a failure
- * occurs. However, they may allow multiple failures before halting, depending on the implementation.
+ * occurs. However, they may allow multiple failures before halting, the test case ends once
+ * FOSSIL_TEST_ASSUME_MAX of them failed.
  * 
  * @param expression The expression to be evaluated.
  * @param message The message to log if the assumption fails.
  */
 #define TEST_ASSUME(expression, message) \
-    _fossil_test_assert_class(expression, TEST_ASSERT_AS_CLASS_ASSUME, (char*)message, (char*)__FILE__, __LINE__, (char*)__func__)
+    _FOSSIL_TEST_CHECK(expression, TEST_ASSERT_AS_CLASS_ASSUME, message)
 
 /**
  * @brief Define macros for exception testing with expression and message.
@@ -596,7 +736,7 @@ extern "C"
  * @param message The message to log if the exception test fails.
  */
 #define TEST_EXCEPT(expression, message) \
-    _fossil_test_assert_class(expression, TEST_ASSERT_AS_CLASS_EXCEPT, (char*)message, (char*)__FILE__, __LINE__, (char*)__func__)
+    _FOSSIL_TEST_CHECK(expression, TEST_ASSERT_AS_CLASS_EXCEPT, message)
 
 /**
  * @brief Define macros for sanity pen testing with expression and message.
@@ -611,7 +751,50 @@ extern "C"
  * @param message The message to log if the sanity test fails.
  */
 #define TEST_SANITY(expression, message) \
-    _fossil_test_assert_class(expression, TEST_ASSERT_AS_CLASS_SANITY, (char*)message, (char*)__FILE__, __LINE__, (char*)__func__)
+    _FOSSIL_TEST_CHECK(expression, TEST_ASSERT_AS_CLASS_SANITY, message)
+
+/**
+ * @brief Define macros for comparisons that keep their operands.
+ * 
+ * These behave like TEST_ASSERT, TEST_EXPECT and TEST_ASSUME over
+ * `actual op expected`, but a failure also reports the values of both
+ * operands. The values are stored as they are and only formatted when the
+ * failures of the test case are printed.
+ * 
+ * @param kind How the operands are printed, FOSSIL_TEST_OPERAND_SIGNED and friends.
+ * @param type The type both operands are compared as.
+ * @param actual The actual value.
+ * @param op The comparison operator.
+ * @param expected The expected value.
+ * @param message The message to log if the comparison fails.
+ */
+#define TEST_ASSERT_COMPARE(kind, type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE(TEST_ASSERT_AS_CLASS_ASSERT, kind, type, actual, op, expected, message)
+#define TEST_EXPECT_COMPARE(kind, type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE(TEST_ASSERT_AS_CLASS_EXPECT, kind, type, actual, op, expected, message)
+#define TEST_ASSUME_COMPARE(kind, type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE(TEST_ASSERT_AS_CLASS_ASSUME, kind, type, actual, op, expected, message)
+
+/**
+ * @brief Define macros for floating point comparisons that keep their operands.
+ */
+#define TEST_ASSERT_COMPARE_FLOAT(type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE_FLOAT(TEST_ASSERT_AS_CLASS_ASSERT, type, actual, op, expected, message)
+#define TEST_EXPECT_COMPARE_FLOAT(type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE_FLOAT(TEST_ASSERT_AS_CLASS_EXPECT, type, actual, op, expected, message)
+#define TEST_ASSUME_COMPARE_FLOAT(type, actual, op, expected, message) \
+    _FOSSIL_TEST_COMPARE_FLOAT(TEST_ASSERT_AS_CLASS_ASSUME, type, actual, op, expected, message)
+
+/**
+ * @brief Define macros for floating point tolerance checks that keep their
+ * operands, op is <= to expect equality and > to expect inequality.
+ */
+#define TEST_ASSERT_NEAR(type, actual, expected, tol, op, message) \
+    _FOSSIL_TEST_COMPARE_NEAR(TEST_ASSERT_AS_CLASS_ASSERT, type, actual, expected, tol, op, message)
+#define TEST_EXPECT_NEAR(type, actual, expected, tol, op, message) \
+    _FOSSIL_TEST_COMPARE_NEAR(TEST_ASSERT_AS_CLASS_EXPECT, type, actual, expected, tol, op, message)
+#define TEST_ASSUME_NEAR(type, actual, expected, tol, op, message) \
+    _FOSSIL_TEST_COMPARE_NEAR(TEST_ASSERT_AS_CLASS_ASSUME, type, actual, expected, tol, op, message)
 
 #ifdef __cplusplus
 }
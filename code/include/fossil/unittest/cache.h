@@ -0,0 +1,126 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_CACHE_H
+#define FOSSIL_TEST_CACHE_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+#include "impact.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Result cache
+ *
+ * With "cache on" a case that passed is remembered under a key made from its
+ * name and mark, the object files of the code it ran and the build IDs of
+ * every shared library loaded into the test program, the mock and test
+ * libraries and a library under test among them. The next run skips the
+ * case when its key is already in the cache directory and counts it as
+ * cached instead of running it.
+ *
+ * Which code a case ran comes from the impact index written by "impact
+ * record", each object file it names is read from next to its .gcda path.
+ * Object files keep their relocations apart from the code, so relinking the
+ * program only misses for the cases that ran a recompiled object. A case the
+ * index has not seen, or whose object files are gone, always runs.
+ *
+ * Like impact selection this only sees the functions a case ran: code linked
+ * into the program without the impact flags, globals of objects it ran no
+ * code of and files it reads are not in the key. Tables are never cached and
+ * neither is anything while recording impact, updating snapshots or
+ * repeating cases.
+ *
+ * The cache is off unless asked for, and is only available on Linux.
+ */
+
+#if defined(__linux__)
+#define FOSSIL_TEST_HAS_RESULT_CACHE 1
+#endif
+
+/**
+ * Function to find the object file gcov names a .gcda file after.
+ *
+ * @param gcda The .gcda path of the object.
+ * @param path Receives the object file path.
+ * @param size The size of path.
+ * @return false when gcda does not end in ".gcda" or path is too small.
+ */
+bool fossil_test_cache_object_path(const char *gcda, char *path, size_t size);
+
+/**
+ * Function to hash the contents of a file.
+ *
+ * @return false when the file cannot be read.
+ */
+bool fossil_test_cache_file(const char *path, uint64_t *hash);
+
+/**
+ * Function to hash the build IDs of the shared libraries loaded into the
+ * test program. A library without a build ID is hashed by its file size and
+ * modification time instead.
+ *
+ * @return The hash, computed once per run.
+ */
+uint64_t fossil_test_cache_libraries(void);
+
+/**
+ * Function to get the impact index cases are keyed on, loaded once from the
+ * "impact <file>" path.
+ *
+ * @return The index, NULL when there is none.
+ */
+const fossil_test_impact_t* fossil_test_cache_index(void);
+
+/**
+ * Function to compute the cache key of a test case.
+ *
+ * @param impact The index telling which objects the case ran.
+ * @param test The test case.
+ * @param key Set to the key.
+ * @return true when the case can be cached.
+ */
+bool fossil_test_cache_key(const fossil_test_impact_t *impact, const fossil_test_t *test, uint64_t *key);
+
+/**
+ * Function to look a key up in the cache directory.
+ *
+ * @return true when a case with that key passed before.
+ */
+bool fossil_test_cache_hit(const char *directory, uint64_t key);
+
+/**
+ * Function to remember that a case passed.
+ *
+ * @return true when the entry was written.
+ */
+bool fossil_test_cache_store(const char *directory, uint64_t key, const char *name);
+
+/**
+ * Function to tell whether the command line lets the runner use the cache.
+ */
+bool fossil_test_cache_active(void);
+
+/**
+ * Function to release the index and the object hashes once the run is over.
+ */
+void fossil_test_cache_finish(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -39,6 +39,22 @@ typedef struct {
     bool summary_enabled;
     bool color_enabled;
     bool sanity_enabled;
+    int shard_index; // zero-based shard run by this process
+    int shard_count; // number of processes splitting the cases, 1 runs everything
+    bool seed_enabled;
+    uint64_t seed;   // replays the cases of property tests
+    bool fuzz_enabled;
+    char fuzz_name[256]; // fuzz target run instead of the suite
+    uint64_t fuzz_runs;  // inputs to try, 0 runs until one fails
+    bool snapshot_update;       // rewrite golden files instead of comparing against them
+    char snapshot_dir[256];     // directory holding the golden files
+    uint32_t failure_limit;     // failures kept per case, 0 keeps all of them
+    bool impact_record;         // write the functions every case runs to the impact index
+    char impact_index[256];     // file holding the impact index
+    bool changed_enabled;
+    char changed_files[4096];   // comma separated files, only cases that ran them are run
+    bool cache_enabled;         // skip cases whose passing result is cached, off by default
+    char cache_dir[256];        // directory holding the cached results
 } fossil_options_t;
 
 extern fossil_options_t _CLI;
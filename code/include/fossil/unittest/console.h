@@ -15,6 +15,7 @@ Description:
 
 #include "fossil/_common/common.h"
 #include "internal.h"
+#include "crash.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -40,6 +41,9 @@ void fossil_test_io_unittest_start(fossil_test_t *test);
 void fossil_test_io_unittest_step(xassert_info *assume);
 void fossil_test_io_unittest_ended(fossil_test_t *test);
 void fossil_test_io_asserted(xassert_info *assume);
+void fossil_test_io_asserted_more(uint64_t count);
+void fossil_test_io_crashed(fossil_test_t *test, const fossil_test_crash_t *crash);
+void fossil_test_io_cached(fossil_test_t *test);
 void fossil_test_io_summary_start(void);
 void fossil_test_io_summary_ended(void);
 
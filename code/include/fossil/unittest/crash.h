@@ -0,0 +1,117 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_CRASH_H
+#define FOSSIL_TEST_CRASH_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+#include <setjmp.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Crash recovery
+ *
+ * While a test case runs the runner keeps a jump point for it. A fatal
+ * assertion jumps back to it, and so does a SIGSEGV, SIGBUS, SIGFPE, SIGILL
+ * or SIGABRT raised by the case. The signal handlers run on an alternate
+ * stack so a blown stack is caught as well, and they only note the signal,
+ * the faulting address and the raw return addresses of the stack. Names for
+ * the addresses are looked up after the jump, outside the handler. The case
+ * is then reported as crashed, its teardown runs and the suite goes on.
+ *
+ * A signal raised outside of a case, or on a thread other than the runner,
+ * still ends the process as it would without the handlers. On Windows no
+ * handlers are installed and only fatal assertions jump back.
+ */
+
+enum {
+    FOSSIL_TEST_CRASH_FRAMES = 32
+};
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#define FOSSIL_TEST_HAS_BACKTRACE 1
+#endif
+
+#ifndef _WIN32
+#define FOSSIL_TEST_HAS_CRASH_HANDLER 1
+typedef sigjmp_buf fossil_test_jump_t;
+#define FOSSIL_TEST_SETJMP(point) sigsetjmp(point, 1)
+#else
+typedef jmp_buf fossil_test_jump_t;
+#define FOSSIL_TEST_SETJMP(point) setjmp(point)
+#endif
+
+/**
+ * Structure holding what the signal handler noted about a crash.
+ */
+typedef struct {
+    int signal;                             /**< The signal that was caught. */
+    void *address;                          /**< Faulting address reported with the signal. */
+    void *frames[FOSSIL_TEST_CRASH_FRAMES]; /**< Return addresses, innermost first. */
+    int frame_count;                        /**< Number of frames, 0 without backtrace support. */
+} fossil_test_crash_t;
+
+/**
+ * Function to install the signal handlers and the alternate stack of the
+ * calling thread, which is the one that runs the test cases.
+ */
+void fossil_test_crash_install(void);
+
+/**
+ * Function to set the jump point fatal assertions and crashes return to.
+ *
+ * @param point The jump point, NULL when no case is running.
+ * @return The jump point that was set before.
+ */
+fossil_test_jump_t* fossil_test_jump_swap(fossil_test_jump_t *point);
+
+/**
+ * Function to return to the jump point of the running case. Only returns
+ * when there is no jump point on the calling thread.
+ */
+void fossil_test_jump_back(void);
+
+/**
+ * Function to take the crash noted since the last call.
+ *
+ * @param crash The destination.
+ * @return True when a crash was noted.
+ */
+bool fossil_test_crash_take(fossil_test_crash_t *crash);
+
+/**
+ * Function to get a readable name for a caught signal.
+ */
+const char* fossil_test_crash_name(int signal);
+
+/**
+ * Function to run a function and catch a crash inside it, for tests that
+ * expect code to fault.
+ *
+ * @param function The function to run.
+ * @param context Passed to the function.
+ * @param crash Filled in when the function crashed, may be NULL.
+ * @return True when the function crashed. A fatal assertion inside the
+ *         function ends it early and counts as no crash.
+ */
+bool fossil_test_crash_run(void (*function)(void *), void *context, fossil_test_crash_t *crash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
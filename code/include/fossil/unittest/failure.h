@@ -0,0 +1,90 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_FAILURE_H
+#define FOSSIL_TEST_FAILURE_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Failure collection
+ *
+ * Every failed assertion of a test case is kept until the case ends and is
+ * then reported in order, so an expectation that fails several times shows
+ * each failure instead of only the last one. Records live in an arena that
+ * is rewound for every case, comparisons keep their raw operands and only
+ * turn them into text when the report is printed. At most "failures <n>"
+ * records are kept per case, 100 by default and 0 for no limit, further
+ * failures are only counted so a failing expectation inside a loop stays
+ * one line of output.
+ */
+
+/**
+ * Structure holding one failure of the running test case.
+ */
+typedef struct fossil_test_failure_t {
+    struct fossil_test_failure_t *next; /**< Next failure in the order they happened. */
+    xassert_info info;                  /**< The assertion, the message is owned by the arena. */
+} fossil_test_failure_t;
+
+/**
+ * Function to keep a failed assertion until the case is reported.
+ *
+ * @param info The assertion, the message is copied.
+ */
+void fossil_test_failure_add(const xassert_info *info);
+
+/**
+ * Function to get the first kept failure of the running case.
+ *
+ * @return The failure, NULL when the case has not failed.
+ */
+const fossil_test_failure_t* fossil_test_failure_first(void);
+
+/**
+ * Function to get the number of failures of the running case, including the
+ * ones past the limit that were not kept.
+ */
+uint64_t fossil_test_failure_count(void);
+
+/**
+ * Function to format the message of a failure along with its operands.
+ *
+ * @param info The assertion.
+ * @param buffer The destination, always NUL-terminated.
+ * @param size The capacity of the destination.
+ * @return The length of the message, like snprintf.
+ */
+size_t fossil_test_failure_format(const xassert_info *info, char *buffer, size_t size);
+
+/**
+ * Function to print every kept failure of the running case and forget them.
+ */
+void fossil_test_failure_report(void);
+
+/**
+ * Function to forget the failures of the running case, the arena keeps its
+ * memory for the next case.
+ */
+void fossil_test_failure_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,111 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_FUZZ_H
+#define FOSSIL_TEST_FUZZ_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Coverage guided fuzzing
+ *
+ * A fuzz target is a test case fed raw bytes. In a normal run every file of
+ * its corpus directory is replayed as a case of its own, so inputs found by
+ * the fuzzer become regression tests. With "fuzz <name>" on the command line
+ * the runner instead loops over that one target in process, mutating corpus
+ * inputs and keeping those that reach new code.
+ *
+ * Coverage comes from the compiler. Building the test program with
+ * -fsanitize-coverage=trace-pc-guard (clang) or -fsanitize-coverage=trace-pc
+ * (gcc), which -Dwith_fuzz=enabled does, makes it call back into this
+ * library. Without it the fuzzer still mutates the corpus, just blindly.
+ */
+
+/**
+ * Directory holding one corpus directory per fuzz target, relative to the
+ * working directory of the test program.
+ */
+#ifndef FOSSIL_FUZZ_CORPUS
+#define FOSSIL_FUZZ_CORPUS "corpus"
+#endif
+
+/**
+ * Longest input the fuzzer generates.
+ */
+#ifndef FOSSIL_FUZZ_MAX_LENGTH
+#define FOSSIL_FUZZ_MAX_LENGTH 4096
+#endif
+
+/**
+ * Structure holding the outcome of a fuzzing session.
+ */
+typedef struct {
+    uint64_t runs;          /**< Inputs executed. */
+    uint64_t corpus_size;   /**< Inputs kept, seeds included. */
+    uint64_t features;      /**< Distinct coverage features seen. */
+    bool failed;            /**< An input failed and was saved as crash-<hash>. */
+} fossil_fuzz_stats_t;
+
+/**
+ * Function to fuzz a target in process until an input fails or the run
+ * budget is spent. New inputs are written to the corpus directory of the
+ * target, a failing input is written there with a "crash-" prefix. A failed
+ * ASSERT or a crash ends the input it happened in and the loop returns, a
+ * crash stays noted for the case running the loop.
+ *
+ * @param test The fuzz target.
+ * @param runs Number of inputs to execute, 0 to run until an input fails.
+ * @param stats Receives the outcome, may be NULL.
+ * @return true if no input failed.
+ */
+bool fossil_fuzz_loop(fossil_test_t *test, uint64_t runs, fossil_fuzz_stats_t *stats);
+
+/**
+ * Function to add an input to the corpus of a fuzz target. The file is named
+ * after a hash of its contents, so adding the same input twice is harmless.
+ *
+ * @param test The fuzz target.
+ * @param data The input.
+ * @param size The length of the input.
+ * @return true if the input is in the corpus.
+ */
+bool fossil_fuzz_corpus_add(const fossil_test_t *test, const void *data, size_t size);
+
+/**
+ * @brief Macro to define a fuzz target.
+ *
+ * Defines a test case whose rows are the files of FOSSIL_FUZZ_CORPUS/<name>.
+ * The body receives the input as data and size.
+ *
+ * @param name The name of the test case.
+ * @param data The name of the input pointer.
+ * @param size The name of the input length.
+ */
+#define _FOSSIL_FUZZ(name, data, size) \
+    _FOSSIL_TEST_ROWS(name, FOSSIL_TEST_TABLE_CORPUS, xnull, 0, 0, FOSSIL_FUZZ_CORPUS "/" #name); \
+    static void name##_fossil_fuzz(const uint8_t *data, size_t size); \
+    static void name##_fossil_rows(const fossil_test_row_t *fossil_row) { \
+        name##_fossil_fuzz((const uint8_t *)fossil_row->data, fossil_row->length); \
+    } \
+    static void name##_fossil_fuzz(const uint8_t *data, size_t size)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
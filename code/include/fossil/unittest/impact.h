@@ -0,0 +1,193 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_IMPACT_H
+#define FOSSIL_TEST_IMPACT_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Test impact selection
+ *
+ * A test program built with the with_impact option carries gcov counters
+ * but writes no .gcda files. Run with "impact record", the runner dumps the
+ * counters in memory after every test case and charges each function whose
+ * counters moved to that case. The functions each case ran, grouped by the
+ * object file they live in, are written to an index, impact.index unless
+ * "impact <file>" names another one.
+ *
+ * Run with "changed <files>", the runner loads the index and only runs the
+ * cases that ran code of one of the comma separated source files. Object
+ * files are matched by name, so build directories do not need to line up
+ * with the source tree. A changed header, a source file the index does not
+ * know or a missing index runs every case, so do cases the index has not
+ * seen yet. Other files, such as documentation, are ignored.
+ *
+ * Coverage only tells which functions ran, not which declarations, macros
+ * or data a case relied on, so the selection is a fast path for CI and not
+ * a replacement for a full run.
+ */
+
+/**
+ * Function the test program passes to dump its gcov counters, it hands
+ * every object to __gcov_info_to_gcda with the callbacks below.
+ */
+typedef void (*fossil_test_impact_collect_t)(void *impact);
+
+/**
+ * Structure holding the functions of one instrumented object file.
+ */
+typedef struct {
+    char *path;            /**< The .gcda path gcov reports for the object. */
+    uint32_t *idents;      /**< Function identifiers, in the order gcov dumps them. */
+    uint64_t *totals;      /**< Sum of the arc counters of each function at the last dump. */
+    size_t count;          /**< Number of functions seen. */
+    size_t capacity;       /**< Number of functions allocated. */
+    bool changed;          /**< One of the changed files compiled into this object. */
+} fossil_test_impact_object_t;
+
+/**
+ * Structure holding the functions one test case ran.
+ */
+typedef struct {
+    char *name;            /**< Name of the test case. */
+    uint64_t *touches;     /**< Object index in the high and function ident in the low half. */
+    size_t count;          /**< Number of functions touched. */
+    size_t capacity;       /**< Number of touches allocated. */
+} fossil_test_impact_case_t;
+
+/**
+ * Structure holding a coverage index, either being recorded or loaded.
+ */
+typedef struct {
+    fossil_test_impact_collect_t collect; /**< Dumps the counters, NULL for a loaded index. */
+    fossil_test_impact_object_t *objects;
+    size_t object_count;
+    size_t object_capacity;
+    fossil_test_impact_case_t *cases;
+    size_t case_count;
+    size_t case_capacity;
+    fossil_test_impact_case_t *current;   /**< Case new counts are charged to, NULL for the baseline. */
+    size_t object;                        /**< Object the stream being read belongs to. */
+    bool streaming;                       /**< A stream is being read. */
+    unsigned char *stream;                /**< Bytes of the .gcda stream being read. */
+    size_t stream_length;
+    size_t stream_capacity;
+    bool select_all;                      /**< A change the index cannot place, run everything. */
+} fossil_test_impact_t;
+
+/**
+ * Function to create an empty index.
+ *
+ * @param collect Dumps the counters of the test program, NULL for an index
+ *                that is only loaded and queried.
+ * @return The index.
+ */
+fossil_test_impact_t* fossil_test_impact_create(fossil_test_impact_collect_t collect);
+
+/**
+ * Function to dump the counters and charge every function that ran since
+ * the last dump to a test case. Rows of a table test add to the same case.
+ *
+ * @param impact The index.
+ * @param name The test case, NULL to only take a baseline.
+ */
+void fossil_test_impact_collect(fossil_test_impact_t *impact, const char *name);
+
+/**
+ * Function to write an index to a file.
+ *
+ * @return true when the file was written.
+ */
+bool fossil_test_impact_save(const fossil_test_impact_t *impact, const char *path);
+
+/**
+ * Function to read an index written by fossil_test_impact_save.
+ *
+ * @return The index, NULL when the file is missing or not an index.
+ */
+fossil_test_impact_t* fossil_test_impact_load(const char *path);
+
+/**
+ * Function to mark the objects built from a comma separated list of changed
+ * files.
+ */
+void fossil_test_impact_change(fossil_test_impact_t *impact, const char *files);
+
+/**
+ * Function to look up the functions a test case ran in a loaded index.
+ *
+ * @return The case, NULL when the index has not seen it.
+ */
+const fossil_test_impact_case_t* fossil_test_impact_find(const fossil_test_impact_t *impact, const char *name);
+
+/**
+ * Function to decide whether a test case has to run after the change.
+ *
+ * @return true when the case ran code of a changed object, is new to the
+ *         index or the change could not be placed.
+ */
+bool fossil_test_impact_selects(const fossil_test_impact_t *impact, const char *name);
+
+/**
+ * Function to erase an index.
+ */
+void fossil_test_impact_erase(fossil_test_impact_t *impact);
+
+/**
+ * Callbacks for __gcov_info_to_gcda, the argument is the index.
+ */
+void fossil_test_impact_filename(const char *filename, void *impact);
+void fossil_test_impact_data(const void *data, unsigned length, void *impact);
+void* fossil_test_impact_allocate(unsigned length, void *impact);
+
+/**
+ * Functions the runner uses to record or select according to the command
+ * line, they do nothing when neither "impact record" nor "changed" is given.
+ */
+void fossil_test_impact_attach(fossil_test_impact_collect_t collect);
+bool fossil_test_impact_case_selected(const char *name);
+void fossil_test_impact_case_ended(const char *name);
+void fossil_test_impact_finish(void);
+
+#ifdef FOSSIL_TEST_IMPACT
+#include <gcov.h>
+
+// Filled by the linker with the gcov_info of every object built with
+// -fprofile-info-section=fossil_gcov_info.
+extern const struct gcov_info *const __start_fossil_gcov_info[] __attribute__((weak));
+extern const struct gcov_info *const __stop_fossil_gcov_info[] __attribute__((weak));
+
+// Left uninstrumented so dumping the counters does not move them.
+__attribute__((no_profile_instrument_function))
+static inline void _fossil_test_impact_collect(void *impact) {
+    for (const struct gcov_info *const *info = __start_fossil_gcov_info; info < __stop_fossil_gcov_info; info++) {
+        __gcov_info_to_gcda(*info, fossil_test_impact_filename, fossil_test_impact_data, fossil_test_impact_allocate, impact);
+    }
+}
+
+#define _FOSSIL_TEST_IMPACT_COLLECT _fossil_test_impact_collect
+#else
+#define _FOSSIL_TEST_IMPACT_COLLECT xnullptr
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
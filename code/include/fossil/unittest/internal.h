@@ -169,6 +169,42 @@ typedef struct {
                                   the test environment. */
 } fossil_fixture_t;
 
+/**
+ * @brief Enumeration of the data sources a parameterized test can draw rows from.
+ */
+typedef enum {
+    FOSSIL_TEST_TABLE_NONE,    /**< Plain test case without rows. */
+    FOSSIL_TEST_TABLE_INLINE,  /**< Array of structs compiled into the test. */
+    FOSSIL_TEST_TABLE_CSV,     /**< Comma separated lines of a data file. */
+    FOSSIL_TEST_TABLE_RECORDS, /**< Fixed-size binary records of a data file. */
+    FOSSIL_TEST_TABLE_CORPUS   /**< Every file of a fuzz corpus directory. */
+} fossil_test_table_kind_t;
+
+/**
+ * @brief One row handed to a parameterized test.
+ *
+ * For data files the bytes point straight into the mapped file and are only
+ * valid while the row runs.
+ */
+typedef struct {
+    const void *data; /**< The element, record or CSV line, not NUL-terminated. */
+    size_t length;    /**< Number of bytes in data. */
+    size_t index;     /**< Zero-based row number within the table. */
+} fossil_test_row_t;
+
+/**
+ * Structure describing where the rows of a parameterized test come from.
+ * Rows are read one at a time while the test runs, nothing is parsed up front.
+ */
+typedef struct {
+    fossil_test_table_kind_t kind;                   /**< Data source, FOSSIL_TEST_TABLE_NONE for plain tests. */
+    const void *rows;                                /**< Inline array of rows. */
+    size_t row_size;                                 /**< Size of an inline element or binary record. */
+    size_t row_count;                                /**< Number of inline rows. */
+    const char *path;                                /**< Data file for CSV and binary records, directory of a corpus. */
+    void (*row_function)(const fossil_test_row_t *); /**< Called once per row instead of test_function. */
+} fossil_test_table_t;
+
 /**
  * Structure representing a test case.
  * This structure contains all the necessary information for a test case, including its name,
@@ -183,6 +219,7 @@ typedef struct fossil_test_t {
     fossil_test_timer_t timer;   /**< Timer for tracking the duration of the test case. */
     fossil_fixture_t fixture;    /**< The fixture settings for setup and teardown functions. */
     int32_t priority;            /**< Priority of the test case (higher value indicates higher priority). */
+    fossil_test_table_t table;   /**< Rows of a parameterized test case. */
     struct fossil_test_t *prev;  /**< Pointer to the previous fossil_test_t node in a linked list. */
     struct fossil_test_t *next;  /**< Pointer to the next fossil_test_t node in a linked list. */
 } fossil_test_t;
@@ -202,18 +239,43 @@ typedef struct {
  * including passed, failed, skipped, and timed-out tests.
  */
 typedef struct {
-    uint16_t expected_passed_count;   /**< Number of expected passed tests. */
-    uint16_t expected_failed_count;   /**< Number of expected failed tests. */
-    uint16_t unexpected_passed_count; /**< Number of unexpected passed tests. */
-    uint16_t unexpected_failed_count; /**< Number of unexpected failed tests. */
-    uint16_t expected_skipped_count;  /**< Number of skipped tests. */
-    uint16_t expected_empty_count;    /**< Number of empty tests. */
-    uint16_t expected_timeout_count;  /**< Number of tests that timed out. */
-    uint16_t expected_total_count;    /**< Total number of unit tests that were run. */
-    uint16_t untested_count;          /**< Total number of untested cases when exit or abort is called 
+    uint32_t expected_passed_count;   /**< Number of expected passed tests. */
+    uint32_t expected_failed_count;   /**< Number of expected failed tests. */
+    uint32_t unexpected_passed_count; /**< Number of unexpected passed tests. */
+    uint32_t unexpected_failed_count; /**< Number of unexpected failed tests. */
+    uint32_t expected_skipped_count;  /**< Number of skipped tests. */
+    uint32_t expected_empty_count;    /**< Number of empty tests. */
+    uint32_t expected_timeout_count;  /**< Number of tests that timed out. */
+    uint32_t expected_total_count;    /**< Total number of unit tests that were run, rows of
+                                           parameterized tests count one each. */
+    uint32_t untested_count;          /**< Total number of untested cases when exit or abort is called 
                                            from an assert. */
+    uint32_t crashed_count;           /**< Number of cases ended by a signal, they count as failed too. */
+    uint32_t cached_count;            /**< Number of cases not run because their passing result was cached. */
 } fossil_test_score_t;
 
+/**
+ * @brief Enumeration of how the operands of a failed comparison are printed.
+ */
+typedef enum {
+    FOSSIL_TEST_OPERAND_NONE,     /**< Plain assertion, only the message is printed. */
+    FOSSIL_TEST_OPERAND_SIGNED,   /**< Signed integers in decimal. */
+    FOSSIL_TEST_OPERAND_UNSIGNED, /**< Unsigned integers in decimal. */
+    FOSSIL_TEST_OPERAND_HEX,      /**< Unsigned integers in hexadecimal. */
+    FOSSIL_TEST_OPERAND_OCTAL,    /**< Unsigned integers in octal. */
+    FOSSIL_TEST_OPERAND_FLOAT,    /**< Floating point values. */
+    FOSSIL_TEST_OPERAND_NEAR      /**< Floating point values compared within a tolerance. */
+} fossil_test_operand_t;
+
+/**
+ * @brief Raw operand of a comparison, integers are kept as their 64-bit
+ * two's complement pattern.
+ */
+typedef union {
+    uint64_t u;
+    double f;
+} fossil_test_value_t;
+
 /**
  * Structure representing information about an assertion.
  * This structure contains detailed information about an assertion, including the name of the test case,
@@ -225,9 +287,14 @@ typedef struct {
     bool should_fail;      /**< Flag indicating whether the test case should fail (1 for true, 0 for false). */
     bool has_assert;       /**< Flag indicating if an assertion occurred (1 for true, 0 for false). */
     int32_t line;          /**< Line number where the assertion occurred. */
+    int64_t row;           /**< Row of a parameterized test being run, -1 for plain tests. */
     char *func;            /**< Function name where the assertion occurred. */
     char *file;            /**< File name where the assertion occurred. */
     char *message;         /**< Message associated with the assertion. */
+    fossil_test_operand_t kind;      /**< How the operands are printed, none for plain assertions. */
+    fossil_test_value_t actual;      /**< Actual operand of a comparison. */
+    fossil_test_value_t expected;    /**< Expected operand of a comparison. */
+    fossil_test_value_t tolerance;   /**< Tolerance of a floating point comparison. */
 } xassert_info;
 
 /**
@@ -262,13 +329,56 @@ void fossil_test_environment_run(fossil_env_t *env);
 void fossil_test_environment_add(fossil_env_t *env, fossil_test_t *test, fossil_fixture_t *fixture);
 int  fossil_test_environment_summary(void);
 
+/**
+ * Decide whether a case, or one row of a table case, belongs to a shard. The
+ * choice hashes the case name and row index, so it does not depend on the
+ * run order and every shard agrees on it even with shuffle or reverse.
+ *
+ * @param name  The name of the test case.
+ * @param row   The zero-based table row, 0 for a plain case.
+ * @param index The zero-based shard asking.
+ * @param count The number of shards, 1 or less owns everything.
+ * @return      True if the shard runs the case or row.
+ */
+bool fossil_test_shard_owns(const char *name, uint64_t row, int index, int count);
+
 void fossil_test_apply_mark(fossil_test_t *test, const char *mark);
 void fossil_test_apply_xtag(fossil_test_t *test, const char *tag);
 void fossil_test_apply_priority(fossil_test_t *test, const char *priority);
 
+/**
+ * @brief Number of assertions that passed on the fast path, per thread.
+ * 
+ * The runner compares it before and after a test case to tell whether the
+ * case asserted anything.
+ */
+extern FOSSIL_TEST_THREAD_LOCAL uint64_t _fossil_test_pass_count;
+
+/**
+ * @brief Function receiving the failed assertions of one thread.
+ */
+typedef void (*fossil_test_assert_hook_t)(const char *message, const char *file, int line);
+
+/**
+ * @brief Route the assertions of the calling thread to a hook.
+ * 
+ * While a hook is set, assertions on this thread leave the scoreboard and
+ * the failure list alone, passing ones are ignored and failing ones go to
+ * the hook. Property cases use it so the assert macros work on their
+ * worker threads.
+ * 
+ * @param hook The hook, NULL to score assertions as usual again.
+ * @return The hook that was set before.
+ */
+fossil_test_assert_hook_t fossil_test_assert_hook_swap(fossil_test_assert_hook_t hook);
+
 /**
  * @brief Internal function for handling test assertions.
  * 
+ * Only reached from _FOSSIL_TEST_CHECK when an assertion fails, or when the
+ * case is marked to fail and every outcome has to be scored, so it is kept
+ * out of line.
+ * 
  * @param expression The expression to evaluate.
  * @param behavior The behavior of the assertion (e.g., ASSERT, EXPECT, ASSUME).
  * @param message The message associated with the assertion.
@@ -276,7 +386,105 @@ void fossil_test_apply_priority(fossil_test_t *test, const char *priority);
  * @param line The line number where the assertion occurred.
  * @param func The function name where the assertion occurred.
  */
-void _fossil_test_assert_class(bool expression, xassert_type_t behavior, char* message, char* file, int line, char* func);
+FOSSIL_TEST_COLD void _fossil_test_assert_class(bool expression, xassert_type_t behavior, char* message, char* file, int line, char* func);
+
+/**
+ * @brief Macro evaluating an assertion inline.
+ * 
+ * A passing assertion costs the test and a thread-local increment, the
+ * reporting call is only made on failure.
+ * 
+ * @param expression The expression to evaluate, exactly once.
+ * @param behavior The behavior of the assertion.
+ * @param message The message to report on failure.
+ */
+#define _FOSSIL_TEST_CHECK(expression, behavior, message) \
+    do { \
+        bool fossil_check_passed = (expression); \
+        if (FOSSIL_TEST_LIKELY(fossil_check_passed && !_ASSERT_INFO.should_fail)) { \
+            _fossil_test_pass_count++; \
+        } else { \
+            _fossil_test_assert_class(fossil_check_passed, behavior, (char*)(message), (char*)__FILE__, __LINE__, (char*)__func__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Internal functions for comparisons that failed, or that have to be
+ * scored because the case is marked to fail.
+ * 
+ * The operands are stored as they are and only formatted into the message
+ * when the failures of the case are reported.
+ * 
+ * @param expression The outcome of the comparison.
+ * @param behavior The behavior of the assertion.
+ * @param kind How the operands are printed.
+ * @param message The message associated with the assertion, a string literal.
+ * @param actual The actual operand.
+ * @param expected The expected operand.
+ * @param tolerance The allowed difference, only for FOSSIL_TEST_OPERAND_NEAR.
+ */
+FOSSIL_TEST_COLD void _fossil_test_assert_integer(bool expression, xassert_type_t behavior, fossil_test_operand_t kind, const char* message, uint64_t actual, uint64_t expected, const char* file, int line, const char* func);
+FOSSIL_TEST_COLD void _fossil_test_assert_float(bool expression, xassert_type_t behavior, fossil_test_operand_t kind, const char* message, double actual, double expected, double tolerance, const char* file, int line, const char* func);
+
+/**
+ * @brief Macro comparing two integers inline and keeping both on failure.
+ * 
+ * Each operand is converted to type and evaluated exactly once.
+ * 
+ * @param behavior The behavior of the assertion.
+ * @param kind How the operands are printed.
+ * @param type The type both operands are compared as.
+ * @param actual The actual value.
+ * @param op The comparison operator.
+ * @param expected The expected value.
+ * @param message The message to report on failure.
+ */
+#define _FOSSIL_TEST_COMPARE(behavior, kind, type, actual, op, expected, message) \
+    do { \
+        type fossil_check_actual = (type)(actual); \
+        type fossil_check_expected = (type)(expected); \
+        bool fossil_check_passed = fossil_check_actual op fossil_check_expected; \
+        if (FOSSIL_TEST_LIKELY(fossil_check_passed && !_ASSERT_INFO.should_fail)) { \
+            _fossil_test_pass_count++; \
+        } else { \
+            _fossil_test_assert_integer(fossil_check_passed, behavior, kind, message, \
+                (uint64_t)fossil_check_actual, (uint64_t)fossil_check_expected, __FILE__, __LINE__, __func__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro comparing two floating point values inline and keeping both on failure.
+ */
+#define _FOSSIL_TEST_COMPARE_FLOAT(behavior, type, actual, op, expected, message) \
+    do { \
+        type fossil_check_actual = (type)(actual); \
+        type fossil_check_expected = (type)(expected); \
+        bool fossil_check_passed = fossil_check_actual op fossil_check_expected; \
+        if (FOSSIL_TEST_LIKELY(fossil_check_passed && !_ASSERT_INFO.should_fail)) { \
+            _fossil_test_pass_count++; \
+        } else { \
+            _fossil_test_assert_float(fossil_check_passed, behavior, FOSSIL_TEST_OPERAND_FLOAT, message, \
+                (double)fossil_check_actual, (double)fossil_check_expected, 0.0, __FILE__, __LINE__, __func__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro comparing the distance of two floating point values against a
+ * tolerance, op is <= for equality and > for inequality.
+ */
+#define _FOSSIL_TEST_COMPARE_NEAR(behavior, type, actual, expected, tol, op, message) \
+    do { \
+        type fossil_check_actual = (type)(actual); \
+        type fossil_check_expected = (type)(expected); \
+        double fossil_check_tolerance = (double)(tol); \
+        bool fossil_check_passed = fabs((double)(fossil_check_actual - fossil_check_expected)) op fossil_check_tolerance; \
+        if (FOSSIL_TEST_LIKELY(fossil_check_passed && !_ASSERT_INFO.should_fail)) { \
+            _fossil_test_pass_count++; \
+        } else { \
+            _fossil_test_assert_float(fossil_check_passed, behavior, FOSSIL_TEST_OPERAND_NEAR, message, \
+                (double)fossil_check_actual, (double)fossil_check_expected, fossil_check_tolerance, __FILE__, __LINE__, __func__); \
+        } \
+    } while (0)
 
 
 /**
@@ -387,11 +595,77 @@ void _fossil_test_assert_class(bool expression, xassert_type_t behavior, char* m
         {0, 0, 0, {0, 0, 0, 0, 0}}, \
         {xnull, xnull},             \
         0,                          \
+        {FOSSIL_TEST_TABLE_NONE, xnull, 0, 0, xnull, xnull}, \
         xnull,                      \
         xnull                       \
     };                              \
     void name##_fossil_test(void)
 
+/**
+ * @brief Shared part of the parameterized test macros.
+ *
+ * Defines the test case with its table and declares the row function, the
+ * caller supplies the thunk adapting a generic row to the typed body.
+ */
+#define _FOSSIL_TEST_ROWS(name, kind, rows, row_size, row_count, path) \
+    static void name##_fossil_rows(const fossil_test_row_t *fossil_row); \
+    fossil_test_t name = {          \
+        (char*)#name,               \
+        xnull,                      \
+        (char*)"fossil",            \
+        (char*)"fossil",            \
+        {0, 0, 0, {0, 0, 0, 0, 0}}, \
+        {xnull, xnull},             \
+        0,                          \
+        {kind, rows, row_size, row_count, path, name##_fossil_rows}, \
+        xnull,                      \
+        xnull                       \
+    }
+
+/**
+ * @brief Macro to define a test case run once per element of an inline array.
+ *
+ * @param name The name of the test case.
+ * @param type The element type of the array.
+ * @param rows The array, its length is taken with sizeof.
+ */
+#define _FOSSIL_TEST_TABLE(name, type, rows) \
+    _FOSSIL_TEST_ROWS(name, FOSSIL_TEST_TABLE_INLINE, rows, sizeof((rows)[0]), sizeof(rows) / sizeof((rows)[0]), xnull); \
+    static void name##_fossil_row(const type *row); \
+    static void name##_fossil_rows(const fossil_test_row_t *fossil_row) { \
+        name##_fossil_row((const type *)fossil_row->data); \
+    } \
+    static void name##_fossil_row(const type *row)
+
+/**
+ * @brief Macro to define a test case run once per line of a CSV data file.
+ *
+ * @param name The name of the test case.
+ * @param path The path of the data file.
+ */
+#define _FOSSIL_TEST_CSV(name, path) \
+    _FOSSIL_TEST_ROWS(name, FOSSIL_TEST_TABLE_CSV, xnull, 0, 0, path); \
+    static void name##_fossil_row(const fossil_test_row_t *row); \
+    static void name##_fossil_rows(const fossil_test_row_t *fossil_row) { \
+        name##_fossil_row(fossil_row); \
+    } \
+    static void name##_fossil_row(const fossil_test_row_t *row)
+
+/**
+ * @brief Macro to define a test case run once per binary record of a data file.
+ *
+ * @param name The name of the test case.
+ * @param type The record type, records are sizeof(type) bytes each.
+ * @param path The path of the data file.
+ */
+#define _FOSSIL_TEST_RECORDS(name, type, path) \
+    _FOSSIL_TEST_ROWS(name, FOSSIL_TEST_TABLE_RECORDS, xnull, sizeof(type), 0, path); \
+    static void name##_fossil_row(const type *row); \
+    static void name##_fossil_rows(const fossil_test_row_t *fossil_row) { \
+        name##_fossil_row((const type *)fossil_row->data); \
+    } \
+    static void name##_fossil_row(const type *row)
+
 /**
  * @brief Macro to define a test case with a priority.
  * 
@@ -415,8 +689,9 @@ void _fossil_test_assert_class(bool expression, xassert_type_t behavior, char* m
 /** Macro to run the test environment.
  * 
  * This macro is used to run the test environment by calling the fossil_test_environment_run function.
+ * It first hands the gcov counters of the test program to the impact index, see impact.h.
  */
-#define _FOSSIL_TEST_RUN() fossil_test_environment_run(&_TEST_ENV)
+#define _FOSSIL_TEST_RUN() (fossil_test_impact_attach(_FOSSIL_TEST_IMPACT_COLLECT), fossil_test_environment_run(&_TEST_ENV))
 
 /**
  * @brief Define macro for defining a test queue.
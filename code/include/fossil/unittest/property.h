@@ -0,0 +1,197 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_PROPERTY_H
+#define FOSSIL_TEST_PROPERTY_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Property based testing
+ *
+ * A property draws its inputs from generators and checks something that must
+ * hold for all of them. Every generated value comes from a recorded stream of
+ * random choices, so a failing case is shrunk by simplifying the stream and
+ * replaying the property until no smaller stream still fails. The shrunk
+ * inputs are printed along with the seed, and "seed <n>" on the command line
+ * replays the exact run.
+ *
+ * Cases run on every core at once, so a property body must not touch shared
+ * state and reports with FOSSIL_PROPERTY_CHECK. Assert macros reached from
+ * the body, directly or through helpers, fail the case the same way instead
+ * of scoring the running test, and a crash in the body fails it too. Each
+ * case runs under a jump point of its worker thread, so a failure ends it
+ * from any depth. The outcome is scored like any other test case.
+ */
+
+/**
+ * Structure holding the state of one generated case. Each worker thread owns
+ * its own, the body only ever passes it to generators and checks.
+ */
+typedef struct fossil_property_t {
+    uint64_t state;           /**< Generator state for fresh choices. */
+    uint64_t *choices;        /**< Choices drawn so far, replayed while shrinking. */
+    size_t choice_count;      /**< Number of choices in use. */
+    size_t choice_capacity;   /**< Number of choices allocated. */
+    size_t cursor;            /**< Next choice to replay. */
+    bool replaying;           /**< Draw from choices instead of the generator. */
+    bool recording;           /**< Describe every drawn value in log. */
+    bool failed;              /**< A check did not hold. */
+    bool discarded;           /**< A requirement did not hold, the case does not count. */
+    const char *expression;   /**< The failed check. */
+    const char *file;         /**< File of the failed check. */
+    int32_t line;             /**< Line of the failed check. */
+    char **strings;           /**< Strings handed out during the case. */
+    size_t string_count;
+    size_t string_capacity;
+    char *log;                /**< Description of the drawn values while recording. */
+    size_t log_length;
+    size_t log_capacity;
+} fossil_property_t;
+
+/**
+ * Structure describing a property test case.
+ */
+typedef struct {
+    const char *name;                         /**< Name of the property. */
+    void (*body)(fossil_property_t *prop);    /**< The property. */
+    uint32_t cases;                           /**< Number of cases to try. */
+} fossil_property_spec_t;
+
+/**
+ * Function to run a property, shrink a failure and report it through the
+ * scoreboard of the running test case.
+ *
+ * @param spec The property.
+ */
+void fossil_property_run(const fossil_property_spec_t *spec);
+
+/**
+ * Function to search a property for a failing case without shrinking or
+ * reporting it.
+ *
+ * @param spec The property.
+ * @param index Set to the lowest failing case, UINT64_MAX when none fails.
+ * @param discarded Set to the number of discarded cases.
+ * @return true if some case failed.
+ */
+bool fossil_property_falsified(const fossil_property_spec_t *spec, uint64_t *index, uint64_t *discarded);
+
+/**
+ * Function to record a failed check and end the case.
+ */
+void fossil_property_fail(fossil_property_t *prop, const char *expression, const char *file, int32_t line);
+
+/**
+ * Function to discard the case, which then counts neither way.
+ */
+void fossil_property_discard(fossil_property_t *prop);
+
+/**
+ * Function to draw an integer in [min, max]. Shrinks toward zero, or the bound
+ * nearest to it, and favors the bounds while generating.
+ */
+int64_t fossil_property_i64(fossil_property_t *prop, const char *label, int64_t min, int64_t max);
+
+/**
+ * Function to draw an unsigned integer in [min, max]. Shrinks toward min.
+ */
+uint64_t fossil_property_u64(fossil_property_t *prop, const char *label, uint64_t min, uint64_t max);
+
+/**
+ * Function to draw a finite double in [min, max]. Shrinks toward zero, or the
+ * bound nearest to it.
+ */
+double fossil_property_f64(fossil_property_t *prop, const char *label, double min, double max);
+
+/**
+ * Function to draw any double, including zeroes of both signs, infinities,
+ * NaN, subnormals and the extremes. Shrinks toward 0.0.
+ */
+double fossil_property_f64_any(fossil_property_t *prop, const char *label);
+
+/**
+ * Function to draw a boolean. Shrinks toward false.
+ */
+bool fossil_property_bool(fossil_property_t *prop, const char *label);
+
+/**
+ * Function to draw a NUL-terminated string owned by the case.
+ *
+ * @param prop The case.
+ * @param label The name printed with the counterexample.
+ * @param max_length The longest string to draw.
+ * @param alphabet The characters to draw from, NULL for printable ASCII.
+ * @return The string, valid until the case ends. Shrinks toward short
+ *         strings of the first alphabet character.
+ */
+const char* fossil_property_cstr(fossil_property_t *prop, const char *label, size_t max_length, const char *alphabet);
+
+/**
+ * Function to fill a buffer with a random number of random bytes.
+ *
+ * @param prop The case.
+ * @param label The name printed with the counterexample.
+ * @param buffer The destination.
+ * @param max_length The capacity of the destination.
+ * @return The number of bytes drawn. Shrinks toward short runs of zeroes.
+ */
+size_t fossil_property_bytes(fossil_property_t *prop, const char *label, void *buffer, size_t max_length);
+
+/**
+ * @brief Macro to define a property test case.
+ *
+ * Defines a plain test case that runs the property body for the given
+ * number of cases. The body receives `prop` for the generators.
+ *
+ * @param name The name of the test case.
+ * @param cases The number of cases to try.
+ */
+#define _FOSSIL_PROPERTY(name, cases) \
+    static void name##_fossil_property(fossil_property_t *prop); \
+    _FOSSIL_TEST(name) { \
+        static const fossil_property_spec_t spec = { #name, name##_fossil_property, cases }; \
+        fossil_property_run(&spec); \
+    } \
+    static void name##_fossil_property(fossil_property_t *prop)
+
+/**
+ * @brief Macro to check a condition inside a property, ending the case when it fails.
+ */
+#define _FOSSIL_PROPERTY_CHECK(expression) \
+    do { \
+        if (!(expression)) { \
+            fossil_property_fail(prop, #expression, __FILE__, __LINE__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to drop cases whose inputs do not meet a precondition.
+ */
+#define _FOSSIL_PROPERTY_REQUIRE(expression) \
+    do { \
+        if (!(expression)) { \
+            fossil_property_discard(prop); \
+        } \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
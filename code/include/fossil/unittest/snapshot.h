@@ -0,0 +1,103 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_SNAPSHOT_H
+#define FOSSIL_TEST_SNAPSHOT_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Snapshot testing
+ *
+ * A snapshot assertion compares output against a golden file under the
+ * snapshot directory, "snapshots" unless "snapshots <directory>" is given.
+ * Next to every golden file a small "<name>.hash" file keeps its length,
+ * modification time and a 64-bit xxHash64, so matching output is hashed once
+ * and the golden file is only stat'ed, never read. When the hash differs or
+ * is missing, or the golden file's size or time no longer match, the golden
+ * file is mapped into memory and compared byte by byte. A mismatch prints a
+ * unified diff for text and a hexdump for binary data, and the actual
+ * output is saved as "<name>.new" beside the golden file.
+ *
+ * Running with "update snapshots" rewrites the golden files and their
+ * hashes instead of comparing.
+ */
+
+/**
+ * Structure holding the state of a streaming hash.
+ */
+typedef struct {
+    uint64_t lanes[4];     /**< Accumulators of the 32 byte stripes. */
+    uint8_t pending[32];   /**< Bytes not yet making up a whole stripe. */
+    size_t pending_size;
+    uint64_t total;        /**< Bytes hashed so far. */
+} fossil_snapshot_hash_t;
+
+/**
+ * Functions to hash data arriving in pieces, the result only depends on the
+ * bytes and not on how they were split.
+ */
+void fossil_snapshot_hash_init(fossil_snapshot_hash_t *hash);
+void fossil_snapshot_hash_update(fossil_snapshot_hash_t *hash, const void *data, size_t size);
+uint64_t fossil_snapshot_hash_final(const fossil_snapshot_hash_t *hash);
+
+/**
+ * Function to hash a buffer in one call.
+ */
+uint64_t fossil_snapshot_hash(const void *data, size_t size);
+
+/**
+ * Function to write a golden file and its hash, creating directories as
+ * needed.
+ *
+ * @param name The snapshot name, may contain '/' to group snapshots.
+ * @return true if both files were written.
+ */
+bool fossil_snapshot_write(const char *name, const void *data, size_t size);
+
+/**
+ * Function to check output against a golden file without asserting, using
+ * the hash file when it still describes the golden file.
+ *
+ * @param name The snapshot name.
+ * @return true if the golden file exists and holds exactly these bytes.
+ */
+bool fossil_snapshot_matches(const char *name, const void *data, size_t size);
+
+/**
+ * Internal function behind the snapshot assertion macros.
+ */
+void _fossil_snapshot_check(xassert_type_t behavior, const char *name, const void *data, size_t size,
+                            const char *file, int line, const char *func);
+
+/**
+ * @brief Macro to check output against the golden file called name.
+ *
+ * @param behavior The assertion class.
+ * @param name The snapshot name, a string.
+ * @param data The output.
+ * @param size The length of the output in bytes.
+ */
+#define _FOSSIL_SNAPSHOT(behavior, name, data, size) \
+    _fossil_snapshot_check(behavior, (name), (const void *)(data), (size_t)(size), __FILE__, __LINE__, __func__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,125 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_TABLE_H
+#define FOSSIL_TEST_TABLE_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Structure walking the rows of a table one at a time. Data files are mapped
+ * read-only where the platform allows it so only the pages holding the rows
+ * being run are ever read.
+ */
+typedef struct {
+    const fossil_test_table_t *table; /**< The table being walked. */
+    const char *base;                 /**< Start of the inline array or file contents. */
+    size_t size;                      /**< Bytes available at base. */
+    size_t position;                  /**< Offset of the next row. */
+    size_t index;                     /**< Number of the next row. */
+    bool mapped;                      /**< base is a file mapping to unmap on close. */
+    bool owned;                       /**< base is a heap copy to free on close. */
+    void *directory;                  /**< Open listing of a corpus directory. */
+    bool listed;                      /**< The corpus listing has been read to the end. */
+} fossil_test_table_cursor_t;
+
+/**
+ * Function to start walking the rows of a table.
+ * 
+ * @param table The table of a parameterized test case.
+ * @param cursor The cursor to initialize.
+ * @return true on success, false if the data file cannot be opened.
+ */
+bool fossil_test_table_open(const fossil_test_table_t *table, fossil_test_table_cursor_t *cursor);
+
+/**
+ * Function to fetch the next row. CSV tables skip blank lines and lines
+ * starting with '#', and drop the line ending. A corpus yields one row per
+ * file, skipping hidden files, and a single empty row when the directory is
+ * missing or empty.
+ * 
+ * @param cursor The cursor.
+ * @param row Receives the row.
+ * @return true if a row was fetched, false at the end of the table.
+ */
+bool fossil_test_table_next(fossil_test_table_cursor_t *cursor, fossil_test_row_t *row);
+
+/**
+ * Function to release the data file behind a cursor.
+ * 
+ * @param cursor The cursor.
+ */
+void fossil_test_table_close(fossil_test_table_cursor_t *cursor);
+
+/**
+ * Function to find a column of a CSV row. Fields are split on demand, a field
+ * in double quotes may hold commas and doubled quotes.
+ * 
+ * @param row The CSV row.
+ * @param column The zero-based column.
+ * @param field Receives the start of the field without its quotes, NULL if the row is shorter.
+ * @return The length of the field.
+ */
+size_t fossil_test_row_field(const fossil_test_row_t *row, size_t column, const char **field);
+
+/**
+ * Function to copy a column of a CSV row into a NUL-terminated buffer,
+ * collapsing doubled quotes.
+ * 
+ * @param row The CSV row.
+ * @param column The zero-based column.
+ * @param buffer The destination.
+ * @param capacity The size of the destination.
+ * @return true if the whole field fit, false if it is missing or was truncated.
+ */
+bool fossil_test_row_copy(const fossil_test_row_t *row, size_t column, char *buffer, size_t capacity);
+
+/**
+ * Function to read a column of a CSV row as an integer, written the way C
+ * literals are (decimal, 0x hexadecimal or 0 octal).
+ * 
+ * @param row The CSV row.
+ * @param column The zero-based column.
+ * @return The value, 0 if the column is missing.
+ */
+int64_t fossil_test_row_i64(const fossil_test_row_t *row, size_t column);
+
+/**
+ * Function to read a column of a CSV row as a floating point number.
+ * 
+ * @param row The CSV row.
+ * @param column The zero-based column.
+ * @return The value, 0 if the column is missing.
+ */
+double fossil_test_row_f64(const fossil_test_row_t *row, size_t column);
+
+/**
+ * Function to compare a column of a CSV row with a string.
+ * 
+ * @param row The CSV row.
+ * @param column The zero-based column.
+ * @param text The expected contents.
+ * @return true if the column exists and matches exactly.
+ */
+bool fossil_test_row_equal(const fossil_test_row_t *row, size_t column, const char *text);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
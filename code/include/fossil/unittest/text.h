@@ -0,0 +1,186 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_TEXT_H
+#define FOSSIL_TEST_TEXT_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+#include <wchar.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * String equality with diffs
+ *
+ * Strings are compared by length first and then with the vector byte
+ * kernels, so equal documents of any size cost about one pass over memory.
+ * On failure the lines around the divergence are diffed with Myers'
+ * algorithm and printed as a unified diff, with the expected text as the
+ * old side. The diff gives up after FOSSIL_TEST_DIFF_EDITS line edits, or
+ * FOSSIL_TEST_DIFF_LINES lines on either side, and prints the changed
+ * region as a whole instead.
+ */
+
+#define FOSSIL_TEST_DIFF_EDITS 512
+#define FOSSIL_TEST_DIFF_LINES 4000
+#define FOSSIL_TEST_DIFF_CONTEXT 3
+#define FOSSIL_TEST_DIFF_OUTPUT 64    // most diff lines printed
+#define FOSSIL_TEST_DIFF_WIDTH 160    // longest line printed before it is cut
+
+/**
+ * Function to find the first byte where two texts differ.
+ *
+ * @return The offset of the first difference, the shorter length when one
+ *         text starts with the other.
+ */
+size_t fossil_test_text_mismatch(const char *actual, size_t actual_length, const char *expected, size_t expected_length);
+
+/**
+ * Function to write a unified diff of two texts.
+ *
+ * @param actual The text under test, the new side.
+ * @param expected The reference text, the old side.
+ * @param out The destination, always NUL-terminated.
+ * @param capacity The size of the destination.
+ * @return The number of characters written.
+ */
+size_t fossil_test_text_diff(const char *actual, size_t actual_length, const char *expected, size_t expected_length,
+                             char *out, size_t capacity);
+
+/**
+ * Internal functions behind the string equality macros.
+ */
+void _fossil_test_text_equal(xassert_type_t behavior, const char *actual, size_t actual_length, const char *expected, size_t expected_length,
+                             const char *names, const char *file, int line, const char *func);
+void _fossil_test_cstr_equal(xassert_type_t behavior, const char *actual, const char *expected,
+                             const char *names, const char *file, int line, const char *func);
+void _fossil_test_wstr_equal(xassert_type_t behavior, const wchar_t *actual, const wchar_t *expected,
+                             const char *names, const char *file, int line, const char *func);
+
+/**
+ * @brief Macro to check that two NUL-terminated strings are equal.
+ */
+#define _FOSSIL_TEST_CSTR_EQUAL(behavior, actual, expected, names) \
+    _fossil_test_cstr_equal(behavior, (const char *)(actual), (const char *)(expected), names, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that two wide strings are equal.
+ */
+#define _FOSSIL_TEST_WSTR_EQUAL(behavior, actual, expected, names) \
+    _fossil_test_wstr_equal(behavior, (actual), (expected), names, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that two texts of known length are equal, they may
+ *        hold NUL bytes.
+ */
+#define _FOSSIL_TEST_TEXT_EQUAL(behavior, actual, actual_length, expected, expected_length) \
+    _fossil_test_text_equal(behavior, (const char *)(actual), (size_t)(actual_length), (const char *)(expected), (size_t)(expected_length), \
+                            "text " #actual " to be equal to " #expected, __FILE__, __LINE__, __func__)
+
+/**
+ * Substring and pattern checks
+ *
+ * Substrings are found with the vector byte search, which tests the first
+ * and last byte of the needle across a whole block before comparing the
+ * rest, so scanning a large captured log costs about one pass over memory.
+ * Patterns are POSIX extended regular expressions where '^' and '$' anchor
+ * at line boundaries. Every pattern assertion keeps the compiled pattern in
+ * a static slot of its own, so a check inside a loop compiles it once.
+ * Without <regex.h> a pattern is searched for as plain text.
+ */
+
+/**
+ * Structure holding the compiled pattern of one assertion call site.
+ */
+typedef struct {
+    volatile uint64_t state;   /**< Empty, compiling or ready. */
+    char *pattern;             /**< The pattern the slot was compiled from. */
+    void *compiled;            /**< The compiled pattern, xnull when it did not compile. */
+    char error[128];           /**< Why the pattern did not compile. */
+} fossil_test_pattern_t;
+
+#define FOSSIL_TEST_TEXT_ANY ((size_t)-1)   // any number of occurrences but zero
+
+/**
+ * Function to find the first occurrence of a needle in a text.
+ *
+ * @return The offset of the occurrence, length if there is none.
+ */
+size_t fossil_test_text_find(const char *text, size_t length, const char *needle, size_t needle_length);
+
+/**
+ * Function to count the occurrences of a needle in a text that do not
+ * overlap, an empty needle is never counted.
+ */
+size_t fossil_test_text_count(const char *text, size_t length, const char *needle, size_t needle_length);
+
+/**
+ * Function to find the first match of a pattern in a NUL-terminated text.
+ *
+ * @param slot The cache of the call site, xnull to compile every time.
+ * @param pattern The regular expression.
+ * @param text The text to search.
+ * @param offset Receives the offset of the match, may be xnull.
+ * @return true if the pattern compiled and matched.
+ */
+bool fossil_test_pattern_find(fossil_test_pattern_t *slot, const char *pattern, const char *text, size_t *offset);
+
+/**
+ * Function to count the matches of a pattern in a NUL-terminated text that
+ * do not overlap, or zero if the pattern does not compile.
+ */
+size_t fossil_test_pattern_count(fossil_test_pattern_t *slot, const char *pattern, const char *text);
+
+/**
+ * Internal functions behind the substring and pattern macros. Wanted tells
+ * whether the needle must be present or absent, count is the number of
+ * occurrences required, or FOSSIL_TEST_TEXT_ANY for at least one.
+ */
+void _fossil_test_text_contains(xassert_type_t behavior, const char *text, const char *needle, bool wanted, size_t count,
+                                const char *names, const char *file, int line, const char *func);
+void _fossil_test_text_affix(xassert_type_t behavior, const char *text, const char *affix, bool at_end,
+                             const char *names, const char *file, int line, const char *func);
+void _fossil_test_text_matches(xassert_type_t behavior, fossil_test_pattern_t *slot, const char *text, const char *pattern, bool wanted,
+                               size_t count, const char *names, const char *file, int line, const char *func);
+
+/**
+ * @brief Macro to check whether a string holds a needle, and how often.
+ */
+#define _FOSSIL_TEST_CONTAINS(behavior, text, needle, wanted, count, names) \
+    _fossil_test_text_contains(behavior, (const char *)(text), (const char *)(needle), wanted, count, names, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that a string starts or ends with an affix.
+ */
+#define _FOSSIL_TEST_AFFIX(behavior, text, affix, at_end, names) \
+    _fossil_test_text_affix(behavior, (const char *)(text), (const char *)(affix), at_end, names, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check a string against a regular expression, compiled
+ *        once for the call site.
+ */
+#define _FOSSIL_TEST_MATCHES(behavior, text, pattern, wanted, count, names) \
+    do { \
+        static fossil_test_pattern_t _fossil_test_pattern_slot; \
+        _fossil_test_text_matches(behavior, &_fossil_test_pattern_slot, (const char *)(text), (pattern), wanted, count, \
+                                  names, __FILE__, __LINE__, __func__); \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
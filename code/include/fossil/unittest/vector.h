@@ -0,0 +1,395 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_VECTOR_H
+#define FOSSIL_TEST_VECTOR_H
+
+#include "fossil/_common/common.h"
+#include "internal.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Bulk array assertions
+ *
+ * Whole arrays are checked in one call by kernels that use AVX2, SSE2 or
+ * NEON where the build and the processor have them and plain C otherwise.
+ * A failure reports the first offending index, its values and a few
+ * elements around it, a pass counts as a single assertion.
+ *
+ * Raw buffers are compared the same way, a failure prints a hexdump of the
+ * differing region only. Buffers of FOSSIL_TEST_MEMORY_PARALLEL bytes or more
+ * are compared on every core.
+ */
+
+#define FOSSIL_TEST_MEMORY_PARALLEL (64u << 20)
+
+/**
+ * Enumeration of the element types the array assertions understand.
+ */
+typedef enum {
+    FOSSIL_TEST_ARRAY_I8,
+    FOSSIL_TEST_ARRAY_I16,
+    FOSSIL_TEST_ARRAY_I32,
+    FOSSIL_TEST_ARRAY_I64,
+    FOSSIL_TEST_ARRAY_U8,
+    FOSSIL_TEST_ARRAY_U16,
+    FOSSIL_TEST_ARRAY_U32,
+    FOSSIL_TEST_ARRAY_U64,
+    FOSSIL_TEST_ARRAY_F32,
+    FOSSIL_TEST_ARRAY_F64
+} fossil_test_array_type_t;
+
+/**
+ * A bound of a range check, read through the member matching the element type.
+ */
+typedef union {
+    int64_t i;
+    uint64_t u;
+    double f;
+} fossil_test_scalar_t;
+
+/**
+ * Function to find the first element that differs between two arrays.
+ * Integers must match exactly, floats may differ by up to the tolerance and
+ * NaN never matches.
+ *
+ * @param type The element type.
+ * @param actual The array under test.
+ * @param expected The reference array.
+ * @param count The number of elements.
+ * @param tolerance The largest accepted difference of float elements.
+ * @return The index of the first mismatch, count if there is none.
+ */
+size_t fossil_test_array_mismatch(fossil_test_array_type_t type, const void *actual, const void *expected, size_t count, double tolerance);
+
+/**
+ * Function to find the first element smaller than the one before it.
+ *
+ * @return The index of the first element out of order, count if the array
+ *         is in non-decreasing order. NaN is out of order.
+ */
+size_t fossil_test_array_unsorted(fossil_test_array_type_t type, const void *data, size_t count);
+
+/**
+ * Function to find the first element outside [min, max].
+ *
+ * @return The index of the first element out of range, count if there is none.
+ */
+size_t fossil_test_array_outside(fossil_test_array_type_t type, const void *data, size_t count, fossil_test_scalar_t min, fossil_test_scalar_t max);
+
+/**
+ * Function to find the first byte that differs between two buffers. Buffers
+ * of FOSSIL_TEST_MEMORY_PARALLEL bytes or more are split across threads.
+ *
+ * @param actual The buffer under test.
+ * @param expected The reference buffer.
+ * @param size The number of bytes.
+ * @return The offset of the first difference, size if there is none.
+ */
+size_t fossil_test_memory_mismatch(const void *actual, const void *expected, size_t size);
+
+/**
+ * Function to find the first byte of a buffer that breaks a repeating pattern.
+ *
+ * @param data The buffer under test.
+ * @param size The number of bytes.
+ * @param pattern The bytes the buffer should repeat from its start.
+ * @param pattern_size The length of the pattern, at least one.
+ * @return The offset of the first difference, size if there is none.
+ */
+size_t fossil_test_memory_unlike(const void *data, size_t size, const void *pattern, size_t pattern_size);
+
+/**
+ * Function to find the first occurrence of a byte string in a buffer.
+ *
+ * @param data The buffer to search.
+ * @param size The number of bytes.
+ * @param needle The bytes to look for.
+ * @param needle_size The length of the needle, an empty needle is found at 0.
+ * @return The offset of the first occurrence, size if there is none.
+ */
+size_t fossil_test_memory_find(const void *data, size_t size, const void *needle, size_t needle_size);
+
+/**
+ * Enumeration of the ways floating point elements may differ.
+ */
+typedef enum {
+    FOSSIL_TEST_TOLERANCE_ULP,     /**< At most ulps representable values apart. */
+    FOSSIL_TEST_TOLERANCE_CLOSE    /**< |actual - expected| <= absolute + relative * |expected|. */
+} fossil_test_tolerance_kind_t;
+
+/**
+ * Structure describing the accepted difference of floating point elements.
+ */
+typedef struct {
+    fossil_test_tolerance_kind_t kind;
+    uint64_t ulps;
+    double relative;
+    double absolute;
+} fossil_test_tolerance_t;
+
+/**
+ * Structure summing up how far a floating point array or matrix is from its
+ * reference. Errors are in ULPs for FOSSIL_TEST_TOLERANCE_ULP and absolute
+ * differences otherwise, NaN counts as an infinite error. The mean counts
+ * at most 2^56 ULPs per element.
+ */
+typedef struct {
+    size_t count;          /**< Elements compared. */
+    size_t failures;       /**< Elements outside the tolerance. */
+    size_t worst_row;      /**< Row of the element with the largest error. */
+    size_t worst_column;   /**< Column of the element with the largest error. */
+    double max_error;      /**< Largest error. */
+    double mean_error;     /**< Mean error over all elements. */
+} fossil_test_float_error_t;
+
+/**
+ * Function to measure a float matrix against its reference.
+ *
+ * @param type FOSSIL_TEST_ARRAY_F32 or FOSSIL_TEST_ARRAY_F64.
+ * @param actual The matrix under test.
+ * @param actual_stride Elements from the start of one actual row to the next.
+ * @param expected The reference matrix.
+ * @param expected_stride Elements from the start of one expected row to the next.
+ * @param rows The number of rows, one for a plain array.
+ * @param columns The number of elements per row.
+ * @param tolerance The accepted difference.
+ * @param error Receives the summary.
+ */
+void fossil_test_float_measure(fossil_test_array_type_t type, const void *actual, size_t actual_stride,
+                               const void *expected, size_t expected_stride, size_t rows, size_t columns,
+                               const fossil_test_tolerance_t *tolerance, fossil_test_float_error_t *error);
+
+/**
+ * Statistical checks
+ *
+ * Samples of any element type are read in blocks of 64 that are widened to
+ * double. The mean and variance come from a single pass: each block is
+ * summed and its squared deviations taken with the vector kernels while it
+ * is still in cache, and the blocks are merged with Chan's update, which
+ * keeps the variance accurate for large samples with a large mean.
+ * Percentiles are selected in linear time from a copy, and two samples are
+ * compared with the two-sample Kolmogorov-Smirnov test.
+ */
+
+/**
+ * Structure holding the moments of a sample.
+ */
+typedef struct {
+    size_t count;
+    double mean;
+    double variance;   /**< Sample variance, divided by count - 1. */
+    double min;
+    double max;
+} fossil_test_moments_t;
+
+/**
+ * Function to compute the moments of a sample in one pass.
+ */
+void fossil_test_array_moments(fossil_test_array_type_t type, const void *data, size_t count, fossil_test_moments_t *moments);
+
+/**
+ * Function to find a percentile of a sample, interpolating linearly between
+ * the two nearest ranks.
+ *
+ * @param percentile A value in [0, 100], 50 for the median.
+ * @return The percentile, NaN for an empty sample or one holding NaN.
+ */
+double fossil_test_array_percentile(fossil_test_array_type_t type, const void *data, size_t count, double percentile);
+
+/**
+ * Function to compare two samples with the two-sample Kolmogorov-Smirnov test.
+ *
+ * @param p_value Receives the asymptotic probability of a distance this large
+ *        if both samples come from one distribution, may be xnull.
+ * @return The largest distance between the two empirical distributions, NaN
+ *         when a sample is empty or holds NaN.
+ */
+double fossil_test_array_ks(fossil_test_array_type_t type, const void *a, size_t a_count, const void *b, size_t b_count, double *p_value);
+
+/**
+ * Internal functions behind the array assertion macros, they score the check
+ * and describe the first offending element on failure.
+ */
+void _fossil_test_array_equal(xassert_type_t behavior, fossil_test_array_type_t type, const void *actual, const void *expected,
+                              size_t count, double tolerance, const char *names, const char *file, int line, const char *func);
+void _fossil_test_array_sorted(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count,
+                               const char *names, const char *file, int line, const char *func);
+void _fossil_test_array_within(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count,
+                               fossil_test_scalar_t min, fossil_test_scalar_t max, const char *names, const char *file, int line, const char *func);
+void _fossil_test_float_check(xassert_type_t behavior, fossil_test_array_type_t type, const void *actual, size_t actual_stride,
+                              const void *expected, size_t expected_stride, size_t rows, size_t columns,
+                              fossil_test_tolerance_t tolerance, const char *names, const char *file, int line, const char *func);
+void _fossil_test_stat_mean(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double min, double max,
+                            const char *names, const char *file, int line, const char *func);
+void _fossil_test_stat_stddev(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double limit,
+                              const char *names, const char *file, int line, const char *func);
+void _fossil_test_stat_percentile(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double percentile,
+                                  double limit, const char *names, const char *file, int line, const char *func);
+void _fossil_test_stat_same(xassert_type_t behavior, fossil_test_array_type_t type, const void *a, size_t a_count, const void *b, size_t b_count,
+                            double alpha, const char *names, const char *file, int line, const char *func);
+void _fossil_test_memory_equal(xassert_type_t behavior, const void *actual, const void *expected, size_t size,
+                               const char *names, const char *file, int line, const char *func);
+void _fossil_test_memory_pattern(xassert_type_t behavior, const void *data, size_t size, const void *pattern, size_t pattern_size,
+                                 const char *names, const char *file, int line, const char *func);
+
+static inline fossil_test_tolerance_t _fossil_test_tolerance_ulp(uint64_t ulps) {
+    fossil_test_tolerance_t tolerance = { FOSSIL_TEST_TOLERANCE_ULP, ulps, 0.0, 0.0 };
+    return tolerance;
+}
+
+static inline fossil_test_tolerance_t _fossil_test_tolerance_close(double relative, double absolute) {
+    fossil_test_tolerance_t tolerance = { FOSSIL_TEST_TOLERANCE_CLOSE, 0, relative, absolute };
+    return tolerance;
+}
+
+// Typed identities so passing the wrong kind of array is a compile time warning.
+#define _FOSSIL_TEST_ARRAY_TYPE(tag, type, member, wide) \
+    static inline const void* _fossil_test_array_of_##tag(const type *data) { \
+        return (const void *)data; \
+    } \
+    static inline fossil_test_scalar_t _fossil_test_scalar_of_##tag(wide value) { \
+        fossil_test_scalar_t scalar; \
+        scalar.member = value; \
+        return scalar; \
+    }
+
+_FOSSIL_TEST_ARRAY_TYPE(I8, int8_t, i, int64_t)
+_FOSSIL_TEST_ARRAY_TYPE(I16, int16_t, i, int64_t)
+_FOSSIL_TEST_ARRAY_TYPE(I32, int32_t, i, int64_t)
+_FOSSIL_TEST_ARRAY_TYPE(I64, int64_t, i, int64_t)
+_FOSSIL_TEST_ARRAY_TYPE(U8, uint8_t, u, uint64_t)
+_FOSSIL_TEST_ARRAY_TYPE(U16, uint16_t, u, uint64_t)
+_FOSSIL_TEST_ARRAY_TYPE(U32, uint32_t, u, uint64_t)
+_FOSSIL_TEST_ARRAY_TYPE(U64, uint64_t, u, uint64_t)
+_FOSSIL_TEST_ARRAY_TYPE(F32, float, f, double)
+_FOSSIL_TEST_ARRAY_TYPE(F64, double, f, double)
+
+/**
+ * @brief Macro to check two arrays element by element.
+ *
+ * @param behavior The assertion class.
+ * @param tag The element type, I8 through U64, F32 or F64.
+ * @param actual The array under test.
+ * @param expected The reference array.
+ * @param count The number of elements.
+ * @param tolerance The largest accepted difference of float elements.
+ */
+#define _FOSSIL_TEST_ARRAY_EQUAL(behavior, tag, actual, expected, count, tolerance) \
+    _fossil_test_array_equal(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(actual), \
+                             _fossil_test_array_of_##tag(expected), (size_t)(count), (double)(tolerance), \
+                             #actual " to equal " #expected, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that an array is in non-decreasing order.
+ */
+#define _FOSSIL_TEST_ARRAY_SORTED(behavior, tag, data, count) \
+    _fossil_test_array_sorted(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(data), (size_t)(count), \
+                              #data " to be sorted", __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that every element of an array lies in [min, max].
+ */
+#define _FOSSIL_TEST_ARRAY_WITHIN(behavior, tag, data, count, min, max) \
+    _fossil_test_array_within(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(data), (size_t)(count), \
+                              _fossil_test_scalar_of_##tag(min), _fossil_test_scalar_of_##tag(max), \
+                              #data " to be within " #min " and " #max, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that a float matrix is within a number of ULPs of its reference.
+ *
+ * @param behavior The assertion class.
+ * @param tag F32 or F64.
+ * @param actual The matrix under test and its row stride in elements.
+ * @param expected The reference matrix and its row stride in elements.
+ * @param rows The number of rows.
+ * @param columns The number of elements per row.
+ * @param ulps The largest accepted distance.
+ */
+#define _FOSSIL_TEST_MATRIX_ULP(behavior, tag, actual, actual_stride, expected, expected_stride, rows, columns, ulps) \
+    _fossil_test_float_check(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(actual), (size_t)(actual_stride), \
+                             _fossil_test_array_of_##tag(expected), (size_t)(expected_stride), (size_t)(rows), (size_t)(columns), \
+                             _fossil_test_tolerance_ulp(ulps), #actual " to be within " #ulps " ULP of " #expected, \
+                             __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that a float matrix is close to its reference, each
+ *        element within absolute + relative * |expected|.
+ */
+#define _FOSSIL_TEST_MATRIX_CLOSE(behavior, tag, actual, actual_stride, expected, expected_stride, rows, columns, relative, absolute) \
+    _fossil_test_float_check(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(actual), (size_t)(actual_stride), \
+                             _fossil_test_array_of_##tag(expected), (size_t)(expected_stride), (size_t)(rows), (size_t)(columns), \
+                             _fossil_test_tolerance_close(relative, absolute), \
+                             #actual " to be close to " #expected " (relative " #relative ", absolute " #absolute ")", \
+                             __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that the mean of a sample lies in [min, max].
+ */
+#define _FOSSIL_TEST_STAT_MEAN(behavior, tag, data, count, min, max) \
+    _fossil_test_stat_mean(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(data), (size_t)(count), \
+                           (double)(min), (double)(max), "mean of " #data " to be within " #min " and " #max, \
+                           __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that the standard deviation of a sample is below limit.
+ */
+#define _FOSSIL_TEST_STAT_STDDEV(behavior, tag, data, count, limit) \
+    _fossil_test_stat_stddev(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(data), (size_t)(count), \
+                             (double)(limit), "standard deviation of " #data " to be below " #limit, \
+                             __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that a percentile of a sample is below limit.
+ */
+#define _FOSSIL_TEST_STAT_PERCENTILE(behavior, tag, data, count, percentile, limit) \
+    _fossil_test_stat_percentile(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(data), (size_t)(count), \
+                                 (double)(percentile), (double)(limit), "percentile " #percentile " of " #data " to be below " #limit, \
+                                 __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that two samples could come from one distribution,
+ *        failing when the Kolmogorov-Smirnov p-value is below alpha.
+ */
+#define _FOSSIL_TEST_STAT_SAME(behavior, tag, a, a_count, b, b_count, alpha) \
+    _fossil_test_stat_same(behavior, FOSSIL_TEST_ARRAY_##tag, _fossil_test_array_of_##tag(a), (size_t)(a_count), \
+                           _fossil_test_array_of_##tag(b), (size_t)(b_count), (double)(alpha), \
+                           #a " and " #b " to share a distribution at alpha " #alpha, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that two buffers hold the same bytes.
+ */
+#define _FOSSIL_TEST_MEM_EQUAL(behavior, actual, expected, size) \
+    _fossil_test_memory_equal(behavior, (actual), (expected), (size_t)(size), \
+                              #actual " to equal " #expected, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Macro to check that a buffer repeats a pattern, zero filled when the
+ *        pattern is a single zero byte.
+ */
+#define _FOSSIL_TEST_MEM_PATTERN(behavior, data, size, pattern, pattern_size) \
+    _fossil_test_memory_pattern(behavior, (data), (size_t)(size), (pattern), (size_t)(pattern_size), \
+                                #data " to repeat " #pattern, __FILE__, __LINE__, __func__)
+
+#define _FOSSIL_TEST_MEM_ZERO(behavior, data, size) \
+    _fossil_test_memory_pattern(behavior, (data), (size_t)(size), "", 1, \
+                                #data " to be zero filled", __FILE__, __LINE__, __func__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
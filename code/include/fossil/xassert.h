@@ -25,6 +25,7 @@ extern "C"
 #include "xassert/string.h"
 #include "xassert/letter.h"
 #include "xassert/within.h"
+#include "xassert/array.h"
 
 #ifdef __cplusplus
 }
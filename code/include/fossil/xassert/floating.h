@@ -24,65 +24,65 @@ extern "C"
 
 // Double equality check with tolerance
 #define ASSERT_ITS_EQUAL_F64(actual, expected, tol) \
-    TEST_ASSERT(fabs((actual) - (expected)) <= (tol), "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
+    TEST_ASSERT_NEAR(double, actual, expected, tol, <=, "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
 
 #define ASSERT_ITS_LESS_THAN_F64(actual, expected) \
-    TEST_ASSERT((actual) < (expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 #define ASSERT_ITS_MORE_THAN_F64(actual, expected) \
-    TEST_ASSERT((actual) > (expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 #define ASSERT_ITS_LESS_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSERT((actual) <= (expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 #define ASSERT_ITS_MORE_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSERT((actual) >= (expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 #define ASSERT_NOT_EQUAL_F64(actual, expected, tol) \
-    TEST_ASSERT(fabs((actual) - (expected)) > (tol), "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
+    TEST_ASSERT_NEAR(double, actual, expected, tol, >, "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
 
 #define ASSERT_NOT_LESS_THAN_F64(actual, expected) \
-    TEST_ASSERT((actual) >= (expected), "Expected " #actual " to not be less than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, >=, expected, "Expected " #actual " to not be less than " #expected)
 
 #define ASSERT_NOT_MORE_THAN_F64(actual, expected) \
-    TEST_ASSERT((actual) <= (expected), "Expected " #actual " to not be more than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, <=, expected, "Expected " #actual " to not be more than " #expected)
 
 #define ASSERT_NOT_LESS_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSERT((actual) > (expected), "Expected " #actual " to not be less than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, >, expected, "Expected " #actual " to not be less than or equal to " #expected)
 
 #define ASSERT_NOT_MORE_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSERT((actual) < (expected), "Expected " #actual " to not be more than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(double, actual, <, expected, "Expected " #actual " to not be more than or equal to " #expected)
 
 // Float equality check with tolerance
 #define ASSERT_ITS_EQUAL_F32(actual, expected, tol) \
-    TEST_ASSERT(fabsf((actual) - (expected)) <= (tol), "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
+    TEST_ASSERT_NEAR(float, actual, expected, tol, <=, "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
 
 #define ASSERT_ITS_LESS_THAN_F32(actual, expected) \
-    TEST_ASSERT((actual) < (expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 #define ASSERT_ITS_MORE_THAN_F32(actual, expected) \
-    TEST_ASSERT((actual) > (expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 #define ASSERT_ITS_LESS_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSERT((actual) <= (expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 #define ASSERT_ITS_MORE_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSERT((actual) >= (expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 #define ASSERT_NOT_EQUAL_F32(actual, expected, tol) \
-    TEST_ASSERT(fabsf((actual) - (expected)) > (tol), "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
+    TEST_ASSERT_NEAR(float, actual, expected, tol, >, "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
 
 #define ASSERT_NOT_LESS_THAN_F32(actual, expected) \
-    TEST_ASSERT((actual) >= (expected), "Expected " #actual " to not be less than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, >=, expected, "Expected " #actual " to not be less than " #expected)
 
 #define ASSERT_NOT_MORE_THAN_F32(actual, expected) \
-    TEST_ASSERT((actual) <= (expected), "Expected " #actual " to not be more than " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, <=, expected, "Expected " #actual " to not be more than " #expected)
 
 #define ASSERT_NOT_LESS_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSERT((actual) > (expected), "Expected " #actual " to not be less than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, >, expected, "Expected " #actual " to not be less than or equal to " #expected)
 
 #define ASSERT_NOT_MORE_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSERT((actual) < (expected), "Expected " #actual " to not be more than or equal to " #expected)
+    TEST_ASSERT_COMPARE_FLOAT(float, actual, <, expected, "Expected " #actual " to not be more than or equal to " #expected)
 
 // Float NaN and Infinity checks
 #define ASSERT_ITS_NAN_F32(actual) \
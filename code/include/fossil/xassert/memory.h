@@ -43,27 +43,42 @@ extern "C"
 
 // Equal
 #define ASSERT_ITS_EQUAL_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) == (size_t)(expected), "Expected " #actual " to be equal to " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, ==, expected, "Expected " #actual " to be equal to " #expected)
 
 // Less than
 #define ASSERT_ITS_LESS_THAN_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) < (size_t)(expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 // More than
 #define ASSERT_ITS_MORE_THAN_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) > (size_t)(expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 // Less or equal
 #define ASSERT_ITS_LESS_OR_EQUAL_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) <= (size_t)(expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 // More or equal
 #define ASSERT_ITS_MORE_OR_EQUAL_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) >= (size_t)(expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 // Not equal
 #define ASSERT_NOT_EQUAL_SIZE(actual, expected) \
-    TEST_ASSERT((size_t)(actual) != (size_t)(expected), "Expected " #actual " to not be equal to " #expected)
+    TEST_ASSERT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, !=, expected, "Expected " #actual " to not be equal to " #expected)
+
+// Buffer content assertions, a failure hexdumps the differing region
+
+#define ASSERT_MEM_EQUAL(actual, expected, len) \
+    _FOSSIL_TEST_MEM_EQUAL(TEST_ASSERT_AS_CLASS_ASSERT, actual, expected, len)
+
+#define ASSERT_MEM_ZERO(data, len) \
+    _FOSSIL_TEST_MEM_ZERO(TEST_ASSERT_AS_CLASS_ASSERT, data, len)
+
+#define ASSERT_MEM_PATTERN(data, len, pattern, pattern_len) \
+    _FOSSIL_TEST_MEM_PATTERN(TEST_ASSERT_AS_CLASS_ASSERT, data, len, pattern, pattern_len)
+
+// Output against the golden file name under the snapshot directory
+#define ASSERT_SNAPSHOT(name, data, len) \
+    _FOSSIL_SNAPSHOT(TEST_ASSERT_AS_CLASS_ASSERT, name, data, len)
 
 #ifdef __cplusplus
 }
@@ -25,6 +25,7 @@ extern "C"
 #include "xassume/string.h"
 #include "xassume/letter.h"
 #include "xassume/within.h"
+#include "xassume/array.h"
 
 #ifdef __cplusplus
 }
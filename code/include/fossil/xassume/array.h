@@ -0,0 +1,150 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FOSSIL_TEST_ASSUME_ARRAY_TYPE_H
+#define FOSSIL_TEST_ASSUME_ARRAY_TYPE_H
+
+#include <fossil/unittest.h> // using assurt rules from Fossil Test
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Whole array assertions, the first offending element and its neighbours are
+// reported on failure
+
+#define ASSUME_ARRAY_EQUAL_I8(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, I8, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_I8(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, I8, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_I8(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, I8, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_I16(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, I16, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_I16(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, I16, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_I16(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, I16, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_I32(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, I32, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_I32(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, I32, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_I32(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, I32, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_I64(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, I64, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_I64(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, I64, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_I64(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, I64, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_U8(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, U8, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_U8(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, U8, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_U8(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, U8, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_U16(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, U16, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_U16(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, U16, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_U16(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, U16, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_U32(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, U32, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_U32(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, U32, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_U32(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, U32, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_U64(actual, expected, count) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, U64, actual, expected, count, 0)
+
+#define ASSUME_ARRAY_SORTED_U64(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, U64, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_U64(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, U64, data, count, min, max)
+
+// Floating point arrays match when every pair differs by at most tol, NaN never matches
+
+#define ASSUME_ARRAY_EQUAL_F32(actual, expected, count, tol) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, F32, actual, expected, count, tol)
+
+#define ASSUME_ARRAY_SORTED_F32(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, F32, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_F32(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, F32, data, count, min, max)
+
+#define ASSUME_ARRAY_EQUAL_F64(actual, expected, count, tol) \
+    _FOSSIL_TEST_ARRAY_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, F64, actual, expected, count, tol)
+
+#define ASSUME_ARRAY_SORTED_F64(data, count) \
+    _FOSSIL_TEST_ARRAY_SORTED(TEST_ASSERT_AS_CLASS_ASSUME, F64, data, count)
+
+#define ASSUME_ARRAY_WITHIN_RANGE_F64(data, count, min, max) \
+    _FOSSIL_TEST_ARRAY_WITHIN(TEST_ASSERT_AS_CLASS_ASSUME, F64, data, count, min, max)
+
+// Floating point arrays and row strided matrices measured in ULPs, or against
+// absolute + relative * |expected|, the failure reports the worst element and
+// the max and mean error
+
+#define ASSUME_ARRAY_ULP_F32(actual, expected, count, ulps) \
+    _FOSSIL_TEST_MATRIX_ULP(TEST_ASSERT_AS_CLASS_ASSUME, F32, actual, 0, expected, 0, 1, count, ulps)
+
+#define ASSUME_ARRAY_CLOSE_F32(actual, expected, count, relative, absolute) \
+    _FOSSIL_TEST_MATRIX_CLOSE(TEST_ASSERT_AS_CLASS_ASSUME, F32, actual, 0, expected, 0, 1, count, relative, absolute)
+
+#define ASSUME_MATRIX_ULP_F32(actual, actual_stride, expected, expected_stride, rows, columns, ulps) \
+    _FOSSIL_TEST_MATRIX_ULP(TEST_ASSERT_AS_CLASS_ASSUME, F32, actual, actual_stride, expected, expected_stride, rows, columns, ulps)
+
+#define ASSUME_MATRIX_CLOSE_F32(actual, actual_stride, expected, expected_stride, rows, columns, relative, absolute) \
+    _FOSSIL_TEST_MATRIX_CLOSE(TEST_ASSERT_AS_CLASS_ASSUME, F32, actual, actual_stride, expected, expected_stride, rows, columns, relative, absolute)
+
+#define ASSUME_ARRAY_ULP_F64(actual, expected, count, ulps) \
+    _FOSSIL_TEST_MATRIX_ULP(TEST_ASSERT_AS_CLASS_ASSUME, F64, actual, 0, expected, 0, 1, count, ulps)
+
+#define ASSUME_ARRAY_CLOSE_F64(actual, expected, count, relative, absolute) \
+    _FOSSIL_TEST_MATRIX_CLOSE(TEST_ASSERT_AS_CLASS_ASSUME, F64, actual, 0, expected, 0, 1, count, relative, absolute)
+
+#define ASSUME_MATRIX_ULP_F64(actual, actual_stride, expected, expected_stride, rows, columns, ulps) \
+    _FOSSIL_TEST_MATRIX_ULP(TEST_ASSERT_AS_CLASS_ASSUME, F64, actual, actual_stride, expected, expected_stride, rows, columns, ulps)
+
+#define ASSUME_MATRIX_CLOSE_F64(actual, actual_stride, expected, expected_stride, rows, columns, relative, absolute) \
+    _FOSSIL_TEST_MATRIX_CLOSE(TEST_ASSERT_AS_CLASS_ASSUME, F64, actual, actual_stride, expected, expected_stride, rows, columns, relative, absolute)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
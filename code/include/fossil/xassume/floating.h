@@ -24,65 +24,65 @@ extern "C"
 
 // Double equality check with tolerance
 #define ASSUME_ITS_EQUAL_F64(actual, expected, tol) \
-    TEST_ASSUME(fabs((actual) - (expected)) <= (tol), "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
+    TEST_ASSUME_NEAR(double, actual, expected, tol, <=, "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
 
 #define ASSUME_ITS_LESS_THAN_F64(actual, expected) \
-    TEST_ASSUME((actual) < (expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 #define ASSUME_ITS_MORE_THAN_F64(actual, expected) \
-    TEST_ASSUME((actual) > (expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 #define ASSUME_ITS_LESS_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSUME((actual) <= (expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 #define ASSUME_ITS_MORE_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSUME((actual) >= (expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 #define ASSUME_NOT_EQUAL_F64(actual, expected, tol) \
-    TEST_ASSUME(fabs((actual) - (expected)) > (tol), "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
+    TEST_ASSUME_NEAR(double, actual, expected, tol, >, "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
 
 #define ASSUME_NOT_LESS_THAN_F64(actual, expected) \
-    TEST_ASSUME((actual) >= (expected), "Expected " #actual " to not be less than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, >=, expected, "Expected " #actual " to not be less than " #expected)
 
 #define ASSUME_NOT_MORE_THAN_F64(actual, expected) \
-    TEST_ASSUME((actual) <= (expected), "Expected " #actual " to not be more than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, <=, expected, "Expected " #actual " to not be more than " #expected)
 
 #define ASSUME_NOT_LESS_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSUME((actual) > (expected), "Expected " #actual " to not be less than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, >, expected, "Expected " #actual " to not be less than or equal to " #expected)
 
 #define ASSUME_NOT_MORE_OR_EQUAL_F64(actual, expected) \
-    TEST_ASSUME((actual) < (expected), "Expected " #actual " to not be more than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(double, actual, <, expected, "Expected " #actual " to not be more than or equal to " #expected)
 
 // Float equality check with tolerance
 #define ASSUME_ITS_EQUAL_F32(actual, expected, tol) \
-    TEST_ASSUME(fabsf((actual) - (expected)) <= (tol), "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
+    TEST_ASSUME_NEAR(float, actual, expected, tol, <=, "Expected " #actual " to be equal to " #expected " within tolerance " #tol)
 
 #define ASSUME_ITS_LESS_THAN_F32(actual, expected) \
-    TEST_ASSUME((actual) < (expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 #define ASSUME_ITS_MORE_THAN_F32(actual, expected) \
-    TEST_ASSUME((actual) > (expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 #define ASSUME_ITS_LESS_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSUME((actual) <= (expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 #define ASSUME_ITS_MORE_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSUME((actual) >= (expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 #define ASSUME_NOT_EQUAL_F32(actual, expected, tol) \
-    TEST_ASSUME(fabsf((actual) - (expected)) > (tol), "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
+    TEST_ASSUME_NEAR(float, actual, expected, tol, >, "Expected " #actual " to not be equal to " #expected " within tolerance " #tol)
 
 #define ASSUME_NOT_LESS_THAN_F32(actual, expected) \
-    TEST_ASSUME((actual) >= (expected), "Expected " #actual " to not be less than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, >=, expected, "Expected " #actual " to not be less than " #expected)
 
 #define ASSUME_NOT_MORE_THAN_F32(actual, expected) \
-    TEST_ASSUME((actual) <= (expected), "Expected " #actual " to not be more than " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, <=, expected, "Expected " #actual " to not be more than " #expected)
 
 #define ASSUME_NOT_LESS_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSUME((actual) > (expected), "Expected " #actual " to not be less than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, >, expected, "Expected " #actual " to not be less than or equal to " #expected)
 
 #define ASSUME_NOT_MORE_OR_EQUAL_F32(actual, expected) \
-    TEST_ASSUME((actual) < (expected), "Expected " #actual " to not be more than or equal to " #expected)
+    TEST_ASSUME_COMPARE_FLOAT(float, actual, <, expected, "Expected " #actual " to not be more than or equal to " #expected)
 
 // Float NaN and Infinity checks
 #define ASSUME_ITS_NAN_F32(actual) \
@@ -43,27 +43,42 @@ extern "C"
 
 // Equal
 #define ASSUME_ITS_EQUAL_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) == (size_t)(expected), "Expected " #actual " to be equal to " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, ==, expected, "Expected " #actual " to be equal to " #expected)
 
 // Less than
 #define ASSUME_ITS_LESS_THAN_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) < (size_t)(expected), "Expected " #actual " to be less than " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 // More than
 #define ASSUME_ITS_MORE_THAN_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) > (size_t)(expected), "Expected " #actual " to be more than " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 // Less or equal
 #define ASSUME_ITS_LESS_OR_EQUAL_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) <= (size_t)(expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 // More or equal
 #define ASSUME_ITS_MORE_OR_EQUAL_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) >= (size_t)(expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 // Not equal
 #define ASSUME_NOT_EQUAL_SIZE(actual, expected) \
-    TEST_ASSUME((size_t)(actual) != (size_t)(expected), "Expected " #actual " to not be equal to " #expected)
+    TEST_ASSUME_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, !=, expected, "Expected " #actual " to not be equal to " #expected)
+
+// Buffer content assertions, a failure hexdumps the differing region
+
+#define ASSUME_MEM_EQUAL(actual, expected, len) \
+    _FOSSIL_TEST_MEM_EQUAL(TEST_ASSERT_AS_CLASS_ASSUME, actual, expected, len)
+
+#define ASSUME_MEM_ZERO(data, len) \
+    _FOSSIL_TEST_MEM_ZERO(TEST_ASSERT_AS_CLASS_ASSUME, data, len)
+
+#define ASSUME_MEM_PATTERN(data, len, pattern, pattern_len) \
+    _FOSSIL_TEST_MEM_PATTERN(TEST_ASSERT_AS_CLASS_ASSUME, data, len, pattern, pattern_len)
+
+// Output against the golden file name under the snapshot directory
+#define ASSUME_SNAPSHOT(name, data, len) \
+    _FOSSIL_SNAPSHOT(TEST_ASSERT_AS_CLASS_ASSUME, name, data, len)
 
 #ifdef __cplusplus
 }
@@ -25,6 +25,7 @@ extern "C"
 #include "xexpect/string.h"
 #include "xexpect/letter.h"
 #include "xexpect/within.h"
+#include "xexpect/array.h"
 
 #ifdef __cplusplus
 }
@@ -43,27 +43,42 @@ extern "C"
 
 // Equal
 #define EXPECT_ITS_EQUAL_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) == (size_t)(expected), "Expected " #actual " to be equal to " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, ==, expected, "Expected " #actual " to be equal to " #expected)
 
 // Less than
 #define EXPECT_ITS_LESS_THAN_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) < (size_t)(expected), "Expected " #actual " to be less than " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <, expected, "Expected " #actual " to be less than " #expected)
 
 // More than
 #define EXPECT_ITS_MORE_THAN_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) > (size_t)(expected), "Expected " #actual " to be more than " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >, expected, "Expected " #actual " to be more than " #expected)
 
 // Less or equal
 #define EXPECT_ITS_LESS_OR_EQUAL_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) <= (size_t)(expected), "Expected " #actual " to be less than or equal to " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, <=, expected, "Expected " #actual " to be less than or equal to " #expected)
 
 // More or equal
 #define EXPECT_ITS_MORE_OR_EQUAL_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) >= (size_t)(expected), "Expected " #actual " to be more than or equal to " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, >=, expected, "Expected " #actual " to be more than or equal to " #expected)
 
 // Not equal
 #define EXPECT_NOT_EQUAL_SIZE(actual, expected) \
-    TEST_EXPECT((size_t)(actual) != (size_t)(expected), "Expected " #actual " to not be equal to " #expected)
+    TEST_EXPECT_COMPARE(FOSSIL_TEST_OPERAND_UNSIGNED, size_t, actual, !=, expected, "Expected " #actual " to not be equal to " #expected)
+
+// Buffer content assertions, a failure hexdumps the differing region
+
+#define EXPECT_MEM_EQUAL(actual, expected, len) \
+    _FOSSIL_TEST_MEM_EQUAL(TEST_ASSERT_AS_CLASS_EXPECT, actual, expected, len)
+
+#define EXPECT_MEM_ZERO(data, len) \
+    _FOSSIL_TEST_MEM_ZERO(TEST_ASSERT_AS_CLASS_EXPECT, data, len)
+
+#define EXPECT_MEM_PATTERN(data, len, pattern, pattern_len) \
+    _FOSSIL_TEST_MEM_PATTERN(TEST_ASSERT_AS_CLASS_EXPECT, data, len, pattern, pattern_len)
+
+// Output against the golden file name under the snapshot directory
+#define EXPECT_SNAPSHOT(name, data, len) \
+    _FOSSIL_SNAPSHOT(TEST_ASSERT_AS_CLASS_EXPECT, name, data, len)
 
 #ifdef __cplusplus
 }
@@ -25,7 +25,7 @@ extern "C"
 
 // Wide char string equality check
 #define EXPECT_ITS_EQUAL_WSTR(actual, expected) \
-    TEST_EXPECT(wcscmp((actual), (expected)) == 0, "Expected wide string " #actual " to be equal to " #expected)
+    _FOSSIL_TEST_WSTR_EQUAL(TEST_ASSERT_AS_CLASS_EXPECT, actual, expected, "wide string " #actual " to be equal to " #expected)
 
 #define EXPECT_NOT_EQUAL_WSTR(actual, expected) \
     TEST_EXPECT(wcscmp((actual), (expected)) != 0, "Expected wide string " #actual " to not be equal to " #expected)
@@ -36,7 +36,7 @@ extern "C"
 
 // Byte string equality check
 #define EXPECT_ITS_EQUAL_BSTR(actual, expected) \
-    TEST_EXPECT(strcmp((const char*)(actual), (const char*)(expected)) == 0, "Expected byte string " #actual " to be equal to " #expected)
+    _FOSSIL_TEST_CSTR_EQUAL(TEST_ASSERT_AS_CLASS_EXPECT, actual, expected, "byte string " #actual " to be equal to " #expected)
 
 #define EXPECT_NOT_EQUAL_BSTR(actual, expected) \
     TEST_EXPECT(strcmp((const char*)(actual), (const char*)(expected)) != 0, "Expected byte string " #actual " to not be equal to " #expected)
@@ -47,7 +47,7 @@ extern "C"
 
 // Classic C string equality check
 #define EXPECT_ITS_EQUAL_CSTR(actual, expected) \
-    TEST_EXPECT(strcmp((actual), (expected)) == 0, "Expected C string " #actual " to be equal to " #expected)
+    _FOSSIL_TEST_CSTR_EQUAL(TEST_ASSERT_AS_CLASS_EXPECT, actual, expected, "C string " #actual " to be equal to " #expected)
 
 #define EXPECT_NOT_EQUAL_CSTR(actual, expected) \
     TEST_EXPECT(strcmp((actual), (expected)) != 0, "Expected C string " #actual " to not be equal to " #expected)
@@ -56,6 +56,38 @@ extern "C"
 #define EXPECT_ITS_LENGTH_EQUAL_CSTR(actual, expected_len) \
     TEST_EXPECT(strlen((actual)) == (expected_len), "Expected length of C string " #actual " to be equal to " #expected_len)
 
+// Text of known length, it may hold NUL bytes. Equality failures above and
+// here print a unified diff of the lines around the first difference
+#define EXPECT_ITS_EQUAL_TEXT(actual, actual_len, expected, expected_len) \
+    _FOSSIL_TEST_TEXT_EQUAL(TEST_ASSERT_AS_CLASS_EXPECT, actual, actual_len, expected, expected_len)
+
+// Substrings of NUL-terminated strings, found with the vector byte search
+#define EXPECT_CONTAINS(text, needle) \
+    _FOSSIL_TEST_CONTAINS(TEST_ASSERT_AS_CLASS_EXPECT, text, needle, true, FOSSIL_TEST_TEXT_ANY, "string " #text " to contain " #needle)
+
+#define EXPECT_NOT_CONTAINS(text, needle) \
+    _FOSSIL_TEST_CONTAINS(TEST_ASSERT_AS_CLASS_EXPECT, text, needle, false, 0, "string " #text " to not contain " #needle)
+
+#define EXPECT_CONTAINS_COUNT(text, needle, count) \
+    _FOSSIL_TEST_CONTAINS(TEST_ASSERT_AS_CLASS_EXPECT, text, needle, true, (size_t)(count), "string " #text " to contain " #needle " " #count " times")
+
+#define EXPECT_STARTS_WITH(text, prefix) \
+    _FOSSIL_TEST_AFFIX(TEST_ASSERT_AS_CLASS_EXPECT, text, prefix, false, "string " #text " to start with " #prefix)
+
+#define EXPECT_ENDS_WITH(text, suffix) \
+    _FOSSIL_TEST_AFFIX(TEST_ASSERT_AS_CLASS_EXPECT, text, suffix, true, "string " #text " to end with " #suffix)
+
+// POSIX extended regular expressions, '^' and '$' anchor at every line. The
+// pattern is compiled once per call site, so these are cheap inside loops
+#define EXPECT_MATCHES(text, pattern) \
+    _FOSSIL_TEST_MATCHES(TEST_ASSERT_AS_CLASS_EXPECT, text, pattern, true, FOSSIL_TEST_TEXT_ANY, "string " #text " to match " #pattern)
+
+#define EXPECT_NOT_MATCHES(text, pattern) \
+    _FOSSIL_TEST_MATCHES(TEST_ASSERT_AS_CLASS_EXPECT, text, pattern, false, 0, "string " #text " to not match " #pattern)
+
+#define EXPECT_MATCHES_COUNT(text, pattern, count) \
+    _FOSSIL_TEST_MATCHES(TEST_ASSERT_AS_CLASS_EXPECT, text, pattern, true, (size_t)(count), "string " #text " to match " #pattern " " #count " times")
+
 #ifdef __cplusplus
 }
 #endif
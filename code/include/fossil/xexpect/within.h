@@ -122,6 +122,129 @@ extern "C"
 #define EXPECT_NOT_WITHIN_RANGE_WCHAR(value, min, max) \
     TEST_EXPECT((wchar_t)(value) < (wchar_t)(min) || (wchar_t)(value) > (wchar_t)(max), "Value " #value " is within range [" #min ", " #max "]")
 
+// Statistics over a sample of count elements, for randomized and noisy
+// results. The mean and standard deviation come from one vectorized pass
+
+#define EXPECT_MEAN_WITHIN_I8(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, I8, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_I8(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, I8, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_I8(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, I8, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_I8(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, I8, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_I16(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, I16, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_I16(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, I16, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_I16(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, I16, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_I16(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, I16, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_I32(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, I32, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_I32(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, I32, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_I32(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, I32, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_I32(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, I32, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_I64(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, I64, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_I64(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, I64, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_I64(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, I64, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_I64(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, I64, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_U8(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, U8, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_U8(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, U8, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_U8(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, U8, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_U8(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, U8, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_U16(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, U16, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_U16(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, U16, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_U16(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, U16, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_U16(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, U16, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_U32(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, U32, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_U32(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, U32, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_U32(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, U32, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_U32(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, U32, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_U64(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, U64, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_U64(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, U64, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_U64(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, U64, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_U64(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, U64, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_F32(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, F32, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_F32(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, F32, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_F32(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, F32, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_F32(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, F32, a, a_count, b, b_count, alpha)
+
+#define EXPECT_MEAN_WITHIN_F64(data, count, min, max) \
+    _FOSSIL_TEST_STAT_MEAN(TEST_ASSERT_AS_CLASS_EXPECT, F64, data, count, min, max)
+
+#define EXPECT_STDDEV_BELOW_F64(data, count, limit) \
+    _FOSSIL_TEST_STAT_STDDEV(TEST_ASSERT_AS_CLASS_EXPECT, F64, data, count, limit)
+
+#define EXPECT_PERCENTILE_BELOW_F64(data, count, percentile, limit) \
+    _FOSSIL_TEST_STAT_PERCENTILE(TEST_ASSERT_AS_CLASS_EXPECT, F64, data, count, percentile, limit)
+
+#define EXPECT_SAME_DISTRIBUTION_F64(a, a_count, b, b_count, alpha) \
+    _FOSSIL_TEST_STAT_SAME(TEST_ASSERT_AS_CLASS_EXPECT, F64, a, a_count, b, b_count, alpha)
+
 #ifdef __cplusplus
 }
 #endif
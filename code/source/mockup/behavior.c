@@ -11,6 +11,7 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/behavior.h"
+#include "fossil/mockup/sequence.h"
 #include <stdarg.h>
 #include <string.h>
 
@@ -37,6 +38,7 @@ fossil_mockup_behavior_t* fossil_mockup_behavior_create(const char *function_nam
     }
 
     behavior->arg_count = arg_count;
+    behavior->sequence_id = fossil_mockup_sequence_register(function_name);
     behavior->next = NULL;
     return behavior;
 }
@@ -48,6 +50,7 @@ void fossil_mockup_behavior_record_call(fossil_mockup_behavior_t *behavior, ...)
         behavior->args[i] = va_arg(args, void *);
     }
     va_end(args);
+    fossil_mockup_sequence_record(behavior->sequence_id);
 }
 
 bool fossil_mockup_behavior_verify_call(fossil_mockup_behavior_t *behavior, int32_t arg_count, ...) {
@@ -0,0 +1,299 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/mockup/capture.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define fossil_capture_dup    _dup
+#define fossil_capture_dup2   _dup2
+#define fossil_capture_close  _close
+#define fossil_capture_read(fd, buf, len) _read(fd, buf, (unsigned int)(len))
+#define fossil_capture_seek   _lseeki64
+#define fossil_capture_truncate(fd) _chsize_s(fd, 0)
+#else
+#include <fcntl.h>
+#include <regex.h>
+#include <sys/mman.h>
+#define fossil_capture_dup    dup
+#define fossil_capture_dup2   dup2
+#define fossil_capture_close  close
+#define fossil_capture_read   read
+#define fossil_capture_seek   lseek
+#define fossil_capture_truncate(fd) ftruncate(fd, 0)
+#endif
+
+#define FOSSIL_CAPTURE_INITIAL_CAPACITY 4096
+#define FOSSIL_CAPTURE_READ_CHUNK 65536
+
+//
+// local functions
+//
+static int fossil_mockup_capture_open_sink(void) {
+    int fd = -1;
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    fd = memfd_create("fossil-capture", MFD_CLOEXEC);
+    if (fd >= 0) {
+        return fd;
+    }
+#endif
+    // Keep our own descriptor so the FILE can be closed right away.
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        return -1;
+    }
+#ifdef _WIN32
+    fd = _dup(_fileno(file));
+#else
+    fd = dup(fileno(file));
+#endif
+    fclose(file);
+    return fd;
+}
+
+static void fossil_mockup_capture_reserve(fossil_mockup_capture_t *capture, size_t needed) {
+    if (needed < capture->capacity) {
+        return;
+    }
+    size_t capacity = capture->capacity;
+    while (capacity <= needed) {
+        capacity *= 2;
+    }
+    char *buffer = (char *)realloc(capture->buffer, capacity);
+    if (buffer == NULL) {
+        perror("Failed to grow output capture buffer");
+        exit(EXIT_FAILURE);
+    }
+    capture->buffer = buffer;
+    capture->capacity = capacity;
+}
+
+static const char* fossil_mockup_capture_find(const char *haystack, size_t length, const char *needle, size_t needle_length) {
+    if (needle_length == 0) {
+        return haystack;
+    }
+    const char *end = haystack + length;
+    while ((size_t)(end - haystack) >= needle_length) {
+        const char *hit = (const char *)memchr(haystack, needle[0], (size_t)(end - haystack) - needle_length + 1);
+        if (hit == NULL) {
+            return NULL;
+        }
+        if (memcmp(hit, needle, needle_length) == 0) {
+            return hit;
+        }
+        haystack = hit + 1;
+    }
+    return NULL;
+}
+
+//
+// public functions
+//
+fossil_mockup_capture_t* fossil_mockup_capture_start(int fd) {
+    fossil_mockup_capture_t *capture = (fossil_mockup_capture_t *)malloc(sizeof(fossil_mockup_capture_t));
+    if (capture == NULL) {
+        perror("Failed to allocate memory for output capture");
+        exit(EXIT_FAILURE);
+    }
+    capture->buffer = (char *)malloc(FOSSIL_CAPTURE_INITIAL_CAPACITY);
+    if (capture->buffer == NULL) {
+        perror("Failed to allocate memory for output capture buffer");
+        exit(EXIT_FAILURE);
+    }
+    capture->buffer[0] = '\0';
+    capture->length = 0;
+    capture->capacity = FOSSIL_CAPTURE_INITIAL_CAPACITY;
+    capture->scratch = NULL;
+    capture->scratch_capacity = 0;
+    capture->target_fd = fd;
+    capture->active = false;
+
+    fflush(NULL);
+    capture->sink_fd = fossil_mockup_capture_open_sink();
+    capture->saved_fd = capture->sink_fd >= 0 ? fossil_capture_dup(fd) : -1;
+    if (capture->sink_fd < 0 || capture->saved_fd < 0 || fossil_capture_dup2(capture->sink_fd, fd) < 0) {
+        fprintf(stderr, "Failed to redirect file descriptor %d for capture\n", fd);
+        if (capture->saved_fd >= 0) {
+            fossil_capture_close(capture->saved_fd);
+        }
+        if (capture->sink_fd >= 0) {
+            fossil_capture_close(capture->sink_fd);
+        }
+        capture->saved_fd = -1;
+        capture->sink_fd = -1;
+        return capture;
+    }
+    capture->active = true;
+    return capture;
+}
+
+size_t fossil_mockup_capture_collect(fossil_mockup_capture_t *capture) {
+    if (capture->sink_fd < 0) {
+        return capture->length;
+    }
+    fflush(NULL);
+
+    // The target shares the sink's file offset, so reading up to the end
+    // leaves it exactly where the next write has to go.
+    if (fossil_capture_seek(capture->sink_fd, (off_t)capture->length, SEEK_SET) < 0) {
+        return capture->length;
+    }
+    for (;;) {
+        fossil_mockup_capture_reserve(capture, capture->length + FOSSIL_CAPTURE_READ_CHUNK);
+        long count = (long)fossil_capture_read(capture->sink_fd, capture->buffer + capture->length, FOSSIL_CAPTURE_READ_CHUNK);
+        if (count <= 0) {
+            break;
+        }
+        capture->length += (size_t)count;
+    }
+    capture->buffer[capture->length] = '\0';
+    return capture->length;
+}
+
+void fossil_mockup_capture_stop(fossil_mockup_capture_t *capture) {
+    if (!capture->active) {
+        return;
+    }
+    fossil_mockup_capture_collect(capture);
+    fossil_capture_dup2(capture->saved_fd, capture->target_fd);
+    fossil_capture_close(capture->saved_fd);
+    fossil_capture_close(capture->sink_fd);
+    capture->saved_fd = -1;
+    capture->sink_fd = -1;
+    capture->active = false;
+}
+
+const char* fossil_mockup_capture_data(fossil_mockup_capture_t *capture, size_t *length) {
+    if (capture->active) {
+        fossil_mockup_capture_collect(capture);
+    }
+    if (length != NULL) {
+        *length = capture->length;
+    }
+    return capture->buffer;
+}
+
+bool fossil_mockup_capture_next_line(fossil_mockup_capture_t *capture, size_t *offset, const char **line, size_t *length) {
+    if (*offset == 0 && capture->active) {
+        fossil_mockup_capture_collect(capture);
+    }
+    if (*offset >= capture->length) {
+        return false;
+    }
+    const char *start = capture->buffer + *offset;
+    size_t remaining = capture->length - *offset;
+    const char *newline = (const char *)memchr(start, '\n', remaining);
+    size_t line_length = newline != NULL ? (size_t)(newline - start) : remaining;
+
+    *line = start;
+    *length = line_length;
+    *offset += newline != NULL ? line_length + 1 : line_length;
+    return true;
+}
+
+size_t fossil_mockup_capture_line_count(fossil_mockup_capture_t *capture) {
+    size_t offset = 0;
+    size_t count = 0;
+    const char *line;
+    size_t length;
+    while (fossil_mockup_capture_next_line(capture, &offset, &line, &length)) {
+        count++;
+    }
+    return count;
+}
+
+bool fossil_mockup_capture_contains(fossil_mockup_capture_t *capture, const char *text) {
+    size_t length;
+    const char *data = fossil_mockup_capture_data(capture, &length);
+    return fossil_mockup_capture_find(data, length, text, strlen(text)) != NULL;
+}
+
+bool fossil_mockup_capture_contains_line(fossil_mockup_capture_t *capture, const char *expected_line) {
+    size_t expected_length = strlen(expected_line);
+    size_t offset = 0;
+    const char *line;
+    size_t length;
+    while (fossil_mockup_capture_next_line(capture, &offset, &line, &length)) {
+        if (length == expected_length && memcmp(line, expected_line, length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool fossil_mockup_capture_match(fossil_mockup_capture_t *capture, const char *pattern) {
+#ifdef _WIN32
+    return fossil_mockup_capture_contains(capture, pattern);
+#else
+    regex_t regex;
+    int status = regcomp(&regex, pattern, REG_EXTENDED | REG_NOSUB);
+    if (status != 0) {
+        char message[256];
+        regerror(status, &regex, message, sizeof(message));
+        fprintf(stderr, "Invalid capture pattern '%s': %s\n", pattern, message);
+        return false;
+    }
+
+    bool matched = false;
+    size_t offset = 0;
+    const char *line;
+    size_t length;
+    while (!matched && fossil_mockup_capture_next_line(capture, &offset, &line, &length)) {
+#ifdef REG_STARTEND
+        regmatch_t range;
+        range.rm_so = 0;
+        range.rm_eo = (regoff_t)length;
+        matched = regexec(&regex, line, 1, &range, REG_STARTEND) == 0;
+#else
+        // One growing scratch buffer instead of a copy per line.
+        if (length + 1 > capture->scratch_capacity) {
+            size_t capacity = capture->scratch_capacity ? capture->scratch_capacity : 256;
+            while (capacity < length + 1) {
+                capacity *= 2;
+            }
+            char *scratch = (char *)realloc(capture->scratch, capacity);
+            if (scratch == NULL) {
+                perror("Failed to grow output capture scratch buffer");
+                exit(EXIT_FAILURE);
+            }
+            capture->scratch = scratch;
+            capture->scratch_capacity = capacity;
+        }
+        memcpy(capture->scratch, line, length);
+        capture->scratch[length] = '\0';
+        matched = regexec(&regex, capture->scratch, 0, NULL, 0) == 0;
+#endif
+    }
+    regfree(&regex);
+    return matched;
+#endif
+}
+
+void fossil_mockup_capture_reset(fossil_mockup_capture_t *capture) {
+    if (capture->sink_fd >= 0) {
+        fflush(NULL);
+        if (fossil_capture_truncate(capture->sink_fd) != 0) {
+            perror("Failed to truncate output capture");
+        }
+        fossil_capture_seek(capture->sink_fd, 0, SEEK_SET);
+    }
+    capture->length = 0;
+    capture->buffer[0] = '\0';
+}
+
+void fossil_mockup_capture_erase(fossil_mockup_capture_t *capture) {
+    fossil_mockup_capture_stop(capture);
+    free(capture->buffer);
+    free(capture->scratch);
+    free(capture);
+}
@@ -11,6 +11,7 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/fake.h"
+#include "fossil/mockup/sequence.h"
 
 fossil_mockup_fake_t* fossil_mockup_fake_create(const char *function_name, void (*fake_function)(void)) {
     fossil_mockup_fake_t *fake = (fossil_mockup_fake_t *)malloc(sizeof(fossil_mockup_fake_t));
@@ -27,11 +28,13 @@ fossil_mockup_fake_t* fossil_mockup_fake_create(const char *function_name, void
     }
 
     fake->fake_function = fake_function;
+    fake->sequence_id = fossil_mockup_sequence_register(function_name);
     fake->next = NULL;
     return fake;
 }
 
 void fossil_mockup_fake_call(fossil_mockup_fake_t *fake) {
+    fossil_mockup_sequence_record(fake->sequence_id);
     if (fake->fake_function) {
         fake->fake_function();
     } else {
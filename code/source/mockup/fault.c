@@ -0,0 +1,194 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/mockup/fault.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <time.h>
+#endif
+
+//
+// local functions
+//
+
+// splitmix64, small and good enough for scheduling faults.
+static uint64_t fossil_mockup_fault_random(fossil_mockup_fault_t *fault) {
+    uint64_t z = (fault->state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static double fossil_mockup_fault_uniform(fossil_mockup_fault_t *fault) {
+    return (double)(fossil_mockup_fault_random(fault) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static uint64_t fossil_mockup_fault_latency(fossil_mockup_fault_t *fault) {
+    uint64_t delay = 0;
+    switch (fault->latency) {
+        case FOSSIL_MOCKUP_LATENCY_FIXED:
+            delay = fault->latency_a;
+            break;
+        case FOSSIL_MOCKUP_LATENCY_UNIFORM:
+            delay = fault->latency_a;
+            if (fault->latency_b > fault->latency_a) {
+                delay += fossil_mockup_fault_random(fault) % (fault->latency_b - fault->latency_a + 1);
+            }
+            break;
+        case FOSSIL_MOCKUP_LATENCY_NORMAL: {
+            // Irwin-Hall: the sum of twelve uniforms minus six is close to a
+            // standard normal and needs no libm.
+            double sum = -6.0;
+            for (int i = 0; i < 12; i++) {
+                sum += fossil_mockup_fault_uniform(fault);
+            }
+            double value = (double)fault->latency_a + sum * (double)fault->latency_b;
+            delay = value > 0.0 ? (uint64_t)value : 0;
+            break;
+        }
+        case FOSSIL_MOCKUP_LATENCY_NONE:
+        default:
+            break;
+    }
+    if (fault->spike_rate > 0.0 && fossil_mockup_fault_uniform(fault) < fault->spike_rate) {
+        delay += fault->spike_us;
+    }
+    return delay;
+}
+
+static void fossil_mockup_fault_delay(fossil_mockup_fault_t *fault, uint64_t microseconds) {
+    if (microseconds == 0) {
+        return;
+    }
+    fault->now_us += microseconds;
+    if (fault->virtual_clock) {
+        return;
+    }
+#ifdef _WIN32
+    Sleep((DWORD)((microseconds + 999) / 1000));
+#else
+    struct timespec remaining = { (time_t)(microseconds / 1000000), (long)(microseconds % 1000000) * 1000 };
+    while (nanosleep(&remaining, &remaining) != 0 && errno == EINTR) {
+    }
+#endif
+}
+
+//
+// public functions
+//
+fossil_mockup_fault_t* fossil_mockup_fault_create(uint64_t seed) {
+    fossil_mockup_fault_t *fault = (fossil_mockup_fault_t *)calloc(1, sizeof(fossil_mockup_fault_t));
+    if (fault == NULL) {
+        perror("Failed to allocate memory for fault injection");
+        exit(EXIT_FAILURE);
+    }
+    fault->seed = seed;
+    fault->state = seed;
+    return fault;
+}
+
+void fossil_mockup_fault_set_latency(fossil_mockup_fault_t *fault, fossil_mockup_latency_t kind, uint64_t a, uint64_t b) {
+    fault->latency = kind;
+    fault->latency_a = a;
+    fault->latency_b = b;
+}
+
+void fossil_mockup_fault_set_spikes(fossil_mockup_fault_t *fault, double rate, uint64_t extra) {
+    fault->spike_rate = rate;
+    fault->spike_us = extra;
+}
+
+void fossil_mockup_fault_set_bandwidth(fossil_mockup_fault_t *fault, uint64_t bytes_per_second) {
+    fault->bytes_per_second = bytes_per_second;
+}
+
+void fossil_mockup_fault_set_short_io(fossil_mockup_fault_t *fault, double rate, size_t max_chunk) {
+    fault->short_rate = rate;
+    fault->max_chunk = max_chunk;
+}
+
+void fossil_mockup_fault_set_errors(fossil_mockup_fault_t *fault, double again_rate, double interrupt_rate, double drop_rate) {
+    fault->again_rate = again_rate;
+    fault->interrupt_rate = interrupt_rate;
+    fault->drop_rate = drop_rate;
+}
+
+void fossil_mockup_fault_set_virtual_clock(fossil_mockup_fault_t *fault, bool enabled) {
+    fault->virtual_clock = enabled;
+}
+
+fossil_mockup_fault_action_t fossil_mockup_fault_next(fossil_mockup_fault_t *fault, size_t requested, size_t *allowed) {
+    *allowed = 0;
+    fault->operation_count++;
+    if (fault->dropped) {
+        fault->drop_count++;
+        return FOSSIL_MOCKUP_FAULT_DROP;
+    }
+
+    // One draw picks the outcome so configured rates do not shift each other.
+    double roll = fossil_mockup_fault_uniform(fault);
+    if (roll < fault->drop_rate) {
+        fault->dropped = true;
+        fault->drop_count++;
+        return FOSSIL_MOCKUP_FAULT_DROP;
+    }
+    roll -= fault->drop_rate;
+    if (roll < fault->again_rate) {
+        fault->again_count++;
+        return FOSSIL_MOCKUP_FAULT_AGAIN;
+    }
+    roll -= fault->again_rate;
+    if (roll < fault->interrupt_rate) {
+        fault->interrupt_count++;
+        return FOSSIL_MOCKUP_FAULT_INTERRUPT;
+    }
+
+    size_t count = requested;
+    if (fault->max_chunk > 0 && count > fault->max_chunk) {
+        count = fault->max_chunk;
+    }
+    if (fault->short_rate > 0.0 && fossil_mockup_fault_uniform(fault) < fault->short_rate && count > 1) {
+        count = 1 + (size_t)(fossil_mockup_fault_random(fault) % (count - 1));
+    }
+    if (count < requested) {
+        fault->short_count++;
+    }
+
+    uint64_t delay = fossil_mockup_fault_latency(fault);
+    if (fault->bytes_per_second > 0) {
+        delay += ((uint64_t)count * 1000000ULL + fault->bytes_per_second - 1) / fault->bytes_per_second;
+    }
+    fossil_mockup_fault_delay(fault, delay);
+    *allowed = count;
+    return FOSSIL_MOCKUP_FAULT_PASS;
+}
+
+uint64_t fossil_mockup_fault_now(const fossil_mockup_fault_t *fault) {
+    return fault->now_us;
+}
+
+void fossil_mockup_fault_reset(fossil_mockup_fault_t *fault) {
+    fault->state = fault->seed;
+    fault->dropped = false;
+    fault->now_us = 0;
+    fault->operation_count = 0;
+    fault->short_count = 0;
+    fault->again_count = 0;
+    fault->interrupt_count = 0;
+    fault->drop_count = 0;
+}
+
+void fossil_mockup_fault_erase(fossil_mockup_fault_t *fault) {
+    free(fault);
+}
@@ -10,42 +10,215 @@ Description:
     feel free to contact Michael at michaelbrockus@gmail.com.
 ==============================================================================
 */
+#include "fossil/_common/common.h"
 #include "fossil/mockup/file.h"
+#include <errno.h>
 #include <string.h>
 
-fossil_mockup_file_t* fossil_mockup_file_create(const char *filename, const char *content) {
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define FOSSIL_MOCKUP_FILE_MIN_CAPACITY 64
+
+//
+// local functions
+//
+
+// Make sure the content is owned and can hold size bytes plus a terminator.
+// Borrowed and mapped content is copied here, before the first modification.
+static void fossil_mockup_file_reserve(fossil_mockup_file_t *file, size_t size) {
+    if (file->storage == FOSSIL_MOCKUP_FILE_OWNED && size < file->capacity) {
+        return;
+    }
+    size_t capacity = file->capacity > FOSSIL_MOCKUP_FILE_MIN_CAPACITY ? file->capacity : FOSSIL_MOCKUP_FILE_MIN_CAPACITY;
+    while (capacity <= size) {
+        capacity *= 2;
+    }
+    char *content;
+    if (file->storage == FOSSIL_MOCKUP_FILE_OWNED) {
+        content = (char *)realloc(file->content, capacity);
+    } else {
+        content = (char *)malloc(capacity);
+        if (content != NULL && file->size > 0) {
+            memcpy(content, file->content, file->size);
+        }
+    }
+    if (content == NULL) {
+        perror("Failed to grow file mock content");
+        exit(EXIT_FAILURE);
+    }
+#ifndef _WIN32
+    if (file->storage == FOSSIL_MOCKUP_FILE_MAPPED) {
+        munmap(file->content, file->size);
+    }
+#endif
+    content[file->size] = '\0';
+    file->content = content;
+    file->capacity = capacity;
+    file->storage = FOSSIL_MOCKUP_FILE_OWNED;
+}
+
+// Let the attached impairment fail or shorten a transfer. Short transfers are
+// kept to whole elements and move at least one, but never more bytes than
+// the caller asked for, which may already be a partial element at the end.
+static bool fossil_mockup_file_impair(fossil_mockup_file_t *file, size_t size, size_t *bytes) {
+    size_t allowed = 0;
+    switch (fossil_mockup_fault_next(file->fault, *bytes, &allowed)) {
+        case FOSSIL_MOCKUP_FAULT_AGAIN:
+            errno = EAGAIN;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_INTERRUPT:
+            errno = EINTR;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_DROP:
+            errno = EIO;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_PASS:
+        default:
+            break;
+    }
+    if (allowed < *bytes) {
+        *bytes = allowed >= size ? allowed - allowed % size : (size < *bytes ? size : *bytes);
+    }
+    return true;
+}
+
+static fossil_mockup_file_t* fossil_mockup_file_alloc(const char *filename) {
     fossil_mockup_file_t *file = (fossil_mockup_file_t *)malloc(sizeof(fossil_mockup_file_t));
     if (file == NULL) {
         perror("Failed to allocate memory for file mock");
         exit(EXIT_FAILURE);
     }
     file->filename = _custom_fossil_test_strdup(filename);
-    file->content = _custom_fossil_test_strdup(content);
-    file->size = strlen(content);
+    file->content = NULL;
+    file->size = 0;
     file->position = 0;
+    file->capacity = 0;
+    file->storage = FOSSIL_MOCKUP_FILE_OWNED;
+    file->fault = NULL;
     file->next = NULL;
     return file;
 }
 
+//
+// public functions
+//
+fossil_mockup_file_t* fossil_mockup_file_create(const char *filename, const char *content) {
+    fossil_mockup_file_t *file = fossil_mockup_file_alloc(filename);
+    size_t size = strlen(content);
+    fossil_mockup_file_reserve(file, size);
+    memcpy(file->content, content, size);
+    file->content[size] = '\0';
+    file->size = size;
+    return file;
+}
+
+fossil_mockup_file_t* fossil_mockup_file_create_from_buffer(const char *filename, const void *data, size_t size) {
+    fossil_mockup_file_t *file = fossil_mockup_file_alloc(filename);
+    file->content = (char *)data;
+    file->size = size;
+    file->storage = FOSSIL_MOCKUP_FILE_BORROWED;
+    return file;
+}
+
+fossil_mockup_file_t* fossil_mockup_file_create_from_fixture(const char *path) {
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Failed to open fixture file '%s'\n", path);
+        return NULL;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        fprintf(stderr, "Failed to stat fixture file '%s'\n", path);
+        return NULL;
+    }
+    fossil_mockup_file_t *file = fossil_mockup_file_alloc(path);
+    if (info.st_size > 0) {
+        void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            file->content = (char *)mapped;
+            file->size = (size_t)info.st_size;
+            file->storage = FOSSIL_MOCKUP_FILE_MAPPED;
+        }
+    }
+    close(fd);
+    if (file->storage == FOSSIL_MOCKUP_FILE_MAPPED) {
+        return file;
+    }
+    fossil_mockup_file_erase(file);
+#endif
+    // No mapping available, read the fixture into owned storage instead.
+    FILE *stream = fopen(path, "rb");
+    if (stream == NULL) {
+        fprintf(stderr, "Failed to open fixture file '%s'\n", path);
+        return NULL;
+    }
+    fossil_mockup_file_t *copy = fossil_mockup_file_alloc(path);
+    char chunk[65536];
+    size_t count;
+    while ((count = fread(chunk, 1, sizeof(chunk), stream)) > 0) {
+        fossil_mockup_file_write(chunk, 1, count, copy);
+    }
+    fclose(stream);
+    fossil_mockup_file_reserve(copy, copy->size);
+    copy->position = 0;
+    return copy;
+}
+
 size_t fossil_mockup_file_read(void *ptr, size_t size, size_t nmemb, fossil_mockup_file_t *file) {
+    if (size == 0 || file->position >= file->size) {
+        return 0;
+    }
     size_t bytes_to_read = size * nmemb;
-    if (file->position + bytes_to_read > file->size) {
+    if (bytes_to_read > file->size - file->position) {
         bytes_to_read = file->size - file->position;
     }
+    if (file->fault != NULL && !fossil_mockup_file_impair(file, size, &bytes_to_read)) {
+        return 0;
+    }
     memcpy(ptr, file->content + file->position, bytes_to_read);
     file->position += bytes_to_read;
     return bytes_to_read / size;
 }
 
+const char* fossil_mockup_file_read_view(fossil_mockup_file_t *file, size_t max_size, size_t *length) {
+    size_t available = file->position < file->size ? file->size - file->position : 0;
+    if (max_size < available) {
+        available = max_size;
+    }
+    const char *view = file->content;
+    if (view != NULL) {
+        view += file->position < file->size ? file->position : file->size;
+    }
+    file->position += available;
+    *length = available;
+    return view;
+}
+
 size_t fossil_mockup_file_write(const void *ptr, size_t size, size_t nmemb, fossil_mockup_file_t *file) {
     size_t bytes_to_write = size * nmemb;
-    if (file->position + bytes_to_write > file->size) {
-        file->content = (char *)realloc(file->content, file->position + bytes_to_write + 1);
-        file->size = file->position + bytes_to_write;
+    if (bytes_to_write == 0) {
+        return 0;
+    }
+    if (file->fault != NULL && !fossil_mockup_file_impair(file, size, &bytes_to_write)) {
+        return 0;
+    }
+    size_t end = file->position + bytes_to_write;
+    fossil_mockup_file_reserve(file, end > file->size ? end : file->size);
+    if (file->position > file->size) {
+        memset(file->content + file->size, 0, file->position - file->size);
     }
     memcpy(file->content + file->position, ptr, bytes_to_write);
-    file->position += bytes_to_write;
-    file->content[file->position] = '\0'; // Null-terminate the content
+    file->position = end;
+    if (end > file->size) {
+        file->size = end;
+        file->content[end] = '\0'; // Null-terminate the content
+    }
     return bytes_to_write / size;
 }
 
@@ -71,12 +244,23 @@ int fossil_mockup_file_seek(fossil_mockup_file_t *file, long offset, int whence)
     return 0;
 }
 
+void fossil_mockup_file_set_fault(fossil_mockup_file_t *file, fossil_mockup_fault_t *fault) {
+    file->fault = fault;
+}
+
 void fossil_mockup_file_reset(fossil_mockup_file_t *file) {
     file->position = 0;
 }
 
 void fossil_mockup_file_erase(fossil_mockup_file_t *file) {
     free(file->filename);
-    free(file->content);
+    if (file->storage == FOSSIL_MOCKUP_FILE_OWNED) {
+        free(file->content);
+    }
+#ifndef _WIN32
+    else if (file->storage == FOSSIL_MOCKUP_FILE_MAPPED) {
+        munmap(file->content, file->size);
+    }
+#endif
     free(file);
 }
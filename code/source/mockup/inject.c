@@ -10,16 +10,203 @@ Description:
     feel free to contact Michael at michaelbrockus@gmail.com.
 ==============================================================================
 */
+#include "fossil/_common/common.h"
 #include "fossil/mockup/inject.h"
 #include <stdarg.h>
 
+#if defined(__ELF__) && (defined(__linux__) || defined(__FreeBSD__))
+#include <dlfcn.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define FOSSIL_INJECT_ELF 1
+#endif
+
+//
+// local functions
+//
+#ifdef FOSSIL_INJECT_ELF
+
+#if __SIZEOF_POINTER__ == 8
+#define FOSSIL_INJECT_R_SYM(info) ELF64_R_SYM(info)
+#define FOSSIL_INJECT_R_TYPE(info) ELF64_R_TYPE(info)
+#else
+#define FOSSIL_INJECT_R_SYM(info) ELF32_R_SYM(info)
+#define FOSSIL_INJECT_R_TYPE(info) ELF32_R_TYPE(info)
+#endif
+
+// Relocations that fill a GOT entry with the address of a function.
+static bool fossil_mockup_inject_is_slot(uint32_t type) {
+#if defined(__x86_64__)
+    return type == R_X86_64_JUMP_SLOT || type == R_X86_64_GLOB_DAT;
+#elif defined(__i386__)
+    return type == R_386_JMP_SLOT || type == R_386_GLOB_DAT;
+#elif defined(__aarch64__)
+    return type == R_AARCH64_JUMP_SLOT || type == R_AARCH64_GLOB_DAT;
+#elif defined(__arm__)
+    return type == R_ARM_JUMP_SLOT || type == R_ARM_GLOB_DAT;
+#elif defined(__riscv)
+    return type == R_RISCV_JUMP_SLOT || type == (__SIZEOF_POINTER__ == 8 ? R_RISCV_64 : R_RISCV_32);
+#else
+    (void)type;
+    return false;
+#endif
+}
+
+typedef struct {
+    fossil_mockup_inject_t *inject;
+    uintptr_t replacement;
+    size_t capacity;
+    uintptr_t relro_start;
+    uintptr_t relro_end;
+} fossil_mockup_inject_scan_t;
+
+static void fossil_mockup_inject_add_slot(fossil_mockup_inject_scan_t *scan, size_t first, uintptr_t slot) {
+    fossil_mockup_inject_t *inject = scan->inject;
+    // Some linkers let DT_RELA cover DT_JMPREL, count each entry once.
+    for (size_t i = first; i < inject->slot_count; i++) {
+        if (inject->slots[i] == slot) {
+            return;
+        }
+    }
+    if (inject->slot_count == scan->capacity) {
+        scan->capacity = scan->capacity ? scan->capacity * 2 : 8;
+        uintptr_t *slots = (uintptr_t *)realloc(inject->slots, scan->capacity * sizeof(uintptr_t));
+        uintptr_t *saved = slots != NULL ? (uintptr_t *)realloc(inject->saved, scan->capacity * sizeof(uintptr_t)) : NULL;
+        if (slots == NULL || saved == NULL) {
+            perror("Failed to allocate memory for injected call sites");
+            exit(EXIT_FAILURE);
+        }
+        inject->slots = slots;
+        inject->saved = saved;
+    }
+    inject->slots[inject->slot_count++] = slot;
+}
+
+// Make a GOT entry writable and store value in it, protect_again puts a
+// read-only page back the way the loader left it.
+static bool fossil_mockup_inject_write_slot(uintptr_t slot, uintptr_t value, bool protect_again) {
+    uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    void *page = (void *)(slot & ~(page_size - 1));
+    if (mprotect(page, (size_t)page_size, PROT_READ | PROT_WRITE) != 0) {
+        return false;
+    }
+    *(volatile uintptr_t *)slot = value;
+    if (protect_again) {
+        mprotect(page, (size_t)page_size, PROT_READ);
+    }
+    return true;
+}
+
+static void fossil_mockup_inject_scan_table(fossil_mockup_inject_scan_t *scan, size_t first, uintptr_t base, const char *table, size_t size, bool rela,
+                                            const ElfW(Sym) *symbols, const char *strings) {
+    size_t entry_size = rela ? sizeof(ElfW(Rela)) : sizeof(ElfW(Rel));
+    for (size_t offset = 0; offset + entry_size <= size; offset += entry_size) {
+        // Rel is a prefix of Rela, the addend is not needed.
+        const ElfW(Rel) *relocation = (const ElfW(Rel) *)(const void *)(table + offset);
+        size_t symbol = FOSSIL_INJECT_R_SYM(relocation->r_info);
+        if (symbol == 0 || !fossil_mockup_inject_is_slot((uint32_t)FOSSIL_INJECT_R_TYPE(relocation->r_info))) {
+            continue;
+        }
+        if (strcmp(strings + symbols[symbol].st_name, scan->inject->dependency_name) == 0) {
+            fossil_mockup_inject_add_slot(scan, first, base + relocation->r_offset);
+        }
+    }
+}
+
+static int fossil_mockup_inject_visit(struct dl_phdr_info *info, size_t size, void *data) {
+    (void)size;
+    fossil_mockup_inject_scan_t *scan = (fossil_mockup_inject_scan_t *)data;
+    const ElfW(Dyn) *dynamic = NULL;
+    scan->relro_start = 0;
+    scan->relro_end = 0;
+    for (ElfW(Half) i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr) *header = &info->dlpi_phdr[i];
+        if (header->p_type == PT_DYNAMIC) {
+            dynamic = (const ElfW(Dyn) *)(info->dlpi_addr + header->p_vaddr);
+        } else if (header->p_type == PT_GNU_RELRO) {
+            scan->relro_start = info->dlpi_addr + header->p_vaddr;
+            scan->relro_end = scan->relro_start + header->p_memsz;
+        }
+    }
+    if (dynamic == NULL) {
+        return 0;
+    }
+
+    uintptr_t symbols = 0, strings = 0, jmprel = 0, rela = 0, rel = 0;
+    size_t jmprel_size = 0, rela_size = 0, rel_size = 0;
+    bool jmprel_is_rela = true;
+    for (; dynamic->d_tag != DT_NULL; dynamic++) {
+        switch (dynamic->d_tag) {
+            case DT_SYMTAB:   symbols = dynamic->d_un.d_ptr; break;
+            case DT_STRTAB:   strings = dynamic->d_un.d_ptr; break;
+            case DT_JMPREL:   jmprel = dynamic->d_un.d_ptr; break;
+            case DT_PLTRELSZ: jmprel_size = dynamic->d_un.d_val; break;
+            case DT_PLTREL:   jmprel_is_rela = dynamic->d_un.d_val == DT_RELA; break;
+            case DT_RELA:     rela = dynamic->d_un.d_ptr; break;
+            case DT_RELASZ:   rela_size = dynamic->d_un.d_val; break;
+            case DT_REL:      rel = dynamic->d_un.d_ptr; break;
+            case DT_RELSZ:    rel_size = dynamic->d_un.d_val; break;
+            default: break;
+        }
+    }
+    if (symbols == 0 || strings == 0) {
+        return 0;
+    }
+    // glibc relocates these addresses in place, musl and the vDSO do not.
+    uintptr_t base = info->dlpi_addr;
+    uintptr_t *addresses[] = { &symbols, &strings, &jmprel, &rela, &rel };
+    for (size_t i = 0; i < sizeof(addresses) / sizeof(addresses[0]); i++) {
+        if (*addresses[i] != 0 && *addresses[i] < base) {
+            *addresses[i] += base;
+        }
+    }
+
+    size_t first = scan->inject->slot_count;
+    const ElfW(Sym) *symbol_table = (const ElfW(Sym) *)symbols;
+    const char *string_table = (const char *)strings;
+    if (jmprel != 0) {
+        fossil_mockup_inject_scan_table(scan, first, base, (const char *)jmprel, jmprel_size, jmprel_is_rela, symbol_table, string_table);
+    }
+    if (rela != 0) {
+        fossil_mockup_inject_scan_table(scan, first, base, (const char *)rela, rela_size, true, symbol_table, string_table);
+    }
+    if (rel != 0) {
+        fossil_mockup_inject_scan_table(scan, first, base, (const char *)rel, rel_size, false, symbol_table, string_table);
+    }
+
+    // Entries are pointer aligned, bit 0 remembers a read-only entry so
+    // restoring can protect it again. Only pages entirely inside
+    // PT_GNU_RELRO are read-only, a shared last page stays writable.
+    fossil_mockup_inject_t *inject = scan->inject;
+    uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    size_t kept = first;
+    for (size_t i = first; i < inject->slot_count; i++) {
+        uintptr_t slot = inject->slots[i];
+        bool relro = slot >= scan->relro_start && (slot & ~(page_size - 1)) + page_size <= scan->relro_end;
+        uintptr_t saved = *(volatile uintptr_t *)slot;
+        if (fossil_mockup_inject_write_slot(slot, scan->replacement, relro)) {
+            inject->slots[kept] = slot | (relro ? 1u : 0u);
+            inject->saved[kept] = saved;
+            kept++;
+        }
+    }
+    inject->slot_count = kept;
+    return 0;
+}
+
+#endif
+
+//
+// public functions
+//
 fossil_mockup_inject_t* fossil_mockup_inject_create(const char *dependency_name, void *replacement_object) {
     fossil_mockup_inject_t *inject = (fossil_mockup_inject_t *)malloc(sizeof(fossil_mockup_inject_t));
     if (inject == NULL) {
         perror("Failed to allocate memory for injected dependency");
         exit(EXIT_FAILURE);
     }
-    
+
     inject->dependency_name = _custom_fossil_test_strdup(dependency_name);
     if (inject->dependency_name == NULL) {
         perror("Failed to duplicate dependency name");
@@ -28,15 +215,80 @@ fossil_mockup_inject_t* fossil_mockup_inject_create(const char *dependency_name,
     }
 
     inject->replacement_object = replacement_object;
+    inject->replacement_function = NULL;
+    inject->original = NULL;
+    inject->slots = NULL;
+    inject->saved = NULL;
+    inject->slot_count = 0;
+    inject->patched = false;
     inject->next = NULL;
     return inject;
 }
 
+fossil_mockup_inject_t* fossil_mockup_inject_create_function(const char *dependency_name, fossil_mockup_function_t replacement) {
+    fossil_mockup_inject_t *inject = fossil_mockup_inject_create(dependency_name, NULL);
+    inject->replacement_function = replacement;
+    return inject;
+}
+
 void* fossil_mockup_inject_get_replacement(fossil_mockup_inject_t *inject) {
     return inject->replacement_object;
 }
 
+bool fossil_mockup_inject_patch(fossil_mockup_inject_t *inject) {
+    if (inject->patched) {
+        return true;
+    }
+    if (inject->replacement_function == NULL) {
+        fprintf(stderr, "Injected dependency '%s' has no replacement function\n", inject->dependency_name);
+        return false;
+    }
+#ifdef FOSSIL_INJECT_ELF
+    fossil_mockup_inject_get_original(inject);
+    fossil_mockup_inject_scan_t scan = { inject, 0, 0, 0, 0 };
+    memcpy(&scan.replacement, &inject->replacement_function, sizeof(scan.replacement));
+    inject->slot_count = 0;
+    dl_iterate_phdr(fossil_mockup_inject_visit, &scan);
+    inject->patched = inject->slot_count > 0;
+    if (!inject->patched) {
+        fprintf(stderr, "No call sites of '%s' could be patched\n", inject->dependency_name);
+    }
+    return inject->patched;
+#else
+    fprintf(stderr, "Patching '%s' at runtime is not supported on this platform\n", inject->dependency_name);
+    return false;
+#endif
+}
+
+void fossil_mockup_inject_restore(fossil_mockup_inject_t *inject) {
+    if (!inject->patched) {
+        return;
+    }
+#ifdef FOSSIL_INJECT_ELF
+    for (size_t i = 0; i < inject->slot_count; i++) {
+        uintptr_t slot = inject->slots[i];
+        fossil_mockup_inject_write_slot(slot & ~(uintptr_t)1, inject->saved[i], (slot & 1) != 0);
+    }
+#endif
+    inject->slot_count = 0;
+    inject->patched = false;
+}
+
+fossil_mockup_function_t fossil_mockup_inject_get_original(fossil_mockup_inject_t *inject) {
+#ifdef FOSSIL_INJECT_ELF
+    if (inject->original == NULL) {
+        // POSIX guarantees dlsym results fit a function pointer.
+        void *symbol = dlsym(RTLD_DEFAULT, inject->dependency_name);
+        memcpy(&inject->original, &symbol, sizeof(inject->original));
+    }
+#endif
+    return inject->original;
+}
+
 void fossil_mockup_inject_erase(fossil_mockup_inject_t *inject) {
+    fossil_mockup_inject_restore(inject);
+    free(inject->slots);
+    free(inject->saved);
     free(inject->dependency_name);
     free(inject);
 }
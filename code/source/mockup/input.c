@@ -13,8 +13,96 @@ Description:
 #include "fossil/mockup/input.h"
 #include <stdarg.h>
 
+//
+// local functions
+//
+
+// Drop whatever backs the current source and fall back to an empty list.
+static void fossil_mockup_input_release(fossil_mockup_input_t *input) {
+    if (input->mocked_inputs) {
+        free(input->mocked_inputs);
+        input->mocked_inputs = NULL;
+    }
+    if (input->file) {
+        fossil_mockup_file_erase(input->file);
+        input->file = NULL;
+    }
+    input->input_count = 0;
+    input->source = FOSSIL_MOCKUP_INPUT_LIST;
+    input->generator = NULL;
+    input->context = NULL;
+    input->exhausted = false;
+    input->cursor = 0;
+    input->length = 0;
+}
+
+static bool fossil_mockup_input_open(fossil_mockup_input_t *input, const char *path, fossil_mockup_input_source_t source) {
+    fossil_mockup_file_t *file = fossil_mockup_file_create_from_fixture(path);
+    if (file == NULL) {
+        return false;
+    }
+    fossil_mockup_input_release(input);
+    input->file = file;
+    input->source = source;
+    return true;
+}
+
+// Copy the next line into the reusable line buffer, growing it geometrically.
+static void* fossil_mockup_input_next_line(fossil_mockup_input_t *input) {
+    const char *content = input->file->content;
+    size_t size = input->file->size;
+    if (size == 0) {
+        return NULL;
+    }
+    if (input->cursor >= size) {
+        input->cursor = 0;
+    }
+    const char *start = content + input->cursor;
+    const char *end = (const char *)memchr(start, '\n', size - input->cursor);
+    size_t length = end ? (size_t)(end - start) : size - input->cursor;
+    input->cursor += length + (end ? 1 : 0);
+    if (length > 0 && start[length - 1] == '\r') {
+        length--;
+    }
+
+    if (length + 1 > input->line_capacity) {
+        size_t capacity = input->line_capacity ? input->line_capacity : 64;
+        while (capacity < length + 1) {
+            capacity *= 2;
+        }
+        char *line = (char *)realloc(input->line, capacity);
+        if (line == NULL) {
+            perror("Failed to allocate memory for input line");
+            exit(EXIT_FAILURE);
+        }
+        input->line = line;
+        input->line_capacity = capacity;
+    }
+    memcpy(input->line, start, length);
+    input->line[length] = '\0';
+    input->length = length;
+    return input->line;
+}
+
+static void* fossil_mockup_input_next_record(fossil_mockup_input_t *input) {
+    size_t usable = input->file->size - input->file->size % input->record_size;
+    if (usable == 0) {
+        return NULL;
+    }
+    if (input->cursor >= usable) {
+        input->cursor = 0;
+    }
+    void *record = input->file->content + input->cursor;
+    input->cursor += input->record_size;
+    input->length = input->record_size;
+    return record;
+}
+
+//
+// public functions
+//
 fossil_mockup_input_t* fossil_mockup_input_create(const char *function_name) {
-    fossil_mockup_input_t *input = (fossil_mockup_input_t *)malloc(sizeof(fossil_mockup_input_t));
+    fossil_mockup_input_t *input = (fossil_mockup_input_t *)calloc(1, sizeof(fossil_mockup_input_t));
     if (input == NULL) {
         perror("Failed to allocate memory for input mock");
         exit(EXIT_FAILURE);
@@ -25,10 +113,7 @@ fossil_mockup_input_t* fossil_mockup_input_create(const char *function_name) {
         free(input);
         exit(EXIT_FAILURE);
     }
-    input->mocked_inputs = NULL;
-    input->input_count = 0;
-    input->call_count = 0;
-    input->next = NULL;
+    input->source = FOSSIL_MOCKUP_INPUT_LIST;
     return input;
 }
 
@@ -46,20 +131,121 @@ void fossil_mockup_input_set_inputs(fossil_mockup_input_t *input, int32_t count,
     }
     va_end(args);
 
-    if (input->mocked_inputs) {
-        free(input->mocked_inputs);
-    }
-
+    fossil_mockup_input_release(input);
     input->mocked_inputs = mocked_inputs;
     input->input_count = count;
 }
 
+void fossil_mockup_input_set_generator(fossil_mockup_input_t *input, fossil_mockup_input_generator_t generator, void *context) {
+    fossil_mockup_input_release(input);
+    input->source = FOSSIL_MOCKUP_INPUT_GENERATOR;
+    input->generator = generator;
+    input->context = context;
+}
+
+void fossil_mockup_input_set_range(fossil_mockup_input_t *input, int64_t start, int64_t stop, int64_t step) {
+    if (step == 0) {
+        fprintf(stderr, "Input function '%s' was given a range with a zero step\n", input->function_name);
+        return;
+    }
+    fossil_mockup_input_release(input);
+    input->source = FOSSIL_MOCKUP_INPUT_RANGE;
+    input->range_start = start;
+    input->range_step = step;
+    input->input_count = 0;
+    // The count saturates so absurd ranges still cycle instead of overflowing.
+    if ((step > 0 && stop > start) || (step < 0 && stop < start)) {
+        uint64_t span = step > 0 ? (uint64_t)stop - (uint64_t)start : (uint64_t)start - (uint64_t)stop;
+        uint64_t stride = step > 0 ? (uint64_t)step : 0 - (uint64_t)step;
+        uint64_t count = (span + stride - 1) / stride;
+        input->input_count = count > INT32_MAX ? INT32_MAX : (int32_t)count;
+    }
+}
+
+bool fossil_mockup_input_set_lines(fossil_mockup_input_t *input, const char *path) {
+    if (!fossil_mockup_input_open(input, path, FOSSIL_MOCKUP_INPUT_LINES)) {
+        return false;
+    }
+    // The fixture never changes, so its lines are counted once here instead
+    // of on every fossil_mockup_input_count call.
+    const char *cursor = input->file->content;
+    const char *end = cursor + input->file->size;
+    uint64_t count = 0;
+    while (cursor < end) {
+        const char *newline = (const char *)memchr(cursor, '\n', (size_t)(end - cursor));
+        count++;
+        cursor = newline ? newline + 1 : end;
+    }
+    input->input_count = count > INT32_MAX ? INT32_MAX : (int32_t)count;
+    return true;
+}
+
+bool fossil_mockup_input_set_records(fossil_mockup_input_t *input, const char *path, size_t record_size) {
+    if (record_size == 0) {
+        fprintf(stderr, "Input function '%s' was given a zero record size\n", input->function_name);
+        return false;
+    }
+    if (!fossil_mockup_input_open(input, path, FOSSIL_MOCKUP_INPUT_RECORDS)) {
+        return false;
+    }
+    input->record_size = record_size;
+    return true;
+}
+
+int64_t fossil_mockup_input_count(const fossil_mockup_input_t *input) {
+    switch (input->source) {
+        case FOSSIL_MOCKUP_INPUT_GENERATOR:
+            return -1;
+        case FOSSIL_MOCKUP_INPUT_RECORDS:
+            return (int64_t)(input->file->size / input->record_size);
+        case FOSSIL_MOCKUP_INPUT_LIST:
+        case FOSSIL_MOCKUP_INPUT_RANGE:
+        case FOSSIL_MOCKUP_INPUT_LINES:
+        default:
+            return input->input_count;
+    }
+}
+
+size_t fossil_mockup_input_length(const fossil_mockup_input_t *input) {
+    return input->length;
+}
+
 void* fossil_mockup_input_get(fossil_mockup_input_t *input) {
-    if (input->input_count > 0) {
+    void *value = NULL;
+    switch (input->source) {
+        case FOSSIL_MOCKUP_INPUT_GENERATOR:
+            if (input->exhausted || !input->generator(input->context, (uint64_t)input->call_count, &value)) {
+                input->exhausted = true;
+                return NULL;
+            }
+            break;
+        case FOSSIL_MOCKUP_INPUT_RANGE:
+            if (input->input_count == 0) {
+                return NULL;
+            }
+            input->value = (int64_t)((uint64_t)input->range_start +
+                                     (uint64_t)(input->call_count % input->input_count) * (uint64_t)input->range_step);
+            input->length = sizeof(int64_t);
+            value = &input->value;
+            break;
+        case FOSSIL_MOCKUP_INPUT_LINES:
+            value = fossil_mockup_input_next_line(input);
+            break;
+        case FOSSIL_MOCKUP_INPUT_RECORDS:
+            value = fossil_mockup_input_next_record(input);
+            break;
+        case FOSSIL_MOCKUP_INPUT_LIST:
+        default:
+            if (input->input_count == 0) {
+                return NULL;
+            }
+            value = input->mocked_inputs[input->call_count % input->input_count];
+            break;
+    }
+    if (value != NULL || input->source == FOSSIL_MOCKUP_INPUT_GENERATOR) {
         input->call_count++;
-        return input->mocked_inputs[(input->call_count - 1) % input->input_count];
     }
-    return NULL;
+    return value;
 }
 
 bool fossil_mockup_input_verify_call_count(fossil_mockup_input_t *input, int32_t expected_call_count) {
@@ -73,12 +259,13 @@ bool fossil_mockup_input_verify_call_count(fossil_mockup_input_t *input, int32_t
 
 void fossil_mockup_input_reset(fossil_mockup_input_t *input) {
     input->call_count = 0;
+    input->cursor = 0;
+    input->exhausted = false;
 }
 
 void fossil_mockup_input_erase(fossil_mockup_input_t *input) {
+    fossil_mockup_input_release(input);
+    free(input->line);
     free(input->function_name);
-    if (input->mocked_inputs) {
-        free(input->mocked_inputs);
-    }
     free(input);
 }
@@ -11,6 +11,7 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/internal.h"
+#include "fossil/mockup/sequence.h"
 #include <stdarg.h>
 
 fossil_mockup_t* fossil_mockup_create(const char *function_name, int32_t num_args) {
@@ -58,6 +59,7 @@ fossil_mockup_t* fossil_mockup_create(const char *function_name, int32_t num_arg
     mock->return_values = NULL;
     mock->return_count = 0;
     mock->call_count = 0;
+    mock->sequence_id = fossil_mockup_sequence_register(function_name);
     mock->called = false;
     mock->next = NULL;
     return mock;
@@ -105,6 +107,7 @@ void* fossil_mockup_call(fossil_mockup_t *mock, ...) {
     va_end(args);
     mock->call_count++;
     mock->called = true;
+    fossil_mockup_sequence_record(mock->sequence_id);
 
     if (mock->return_count > 0) {
         return mock->return_values[(mock->call_count - 1) % mock->return_count];
@@ -11,8 +11,36 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/network.h"
+#include <errno.h>
 #include <string.h>
 
+//
+// local functions
+//
+static bool fossil_mockup_network_impair(fossil_mockup_network_t *network, size_t requested, size_t *allowed) {
+    *allowed = requested;
+    if (network->fault == NULL) {
+        return true;
+    }
+    switch (fossil_mockup_fault_next(network->fault, requested, allowed)) {
+        case FOSSIL_MOCKUP_FAULT_AGAIN:
+            errno = EAGAIN;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_INTERRUPT:
+            errno = EINTR;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_DROP:
+            errno = ECONNRESET;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_PASS:
+        default:
+            return true;
+    }
+}
+
+//
+// public functions
+//
 fossil_mockup_network_t* fossil_mockup_network_create(const char *host, const char *request, const char *response) {
     fossil_mockup_network_t *network = (fossil_mockup_network_t *)malloc(sizeof(fossil_mockup_network_t));
     if (network == NULL) {
@@ -44,15 +72,47 @@ fossil_mockup_network_t* fossil_mockup_network_create(const char *host, const ch
         exit(EXIT_FAILURE);
     }
 
+    network->fault = NULL;
+    network->received = strlen(network->response);
     network->next = NULL;
     return network;
 }
 
 const char* fossil_mockup_network_request(fossil_mockup_network_t *network, const char *request) {
-    if (strcmp(request, network->request) == 0) {
-        return network->response;
+    if (strcmp(request, network->request) != 0) {
+        return NULL;
+    }
+    size_t allowed = 0;
+    if (!fossil_mockup_network_impair(network, 0, &allowed)) {
+        return NULL;
+    }
+    network->received = 0;
+    return network->response;
+}
+
+int64_t fossil_mockup_network_receive(fossil_mockup_network_t *network, void *buffer, size_t capacity) {
+    const char *pending = network->response + network->received;
+    size_t count = 0;
+    while (count < capacity && pending[count] != '\0') {
+        count++;
+    }
+    if (count == 0) {
+        if (network->fault != NULL && network->fault->dropped) {
+            errno = ECONNRESET;
+            return -1;
+        }
+        return 0;
     }
-    return NULL;
+    if (!fossil_mockup_network_impair(network, count, &count)) {
+        return -1;
+    }
+    memcpy(buffer, pending, count);
+    network->received += count;
+    return (int64_t)count;
+}
+
+void fossil_mockup_network_set_fault(fossil_mockup_network_t *network, fossil_mockup_fault_t *fault) {
+    network->fault = fault;
 }
 
 void fossil_mockup_network_erase(fossil_mockup_network_t *network) {
@@ -22,14 +22,24 @@ fossil_mockup_output_t* fossil_mockup_output_create(const char *function_name) {
     output->function_name = _custom_fossil_test_strdup(function_name);
     output->captured_outputs = NULL;
     output->output_count = 0;
+    output->output_capacity = 0;
     output->call_count = 0;
     output->next = NULL;
     return output;
 }
 
 void fossil_mockup_output_capture(fossil_mockup_output_t *output, const char *captured_output) {
+    if (output->call_count == output->output_capacity) {
+        int32_t capacity = output->output_capacity ? output->output_capacity * 2 : 8;
+        char **outputs = (char **)realloc(output->captured_outputs, (size_t)capacity * sizeof(char *));
+        if (outputs == NULL) {
+            perror("Failed to grow captured outputs");
+            exit(EXIT_FAILURE);
+        }
+        output->captured_outputs = outputs;
+        output->output_capacity = capacity;
+    }
     output->call_count++;
-    output->captured_outputs = (char **)realloc(output->captured_outputs, output->call_count * sizeof(char *));
     output->captured_outputs[output->call_count - 1] = _custom_fossil_test_strdup(captured_output);
     output->output_count = output->call_count;
 }
@@ -57,6 +67,7 @@ void fossil_mockup_output_reset(fossil_mockup_output_t *output) {
     }
     free(output->captured_outputs);
     output->captured_outputs = NULL;
+    output->output_capacity = 0;
     output->call_count = 0;
     output->output_count = 0;
 }
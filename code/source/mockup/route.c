@@ -0,0 +1,732 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/mockup/route.h"
+
+#define FOSSIL_ROUTE_INITIAL_BUCKETS 64
+#define FOSSIL_ROUTE_PATTERN_BUCKETS 16
+
+//
+// local types
+//
+typedef struct {
+    const char *text;   // points into the response body
+    size_t length;
+    bool placeholder;   // text is a capture name
+} fossil_mockup_response_part_t;
+
+struct fossil_mockup_response {
+    const char *body;
+    char *owned;        // NULL for borrowed bodies
+    size_t length;
+    fossil_mockup_response_part_t *parts;
+    size_t part_count;
+    bool is_template;
+    uint32_t references;
+};
+
+typedef enum {
+    FOSSIL_ROUTE_SEGMENT_LITERAL,
+    FOSSIL_ROUTE_SEGMENT_PARAM,   // ":name", one non-empty segment
+    FOSSIL_ROUTE_SEGMENT_ANY,     // "*", one segment
+    FOSSIL_ROUTE_SEGMENT_REST     // "**", every remaining segment
+} fossil_mockup_route_segment_kind_t;
+
+typedef struct {
+    fossil_mockup_route_segment_kind_t kind;
+    const char *text;   // points into the route path
+    size_t length;
+} fossil_mockup_route_segment_t;
+
+typedef struct fossil_mockup_route {
+    fossil_mockup_route_kind_t kind;
+    char *host;
+    char *method;
+    size_t method_length;
+    char *path;
+    size_t path_length;
+    uint64_t hash;
+    fossil_mockup_response_t *response;
+    fossil_mockup_route_segment_t *segments;
+    size_t segment_count;
+    const fossil_mockup_route_segment_t *key; // first literal segment, NULL if it is a wildcard
+    size_t order;                           // position among the patterns of its group
+    struct fossil_mockup_route *index_next; // pattern bucket or wildcard list
+    struct fossil_mockup_route *next;       // hash bucket or pattern list
+    struct fossil_mockup_route *owner_next; // every route, for erase
+} fossil_mockup_route_t;
+
+typedef struct fossil_mockup_route_node {
+    unsigned char byte;
+    const fossil_mockup_route_t *route;     // prefix ending at this node
+    struct fossil_mockup_route_node *child;
+    struct fossil_mockup_route_node *sibling;
+} fossil_mockup_route_node_t;
+
+// Prefix trie and pattern list shared by every route of one host and method.
+// Patterns are also indexed by their first path segment, patterns starting
+// with a wildcard are kept apart and tried along with every bucket.
+typedef struct fossil_mockup_route_group {
+    char *host;
+    char *method;
+    size_t method_length;
+    uint64_t hash;
+    fossil_mockup_route_node_t root;
+    fossil_mockup_route_t *patterns;
+    fossil_mockup_route_t *last_pattern;
+    size_t pattern_count;
+    fossil_mockup_route_t **pattern_buckets;
+    size_t pattern_bucket_count;
+    fossil_mockup_route_t *wildcards;
+    fossil_mockup_route_t *last_wildcard;
+    struct fossil_mockup_route_group *next;
+} fossil_mockup_route_group_t;
+
+struct fossil_mockup_route_table {
+    fossil_mockup_route_t **buckets;
+    size_t bucket_count;
+    size_t exact_count;
+    fossil_mockup_route_group_t **groups;
+    size_t group_bucket_count;
+    size_t group_count;
+    fossil_mockup_route_t *routes;
+    size_t route_count;
+};
+
+//
+// local functions
+//
+static uint64_t fossil_mockup_route_hash_bytes(uint64_t hash, const char *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    // Separator so "ab" + "c" and "a" + "bc" hash differently.
+    hash ^= 0xffu;
+    return hash * 1099511628211ULL;
+}
+
+static uint64_t fossil_mockup_route_group_hash(const char *host, const char *method, size_t method_length) {
+    uint64_t hash = fossil_mockup_route_hash_bytes(1469598103934665603ULL, host, strlen(host));
+    return fossil_mockup_route_hash_bytes(hash, method, method_length);
+}
+
+static bool fossil_mockup_route_same(const char *stored, size_t stored_length, const char *text, size_t length) {
+    return stored_length == length && memcmp(stored, text, length) == 0;
+}
+
+static void* fossil_mockup_route_alloc(size_t size, const char *what) {
+    void *memory = calloc(1, size);
+    if (memory == NULL) {
+        perror(what);
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static bool fossil_mockup_route_is_name(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Split a template into literal runs and "{name}" placeholders once, so
+// rendering is a walk over the parts.
+static void fossil_mockup_response_compile(fossil_mockup_response_t *response) {
+    size_t capacity = 0;
+    const char *text = response->body;
+    const char *end = response->body + response->length;
+    const char *literal = text;
+    while (text < end) {
+        const char *name_end = text + 1;
+        if (*text == '{') {
+            while (name_end < end && fossil_mockup_route_is_name(*name_end)) {
+                name_end++;
+            }
+        }
+        if (*text != '{' || name_end == text + 1 || name_end >= end || *name_end != '}') {
+            text++;
+            continue;
+        }
+        for (int pass = 0; pass < 2; pass++) {
+            const char *part_text = pass == 0 ? literal : text + 1;
+            size_t part_length = pass == 0 ? (size_t)(text - literal) : (size_t)(name_end - text - 1);
+            if (pass == 0 && part_length == 0) {
+                continue;
+            }
+            if (response->part_count == capacity) {
+                capacity = capacity ? capacity * 2 : 8;
+                fossil_mockup_response_part_t *parts = (fossil_mockup_response_part_t *)realloc(response->parts, capacity * sizeof(fossil_mockup_response_part_t));
+                if (parts == NULL) {
+                    perror("Failed to allocate memory for response template");
+                    exit(EXIT_FAILURE);
+                }
+                response->parts = parts;
+            }
+            response->parts[response->part_count].text = part_text;
+            response->parts[response->part_count].length = part_length;
+            response->parts[response->part_count].placeholder = pass == 1;
+            response->part_count++;
+        }
+        response->is_template = true;
+        text = name_end + 1;
+        literal = text;
+    }
+    if (response->is_template && literal < end) {
+        fossil_mockup_response_part_t *parts = (fossil_mockup_response_part_t *)realloc(response->parts, (response->part_count + 1) * sizeof(fossil_mockup_response_part_t));
+        if (parts == NULL) {
+            perror("Failed to allocate memory for response template");
+            exit(EXIT_FAILURE);
+        }
+        response->parts = parts;
+        response->parts[response->part_count].text = literal;
+        response->parts[response->part_count].length = (size_t)(end - literal);
+        response->parts[response->part_count].placeholder = false;
+        response->part_count++;
+    }
+}
+
+// Split a pattern on '/' into segments pointing into route->path.
+static bool fossil_mockup_route_compile(fossil_mockup_route_t *route) {
+    size_t count = 1;
+    for (size_t i = 0; i < route->path_length; i++) {
+        count += route->path[i] == '/';
+    }
+    route->segments = (fossil_mockup_route_segment_t *)fossil_mockup_route_alloc(count * sizeof(fossil_mockup_route_segment_t), "Failed to allocate memory for route pattern");
+    route->segment_count = count;
+
+    int32_t params = 0;
+    const char *text = route->path;
+    for (size_t i = 0; i < count; i++) {
+        const char *slash = memchr(text, '/', (size_t)(route->path + route->path_length - text));
+        size_t length = slash != NULL ? (size_t)(slash - text) : (size_t)(route->path + route->path_length - text);
+        fossil_mockup_route_segment_t *segment = &route->segments[i];
+        segment->text = text;
+        segment->length = length;
+        if (length >= 2 && text[0] == ':') {
+            segment->kind = FOSSIL_ROUTE_SEGMENT_PARAM;
+            segment->text = text + 1;
+            segment->length = length - 1;
+            params++;
+        } else if (length == 1 && text[0] == '*') {
+            segment->kind = FOSSIL_ROUTE_SEGMENT_ANY;
+        } else if (length == 2 && text[0] == '*' && text[1] == '*') {
+            segment->kind = FOSSIL_ROUTE_SEGMENT_REST;
+            if (i + 1 != count) {
+                fprintf(stderr, "Route pattern '%s' may only use '**' as its last segment\n", route->path);
+                return false;
+            }
+        } else {
+            segment->kind = FOSSIL_ROUTE_SEGMENT_LITERAL;
+        }
+        text += length + 1;
+    }
+    if (params > FOSSIL_MOCKUP_ROUTE_MAX_CAPTURES) {
+        fprintf(stderr, "Route pattern '%s' has more than %d parameters\n", route->path, FOSSIL_MOCKUP_ROUTE_MAX_CAPTURES);
+        return false;
+    }
+    return true;
+}
+
+// Walk the request path one segment at a time, without copying it.
+static bool fossil_mockup_route_match_pattern(const fossil_mockup_route_t *route, const char *path, size_t path_length, fossil_mockup_route_match_t *match) {
+    size_t position = 0;
+    bool exhausted = false;
+    int32_t captures = 0;
+    for (size_t i = 0; i < route->segment_count; i++) {
+        const fossil_mockup_route_segment_t *segment = &route->segments[i];
+        if (segment->kind == FOSSIL_ROUTE_SEGMENT_REST) {
+            match->capture_count = captures;
+            return true;
+        }
+        if (exhausted) {
+            return false; // the request has fewer segments
+        }
+        const char *text = path + position;
+        const char *slash = memchr(text, '/', path_length - position);
+        size_t length = slash != NULL ? (size_t)(slash - text) : path_length - position;
+        if (segment->kind == FOSSIL_ROUTE_SEGMENT_LITERAL) {
+            if (!fossil_mockup_route_same(segment->text, segment->length, text, length)) {
+                return false;
+            }
+        } else if (segment->kind == FOSSIL_ROUTE_SEGMENT_PARAM) {
+            if (length == 0) {
+                return false;
+            }
+            match->captures[captures].name = segment->text;
+            match->captures[captures].name_length = segment->length;
+            match->captures[captures].value = text;
+            match->captures[captures].value_length = length;
+            captures++;
+        }
+        if (slash == NULL) {
+            exhausted = true;
+        } else {
+            position += length + 1;
+        }
+    }
+    if (!exhausted) {
+        return false; // the request has more segments
+    }
+    match->capture_count = captures;
+    return true;
+}
+
+static void fossil_mockup_route_rehash(fossil_mockup_route_table_t *table, size_t bucket_count) {
+    fossil_mockup_route_t **buckets = (fossil_mockup_route_t **)fossil_mockup_route_alloc(bucket_count * sizeof(fossil_mockup_route_t *), "Failed to allocate route index");
+    for (size_t i = 0; i < table->bucket_count; i++) {
+        fossil_mockup_route_t *route = table->buckets[i];
+        while (route != NULL) {
+            fossil_mockup_route_t *next = route->next;
+            size_t bucket = (size_t)(route->hash & (bucket_count - 1));
+            route->next = buckets[bucket];
+            buckets[bucket] = route;
+            route = next;
+        }
+    }
+    free(table->buckets);
+    table->buckets = buckets;
+    table->bucket_count = bucket_count;
+}
+
+static void fossil_mockup_route_regroup(fossil_mockup_route_table_t *table, size_t bucket_count) {
+    fossil_mockup_route_group_t **groups = (fossil_mockup_route_group_t **)fossil_mockup_route_alloc(bucket_count * sizeof(fossil_mockup_route_group_t *), "Failed to allocate route index");
+    for (size_t i = 0; i < table->group_bucket_count; i++) {
+        fossil_mockup_route_group_t *group = table->groups[i];
+        while (group != NULL) {
+            fossil_mockup_route_group_t *next = group->next;
+            size_t bucket = (size_t)(group->hash & (bucket_count - 1));
+            group->next = groups[bucket];
+            groups[bucket] = group;
+            group = next;
+        }
+    }
+    free(table->groups);
+    table->groups = groups;
+    table->group_bucket_count = bucket_count;
+}
+
+static const fossil_mockup_route_t* fossil_mockup_route_find_exact(const fossil_mockup_route_table_t *table, const char *host, const char *method, size_t method_length, const char *path, size_t path_length) {
+    if (table->bucket_count == 0) {
+        return NULL;
+    }
+    uint64_t hash = fossil_mockup_route_hash_bytes(fossil_mockup_route_group_hash(host, method, method_length), path, path_length);
+    for (const fossil_mockup_route_t *route = table->buckets[hash & (table->bucket_count - 1)]; route != NULL; route = route->next) {
+        if (route->hash == hash && fossil_mockup_route_same(route->path, route->path_length, path, path_length) &&
+            fossil_mockup_route_same(route->method, route->method_length, method, method_length) && strcmp(route->host, host) == 0) {
+            return route;
+        }
+    }
+    return NULL;
+}
+
+static fossil_mockup_route_group_t* fossil_mockup_route_find_group(const fossil_mockup_route_table_t *table, const char *host, const char *method, size_t method_length) {
+    if (table->group_bucket_count == 0) {
+        return NULL;
+    }
+    uint64_t hash = fossil_mockup_route_group_hash(host, method, method_length);
+    for (fossil_mockup_route_group_t *group = table->groups[hash & (table->group_bucket_count - 1)]; group != NULL; group = group->next) {
+        if (group->hash == hash && fossil_mockup_route_same(group->method, group->method_length, method, method_length) && strcmp(group->host, host) == 0) {
+            return group;
+        }
+    }
+    return NULL;
+}
+
+static fossil_mockup_route_group_t* fossil_mockup_route_get_group(fossil_mockup_route_table_t *table, const char *host, const char *method) {
+    size_t method_length = strlen(method);
+    fossil_mockup_route_group_t *group = fossil_mockup_route_find_group(table, host, method, method_length);
+    if (group != NULL) {
+        return group;
+    }
+    if (table->group_count + 1 > table->group_bucket_count) {
+        fossil_mockup_route_regroup(table, table->group_bucket_count ? table->group_bucket_count * 2 : FOSSIL_ROUTE_INITIAL_BUCKETS);
+    }
+    group = (fossil_mockup_route_group_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_route_group_t), "Failed to allocate memory for route group");
+    group->host = _custom_fossil_test_strdup(host);
+    group->method = _custom_fossil_test_strdup(method);
+    group->method_length = method_length;
+    group->hash = fossil_mockup_route_group_hash(host, method, method_length);
+    size_t bucket = (size_t)(group->hash & (table->group_bucket_count - 1));
+    group->next = table->groups[bucket];
+    table->groups[bucket] = group;
+    table->group_count++;
+    return group;
+}
+
+static bool fossil_mockup_route_insert_prefix(fossil_mockup_route_group_t *group, const fossil_mockup_route_t *route) {
+    fossil_mockup_route_node_t *node = &group->root;
+    for (size_t i = 0; i < route->path_length; i++) {
+        unsigned char byte = (unsigned char)route->path[i];
+        fossil_mockup_route_node_t *child = node->child;
+        while (child != NULL && child->byte != byte) {
+            child = child->sibling;
+        }
+        if (child == NULL) {
+            child = (fossil_mockup_route_node_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_route_node_t), "Failed to allocate memory for route prefix");
+            child->byte = byte;
+            child->sibling = node->child;
+            node->child = child;
+        }
+        node = child;
+    }
+    if (node->route != NULL) {
+        return false;
+    }
+    node->route = route;
+    return true;
+}
+
+static const fossil_mockup_route_t* fossil_mockup_route_longest_prefix(const fossil_mockup_route_group_t *group, const char *path, size_t path_length) {
+    const fossil_mockup_route_node_t *node = &group->root;
+    const fossil_mockup_route_t *best = node->route;
+    for (size_t i = 0; i < path_length; i++) {
+        const fossil_mockup_route_node_t *child = node->child;
+        while (child != NULL && child->byte != (unsigned char)path[i]) {
+            child = child->sibling;
+        }
+        if (child == NULL) {
+            break;
+        }
+        node = child;
+        if (node->route != NULL) {
+            best = node->route;
+        }
+    }
+    return best;
+}
+
+static void fossil_mockup_route_free_nodes(fossil_mockup_route_node_t *node) {
+    while (node != NULL) {
+        fossil_mockup_route_node_t *sibling = node->sibling;
+        fossil_mockup_route_free_nodes(node->child);
+        free(node);
+        node = sibling;
+    }
+}
+
+// The segment a path is indexed by: the first one, or the second when the
+// path starts with '/' and the first is empty.
+static size_t fossil_mockup_route_key_index(const fossil_mockup_route_t *route) {
+    return route->segment_count > 1 && route->segments[0].kind == FOSSIL_ROUTE_SEGMENT_LITERAL && route->segments[0].length == 0 ? 1 : 0;
+}
+
+static const char* fossil_mockup_route_request_key(const char *path, size_t path_length, size_t *length) {
+    const char *text = path_length > 0 && path[0] == '/' ? path + 1 : path;
+    size_t left = path_length - (size_t)(text - path);
+    const char *slash = memchr(text, '/', left);
+    *length = slash != NULL ? (size_t)(slash - text) : left;
+    return text;
+}
+
+static void fossil_mockup_route_append(fossil_mockup_route_t **head, fossil_mockup_route_t *route) {
+    while (*head != NULL) {
+        head = &(*head)->index_next;
+    }
+    route->index_next = NULL;
+    *head = route;
+}
+
+// Buckets keep patterns in the order they were added, so rebuilding walks
+// the pattern list from the start.
+static void fossil_mockup_route_reindex(fossil_mockup_route_group_t *group, size_t bucket_count) {
+    free(group->pattern_buckets);
+    group->pattern_buckets = (fossil_mockup_route_t **)fossil_mockup_route_alloc(bucket_count * sizeof(fossil_mockup_route_t *), "Failed to allocate route index");
+    group->pattern_bucket_count = bucket_count;
+    for (fossil_mockup_route_t *route = group->patterns; route != NULL; route = route->next) {
+        if (route->key != NULL) {
+            fossil_mockup_route_append(&group->pattern_buckets[route->hash & (bucket_count - 1)], route);
+        }
+    }
+}
+
+static void fossil_mockup_route_index_pattern(fossil_mockup_route_group_t *group, fossil_mockup_route_t *route) {
+    const fossil_mockup_route_segment_t *segment = &route->segments[fossil_mockup_route_key_index(route)];
+    route->order = group->pattern_count++;
+    if (group->last_pattern != NULL) {
+        group->last_pattern->next = route;
+    } else {
+        group->patterns = route;
+    }
+    group->last_pattern = route;
+
+    if (segment->kind != FOSSIL_ROUTE_SEGMENT_LITERAL) {
+        if (group->last_wildcard != NULL) {
+            group->last_wildcard->index_next = route;
+        } else {
+            group->wildcards = route;
+        }
+        group->last_wildcard = route;
+        return;
+    }
+    route->key = segment;
+    route->hash = fossil_mockup_route_hash_bytes(1469598103934665603ULL, segment->text, segment->length);
+    if (group->pattern_count > group->pattern_bucket_count) {
+        fossil_mockup_route_reindex(group, group->pattern_bucket_count ? group->pattern_bucket_count * 2 : FOSSIL_ROUTE_PATTERN_BUCKETS);
+    } else {
+        fossil_mockup_route_append(&group->pattern_buckets[route->hash & (group->pattern_bucket_count - 1)], route);
+    }
+}
+
+static const fossil_mockup_route_t* fossil_mockup_route_next_keyed(const fossil_mockup_route_t *route, const char *key, size_t key_length) {
+    while (route != NULL && !fossil_mockup_route_same(route->key->text, route->key->length, key, key_length)) {
+        route = route->index_next;
+    }
+    return route;
+}
+
+// Only the patterns whose first segment is the request's, and the ones that
+// start with a wildcard, are tried, merged back into the order they were added.
+static const fossil_mockup_route_t* fossil_mockup_route_match_group(const fossil_mockup_route_group_t *group, const char *path, size_t path_length, fossil_mockup_route_match_t *match) {
+    if (group->pattern_count == 0) {
+        return NULL;
+    }
+    size_t key_length = 0;
+    const char *key = fossil_mockup_route_request_key(path, path_length, &key_length);
+    const fossil_mockup_route_t *keyed = NULL;
+    if (group->pattern_bucket_count > 0) {
+        uint64_t hash = fossil_mockup_route_hash_bytes(1469598103934665603ULL, key, key_length);
+        keyed = fossil_mockup_route_next_keyed(group->pattern_buckets[hash & (group->pattern_bucket_count - 1)], key, key_length);
+    }
+    const fossil_mockup_route_t *wildcard = group->wildcards;
+    while (keyed != NULL || wildcard != NULL) {
+        const fossil_mockup_route_t *route;
+        if (wildcard == NULL || (keyed != NULL && keyed->order < wildcard->order)) {
+            route = keyed;
+            keyed = fossil_mockup_route_next_keyed(keyed->index_next, key, key_length);
+        } else {
+            route = wildcard;
+            wildcard = wildcard->index_next;
+        }
+        if (fossil_mockup_route_match_pattern(route, path, path_length, match)) {
+            return route;
+        }
+    }
+    return NULL;
+}
+
+static bool fossil_mockup_route_lookup_method(const fossil_mockup_route_table_t *table, const char *host, const char *method, size_t method_length, const char *path, size_t path_length, fossil_mockup_route_match_t *match) {
+    const char *hosts[2] = { host, "*" };
+    size_t host_count = strcmp(host, "*") == 0 ? 1 : 2;
+    memset(match, 0, sizeof(*match));
+
+    for (size_t i = 0; i < host_count; i++) {
+        const fossil_mockup_route_t *route = fossil_mockup_route_find_exact(table, hosts[i], method, method_length, path, path_length);
+        if (route != NULL) {
+            match->response = route->response;
+            match->kind = FOSSIL_MOCKUP_ROUTE_EXACT;
+            return true;
+        }
+    }
+    const fossil_mockup_route_group_t *groups[2] = { NULL, NULL };
+    for (size_t i = 0; i < host_count; i++) {
+        groups[i] = fossil_mockup_route_find_group(table, hosts[i], method, method_length);
+        const fossil_mockup_route_t *route = groups[i] != NULL ? fossil_mockup_route_match_group(groups[i], path, path_length, match) : NULL;
+        if (route != NULL) {
+            match->response = route->response;
+            match->kind = FOSSIL_MOCKUP_ROUTE_PATTERN;
+            return true;
+        }
+    }
+    match->capture_count = 0;
+    for (size_t i = 0; i < host_count; i++) {
+        const fossil_mockup_route_t *route = groups[i] != NULL ? fossil_mockup_route_longest_prefix(groups[i], path, path_length) : NULL;
+        if (route != NULL) {
+            match->response = route->response;
+            match->kind = FOSSIL_MOCKUP_ROUTE_PREFIX;
+            return true;
+        }
+    }
+    return false;
+}
+
+//
+// public functions
+//
+fossil_mockup_response_t* fossil_mockup_response_create(const char *body) {
+    fossil_mockup_response_t *response = (fossil_mockup_response_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_response_t), "Failed to allocate memory for response");
+    response->owned = _custom_fossil_test_strdup(body);
+    response->body = response->owned;
+    response->length = strlen(body);
+    response->references = 1;
+    return response;
+}
+
+fossil_mockup_response_t* fossil_mockup_response_borrow(const char *body, size_t length) {
+    fossil_mockup_response_t *response = (fossil_mockup_response_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_response_t), "Failed to allocate memory for response");
+    response->body = body;
+    response->length = length;
+    response->references = 1;
+    return response;
+}
+
+fossil_mockup_response_t* fossil_mockup_response_template(const char *body) {
+    fossil_mockup_response_t *response = fossil_mockup_response_create(body);
+    fossil_mockup_response_compile(response);
+    return response;
+}
+
+bool fossil_mockup_response_is_template(const fossil_mockup_response_t *response) {
+    return response->is_template;
+}
+
+const char* fossil_mockup_response_body(const fossil_mockup_response_t *response, size_t *length) {
+    if (length != NULL) {
+        *length = response->length;
+    }
+    return response->body;
+}
+
+size_t fossil_mockup_response_render(const fossil_mockup_response_t *response, const fossil_mockup_route_match_t *match, char *buffer, size_t capacity) {
+    if (!response->is_template) {
+        if (capacity > 0) {
+            memcpy(buffer, response->body, response->length < capacity ? response->length : capacity);
+        }
+        return response->length;
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < response->part_count; i++) {
+        const fossil_mockup_response_part_t *part = &response->parts[i];
+        const char *text = part->text;
+        size_t length = part->length;
+        if (part->placeholder) {
+            text = NULL;
+            length = 0;
+            for (int32_t c = 0; match != NULL && c < match->capture_count; c++) {
+                if (fossil_mockup_route_same(match->captures[c].name, match->captures[c].name_length, part->text, part->length)) {
+                    text = match->captures[c].value;
+                    length = match->captures[c].value_length;
+                    break;
+                }
+            }
+        }
+        if (total < capacity && length > 0) {
+            memcpy(buffer + total, text, length < capacity - total ? length : capacity - total);
+        }
+        total += length;
+    }
+    return total;
+}
+
+void fossil_mockup_response_release(fossil_mockup_response_t *response) {
+    if (response == NULL || --response->references > 0) {
+        return;
+    }
+    free(response->parts);
+    free(response->owned);
+    free(response);
+}
+
+fossil_mockup_route_table_t* fossil_mockup_route_table_create(void) {
+    return (fossil_mockup_route_table_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_route_table_t), "Failed to allocate memory for route table");
+}
+
+bool fossil_mockup_route_add(fossil_mockup_route_table_t *table, fossil_mockup_route_kind_t kind, const char *host, const char *method, const char *path, fossil_mockup_response_t *response) {
+    fossil_mockup_route_t *route = (fossil_mockup_route_t *)fossil_mockup_route_alloc(sizeof(fossil_mockup_route_t), "Failed to allocate memory for route");
+    route->kind = kind;
+    route->host = _custom_fossil_test_strdup(host);
+    route->method = _custom_fossil_test_strdup(method);
+    route->method_length = strlen(method);
+    route->path = _custom_fossil_test_strdup(path);
+    route->path_length = strlen(path);
+    route->response = response;
+
+    bool added = false;
+    if (kind == FOSSIL_MOCKUP_ROUTE_EXACT) {
+        added = fossil_mockup_route_find_exact(table, host, method, route->method_length, path, route->path_length) == NULL;
+        if (added) {
+            if (table->exact_count + 1 > table->bucket_count) {
+                fossil_mockup_route_rehash(table, table->bucket_count ? table->bucket_count * 2 : FOSSIL_ROUTE_INITIAL_BUCKETS);
+            }
+            route->hash = fossil_mockup_route_hash_bytes(fossil_mockup_route_group_hash(host, method, route->method_length), path, route->path_length);
+            size_t bucket = (size_t)(route->hash & (table->bucket_count - 1));
+            route->next = table->buckets[bucket];
+            table->buckets[bucket] = route;
+            table->exact_count++;
+        }
+    } else if (kind == FOSSIL_MOCKUP_ROUTE_PREFIX) {
+        added = fossil_mockup_route_insert_prefix(fossil_mockup_route_get_group(table, host, method), route);
+    } else if (kind == FOSSIL_MOCKUP_ROUTE_PATTERN && fossil_mockup_route_compile(route)) {
+        fossil_mockup_route_index_pattern(fossil_mockup_route_get_group(table, host, method), route);
+        added = true;
+    }
+
+    if (!added) {
+        fprintf(stderr, "Route %s %s for host '%s' was not added\n", method, path, host);
+        free(route->segments);
+        free(route->path);
+        free(route->method);
+        free(route->host);
+        free(route);
+        return false;
+    }
+    response->references++;
+    route->owner_next = table->routes;
+    table->routes = route;
+    table->route_count++;
+    return true;
+}
+
+bool fossil_mockup_route_lookup(const fossil_mockup_route_table_t *table, const char *host, const char *method, const char *path, size_t path_length, fossil_mockup_route_match_t *match) {
+    return fossil_mockup_route_lookup_method(table, host, method, strlen(method), path, path_length, match);
+}
+
+bool fossil_mockup_route_lookup_request(const fossil_mockup_route_table_t *table, const char *host, const char *request, size_t length, fossil_mockup_route_match_t *match) {
+    if (fossil_mockup_route_lookup_method(table, host, "", 0, request, length, match)) {
+        return true;
+    }
+    const char *line_end = memchr(request, '\n', length);
+    size_t line_length = line_end != NULL ? (size_t)(line_end - request) : length;
+    if (line_length > 0 && request[line_length - 1] == '\r') {
+        line_length--;
+    }
+    const char *space = memchr(request, ' ', line_length);
+    if (space == NULL) {
+        return false;
+    }
+    const char *path = space + 1;
+    const char *path_end = memchr(path, ' ', line_length - (size_t)(path - request));
+    size_t path_length = path_end != NULL ? (size_t)(path_end - path) : line_length - (size_t)(path - request);
+    return fossil_mockup_route_lookup_method(table, host, request, (size_t)(space - request), path, path_length, match);
+}
+
+size_t fossil_mockup_route_count(const fossil_mockup_route_table_t *table) {
+    return table->route_count;
+}
+
+void fossil_mockup_route_table_erase(fossil_mockup_route_table_t *table) {
+    fossil_mockup_route_t *route = table->routes;
+    while (route != NULL) {
+        fossil_mockup_route_t *next = route->owner_next;
+        fossil_mockup_response_release(route->response);
+        free(route->segments);
+        free(route->path);
+        free(route->method);
+        free(route->host);
+        free(route);
+        route = next;
+    }
+    for (size_t i = 0; i < table->group_bucket_count; i++) {
+        fossil_mockup_route_group_t *group = table->groups[i];
+        while (group != NULL) {
+            fossil_mockup_route_group_t *next = group->next;
+            fossil_mockup_route_free_nodes(group->root.child);
+            free(group->pattern_buckets);
+            free(group->method);
+            free(group->host);
+            free(group);
+            group = next;
+        }
+    }
+    free(table->groups);
+    free(table->buckets);
+    free(table);
+}
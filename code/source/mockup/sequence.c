@@ -0,0 +1,371 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/atomic.h"
+#include "fossil/mockup/sequence.h"
+#include <stdarg.h>
+
+//
+// local types
+//
+typedef struct {
+    char **names;          // registered names indexed by id
+    int32_t *slots;        // open addressing table of id + 1, 0 marks an empty slot
+    int32_t name_count;
+    int32_t slot_capacity;
+    volatile uint32_t lock;
+} fossil_mockup_sequence_registry_t;
+
+typedef struct {
+    fossil_mockup_sequence_event_t *events;
+    size_t capacity;
+    volatile uint64_t head;
+    volatile uint64_t dropped;
+    volatile uint32_t active;
+    fossil_mockup_sequence_expect_t *expectations;
+} fossil_mockup_sequence_log_t;
+
+static fossil_mockup_sequence_registry_t registry;
+static fossil_mockup_sequence_log_t sequence_log;
+static volatile uint32_t next_thread_id;
+static FOSSIL_TEST_THREAD_LOCAL uint32_t current_thread_id;
+
+static uint32_t fossil_mockup_sequence_hash(const char *name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint64_t fossil_mockup_sequence_now(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void fossil_mockup_sequence_lock(void) {
+    while (fossil_atomic_exchange_u32(&registry.lock, 1) != 0) {
+        // registration only happens while creating mocks, spinning is fine
+    }
+}
+
+static void fossil_mockup_sequence_unlock(void) {
+    fossil_atomic_store_u32(&registry.lock, 0);
+}
+
+static void fossil_mockup_sequence_grow(void) {
+    int32_t capacity = registry.slot_capacity == 0 ? 64 : registry.slot_capacity * 2;
+    int32_t *slots = (int32_t *)calloc((size_t)capacity, sizeof(int32_t));
+    char **names = (char **)realloc(registry.names, (size_t)capacity * sizeof(char *));
+    if (slots == NULL || names == NULL) {
+        perror("Failed to allocate memory for sequence registry");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int32_t id = 0; id < registry.name_count; id++) {
+        uint32_t index = fossil_mockup_sequence_hash(names[id]) & (uint32_t)(capacity - 1);
+        while (slots[index] != 0) {
+            index = (index + 1) & (uint32_t)(capacity - 1);
+        }
+        slots[index] = id + 1;
+    }
+
+    free(registry.slots);
+    registry.slots = slots;
+    registry.names = names;
+    registry.slot_capacity = capacity;
+}
+
+int32_t fossil_mockup_sequence_register(const char *name) {
+    if (name == NULL) {
+        return -1;
+    }
+
+    fossil_mockup_sequence_lock();
+    // keep the table at most half full so probe chains stay short
+    if ((registry.name_count + 1) * 2 > registry.slot_capacity) {
+        fossil_mockup_sequence_grow();
+    }
+
+    uint32_t mask = (uint32_t)(registry.slot_capacity - 1);
+    uint32_t index = fossil_mockup_sequence_hash(name) & mask;
+    while (registry.slots[index] != 0) {
+        int32_t id = registry.slots[index] - 1;
+        if (strcmp(registry.names[id], name) == 0) {
+            fossil_mockup_sequence_unlock();
+            return id;
+        }
+        index = (index + 1) & mask;
+    }
+
+    int32_t id = registry.name_count;
+    registry.names[id] = _custom_fossil_test_strdup(name);
+    if (registry.names[id] == NULL) {
+        perror("Failed to duplicate mock name");
+        exit(EXIT_FAILURE);
+    }
+    registry.slots[index] = id + 1;
+    registry.name_count++;
+    fossil_mockup_sequence_unlock();
+    return id;
+}
+
+// The names array moves when registration grows it, the strings it points
+// to never do, so only the lookup has to hold the lock.
+const char* fossil_mockup_sequence_name(int32_t mock_id) {
+    const char *name = NULL;
+    fossil_mockup_sequence_lock();
+    if (mock_id >= 0 && mock_id < registry.name_count) {
+        name = registry.names[mock_id];
+    }
+    fossil_mockup_sequence_unlock();
+    return name;
+}
+
+static void fossil_mockup_sequence_clear_expectations(void) {
+    fossil_mockup_sequence_expect_t *current = sequence_log.expectations;
+    while (current != NULL) {
+        fossil_mockup_sequence_expect_t *next = current->next;
+        free(current->mock_ids);
+        free(current);
+        current = next;
+    }
+    sequence_log.expectations = NULL;
+}
+
+void fossil_mockup_sequence_start(size_t capacity) {
+    if (capacity == 0) {
+        capacity = FOSSIL_MOCKUP_SEQUENCE_DEFAULT_CAPACITY;
+    }
+
+    fossil_atomic_store_u32(&sequence_log.active, 0);
+    if (sequence_log.capacity != capacity) {
+        free(sequence_log.events);
+        sequence_log.events = (fossil_mockup_sequence_event_t *)calloc(capacity, sizeof(fossil_mockup_sequence_event_t));
+        if (sequence_log.events == NULL) {
+            perror("Failed to allocate memory for sequence log");
+            exit(EXIT_FAILURE);
+        }
+        sequence_log.capacity = capacity;
+    }
+    fossil_mockup_sequence_reset();
+    fossil_atomic_store_u32(&sequence_log.active, 1);
+}
+
+void fossil_mockup_sequence_stop(void) {
+    fossil_atomic_store_u32(&sequence_log.active, 0);
+}
+
+void fossil_mockup_sequence_record(int32_t mock_id) {
+    if (!fossil_atomic_load_u32(&sequence_log.active)) {
+        return;
+    }
+
+    uint64_t slot = fossil_atomic_fetch_add_u64(&sequence_log.head, 1);
+    if (slot >= sequence_log.capacity) {
+        fossil_atomic_fetch_add_u64(&sequence_log.dropped, 1);
+        return;
+    }
+
+    if (current_thread_id == 0) {
+        current_thread_id = fossil_atomic_fetch_add_u32(&next_thread_id, 1) + 1;
+    }
+
+    fossil_mockup_sequence_event_t *event = &sequence_log.events[slot];
+    event->sequence = slot;
+    event->timestamp = fossil_mockup_sequence_now();
+    event->mock_id = mock_id;
+    event->thread_id = current_thread_id;
+    fossil_atomic_store_u32(&event->ready, 1);
+}
+
+size_t fossil_mockup_sequence_count(void) {
+    uint64_t head = fossil_atomic_load_u64(&sequence_log.head);
+    return head < sequence_log.capacity ? (size_t)head : sequence_log.capacity;
+}
+
+size_t fossil_mockup_sequence_dropped(void) {
+    return (size_t)fossil_atomic_load_u64(&sequence_log.dropped);
+}
+
+const fossil_mockup_sequence_event_t* fossil_mockup_sequence_event(size_t index) {
+    if (index >= fossil_mockup_sequence_count()) {
+        return NULL;
+    }
+    fossil_mockup_sequence_event_t *event = &sequence_log.events[index];
+    while (!fossil_atomic_load_u32(&event->ready)) {
+        // a writer reserved the slot but has not finished filling it in
+    }
+    return event;
+}
+
+static fossil_mockup_sequence_expect_t* fossil_mockup_sequence_add_expectation(fossil_mockup_sequence_kind_t kind, int32_t id_count) {
+    fossil_mockup_sequence_expect_t *expect = (fossil_mockup_sequence_expect_t *)malloc(sizeof(fossil_mockup_sequence_expect_t));
+    if (expect == NULL) {
+        perror("Failed to allocate memory for sequence expectation");
+        exit(EXIT_FAILURE);
+    }
+    expect->mock_ids = (int32_t *)malloc((size_t)(id_count > 0 ? id_count : 1) * sizeof(int32_t));
+    if (expect->mock_ids == NULL) {
+        perror("Failed to allocate memory for sequence expectation");
+        free(expect);
+        exit(EXIT_FAILURE);
+    }
+    expect->kind = kind;
+    expect->id_count = id_count;
+    expect->expected_count = 0;
+    expect->next = sequence_log.expectations;
+    sequence_log.expectations = expect;
+    return expect;
+}
+
+void fossil_mockup_sequence_expect_order(int32_t count, ...) {
+    if (count <= 0) {
+        return;
+    }
+    fossil_mockup_sequence_expect_t *expect = fossil_mockup_sequence_add_expectation(FOSSIL_MOCKUP_SEQUENCE_ORDER, count);
+
+    va_list args;
+    va_start(args, count);
+    for (int32_t i = 0; i < count; i++) {
+        expect->mock_ids[i] = fossil_mockup_sequence_register(va_arg(args, const char *));
+    }
+    va_end(args);
+}
+
+void fossil_mockup_sequence_expect_before(const char *first, const char *then) {
+    fossil_mockup_sequence_expect_t *expect = fossil_mockup_sequence_add_expectation(FOSSIL_MOCKUP_SEQUENCE_BEFORE, 2);
+    expect->mock_ids[0] = fossil_mockup_sequence_register(first);
+    expect->mock_ids[1] = fossil_mockup_sequence_register(then);
+}
+
+void fossil_mockup_sequence_expect_count(const char *name, int32_t expected_count) {
+    fossil_mockup_sequence_expect_t *expect = fossil_mockup_sequence_add_expectation(FOSSIL_MOCKUP_SEQUENCE_COUNT, 1);
+    expect->mock_ids[0] = fossil_mockup_sequence_register(name);
+    expect->expected_count = expected_count;
+}
+
+static bool fossil_mockup_sequence_verify_order(fossil_mockup_sequence_expect_t *expect, size_t count) {
+    int32_t matched = 0;
+    for (size_t i = 0; i < count && matched < expect->id_count; i++) {
+        if (fossil_mockup_sequence_event(i)->mock_id == expect->mock_ids[matched]) {
+            matched++;
+        }
+    }
+    if (matched != expect->id_count) {
+        fprintf(stderr, "Call sequence mismatch: expected '%s' (step %d of %d) was not called in order\n",
+                fossil_mockup_sequence_name(expect->mock_ids[matched]), matched + 1, expect->id_count);
+        return false;
+    }
+    return true;
+}
+
+static bool fossil_mockup_sequence_verify_before(fossil_mockup_sequence_expect_t *expect, size_t count) {
+    const char *first = fossil_mockup_sequence_name(expect->mock_ids[0]);
+    const char *then = fossil_mockup_sequence_name(expect->mock_ids[1]);
+    size_t last_first = 0;
+    size_t first_then = 0;
+    bool seen_first = false;
+    bool seen_then = false;
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t id = fossil_mockup_sequence_event(i)->mock_id;
+        if (id == expect->mock_ids[0]) {
+            last_first = i;
+            seen_first = true;
+        } else if (id == expect->mock_ids[1] && !seen_then) {
+            first_then = i;
+            seen_then = true;
+        }
+    }
+
+    if (!seen_first || !seen_then) {
+        fprintf(stderr, "Call sequence mismatch: expected both '%s' and '%s' to be called\n", first, then);
+        return false;
+    }
+    if (last_first > first_then) {
+        fprintf(stderr, "Call sequence mismatch: '%s' was called at step %zu after '%s' at step %zu\n",
+                first, last_first, then, first_then);
+        return false;
+    }
+    return true;
+}
+
+static bool fossil_mockup_sequence_verify_count(fossil_mockup_sequence_expect_t *expect, size_t count) {
+    int32_t calls = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (fossil_mockup_sequence_event(i)->mock_id == expect->mock_ids[0]) {
+            calls++;
+        }
+    }
+    if (calls != expect->expected_count) {
+        fprintf(stderr, "Call sequence mismatch: '%s' was called %d times, expected %d times\n",
+                fossil_mockup_sequence_name(expect->mock_ids[0]), calls, expect->expected_count);
+        return false;
+    }
+    return true;
+}
+
+bool fossil_mockup_sequence_verify(void) {
+    size_t count = fossil_mockup_sequence_count();
+    bool result = true;
+
+    if (fossil_mockup_sequence_dropped() > 0) {
+        fprintf(stderr, "Call sequence log overflowed: %zu interactions were dropped\n", fossil_mockup_sequence_dropped());
+        result = false;
+    }
+
+    for (fossil_mockup_sequence_expect_t *expect = sequence_log.expectations; expect != NULL; expect = expect->next) {
+        switch (expect->kind) {
+            case FOSSIL_MOCKUP_SEQUENCE_ORDER:
+                result = fossil_mockup_sequence_verify_order(expect, count) && result;
+                break;
+            case FOSSIL_MOCKUP_SEQUENCE_BEFORE:
+                result = fossil_mockup_sequence_verify_before(expect, count) && result;
+                break;
+            case FOSSIL_MOCKUP_SEQUENCE_COUNT:
+                result = fossil_mockup_sequence_verify_count(expect, count) && result;
+                break;
+        }
+    }
+    return result;
+}
+
+void fossil_mockup_sequence_reset(void) {
+    size_t count = fossil_mockup_sequence_count();
+    for (size_t i = 0; i < count; i++) {
+        sequence_log.events[i].ready = 0;
+    }
+    fossil_atomic_store_u64(&sequence_log.head, 0);
+    fossil_atomic_store_u64(&sequence_log.dropped, 0);
+    fossil_mockup_sequence_clear_expectations();
+}
+
+void fossil_mockup_sequence_erase(void) {
+    fossil_mockup_sequence_stop();
+    fossil_mockup_sequence_clear_expectations();
+    free(sequence_log.events);
+    sequence_log.events = NULL;
+    sequence_log.capacity = 0;
+    fossil_atomic_store_u64(&sequence_log.head, 0);
+    fossil_atomic_store_u64(&sequence_log.dropped, 0);
+}
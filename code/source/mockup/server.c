@@ -0,0 +1,730 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/atomic.h"
+#include "fossil/_common/thread.h"
+#include "fossil/mockup/server.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#define FOSSIL_SERVER_EPOLL 1
+#endif
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+#define FOSSIL_SERVER_READ_CHUNK 16384
+#define FOSSIL_SERVER_MAX_EVENTS 256
+#define FOSSIL_SERVER_DATAGRAM_SIZE 65536
+
+//
+// local types
+//
+typedef struct fossil_mockup_server_connection {
+    int fd;
+    char *input;
+    size_t input_length;
+    size_t input_capacity;
+    size_t input_scanned;  // bytes already searched for a delimiter
+    char *output;          // bytes the socket did not take yet
+    size_t output_length;
+    size_t output_capacity;
+    size_t output_offset;
+    struct fossil_mockup_server_connection *prev;
+    struct fossil_mockup_server_connection *next;
+} fossil_mockup_server_connection_t;
+
+typedef struct {
+    void *owner;
+    bool readable;
+    bool writable;
+    bool hangup;
+} fossil_mockup_server_event_t;
+
+struct fossil_mockup_server {
+    char *host;
+    fossil_mockup_server_transport_t transport;
+    char *address;
+    uint16_t port;
+    char *delimiter;
+    size_t delimiter_length;
+    char *default_response;
+    fossil_mockup_network_t *networks;
+    fossil_mockup_network_t *last_network;
+    fossil_mockup_route_table_t *routes;
+    fossil_mockup_fault_t *fault;  // optional impairment, not owned
+    char *rendered;               // scratch for templated responses
+    size_t rendered_capacity;
+    int listen_fd;
+    int wake_fds[2];
+    int event_fd;                 // epoll instance on Linux
+#ifndef _WIN32
+    struct pollfd *poll_fds;      // poll fallback elsewhere
+#endif
+    void **poll_owners;
+    size_t poll_count;
+    size_t poll_capacity;
+    char *datagram;
+    fossil_mockup_server_connection_t *connections;
+    fossil_thread_t thread;
+    bool started;
+    volatile uint32_t running;
+    volatile uint64_t request_count;
+    volatile uint64_t unmatched_count;
+    volatile uint64_t connection_count;
+};
+
+//
+// local functions
+//
+#ifndef _WIN32
+
+static void fossil_mockup_server_reserve(char **buffer, size_t *capacity, size_t needed) {
+    if (needed <= *capacity) {
+        return;
+    }
+    size_t grown = *capacity ? *capacity : FOSSIL_SERVER_READ_CHUNK;
+    while (grown < needed) {
+        grown *= 2;
+    }
+    char *resized = (char *)realloc(*buffer, grown);
+    if (resized == NULL) {
+        perror("Failed to grow mock server buffer");
+        exit(EXIT_FAILURE);
+    }
+    *buffer = resized;
+    *capacity = grown;
+}
+
+static const char* fossil_mockup_server_lookup(fossil_mockup_server_t *server, const char *request, size_t length, size_t *response_length) {
+    fossil_mockup_route_match_t match;
+    if (fossil_mockup_route_lookup_request(server->routes, server->host, request, length, &match)) {
+        fossil_atomic_fetch_add_u64(&server->request_count, 1);
+        if (!fossil_mockup_response_is_template(match.response)) {
+            return fossil_mockup_response_body(match.response, response_length);
+        }
+        size_t needed = fossil_mockup_response_render(match.response, &match, server->rendered, server->rendered_capacity);
+        if (needed > server->rendered_capacity) {
+            fossil_mockup_server_reserve(&server->rendered, &server->rendered_capacity, needed);
+            fossil_mockup_response_render(match.response, &match, server->rendered, server->rendered_capacity);
+        }
+        *response_length = needed;
+        return needed > 0 ? server->rendered : "";
+    }
+    fossil_atomic_fetch_add_u64(&server->unmatched_count, 1);
+    if (server->default_response != NULL) {
+        *response_length = strlen(server->default_response);
+        return server->default_response;
+    }
+    return NULL;
+}
+
+static bool fossil_mockup_server_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0 && fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+}
+
+//
+// event loop, epoll on Linux and poll everywhere else
+//
+static bool fossil_mockup_server_loop_init(fossil_mockup_server_t *server) {
+#ifdef FOSSIL_SERVER_EPOLL
+    server->event_fd = epoll_create1(EPOLL_CLOEXEC);
+    return server->event_fd >= 0;
+#else
+    server->poll_count = 0;
+    return true;
+#endif
+}
+
+static void fossil_mockup_server_loop_close(fossil_mockup_server_t *server) {
+#ifdef FOSSIL_SERVER_EPOLL
+    if (server->event_fd >= 0) {
+        close(server->event_fd);
+        server->event_fd = -1;
+    }
+#else
+    server->poll_count = 0;
+#endif
+}
+
+static void fossil_mockup_server_loop_add(fossil_mockup_server_t *server, int fd, void *owner) {
+#ifdef FOSSIL_SERVER_EPOLL
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = owner;
+    epoll_ctl(server->event_fd, EPOLL_CTL_ADD, fd, &event);
+#else
+    if (server->poll_count == server->poll_capacity) {
+        size_t capacity = server->poll_capacity ? server->poll_capacity * 2 : 64;
+        struct pollfd *fds = (struct pollfd *)realloc(server->poll_fds, capacity * sizeof(struct pollfd));
+        void **owners = (void **)realloc(server->poll_owners, capacity * sizeof(void *));
+        if (fds == NULL || owners == NULL) {
+            perror("Failed to grow mock server poll set");
+            exit(EXIT_FAILURE);
+        }
+        server->poll_fds = fds;
+        server->poll_owners = owners;
+        server->poll_capacity = capacity;
+    }
+    server->poll_fds[server->poll_count].fd = fd;
+    server->poll_fds[server->poll_count].events = POLLIN;
+    server->poll_fds[server->poll_count].revents = 0;
+    server->poll_owners[server->poll_count] = owner;
+    server->poll_count++;
+#endif
+}
+
+static void fossil_mockup_server_loop_watch_write(fossil_mockup_server_t *server, int fd, void *owner, bool writable) {
+#ifdef FOSSIL_SERVER_EPOLL
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | (writable ? EPOLLOUT : 0);
+    event.data.ptr = owner;
+    epoll_ctl(server->event_fd, EPOLL_CTL_MOD, fd, &event);
+#else
+    (void)owner;
+    for (size_t i = 0; i < server->poll_count; i++) {
+        if (server->poll_fds[i].fd == fd) {
+            server->poll_fds[i].events = (short)(POLLIN | (writable ? POLLOUT : 0));
+            break;
+        }
+    }
+#endif
+}
+
+static void fossil_mockup_server_loop_remove(fossil_mockup_server_t *server, int fd) {
+#ifdef FOSSIL_SERVER_EPOLL
+    epoll_ctl(server->event_fd, EPOLL_CTL_DEL, fd, NULL);
+#else
+    for (size_t i = 0; i < server->poll_count; i++) {
+        if (server->poll_fds[i].fd == fd) {
+            server->poll_count--;
+            server->poll_fds[i] = server->poll_fds[server->poll_count];
+            server->poll_owners[i] = server->poll_owners[server->poll_count];
+            break;
+        }
+    }
+#endif
+}
+
+static int fossil_mockup_server_loop_wait(fossil_mockup_server_t *server, fossil_mockup_server_event_t *events, int max_events) {
+#ifdef FOSSIL_SERVER_EPOLL
+    struct epoll_event ready[FOSSIL_SERVER_MAX_EVENTS];
+    int count = epoll_wait(server->event_fd, ready, max_events, -1);
+    for (int i = 0; i < count; i++) {
+        events[i].owner = ready[i].data.ptr;
+        events[i].readable = (ready[i].events & EPOLLIN) != 0;
+        events[i].writable = (ready[i].events & EPOLLOUT) != 0;
+        events[i].hangup = (ready[i].events & (EPOLLERR | EPOLLHUP)) != 0;
+    }
+    return count;
+#else
+    if (poll(server->poll_fds, (nfds_t)server->poll_count, -1) < 0) {
+        return -1;
+    }
+    int count = 0;
+    for (size_t i = 0; i < server->poll_count && count < max_events; i++) {
+        short revents = server->poll_fds[i].revents;
+        if (revents == 0) {
+            continue;
+        }
+        events[count].owner = server->poll_owners[i];
+        events[count].readable = (revents & POLLIN) != 0;
+        events[count].writable = (revents & POLLOUT) != 0;
+        events[count].hangup = (revents & (POLLERR | POLLHUP | POLLNVAL)) != 0;
+        count++;
+    }
+    return count;
+#endif
+}
+
+//
+// connections
+//
+static void fossil_mockup_server_close_connection(fossil_mockup_server_t *server, fossil_mockup_server_connection_t *connection) {
+    fossil_mockup_server_loop_remove(server, connection->fd);
+    close(connection->fd);
+    if (connection->prev != NULL) {
+        connection->prev->next = connection->next;
+    } else {
+        server->connections = connection->next;
+    }
+    if (connection->next != NULL) {
+        connection->next->prev = connection->prev;
+    }
+    free(connection->input);
+    free(connection->output);
+    free(connection);
+}
+
+// send() through the impairment layer when one is attached, so replies can
+// be delayed, split into partial packets, refused or cut off.
+static ssize_t fossil_mockup_server_write(fossil_mockup_server_t *server, int fd, const char *data, size_t length) {
+    if (server->fault != NULL) {
+        size_t allowed = 0;
+        switch (fossil_mockup_fault_next(server->fault, length, &allowed)) {
+            case FOSSIL_MOCKUP_FAULT_AGAIN:
+                errno = EAGAIN;
+                return -1;
+            case FOSSIL_MOCKUP_FAULT_INTERRUPT:
+                errno = EINTR;
+                return -1;
+            case FOSSIL_MOCKUP_FAULT_DROP:
+                errno = ECONNRESET;
+                return -1;
+            case FOSSIL_MOCKUP_FAULT_PASS:
+            default:
+                length = allowed;
+                break;
+        }
+    }
+    return send(fd, data, length, MSG_NOSIGNAL);
+}
+
+// Send straight from the response when nothing is queued, so the common case
+// does not copy; whatever the socket does not take is queued in order.
+static bool fossil_mockup_server_send(fossil_mockup_server_t *server, fossil_mockup_server_connection_t *connection, const char *data, size_t length) {
+    size_t sent = 0;
+    if (connection->output_offset == connection->output_length) {
+        while (sent < length) {
+            ssize_t count = fossil_mockup_server_write(server, connection->fd, data + sent, length - sent);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    break;
+                }
+                return false;
+            }
+            sent += (size_t)count;
+        }
+    }
+    if (sent < length) {
+        bool was_idle = connection->output_offset == connection->output_length;
+        fossil_mockup_server_reserve(&connection->output, &connection->output_capacity, connection->output_length + length - sent);
+        memcpy(connection->output + connection->output_length, data + sent, length - sent);
+        connection->output_length += length - sent;
+        if (was_idle) {
+            fossil_mockup_server_loop_watch_write(server, connection->fd, connection, true);
+        }
+    }
+    return true;
+}
+
+static bool fossil_mockup_server_flush(fossil_mockup_server_t *server, fossil_mockup_server_connection_t *connection) {
+    while (connection->output_offset < connection->output_length) {
+        ssize_t count = fossil_mockup_server_write(server, connection->fd, connection->output + connection->output_offset,
+                                                   connection->output_length - connection->output_offset);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        connection->output_offset += (size_t)count;
+    }
+    connection->output_offset = 0;
+    connection->output_length = 0;
+    fossil_mockup_server_loop_watch_write(server, connection->fd, connection, false);
+    return true;
+}
+
+static const char* fossil_mockup_server_find_delimiter(const fossil_mockup_server_t *server, const char *data, size_t length) {
+    const char *end = data + length;
+    while ((size_t)(end - data) >= server->delimiter_length) {
+        const char *hit = (const char *)memchr(data, server->delimiter[0], (size_t)(end - data) - server->delimiter_length + 1);
+        if (hit == NULL) {
+            return NULL;
+        }
+        if (memcmp(hit, server->delimiter, server->delimiter_length) == 0) {
+            return hit;
+        }
+        data = hit + 1;
+    }
+    return NULL;
+}
+
+static bool fossil_mockup_server_read(fossil_mockup_server_t *server, fossil_mockup_server_connection_t *connection) {
+    fossil_mockup_server_reserve(&connection->input, &connection->input_capacity, connection->input_length + FOSSIL_SERVER_READ_CHUNK);
+    ssize_t count = recv(connection->fd, connection->input + connection->input_length, FOSSIL_SERVER_READ_CHUNK, 0);
+    if (count == 0) {
+        return false;
+    }
+    if (count < 0) {
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    }
+    connection->input_length += (size_t)count;
+
+    // Answer every complete request in the buffer, in arrival order.
+    size_t consumed = 0;
+    for (;;) {
+        size_t scan_from = connection->input_scanned > consumed ? connection->input_scanned : consumed;
+        const char *frame = connection->input + consumed;
+        const char *end = fossil_mockup_server_find_delimiter(server, connection->input + scan_from, connection->input_length - scan_from);
+        if (end == NULL) {
+            size_t keep = server->delimiter_length - 1;
+            connection->input_scanned = connection->input_length > keep ? connection->input_length - keep : 0;
+            break;
+        }
+        size_t response_length = 0;
+        const char *response = fossil_mockup_server_lookup(server, frame, (size_t)(end - frame), &response_length);
+        if (response != NULL && !fossil_mockup_server_send(server, connection, response, response_length)) {
+            return false;
+        }
+        consumed = (size_t)(end - connection->input) + server->delimiter_length;
+    }
+    if (consumed > 0) {
+        memmove(connection->input, connection->input + consumed, connection->input_length - consumed);
+        connection->input_length -= consumed;
+        connection->input_scanned = connection->input_scanned > consumed ? connection->input_scanned - consumed : 0;
+    }
+    return true;
+}
+
+static void fossil_mockup_server_accept(fossil_mockup_server_t *server) {
+    for (;;) {
+        int fd = accept(server->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            return; // EAGAIN once the backlog is drained, or out of descriptors
+        }
+        if (!fossil_mockup_server_nonblocking(fd)) {
+            close(fd);
+            continue;
+        }
+#ifdef SO_NOSIGPIPE
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+        fossil_mockup_server_connection_t *connection = (fossil_mockup_server_connection_t *)calloc(1, sizeof(fossil_mockup_server_connection_t));
+        if (connection == NULL) {
+            perror("Failed to allocate memory for mock server connection");
+            exit(EXIT_FAILURE);
+        }
+        connection->fd = fd;
+        connection->next = server->connections;
+        if (server->connections != NULL) {
+            server->connections->prev = connection;
+        }
+        server->connections = connection;
+        fossil_mockup_server_loop_add(server, fd, connection);
+        fossil_atomic_fetch_add_u64(&server->connection_count, 1);
+    }
+}
+
+static void fossil_mockup_server_receive_datagrams(fossil_mockup_server_t *server) {
+    for (;;) {
+        struct sockaddr_storage peer;
+        socklen_t peer_length = sizeof(peer);
+        ssize_t count = recvfrom(server->listen_fd, server->datagram, FOSSIL_SERVER_DATAGRAM_SIZE, 0,
+                                 (struct sockaddr *)&peer, &peer_length);
+        if (count < 0) {
+            return;
+        }
+        size_t length = (size_t)count;
+        if (length >= server->delimiter_length &&
+            memcmp(server->datagram + length - server->delimiter_length, server->delimiter, server->delimiter_length) == 0) {
+            length -= server->delimiter_length;
+        }
+        size_t response_length = 0;
+        const char *response = fossil_mockup_server_lookup(server, server->datagram, length, &response_length);
+        if (response != NULL && server->fault != NULL) {
+            // Datagrams that fail are lost, short ones arrive truncated.
+            size_t allowed = 0;
+            if (fossil_mockup_fault_next(server->fault, response_length, &allowed) != FOSSIL_MOCKUP_FAULT_PASS) {
+                continue;
+            }
+            response_length = allowed;
+        }
+        if (response != NULL) {
+            sendto(server->listen_fd, response, response_length, MSG_NOSIGNAL, (struct sockaddr *)&peer, peer_length);
+        }
+    }
+}
+
+static void* fossil_mockup_server_main(void *arg) {
+    fossil_mockup_server_t *server = (fossil_mockup_server_t *)arg;
+    fossil_mockup_server_event_t events[FOSSIL_SERVER_MAX_EVENTS];
+
+    while (fossil_atomic_load_u32(&server->running)) {
+        int count = fossil_mockup_server_loop_wait(server, events, FOSSIL_SERVER_MAX_EVENTS);
+        for (int i = 0; i < count; i++) {
+            void *owner = events[i].owner;
+            if (owner == (void *)&server->wake_fds[0]) {
+                fossil_atomic_store_u32(&server->running, 0);
+            } else if (owner == (void *)&server->listen_fd) {
+                if (server->transport == FOSSIL_MOCKUP_SERVER_UDP) {
+                    fossil_mockup_server_receive_datagrams(server);
+                } else {
+                    fossil_mockup_server_accept(server);
+                }
+            } else {
+                fossil_mockup_server_connection_t *connection = (fossil_mockup_server_connection_t *)owner;
+                bool keep = true;
+                if (events[i].writable) {
+                    keep = fossil_mockup_server_flush(server, connection);
+                }
+                if (keep && (events[i].readable || events[i].hangup)) {
+                    keep = fossil_mockup_server_read(server, connection);
+                }
+                if (!keep) {
+                    fossil_mockup_server_close_connection(server, connection);
+                }
+            }
+        }
+    }
+    while (server->connections != NULL) {
+        fossil_mockup_server_close_connection(server, server->connections);
+    }
+    return NULL;
+}
+
+static int fossil_mockup_server_bind(fossil_mockup_server_t *server) {
+    if (server->transport == FOSSIL_MOCKUP_SERVER_UNIX) {
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (server->address == NULL || strlen(server->address) >= sizeof(address.sun_path)) {
+            fprintf(stderr, "Invalid unix socket path for mock server '%s'\n", server->host);
+            return -1;
+        }
+        strcpy(address.sun_path, server->address);
+        unlink(server->address);
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            return -1;
+        }
+        return fd;
+    }
+
+    char ip[64] = "127.0.0.1";
+    unsigned port = 0;
+    if (server->address != NULL) {
+        const char *colon = strrchr(server->address, ':');
+        size_t ip_length = colon != NULL ? (size_t)(colon - server->address) : strlen(server->address);
+        if (ip_length > 0 && ip_length < sizeof(ip)) {
+            memcpy(ip, server->address, ip_length);
+            ip[ip_length] = '\0';
+        }
+        if (colon != NULL) {
+            port = (unsigned)strtoul(colon + 1, NULL, 10);
+        }
+    }
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    if (inet_pton(AF_INET, ip, &address.sin_addr) != 1) {
+        fprintf(stderr, "Invalid address '%s' for mock server '%s'\n", server->address, server->host);
+        return -1;
+    }
+    int fd = socket(AF_INET, server->transport == FOSSIL_MOCKUP_SERVER_UDP ? SOCK_DGRAM : SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    socklen_t length = sizeof(address);
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        getsockname(fd, (struct sockaddr *)&address, &length) != 0) {
+        close(fd);
+        return -1;
+    }
+    server->port = ntohs(address.sin_port);
+    return fd;
+}
+
+#endif
+
+//
+// public functions
+//
+fossil_mockup_server_t* fossil_mockup_server_create(const char *host, fossil_mockup_server_transport_t transport, const char *address) {
+    fossil_mockup_server_t *server = (fossil_mockup_server_t *)calloc(1, sizeof(fossil_mockup_server_t));
+    if (server == NULL) {
+        perror("Failed to allocate memory for mock server");
+        exit(EXIT_FAILURE);
+    }
+    server->host = _custom_fossil_test_strdup(host);
+    server->transport = transport;
+    server->address = address != NULL ? _custom_fossil_test_strdup(address) : NULL;
+    server->delimiter = _custom_fossil_test_strdup("\n");
+    server->delimiter_length = 1;
+    server->listen_fd = -1;
+    server->wake_fds[0] = -1;
+    server->wake_fds[1] = -1;
+    server->event_fd = -1;
+    server->routes = fossil_mockup_route_table_create();
+    return server;
+}
+
+void fossil_mockup_server_add(fossil_mockup_server_t *server, fossil_mockup_network_t *network) {
+    network->next = NULL;
+    if (server->last_network != NULL) {
+        server->last_network->next = network;
+    } else {
+        server->networks = network;
+    }
+    server->last_network = network;
+
+    // The route borrows the network's response, which lives until erase.
+    fossil_mockup_response_t *response = fossil_mockup_response_borrow(network->response, strlen(network->response));
+    fossil_mockup_route_add(server->routes, FOSSIL_MOCKUP_ROUTE_EXACT, network->host, "", network->request, response);
+    fossil_mockup_response_release(response);
+}
+
+fossil_mockup_route_table_t* fossil_mockup_server_routes(fossil_mockup_server_t *server) {
+    return server->routes;
+}
+
+void fossil_mockup_server_set_fault(fossil_mockup_server_t *server, fossil_mockup_fault_t *fault) {
+    server->fault = fault;
+}
+
+void fossil_mockup_server_set_default(fossil_mockup_server_t *server, const char *response) {
+    free(server->default_response);
+    server->default_response = response != NULL ? _custom_fossil_test_strdup(response) : NULL;
+}
+
+void fossil_mockup_server_set_delimiter(fossil_mockup_server_t *server, const char *delimiter) {
+    if (delimiter == NULL || delimiter[0] == '\0') {
+        fprintf(stderr, "Mock server '%s' needs a non-empty request delimiter\n", server->host);
+        return;
+    }
+    free(server->delimiter);
+    server->delimiter = _custom_fossil_test_strdup(delimiter);
+    server->delimiter_length = strlen(delimiter);
+}
+
+bool fossil_mockup_server_start(fossil_mockup_server_t *server) {
+#ifdef _WIN32
+    fprintf(stderr, "Mock server '%s' is not supported on this platform\n", server->host);
+    return false;
+#else
+    if (server->started) {
+        return true;
+    }
+    server->listen_fd = fossil_mockup_server_bind(server);
+    if (server->listen_fd < 0) {
+        fprintf(stderr, "Failed to bind mock server '%s'\n", server->host);
+        return false;
+    }
+    if ((server->transport != FOSSIL_MOCKUP_SERVER_UDP && listen(server->listen_fd, SOMAXCONN) != 0) ||
+        !fossil_mockup_server_nonblocking(server->listen_fd) || pipe(server->wake_fds) != 0 ||
+        !fossil_mockup_server_loop_init(server)) {
+        fprintf(stderr, "Failed to start mock server '%s'\n", server->host);
+        fossil_mockup_server_stop(server);
+        return false;
+    }
+    if (server->transport == FOSSIL_MOCKUP_SERVER_UDP && server->datagram == NULL) {
+        server->datagram = (char *)malloc(FOSSIL_SERVER_DATAGRAM_SIZE);
+        if (server->datagram == NULL) {
+            perror("Failed to allocate memory for mock server datagrams");
+            exit(EXIT_FAILURE);
+        }
+    }
+    fossil_mockup_server_loop_add(server, server->listen_fd, &server->listen_fd);
+    fossil_mockup_server_loop_add(server, server->wake_fds[0], &server->wake_fds[0]);
+    fossil_atomic_store_u32(&server->running, 1);
+    if (fossil_thread_create(&server->thread, fossil_mockup_server_main, server) != 0) {
+        fprintf(stderr, "Failed to start mock server thread for '%s'\n", server->host);
+        fossil_atomic_store_u32(&server->running, 0);
+        fossil_mockup_server_stop(server);
+        return false;
+    }
+    server->started = true;
+    return true;
+#endif
+}
+
+void fossil_mockup_server_stop(fossil_mockup_server_t *server) {
+#ifndef _WIN32
+    if (server->started) {
+        ssize_t ignored = write(server->wake_fds[1], "x", 1);
+        (void)ignored;
+        fossil_thread_join(server->thread);
+        server->started = false;
+    }
+    fossil_mockup_server_loop_close(server);
+    for (int i = 0; i < 2; i++) {
+        if (server->wake_fds[i] >= 0) {
+            close(server->wake_fds[i]);
+            server->wake_fds[i] = -1;
+        }
+    }
+    if (server->listen_fd >= 0) {
+        close(server->listen_fd);
+        server->listen_fd = -1;
+        if (server->transport == FOSSIL_MOCKUP_SERVER_UNIX) {
+            unlink(server->address);
+        }
+    }
+#else
+    (void)server;
+#endif
+}
+
+uint16_t fossil_mockup_server_port(const fossil_mockup_server_t *server) {
+    return server->port;
+}
+
+const char* fossil_mockup_server_path(const fossil_mockup_server_t *server) {
+    return server->transport == FOSSIL_MOCKUP_SERVER_UNIX ? server->address : NULL;
+}
+
+uint64_t fossil_mockup_server_request_count(const fossil_mockup_server_t *server) {
+    return fossil_atomic_load_u64((volatile uint64_t *)&server->request_count);
+}
+
+uint64_t fossil_mockup_server_unmatched_count(const fossil_mockup_server_t *server) {
+    return fossil_atomic_load_u64((volatile uint64_t *)&server->unmatched_count);
+}
+
+uint64_t fossil_mockup_server_connection_count(const fossil_mockup_server_t *server) {
+    return fossil_atomic_load_u64((volatile uint64_t *)&server->connection_count);
+}
+
+void fossil_mockup_server_erase(fossil_mockup_server_t *server) {
+    fossil_mockup_server_stop(server);
+    fossil_mockup_route_table_erase(server->routes);
+    fossil_mockup_network_t *network = server->networks;
+    while (network != NULL) {
+        fossil_mockup_network_t *next = network->next;
+        fossil_mockup_network_erase(network);
+        network = next;
+    }
+#ifndef _WIN32
+    free(server->poll_fds);
+#endif
+    free(server->poll_owners);
+    free(server->datagram);
+    free(server->rendered);
+    free(server->default_response);
+    free(server->delimiter);
+    free(server->address);
+    free(server->host);
+    free(server);
+}
@@ -11,6 +11,7 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/spy.h"
+#include "fossil/mockup/sequence.h"
 #include <stdarg.h>
 
 fossil_mockup_spy_t* fossil_mockup_spy_create(const char *function_name, int32_t num_args) {
@@ -23,6 +24,7 @@ fossil_mockup_spy_t* fossil_mockup_spy_create(const char *function_name, int32_t
     spy->num_args = num_args;
     spy->recorded_args = (void **)malloc(num_args * sizeof(void *));
     spy->call_count = 0;
+    spy->sequence_id = fossil_mockup_sequence_register(function_name);
     spy->next = NULL;
     return spy;
 }
@@ -35,6 +37,7 @@ void fossil_mockup_spy_record_call(fossil_mockup_spy_t *spy, ...) {
     }
     va_end(args);
     spy->call_count++;
+    fossil_mockup_sequence_record(spy->sequence_id);
 }
 
 void** fossil_mockup_spy_get_call_args(fossil_mockup_spy_t *spy, int32_t call_index) {
@@ -11,6 +11,7 @@ Description:
 ==============================================================================
 */
 #include "fossil/mockup/stub.h"
+#include "fossil/mockup/sequence.h"
 #include <stdarg.h>
 
 fossil_mockup_stub_t* fossil_mockup_stub_create(const char *function_name) {
@@ -30,6 +31,7 @@ fossil_mockup_stub_t* fossil_mockup_stub_create(const char *function_name) {
     stub->return_values = NULL;
     stub->return_count = 0;
     stub->call_count = 0;
+    stub->sequence_id = fossil_mockup_sequence_register(function_name);
     stub->next = NULL;
     return stub;
 }
@@ -54,6 +56,7 @@ void fossil_mockup_stub_set_return_values(fossil_mockup_stub_t *stub, int32_t co
 
 void* fossil_mockup_stub_call(fossil_mockup_stub_t *stub) {
     stub->call_count++;
+    fossil_mockup_sequence_record(stub->sequence_id);
 
     if (stub->return_count > 0) {
         return stub->return_values[(stub->call_count - 1) % stub->return_count];
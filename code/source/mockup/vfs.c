@@ -0,0 +1,855 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/mockup/vfs.h"
+#include <errno.h>
+#include <fcntl.h>
+
+#ifndef O_RDONLY
+#define O_RDONLY _O_RDONLY
+#define O_WRONLY _O_WRONLY
+#define O_RDWR   _O_RDWR
+#define O_CREAT  _O_CREAT
+#define O_EXCL   _O_EXCL
+#define O_TRUNC  _O_TRUNC
+#define O_APPEND _O_APPEND
+#endif
+
+#ifndef O_ACCMODE
+#define O_ACCMODE (O_RDONLY | O_WRONLY | O_RDWR)
+#endif
+
+#define FOSSIL_VFS_INITIAL_BUCKETS 64
+
+//
+// local types
+//
+typedef struct {
+    fossil_mockup_vfs_node_t *node;
+    int64_t position;
+    int flags;
+    bool in_use;
+} fossil_mockup_vfs_descriptor_t;
+
+typedef struct {
+    void *address;
+    fossil_mockup_vfs_node_t *node; // file behind a shared mapping, NULL for a private copy
+} fossil_mockup_vfs_mapping_t;
+
+typedef struct {
+    fossil_mockup_vfs_node_t **buckets;
+    size_t bucket_count;
+    size_t node_count;
+    fossil_mockup_vfs_descriptor_t *descriptors;
+    size_t descriptor_count;
+    size_t descriptor_capacity;
+    fossil_mockup_vfs_mapping_t *mappings;
+    size_t mapping_count;
+    size_t mapping_capacity;
+    char **mounts;
+    size_t mount_count;
+} fossil_mockup_vfs_t;
+
+static fossil_mockup_vfs_t _FOSSIL_VFS = {0};
+
+//
+// local functions
+//
+static void* fossil_mockup_vfs_grow(void *items, size_t *capacity, size_t item_size) {
+    size_t grown = *capacity ? *capacity * 2 : 8;
+    void *resized = realloc(items, grown * item_size);
+    if (resized == NULL) {
+        perror("Failed to grow virtual filesystem table");
+        exit(EXIT_FAILURE);
+    }
+    *capacity = grown;
+    return resized;
+}
+
+static uint64_t fossil_mockup_vfs_hash(const char *path) {
+    uint64_t hash = 1469598103934665603ULL;
+    while (*path) {
+        hash ^= (unsigned char)*path++;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Collapse repeated separators, "." and ".." so every spelling of a path
+// maps to the same key. Relative paths are kept relative.
+static char* fossil_mockup_vfs_normalize(const char *path) {
+    size_t length = strlen(path);
+    char *normal = (char *)malloc(length + 2);
+    if (normal == NULL) {
+        perror("Failed to allocate memory for path");
+        exit(EXIT_FAILURE);
+    }
+    bool absolute = path[0] == '/';
+    size_t out = 0;
+    if (absolute) {
+        normal[out++] = '/';
+    }
+    const char *cursor = path;
+    while (*cursor) {
+        while (*cursor == '/') {
+            cursor++;
+        }
+        const char *start = cursor;
+        while (*cursor && *cursor != '/') {
+            cursor++;
+        }
+        size_t part = (size_t)(cursor - start);
+        if (part == 0 || (part == 1 && start[0] == '.')) {
+            continue;
+        }
+        if (part == 2 && start[0] == '.' && start[1] == '.') {
+            size_t floor = absolute ? 1 : 0;
+            while (out > floor && normal[out - 1] != '/') {
+                out--;
+            }
+            if (out > floor) {
+                out--;
+            }
+            continue;
+        }
+        if (out > 0 && normal[out - 1] != '/') {
+            normal[out++] = '/';
+        }
+        memcpy(normal + out, start, part);
+        out += part;
+    }
+    if (out == 0) {
+        normal[out++] = '.';
+    }
+    normal[out] = '\0';
+    return normal;
+}
+
+static char* fossil_mockup_vfs_parent_path(const char *normal) {
+    const char *slash = strrchr(normal, '/');
+    if (slash == NULL) {
+        return _custom_fossil_test_strdup(".");
+    }
+    if (slash == normal) {
+        return _custom_fossil_test_strdup("/");
+    }
+    size_t length = (size_t)(slash - normal);
+    char *parent = (char *)malloc(length + 1);
+    if (parent == NULL) {
+        perror("Failed to allocate memory for path");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(parent, normal, length);
+    parent[length] = '\0';
+    return parent;
+}
+
+static fossil_mockup_vfs_node_t* fossil_mockup_vfs_find(const char *normal) {
+    if (_FOSSIL_VFS.bucket_count == 0) {
+        return NULL;
+    }
+    size_t bucket = (size_t)(fossil_mockup_vfs_hash(normal) & (_FOSSIL_VFS.bucket_count - 1));
+    for (fossil_mockup_vfs_node_t *node = _FOSSIL_VFS.buckets[bucket]; node != NULL; node = node->next) {
+        if (strcmp(node->path, normal) == 0) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+static void fossil_mockup_vfs_rehash(size_t bucket_count) {
+    fossil_mockup_vfs_node_t **buckets = (fossil_mockup_vfs_node_t **)calloc(bucket_count, sizeof(fossil_mockup_vfs_node_t *));
+    if (buckets == NULL) {
+        perror("Failed to allocate virtual filesystem index");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < _FOSSIL_VFS.bucket_count; i++) {
+        fossil_mockup_vfs_node_t *node = _FOSSIL_VFS.buckets[i];
+        while (node != NULL) {
+            fossil_mockup_vfs_node_t *next = node->next;
+            size_t bucket = (size_t)(fossil_mockup_vfs_hash(node->path) & (bucket_count - 1));
+            node->next = buckets[bucket];
+            buckets[bucket] = node;
+            node = next;
+        }
+    }
+    free(_FOSSIL_VFS.buckets);
+    _FOSSIL_VFS.buckets = buckets;
+    _FOSSIL_VFS.bucket_count = bucket_count;
+}
+
+// Takes ownership of normal.
+static fossil_mockup_vfs_node_t* fossil_mockup_vfs_insert(char *normal, fossil_mockup_vfs_node_t *parent, bool is_directory, uint32_t mode) {
+    if (_FOSSIL_VFS.node_count + 1 > _FOSSIL_VFS.bucket_count) {
+        fossil_mockup_vfs_rehash(_FOSSIL_VFS.bucket_count ? _FOSSIL_VFS.bucket_count * 2 : FOSSIL_VFS_INITIAL_BUCKETS);
+    }
+    fossil_mockup_vfs_node_t *node = (fossil_mockup_vfs_node_t *)malloc(sizeof(fossil_mockup_vfs_node_t));
+    if (node == NULL) {
+        perror("Failed to allocate memory for virtual file");
+        exit(EXIT_FAILURE);
+    }
+    node->path = normal;
+    node->is_directory = is_directory;
+    node->is_mount = false;
+    node->mode = mode;
+    node->file = is_directory ? NULL : fossil_mockup_file_create(normal, "");
+    node->parent = parent;
+    node->children = NULL;
+    node->sibling = NULL;
+    if (parent != NULL) {
+        node->sibling = parent->children;
+        parent->children = node;
+    }
+    size_t bucket = (size_t)(fossil_mockup_vfs_hash(normal) & (_FOSSIL_VFS.bucket_count - 1));
+    node->next = _FOSSIL_VFS.buckets[bucket];
+    _FOSSIL_VFS.buckets[bucket] = node;
+    _FOSSIL_VFS.node_count++;
+    return node;
+}
+
+static void fossil_mockup_vfs_detach(fossil_mockup_vfs_node_t *node) {
+    size_t bucket = (size_t)(fossil_mockup_vfs_hash(node->path) & (_FOSSIL_VFS.bucket_count - 1));
+    for (fossil_mockup_vfs_node_t **link = &_FOSSIL_VFS.buckets[bucket]; *link != NULL; link = &(*link)->next) {
+        if (*link == node) {
+            *link = node->next;
+            break;
+        }
+    }
+    if (node->parent != NULL) {
+        for (fossil_mockup_vfs_node_t **link = &node->parent->children; *link != NULL; link = &(*link)->sibling) {
+            if (*link == node) {
+                *link = node->sibling;
+                break;
+            }
+        }
+    }
+    node->parent = NULL;
+    node->next = NULL;
+    _FOSSIL_VFS.node_count--;
+}
+
+static void fossil_mockup_vfs_free_node(fossil_mockup_vfs_node_t *node) {
+    if (node->file != NULL) {
+        fossil_mockup_file_erase(node->file);
+    }
+    free(node->path);
+    free(node);
+}
+
+static bool fossil_mockup_vfs_is_open(const fossil_mockup_vfs_node_t *node) {
+    for (size_t i = 0; i < _FOSSIL_VFS.descriptor_count; i++) {
+        if (_FOSSIL_VFS.descriptors[i].in_use && _FOSSIL_VFS.descriptors[i].node == node) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool fossil_mockup_vfs_is_mapped(const fossil_mockup_vfs_node_t *node) {
+    for (size_t i = 0; i < _FOSSIL_VFS.mapping_count; i++) {
+        if (_FOSSIL_VFS.mappings[i].node == node) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// An unlinked node lives on only while it is still open or mapped somewhere.
+static void fossil_mockup_vfs_release(fossil_mockup_vfs_node_t *node) {
+    if (node->parent == NULL && !node->is_mount && !fossil_mockup_vfs_is_open(node) && !fossil_mockup_vfs_is_mapped(node)) {
+        fossil_mockup_vfs_free_node(node);
+    }
+}
+
+static bool fossil_mockup_vfs_under_mount(const char *normal) {
+    for (size_t i = 0; i < _FOSSIL_VFS.mount_count; i++) {
+        const char *root = _FOSSIL_VFS.mounts[i];
+        size_t length = strlen(root);
+        if (strcmp(root, "/") == 0) {
+            if (normal[0] == '/') {
+                return true;
+            }
+            continue;
+        }
+        if (strcmp(root, ".") == 0) {
+            if (normal[0] != '/') {
+                return true;
+            }
+            continue;
+        }
+        if (strncmp(normal, root, length) == 0 && (normal[length] == '\0' || normal[length] == '/')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Create missing directories up to and including normal; returns NULL if a
+// file is in the way or the path is outside every mount.
+static fossil_mockup_vfs_node_t* fossil_mockup_vfs_make_dirs(const char *normal) {
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_find(normal);
+    if (node != NULL) {
+        return node->is_directory ? node : NULL;
+    }
+    if (!fossil_mockup_vfs_under_mount(normal)) {
+        return NULL;
+    }
+    char *parent_path = fossil_mockup_vfs_parent_path(normal);
+    fossil_mockup_vfs_node_t *parent = fossil_mockup_vfs_make_dirs(parent_path);
+    free(parent_path);
+    if (parent == NULL) {
+        return NULL;
+    }
+    return fossil_mockup_vfs_insert(_custom_fossil_test_strdup(normal), parent, true, 0755);
+}
+
+static fossil_mockup_vfs_descriptor_t* fossil_mockup_vfs_descriptor(int fd) {
+    if (fd < FOSSIL_MOCKUP_VFS_FD_BASE) {
+        return NULL;
+    }
+    size_t index = (size_t)(fd - FOSSIL_MOCKUP_VFS_FD_BASE);
+    if (index >= _FOSSIL_VFS.descriptor_count || !_FOSSIL_VFS.descriptors[index].in_use) {
+        return NULL;
+    }
+    return &_FOSSIL_VFS.descriptors[index];
+}
+
+// Faults attached to a file mock apply to descriptor I/O as well, a short
+// transfer becomes a short read or write and a failure returns -1.
+static bool fossil_mockup_vfs_impair(fossil_mockup_file_t *file, size_t *count) {
+    if (file->fault == NULL || *count == 0) {
+        return true;
+    }
+    size_t allowed = 0;
+    switch (fossil_mockup_fault_next(file->fault, *count, &allowed)) {
+        case FOSSIL_MOCKUP_FAULT_AGAIN:
+            errno = EAGAIN;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_INTERRUPT:
+            errno = EINTR;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_DROP:
+            errno = EIO;
+            return false;
+        case FOSSIL_MOCKUP_FAULT_PASS:
+        default:
+            *count = allowed;
+            return true;
+    }
+}
+
+static ptrdiff_t fossil_mockup_vfs_read_at(fossil_mockup_file_t *file, void *buffer, size_t count, int64_t offset) {
+    if ((uint64_t)offset >= file->size) {
+        return 0;
+    }
+    size_t available = file->size - (size_t)offset;
+    if (count > available) {
+        count = available;
+    }
+    if (!fossil_mockup_vfs_impair(file, &count)) {
+        return -1;
+    }
+    memcpy(buffer, file->content + offset, count);
+    return (ptrdiff_t)count;
+}
+
+static ptrdiff_t fossil_mockup_vfs_write_at(fossil_mockup_vfs_node_t *node, const void *buffer, size_t count, int64_t offset) {
+    fossil_mockup_file_t *file = node->file;
+    if (!fossil_mockup_vfs_impair(file, &count)) {
+        return -1;
+    }
+    // Shared mappings point into the content, so it must not move while one
+    // is in use. A write that would have to grow the buffer fails instead.
+    uint64_t end = (uint64_t)offset + count;
+    if (end > file->size && (file->storage != FOSSIL_MOCKUP_FILE_OWNED || end >= file->capacity) &&
+        fossil_mockup_vfs_is_mapped(node)) {
+        errno = ENOSPC;
+        return -1;
+    }
+    // The fault was consulted above, keep the file mock from rolling again.
+    fossil_mockup_fault_t *fault = file->fault;
+    size_t position = file->position;
+    file->fault = NULL;
+    file->position = (size_t)offset;
+    fossil_mockup_file_write(buffer, 1, count, file);
+    file->position = position;
+    file->fault = fault;
+    return (ptrdiff_t)count;
+}
+
+//
+// public functions
+//
+int fossil_mockup_vfs_mount(const char *root) {
+    char *normal = fossil_mockup_vfs_normalize(root);
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_find(normal);
+    if (node != NULL && !node->is_directory) {
+        free(normal);
+        errno = ENOTDIR;
+        return -1;
+    }
+    if (_FOSSIL_VFS.mount_count % 8 == 0) {
+        char **mounts = (char **)realloc(_FOSSIL_VFS.mounts, (_FOSSIL_VFS.mount_count + 8) * sizeof(char *));
+        if (mounts == NULL) {
+            perror("Failed to grow virtual filesystem mounts");
+            exit(EXIT_FAILURE);
+        }
+        _FOSSIL_VFS.mounts = mounts;
+    }
+    _FOSSIL_VFS.mounts[_FOSSIL_VFS.mount_count++] = _custom_fossil_test_strdup(normal);
+    if (node == NULL) {
+        char *parent_path = fossil_mockup_vfs_parent_path(normal);
+        fossil_mockup_vfs_node_t *parent = fossil_mockup_vfs_find(parent_path);
+        free(parent_path);
+        node = fossil_mockup_vfs_insert(normal, parent != NULL && parent->is_directory ? parent : NULL, true, 0755);
+    } else {
+        free(normal);
+    }
+    node->is_mount = true;
+    return 0;
+}
+
+bool fossil_mockup_vfs_owns(const char *path) {
+    if (path == NULL || _FOSSIL_VFS.mount_count == 0) {
+        return false;
+    }
+    char *normal = fossil_mockup_vfs_normalize(path);
+    bool owned = fossil_mockup_vfs_under_mount(normal);
+    free(normal);
+    return owned;
+}
+
+bool fossil_mockup_vfs_is_fd(int fd) {
+    return fossil_mockup_vfs_descriptor(fd) != NULL;
+}
+
+fossil_mockup_file_t* fossil_mockup_vfs_add_file(const char *path, const char *content) {
+    char *normal = fossil_mockup_vfs_normalize(path);
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_find(normal);
+    if (node == NULL) {
+        char *parent_path = fossil_mockup_vfs_parent_path(normal);
+        fossil_mockup_vfs_node_t *parent = fossil_mockup_vfs_make_dirs(parent_path);
+        free(parent_path);
+        if (parent == NULL || !fossil_mockup_vfs_under_mount(normal)) {
+            fprintf(stderr, "Virtual file '%s' is not below a mount point\n", path);
+            free(normal);
+            errno = ENOENT;
+            return NULL;
+        }
+        node = fossil_mockup_vfs_insert(normal, parent, false, 0644);
+    } else {
+        free(normal);
+        if (node->is_directory) {
+            errno = EISDIR;
+            return NULL;
+        }
+    }
+    node->file->size = 0;
+    node->file->content[0] = '\0';
+    fossil_mockup_vfs_write_at(node, content, strlen(content), 0);
+    return node->file;
+}
+
+fossil_mockup_vfs_node_t* fossil_mockup_vfs_lookup(const char *path) {
+    char *normal = fossil_mockup_vfs_normalize(path);
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_find(normal);
+    free(normal);
+    return node;
+}
+
+int fossil_mockup_vfs_mkdir(const char *path, uint32_t mode) {
+    char *normal = fossil_mockup_vfs_normalize(path);
+    if (fossil_mockup_vfs_find(normal) != NULL) {
+        free(normal);
+        errno = EEXIST;
+        return -1;
+    }
+    char *parent_path = fossil_mockup_vfs_parent_path(normal);
+    fossil_mockup_vfs_node_t *parent = fossil_mockup_vfs_find(parent_path);
+    free(parent_path);
+    if (parent == NULL || !parent->is_directory || !fossil_mockup_vfs_under_mount(normal)) {
+        free(normal);
+        errno = parent != NULL && !parent->is_directory ? ENOTDIR : ENOENT;
+        return -1;
+    }
+    fossil_mockup_vfs_insert(normal, parent, true, mode);
+    return 0;
+}
+
+int fossil_mockup_vfs_open(const char *path, int flags, uint32_t mode) {
+    char *normal = fossil_mockup_vfs_normalize(path);
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_find(normal);
+    int access = flags & O_ACCMODE;
+
+    if (node == NULL) {
+        char *parent_path = fossil_mockup_vfs_parent_path(normal);
+        fossil_mockup_vfs_node_t *parent = fossil_mockup_vfs_find(parent_path);
+        free(parent_path);
+        if (!(flags & O_CREAT) || parent == NULL || !parent->is_directory || !fossil_mockup_vfs_under_mount(normal)) {
+            free(normal);
+            errno = ENOENT;
+            return -1;
+        }
+        node = fossil_mockup_vfs_insert(normal, parent, false, mode);
+    } else {
+        free(normal);
+        if ((flags & O_CREAT) && (flags & O_EXCL)) {
+            errno = EEXIST;
+            return -1;
+        }
+        if (node->is_directory && access != O_RDONLY) {
+            errno = EISDIR;
+            return -1;
+        }
+    }
+    if ((flags & O_TRUNC) && access != O_RDONLY && node->file != NULL) {
+        node->file->size = 0;
+        node->file->content[0] = '\0';
+    }
+
+    size_t index = 0;
+    while (index < _FOSSIL_VFS.descriptor_count && _FOSSIL_VFS.descriptors[index].in_use) {
+        index++;
+    }
+    if (index == _FOSSIL_VFS.descriptor_count) {
+        if (_FOSSIL_VFS.descriptor_count == _FOSSIL_VFS.descriptor_capacity) {
+            _FOSSIL_VFS.descriptors = (fossil_mockup_vfs_descriptor_t *)fossil_mockup_vfs_grow(
+                _FOSSIL_VFS.descriptors, &_FOSSIL_VFS.descriptor_capacity, sizeof(fossil_mockup_vfs_descriptor_t));
+        }
+        _FOSSIL_VFS.descriptor_count++;
+    }
+    fossil_mockup_vfs_descriptor_t *descriptor = &_FOSSIL_VFS.descriptors[index];
+    descriptor->node = node;
+    descriptor->position = 0;
+    descriptor->flags = flags;
+    descriptor->in_use = true;
+    return FOSSIL_MOCKUP_VFS_FD_BASE + (int)index;
+}
+
+ptrdiff_t fossil_mockup_vfs_pread(int fd, void *buffer, size_t count, int64_t offset) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL || (descriptor->flags & O_ACCMODE) == O_WRONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    if (descriptor->node->is_directory) {
+        errno = EISDIR;
+        return -1;
+    }
+    if (offset < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return fossil_mockup_vfs_read_at(descriptor->node->file, buffer, count, offset);
+}
+
+ptrdiff_t fossil_mockup_vfs_pwrite(int fd, const void *buffer, size_t count, int64_t offset) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL || (descriptor->flags & O_ACCMODE) == O_RDONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    if (offset < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return fossil_mockup_vfs_write_at(descriptor->node, buffer, count, offset);
+}
+
+ptrdiff_t fossil_mockup_vfs_read(int fd, void *buffer, size_t count) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    ptrdiff_t result = fossil_mockup_vfs_pread(fd, buffer, count, descriptor->position);
+    if (result > 0) {
+        descriptor->position += result;
+    }
+    return result;
+}
+
+ptrdiff_t fossil_mockup_vfs_write(int fd, const void *buffer, size_t count) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((descriptor->flags & O_APPEND) && descriptor->node->file != NULL) {
+        descriptor->position = (int64_t)descriptor->node->file->size;
+    }
+    ptrdiff_t result = fossil_mockup_vfs_pwrite(fd, buffer, count, descriptor->position);
+    if (result > 0) {
+        descriptor->position += result;
+    }
+    return result;
+}
+
+int64_t fossil_mockup_vfs_lseek(int fd, int64_t offset, int whence) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    int64_t size = descriptor->node->file != NULL ? (int64_t)descriptor->node->file->size : 0;
+    int64_t position;
+    switch (whence) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = descriptor->position + offset;
+            break;
+        case SEEK_END:
+            position = size + offset;
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+    if (position < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    descriptor->position = position;
+    return position;
+}
+
+int fossil_mockup_vfs_close(int fd) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    fossil_mockup_vfs_node_t *node = descriptor->node;
+    descriptor->in_use = false;
+    descriptor->node = NULL;
+    fossil_mockup_vfs_release(node);
+    return 0;
+}
+
+int fossil_mockup_vfs_fstat(int fd, fossil_mockup_vfs_stat_t *info) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    fossil_mockup_vfs_node_t *node = descriptor->node;
+    info->size = node->file != NULL ? (uint64_t)node->file->size : 0;
+    info->inode = (uint64_t)(uintptr_t)node;
+    info->mode = node->mode;
+    info->is_directory = node->is_directory;
+    return 0;
+}
+
+int fossil_mockup_vfs_stat(const char *path, fossil_mockup_vfs_stat_t *info) {
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_lookup(path);
+    if (node == NULL) {
+        errno = ENOENT;
+        return -1;
+    }
+    info->size = node->file != NULL ? (uint64_t)node->file->size : 0;
+    info->inode = (uint64_t)(uintptr_t)node;
+    info->mode = node->mode;
+    info->is_directory = node->is_directory;
+    return 0;
+}
+
+int fossil_mockup_vfs_unlink(const char *path) {
+    fossil_mockup_vfs_node_t *node = fossil_mockup_vfs_lookup(path);
+    if (node == NULL) {
+        errno = ENOENT;
+        return -1;
+    }
+    if (node->is_mount) {
+        errno = EBUSY;
+        return -1;
+    }
+    if (node->children != NULL) {
+        errno = ENOTEMPTY;
+        return -1;
+    }
+    fossil_mockup_vfs_detach(node);
+    fossil_mockup_vfs_release(node);
+    return 0;
+}
+
+void* fossil_mockup_vfs_mmap(int fd, size_t length, int64_t offset, bool private_copy) {
+    fossil_mockup_vfs_descriptor_t *descriptor = fossil_mockup_vfs_descriptor(fd);
+    if (descriptor == NULL || descriptor->node->file == NULL) {
+        errno = EBADF;
+        return NULL;
+    }
+    fossil_mockup_file_t *file = descriptor->node->file;
+    if (length == 0 || offset < 0 || (size_t)offset + length > file->size) {
+        errno = EINVAL;
+        return NULL;
+    }
+    void *address = file->content + offset;
+    if (private_copy) {
+        address = malloc(length);
+        if (address == NULL) {
+            errno = ENOMEM;
+            return NULL;
+        }
+        memcpy(address, file->content + offset, length);
+    }
+    if (_FOSSIL_VFS.mapping_count == _FOSSIL_VFS.mapping_capacity) {
+        _FOSSIL_VFS.mappings = (fossil_mockup_vfs_mapping_t *)fossil_mockup_vfs_grow(
+            _FOSSIL_VFS.mappings, &_FOSSIL_VFS.mapping_capacity, sizeof(fossil_mockup_vfs_mapping_t));
+    }
+    _FOSSIL_VFS.mappings[_FOSSIL_VFS.mapping_count].address = address;
+    _FOSSIL_VFS.mappings[_FOSSIL_VFS.mapping_count].node = private_copy ? NULL : descriptor->node;
+    _FOSSIL_VFS.mapping_count++;
+    return address;
+}
+
+int fossil_mockup_vfs_munmap(void *address) {
+    for (size_t i = 0; i < _FOSSIL_VFS.mapping_count; i++) {
+        if (_FOSSIL_VFS.mappings[i].address == address) {
+            fossil_mockup_vfs_node_t *node = _FOSSIL_VFS.mappings[i].node;
+            _FOSSIL_VFS.mappings[i] = _FOSSIL_VFS.mappings[--_FOSSIL_VFS.mapping_count];
+            if (node == NULL) {
+                free(address);
+            } else {
+                fossil_mockup_vfs_release(node);
+            }
+            return 0;
+        }
+    }
+    errno = EINVAL;
+    return -1;
+}
+
+#if defined(__GLIBC__)
+static ssize_t fossil_mockup_vfs_cookie_read(void *cookie, char *buffer, size_t size) {
+    return (ssize_t)fossil_mockup_vfs_read((int)(intptr_t)cookie, buffer, size);
+}
+
+static ssize_t fossil_mockup_vfs_cookie_write(void *cookie, const char *buffer, size_t size) {
+    return (ssize_t)fossil_mockup_vfs_write((int)(intptr_t)cookie, buffer, size);
+}
+
+static int fossil_mockup_vfs_cookie_seek(void *cookie, off64_t *offset, int whence) {
+    int64_t position = fossil_mockup_vfs_lseek((int)(intptr_t)cookie, (int64_t)*offset, whence);
+    if (position < 0) {
+        return -1;
+    }
+    *offset = (off64_t)position;
+    return 0;
+}
+
+static int fossil_mockup_vfs_cookie_close(void *cookie) {
+    return fossil_mockup_vfs_close((int)(intptr_t)cookie);
+}
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+static int fossil_mockup_vfs_cookie_read(void *cookie, char *buffer, int size) {
+    return (int)fossil_mockup_vfs_read((int)(intptr_t)cookie, buffer, (size_t)size);
+}
+
+static int fossil_mockup_vfs_cookie_write(void *cookie, const char *buffer, int size) {
+    return (int)fossil_mockup_vfs_write((int)(intptr_t)cookie, buffer, (size_t)size);
+}
+
+static fpos_t fossil_mockup_vfs_cookie_seek(void *cookie, fpos_t offset, int whence) {
+    return (fpos_t)fossil_mockup_vfs_lseek((int)(intptr_t)cookie, (int64_t)offset, whence);
+}
+
+static int fossil_mockup_vfs_cookie_close(void *cookie) {
+    return fossil_mockup_vfs_close((int)(intptr_t)cookie);
+}
+#endif
+
+FILE* fossil_mockup_vfs_fopen(const char *path, const char *mode) {
+    int flags;
+    switch (mode[0]) {
+        case 'r':
+            flags = O_RDONLY;
+            break;
+        case 'w':
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+            break;
+        case 'a':
+            flags = O_WRONLY | O_CREAT | O_APPEND;
+            break;
+        default:
+            errno = EINVAL;
+            return NULL;
+    }
+    if (strchr(mode, '+') != NULL) {
+        flags = (flags & ~O_ACCMODE) | O_RDWR;
+    }
+    if (strchr(mode, 'x') != NULL) {
+        flags |= O_EXCL;
+    }
+
+#if defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+    int fd = fossil_mockup_vfs_open(path, flags, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+#if defined(__GLIBC__)
+    cookie_io_functions_t functions = {
+        fossil_mockup_vfs_cookie_read,
+        fossil_mockup_vfs_cookie_write,
+        fossil_mockup_vfs_cookie_seek,
+        fossil_mockup_vfs_cookie_close
+    };
+    FILE *stream = fopencookie((void *)(intptr_t)fd, mode, functions);
+#else
+    FILE *stream = funopen((void *)(intptr_t)fd,
+        fossil_mockup_vfs_cookie_read,
+        fossil_mockup_vfs_cookie_write,
+        fossil_mockup_vfs_cookie_seek,
+        fossil_mockup_vfs_cookie_close);
+#endif
+    if (stream == NULL) {
+        fossil_mockup_vfs_close(fd);
+    }
+    return stream;
+#else
+    (void)path;
+    (void)flags;
+    errno = ENOSYS;
+    return NULL;
+#endif
+}
+
+void fossil_mockup_vfs_erase(void) {
+    while (_FOSSIL_VFS.mapping_count > 0) {
+        fossil_mockup_vfs_munmap(_FOSSIL_VFS.mappings[_FOSSIL_VFS.mapping_count - 1].address);
+    }
+    // Unlinked nodes that are still open are only reachable from descriptors.
+    for (size_t i = 0; i < _FOSSIL_VFS.descriptor_count; i++) {
+        fossil_mockup_vfs_descriptor_t *descriptor = &_FOSSIL_VFS.descriptors[i];
+        if (descriptor->in_use) {
+            fossil_mockup_vfs_close(FOSSIL_MOCKUP_VFS_FD_BASE + (int)i);
+        }
+    }
+    for (size_t i = 0; i < _FOSSIL_VFS.bucket_count; i++) {
+        fossil_mockup_vfs_node_t *node = _FOSSIL_VFS.buckets[i];
+        while (node != NULL) {
+            fossil_mockup_vfs_node_t *next = node->next;
+            fossil_mockup_vfs_free_node(node);
+            node = next;
+        }
+    }
+    for (size_t i = 0; i < _FOSSIL_VFS.mount_count; i++) {
+        free(_FOSSIL_VFS.mounts[i]);
+    }
+    free(_FOSSIL_VFS.buckets);
+    free(_FOSSIL_VFS.descriptors);
+    free(_FOSSIL_VFS.mappings);
+    free(_FOSSIL_VFS.mounts);
+    memset(&_FOSSIL_VFS, 0, sizeof(_FOSSIL_VFS));
+}
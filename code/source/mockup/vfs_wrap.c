@@ -0,0 +1,342 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/mockup/vfs.h"
+
+// Linker interposition for the virtual filesystem. Linking a program with
+// -Wl,--wrap=<name> for each function below turns its calls to <name> into
+// calls to __wrap_<name>, while __real_<name> still reaches the C library.
+// Paths below a VFS mount and descriptors handed out by the VFS are served
+// from memory, everything else passes straight through.
+//
+// With _FILE_OFFSET_BITS=64, which meson sets on Linux, glibc headers turn
+// open, fopen, lseek, pread, pwrite, mmap, stat and fstat into their *64
+// names, and _FORTIFY_SOURCE turns some calls into __open_2, __read_chk and
+// friends. Those names are wrapped as well and land in the same place.
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+int __real_open(const char *path, int flags, ...);
+FILE* __real_fopen(const char *path, const char *mode);
+ssize_t __real_read(int fd, void *buffer, size_t count);
+ssize_t __real_write(int fd, const void *buffer, size_t count);
+ssize_t __real_pread(int fd, void *buffer, size_t count, off_t offset);
+ssize_t __real_pwrite(int fd, const void *buffer, size_t count, off_t offset);
+off_t __real_lseek(int fd, off_t offset, int whence);
+int __real_close(int fd);
+int __real_stat(const char *path, struct stat *info);
+int __real_fstat(int fd, struct stat *info);
+int __real_unlink(const char *path);
+void* __real_mmap(void *address, size_t length, int protection, int flags, int fd, off_t offset);
+int __real_munmap(void *address, size_t length);
+
+int __wrap_open(const char *path, int flags, ...);
+FILE* __wrap_fopen(const char *path, const char *mode);
+ssize_t __wrap_read(int fd, void *buffer, size_t count);
+ssize_t __wrap_write(int fd, const void *buffer, size_t count);
+ssize_t __wrap_pread(int fd, void *buffer, size_t count, off_t offset);
+ssize_t __wrap_pwrite(int fd, const void *buffer, size_t count, off_t offset);
+off_t __wrap_lseek(int fd, off_t offset, int whence);
+int __wrap_close(int fd);
+int __wrap_stat(const char *path, struct stat *info);
+int __wrap_fstat(int fd, struct stat *info);
+int __wrap_unlink(const char *path);
+void* __wrap_mmap(void *address, size_t length, int protection, int flags, int fd, off_t offset);
+int __wrap_munmap(void *address, size_t length);
+
+#ifdef __GLIBC__
+#define FOSSIL_MOCKUP_VFS_WRAP_GLIBC 1
+
+int __real_open64(const char *path, int flags, ...);
+FILE* __real_fopen64(const char *path, const char *mode);
+ssize_t __real_pread64(int fd, void *buffer, size_t count, off64_t offset);
+ssize_t __real_pwrite64(int fd, const void *buffer, size_t count, off64_t offset);
+off64_t __real_lseek64(int fd, off64_t offset, int whence);
+int __real_stat64(const char *path, struct stat64 *info);
+int __real_fstat64(int fd, struct stat64 *info);
+void* __real_mmap64(void *address, size_t length, int protection, int flags, int fd, off64_t offset);
+int __real___open_2(const char *path, int flags);
+int __real___open64_2(const char *path, int flags);
+ssize_t __real___read_chk(int fd, void *buffer, size_t count, size_t size);
+ssize_t __real___pread_chk(int fd, void *buffer, size_t count, off_t offset, size_t size);
+ssize_t __real___pread64_chk(int fd, void *buffer, size_t count, off64_t offset, size_t size);
+
+int __wrap_open64(const char *path, int flags, ...);
+FILE* __wrap_fopen64(const char *path, const char *mode);
+ssize_t __wrap_pread64(int fd, void *buffer, size_t count, off64_t offset);
+ssize_t __wrap_pwrite64(int fd, const void *buffer, size_t count, off64_t offset);
+off64_t __wrap_lseek64(int fd, off64_t offset, int whence);
+int __wrap_stat64(const char *path, struct stat64 *info);
+int __wrap_fstat64(int fd, struct stat64 *info);
+void* __wrap_mmap64(void *address, size_t length, int protection, int flags, int fd, off64_t offset);
+int __wrap___open_2(const char *path, int flags);
+int __wrap___open64_2(const char *path, int flags);
+ssize_t __wrap___read_chk(int fd, void *buffer, size_t count, size_t size);
+ssize_t __wrap___pread_chk(int fd, void *buffer, size_t count, off_t offset, size_t size);
+ssize_t __wrap___pread64_chk(int fd, void *buffer, size_t count, off64_t offset, size_t size);
+#endif
+
+// The VFS keeps the same fields for both layouts, only the type differs.
+#define FOSSIL_MOCKUP_VFS_FILL_STAT(vfs_info, info) \
+    do { \
+        memset((info), 0, sizeof(*(info))); \
+        (info)->st_size = (vfs_info)->size; \
+        (info)->st_ino = (vfs_info)->inode; \
+        (info)->st_mode = (mode_t)(((vfs_info)->is_directory ? S_IFDIR : S_IFREG) | ((vfs_info)->mode & 07777)); \
+        (info)->st_nlink = 1; \
+        (info)->st_blksize = 4096; \
+        (info)->st_blocks = ((vfs_info)->size + 511) / 512; \
+    } while (0)
+
+// A fortified call whose count does not fit its buffer is an overflow the C
+// library would have stopped, do the same for VFS descriptors.
+static void fossil_mockup_vfs_check_size(size_t count, size_t size) {
+    if (count > size) {
+        fprintf(stderr, "*** buffer overflow detected ***: read of %zu bytes into %zu\n", count, size);
+        abort();
+    }
+}
+
+int __wrap_open(const char *path, int flags, ...) {
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list args;
+        va_start(args, flags);
+        mode = (mode_t)va_arg(args, int);
+        va_end(args);
+    }
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_open(path, flags, (uint32_t)mode);
+    }
+    return __real_open(path, flags, mode);
+}
+
+FILE* __wrap_fopen(const char *path, const char *mode) {
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_fopen(path, mode);
+    }
+    return __real_fopen(path, mode);
+}
+
+ssize_t __wrap_read(int fd, void *buffer, size_t count) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_read(fd, buffer, count);
+    }
+    return __real_read(fd, buffer, count);
+}
+
+ssize_t __wrap_write(int fd, const void *buffer, size_t count) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_write(fd, buffer, count);
+    }
+    return __real_write(fd, buffer, count);
+}
+
+ssize_t __wrap_pread(int fd, void *buffer, size_t count, off_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_pread(fd, buffer, count, (int64_t)offset);
+    }
+    return __real_pread(fd, buffer, count, offset);
+}
+
+ssize_t __wrap_pwrite(int fd, const void *buffer, size_t count, off_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_pwrite(fd, buffer, count, (int64_t)offset);
+    }
+    return __real_pwrite(fd, buffer, count, offset);
+}
+
+off_t __wrap_lseek(int fd, off_t offset, int whence) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (off_t)fossil_mockup_vfs_lseek(fd, (int64_t)offset, whence);
+    }
+    return __real_lseek(fd, offset, whence);
+}
+
+int __wrap_close(int fd) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return fossil_mockup_vfs_close(fd);
+    }
+    return __real_close(fd);
+}
+
+int __wrap_stat(const char *path, struct stat *info) {
+    if (fossil_mockup_vfs_owns(path)) {
+        fossil_mockup_vfs_stat_t vfs_info;
+        if (fossil_mockup_vfs_stat(path, &vfs_info) != 0) {
+            return -1;
+        }
+        FOSSIL_MOCKUP_VFS_FILL_STAT(&vfs_info, info);
+        return 0;
+    }
+    return __real_stat(path, info);
+}
+
+int __wrap_fstat(int fd, struct stat *info) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        fossil_mockup_vfs_stat_t vfs_info;
+        if (fossil_mockup_vfs_fstat(fd, &vfs_info) != 0) {
+            return -1;
+        }
+        FOSSIL_MOCKUP_VFS_FILL_STAT(&vfs_info, info);
+        return 0;
+    }
+    return __real_fstat(fd, info);
+}
+
+int __wrap_unlink(const char *path) {
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_unlink(path);
+    }
+    return __real_unlink(path);
+}
+
+void* __wrap_mmap(void *address, size_t length, int protection, int flags, int fd, off_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        bool private_copy = (flags & MAP_PRIVATE) != 0 && (protection & PROT_WRITE) != 0;
+        void *mapped = fossil_mockup_vfs_mmap(fd, length, (int64_t)offset, private_copy);
+        return mapped != NULL ? mapped : MAP_FAILED;
+    }
+    return __real_mmap(address, length, protection, flags, fd, offset);
+}
+
+int __wrap_munmap(void *address, size_t length) {
+    if (fossil_mockup_vfs_munmap(address) == 0) {
+        return 0;
+    }
+    return __real_munmap(address, length);
+}
+
+#ifdef FOSSIL_MOCKUP_VFS_WRAP_GLIBC
+
+int __wrap_open64(const char *path, int flags, ...) {
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list args;
+        va_start(args, flags);
+        mode = (mode_t)va_arg(args, int);
+        va_end(args);
+    }
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_open(path, flags, (uint32_t)mode);
+    }
+    return __real_open64(path, flags, mode);
+}
+
+FILE* __wrap_fopen64(const char *path, const char *mode) {
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_fopen(path, mode);
+    }
+    return __real_fopen64(path, mode);
+}
+
+ssize_t __wrap_pread64(int fd, void *buffer, size_t count, off64_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_pread(fd, buffer, count, (int64_t)offset);
+    }
+    return __real_pread64(fd, buffer, count, offset);
+}
+
+ssize_t __wrap_pwrite64(int fd, const void *buffer, size_t count, off64_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (ssize_t)fossil_mockup_vfs_pwrite(fd, buffer, count, (int64_t)offset);
+    }
+    return __real_pwrite64(fd, buffer, count, offset);
+}
+
+off64_t __wrap_lseek64(int fd, off64_t offset, int whence) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        return (off64_t)fossil_mockup_vfs_lseek(fd, (int64_t)offset, whence);
+    }
+    return __real_lseek64(fd, offset, whence);
+}
+
+int __wrap_stat64(const char *path, struct stat64 *info) {
+    if (fossil_mockup_vfs_owns(path)) {
+        fossil_mockup_vfs_stat_t vfs_info;
+        if (fossil_mockup_vfs_stat(path, &vfs_info) != 0) {
+            return -1;
+        }
+        FOSSIL_MOCKUP_VFS_FILL_STAT(&vfs_info, info);
+        return 0;
+    }
+    return __real_stat64(path, info);
+}
+
+int __wrap_fstat64(int fd, struct stat64 *info) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        fossil_mockup_vfs_stat_t vfs_info;
+        if (fossil_mockup_vfs_fstat(fd, &vfs_info) != 0) {
+            return -1;
+        }
+        FOSSIL_MOCKUP_VFS_FILL_STAT(&vfs_info, info);
+        return 0;
+    }
+    return __real_fstat64(fd, info);
+}
+
+void* __wrap_mmap64(void *address, size_t length, int protection, int flags, int fd, off64_t offset) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        bool private_copy = (flags & MAP_PRIVATE) != 0 && (protection & PROT_WRITE) != 0;
+        void *mapped = fossil_mockup_vfs_mmap(fd, length, (int64_t)offset, private_copy);
+        return mapped != NULL ? mapped : MAP_FAILED;
+    }
+    return __real_mmap64(address, length, protection, flags, fd, offset);
+}
+
+int __wrap___open_2(const char *path, int flags) {
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_open(path, flags, 0);
+    }
+    return __real___open_2(path, flags);
+}
+
+int __wrap___open64_2(const char *path, int flags) {
+    if (fossil_mockup_vfs_owns(path)) {
+        return fossil_mockup_vfs_open(path, flags, 0);
+    }
+    return __real___open64_2(path, flags);
+}
+
+ssize_t __wrap___read_chk(int fd, void *buffer, size_t count, size_t size) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        fossil_mockup_vfs_check_size(count, size);
+        return (ssize_t)fossil_mockup_vfs_read(fd, buffer, count);
+    }
+    return __real___read_chk(fd, buffer, count, size);
+}
+
+ssize_t __wrap___pread_chk(int fd, void *buffer, size_t count, off_t offset, size_t size) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        fossil_mockup_vfs_check_size(count, size);
+        return (ssize_t)fossil_mockup_vfs_pread(fd, buffer, count, (int64_t)offset);
+    }
+    return __real___pread_chk(fd, buffer, count, offset, size);
+}
+
+ssize_t __wrap___pread64_chk(int fd, void *buffer, size_t count, off64_t offset, size_t size) {
+    if (fossil_mockup_vfs_is_fd(fd)) {
+        fossil_mockup_vfs_check_size(count, size);
+        return (ssize_t)fossil_mockup_vfs_pread(fd, buffer, count, (int64_t)offset);
+    }
+    return __real___pread64_chk(fd, buffer, count, offset, size);
+}
+
+#endif
+
+#endif
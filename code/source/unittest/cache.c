@@ -0,0 +1,264 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/cache.h"
+#include "fossil/unittest/commands.h"
+#include "fossil/unittest/snapshot.h"
+#include <sys/stat.h>
+
+#ifdef FOSSIL_TEST_HAS_RESULT_CACHE
+#include <link.h>
+#endif
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+enum {
+    FOSSIL_TEST_CACHE_UNKNOWN = 0,
+    FOSSIL_TEST_CACHE_HASHED,
+    FOSSIL_TEST_CACHE_MISSING
+};
+
+static bool fossil_test_cache_scanned = false;
+static uint64_t fossil_test_cache_library_hash = 0;
+
+// The index the runner keys cases on, loaded on first use.
+static bool fossil_test_cache_loaded = false;
+static fossil_test_impact_t *fossil_test_cache_impact = xnullptr;
+
+// Object file hashes of that index, each object file is read at most once.
+static uint64_t *fossil_test_cache_objects = xnullptr;
+static uint8_t *fossil_test_cache_states = xnullptr;
+
+//
+// local functions
+//
+#ifdef FOSSIL_TEST_HAS_RESULT_CACHE
+
+static void fossil_test_cache_hash_note(fossil_snapshot_hash_t *hash, const unsigned char *note, size_t size, bool *found) {
+    size_t at = 0;
+    while (at + sizeof(ElfW(Nhdr)) <= size) {
+        const ElfW(Nhdr) *entry = (const ElfW(Nhdr) *)(note + at);
+        size_t name = (entry->n_namesz + 3) & ~(size_t)3;
+        size_t desc = (entry->n_descsz + 3) & ~(size_t)3;
+        const unsigned char *data = note + at + sizeof(ElfW(Nhdr));
+        if (entry->n_type == NT_GNU_BUILD_ID && entry->n_namesz == 4 && memcmp(data, "GNU", 4) == 0) {
+            fossil_snapshot_hash_update(hash, data + name, entry->n_descsz);
+            *found = true;
+            return;
+        }
+        at += sizeof(ElfW(Nhdr)) + name + desc;
+    }
+}
+
+// The program itself has no name here and is covered by its object files,
+// every shared library adds its build ID.
+static int fossil_test_cache_visit(struct dl_phdr_info *info, size_t size, void *data) {
+    (void)size;
+    fossil_snapshot_hash_t *hash = (fossil_snapshot_hash_t *)data;
+    if (info->dlpi_name == xnullptr || info->dlpi_name[0] == '\0') {
+        return 0;
+    }
+
+    bool found = false;
+    for (ElfW(Half) i = 0; i < info->dlpi_phnum && !found; i++) {
+        if (info->dlpi_phdr[i].p_type == PT_NOTE) {
+            fossil_test_cache_hash_note(hash, (const unsigned char *)(info->dlpi_addr + info->dlpi_phdr[i].p_vaddr),
+                info->dlpi_phdr[i].p_memsz, &found);
+        }
+    }
+    if (!found) {
+        struct stat status;
+        fossil_snapshot_hash_update(hash, info->dlpi_name, strlen(info->dlpi_name));
+        if (stat(info->dlpi_name, &status) == 0) {
+            int64_t stamp[2] = { (int64_t)status.st_size, (int64_t)status.st_mtime };
+            fossil_snapshot_hash_update(hash, stamp, sizeof(stamp));
+        }
+    }
+    return 0;
+}
+
+#endif
+
+static void fossil_test_cache_scan(void) {
+    if (fossil_test_cache_scanned) {
+        return;
+    }
+    fossil_test_cache_scanned = true;
+
+    fossil_snapshot_hash_t hash;
+    fossil_snapshot_hash_init(&hash);
+#ifdef FOSSIL_TEST_HAS_RESULT_CACHE
+    dl_iterate_phdr(fossil_test_cache_visit, &hash);
+#endif
+    fossil_test_cache_library_hash = fossil_snapshot_hash_final(&hash);
+}
+
+static bool fossil_test_cache_path(char *path, size_t size, const char *directory, uint64_t key) {
+    return (size_t)snprintf(path, size, "%s/%016llx", directory, (unsigned long long)key) < size;
+}
+
+static bool fossil_test_cache_read_object(const fossil_test_impact_t *impact, size_t object, uint64_t *hash) {
+    char path[FILENAME_MAX];
+    return fossil_test_cache_object_path(impact->objects[object].path, path, sizeof(path)) &&
+           fossil_test_cache_file(path, hash);
+}
+
+// The hash of one object file of the index, false when it cannot be read.
+// Hashes of the runner's index are kept for the rest of the run.
+static bool fossil_test_cache_object_hash(const fossil_test_impact_t *impact, size_t object, uint64_t *hash) {
+    if (impact != fossil_test_cache_impact) {
+        return fossil_test_cache_read_object(impact, object, hash);
+    }
+    if (fossil_test_cache_states == xnullptr) {
+        fossil_test_cache_objects = (uint64_t *)calloc(impact->object_count + 1, sizeof(uint64_t));
+        fossil_test_cache_states = (uint8_t *)calloc(impact->object_count + 1, sizeof(uint8_t));
+        if (fossil_test_cache_objects == xnullptr || fossil_test_cache_states == xnullptr) {
+            perror("Failed to allocate memory for the result cache");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (fossil_test_cache_states[object] == FOSSIL_TEST_CACHE_UNKNOWN) {
+        bool hashed = fossil_test_cache_read_object(impact, object, &fossil_test_cache_objects[object]);
+        fossil_test_cache_states[object] = hashed ? FOSSIL_TEST_CACHE_HASHED : FOSSIL_TEST_CACHE_MISSING;
+    }
+    *hash = fossil_test_cache_objects[object];
+    return fossil_test_cache_states[object] == FOSSIL_TEST_CACHE_HASHED;
+}
+
+//
+// public functions
+//
+
+bool fossil_test_cache_object_path(const char *gcda, char *path, size_t size) {
+    size_t length = strlen(gcda);
+    if (length < 5 || strcmp(gcda + length - 5, ".gcda") != 0 || length - 5 + sizeof(".o") > size) {
+        return false;
+    }
+    memcpy(path, gcda, length - 5);
+    memcpy(path + length - 5, ".o", sizeof(".o"));
+    return true;
+}
+
+bool fossil_test_cache_file(const char *path, uint64_t *hash) {
+    FILE *file = fopen(path, "rb");
+    if (file == xnullptr) {
+        return false;
+    }
+    fossil_snapshot_hash_t state;
+    fossil_snapshot_hash_init(&state);
+    unsigned char chunk[65536];
+    size_t count;
+    while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        fossil_snapshot_hash_update(&state, chunk, count);
+    }
+    bool read = !ferror(file);
+    fclose(file);
+    *hash = fossil_snapshot_hash_final(&state);
+    return read;
+}
+
+uint64_t fossil_test_cache_libraries(void) {
+    fossil_test_cache_scan();
+    return fossil_test_cache_library_hash;
+}
+
+const fossil_test_impact_t* fossil_test_cache_index(void) {
+    if (!fossil_test_cache_loaded) {
+        fossil_test_cache_loaded = true;
+        fossil_test_cache_impact = fossil_test_impact_load(_CLI.impact_index);
+        if (fossil_test_cache_impact == xnullptr) {
+            fprintf(stderr, "No impact index at '%s', the cache needs one and every case runs\n", _CLI.impact_index);
+        }
+    }
+    return fossil_test_cache_impact;
+}
+
+bool fossil_test_cache_key(const fossil_test_impact_t *impact, const fossil_test_t *test, uint64_t *key) {
+    if (impact == xnullptr || test->table.kind != FOSSIL_TEST_TABLE_NONE) {
+        return false;
+    }
+    const fossil_test_impact_case_t *ran = fossil_test_impact_find(impact, test->name);
+    if (ran == xnullptr) {
+        return false;
+    }
+    fossil_snapshot_hash_t hash;
+    fossil_snapshot_hash_init(&hash);
+    fossil_snapshot_hash_update(&hash, test->name, strlen(test->name) + 1);
+    fossil_snapshot_hash_update(&hash, test->marks, strlen(test->marks) + 1);
+    uint64_t libraries = fossil_test_cache_libraries();
+    fossil_snapshot_hash_update(&hash, &libraries, sizeof(libraries));
+    if (_CLI.seed_enabled) {
+        fossil_snapshot_hash_update(&hash, &_CLI.seed, sizeof(_CLI.seed));
+    }
+
+    // Touches are sorted, so the functions of one object come together.
+    for (size_t i = 0; i < ran->count; i++) {
+        size_t object = (size_t)(ran->touches[i] >> 32);
+        if (i > 0 && object == (size_t)(ran->touches[i - 1] >> 32)) {
+            continue;
+        }
+        uint64_t code = 0;
+        if (object >= impact->object_count || !fossil_test_cache_object_hash(impact, object, &code)) {
+            return false;
+        }
+        const char *path = impact->objects[object].path;
+        fossil_snapshot_hash_update(&hash, path, strlen(path) + 1);
+        fossil_snapshot_hash_update(&hash, &code, sizeof(code));
+    }
+    *key = fossil_snapshot_hash_final(&hash);
+    return true;
+}
+
+bool fossil_test_cache_hit(const char *directory, uint64_t key) {
+    char path[FILENAME_MAX];
+    struct stat status;
+    return fossil_test_cache_path(path, sizeof(path), directory, key) && stat(path, &status) == 0;
+}
+
+bool fossil_test_cache_store(const char *directory, uint64_t key, const char *name) {
+    char path[FILENAME_MAX];
+    if (!fossil_test_cache_path(path, sizeof(path), directory, key)) {
+        return false;
+    }
+#ifndef _WIN32
+    mkdir(directory, 0755);
+#else
+    _mkdir(directory);
+#endif
+    FILE *file = fopen(path, "w");
+    if (file == xnullptr) {
+        return false;
+    }
+    fprintf(file, "%s passed\n", name);
+    return fclose(file) == 0;
+}
+
+bool fossil_test_cache_active(void) {
+#ifdef FOSSIL_TEST_HAS_RESULT_CACHE
+    return _CLI.cache_enabled && !_CLI.impact_record && !_CLI.snapshot_update && !_CLI.repeat_enabled;
+#else
+    return false;
+#endif
+}
+
+void fossil_test_cache_finish(void) {
+    free(fossil_test_cache_objects);
+    free(fossil_test_cache_states);
+    fossil_test_cache_objects = xnullptr;
+    fossil_test_cache_states = xnullptr;
+    fossil_test_impact_erase(fossil_test_cache_impact);
+    fossil_test_cache_impact = xnullptr;
+    fossil_test_cache_loaded = false;
+}
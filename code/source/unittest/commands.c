@@ -37,6 +37,22 @@ fossil_options_t init_options(void) {
     options.summary_enabled = false;
     options.color_enabled = false;
     options.sanity_enabled = false;
+    options.shard_index = 0;
+    options.shard_count = 1;
+    options.seed_enabled = false;
+    options.seed = 0;
+    options.fuzz_enabled = false;
+    options.fuzz_name[0] = '\0';
+    options.fuzz_runs = 0;
+    options.snapshot_update = false;
+    strcpy(options.snapshot_dir, "snapshots");
+    options.failure_limit = 100;
+    options.impact_record = false;
+    strcpy(options.impact_index, "impact.index");
+    options.changed_enabled = false;
+    options.changed_files[0] = '\0';
+    options.cache_enabled = false;
+    strcpy(options.cache_dir, "cache");
     return options;
 }
 
@@ -106,6 +122,71 @@ fossil_options_t fossil_options_parse(int argc, char **argv) {
             } else if (i + 1 < argc && strcmp(argv[i + 1], "disable") == 0) {
                 options.sanity_enabled = false;
             }
+        } else if (strcmp(argv[i], "shard") == 0) {
+            int index = 0;
+            int count = 0;
+            if (i + 1 < argc && sscanf(argv[i + 1], "%d/%d", &index, &count) == 2 &&
+                count > 0 && index >= 0 && index < count) {
+                options.shard_index = index;
+                options.shard_count = count;
+                i++;
+            }
+        } else if (strcmp(argv[i], "seed") == 0) {
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                options.seed_enabled = true;
+                options.seed = strtoull(argv[i + 1], xnullptr, 0);
+                i++;
+            }
+        } else if (strcmp(argv[i], "fuzz") == 0) {
+            if (i + 1 < argc && argv[i + 1][0] != '-' && strlen(argv[i + 1]) < sizeof(options.fuzz_name)) {
+                options.fuzz_enabled = true;
+                strcpy(options.fuzz_name, argv[i + 1]);
+                i++;
+                if (i + 1 < argc && isdigit((unsigned char)argv[i + 1][0])) {
+                    options.fuzz_runs = strtoull(argv[i + 1], xnullptr, 10);
+                    i++;
+                }
+            }
+        } else if (strcmp(argv[i], "update") == 0) {
+            if (i + 1 < argc && strcmp(argv[i + 1], "snapshots") == 0) {
+                options.snapshot_update = true;
+                i++;
+            }
+        } else if (strcmp(argv[i], "snapshots") == 0) {
+            if (i + 1 < argc && argv[i + 1][0] != '-' && strlen(argv[i + 1]) < sizeof(options.snapshot_dir)) {
+                strcpy(options.snapshot_dir, argv[i + 1]);
+                i++;
+            }
+        } else if (strcmp(argv[i], "failures") == 0) {
+            if (i + 1 < argc && isdigit((unsigned char)argv[i + 1][0])) {
+                options.failure_limit = (uint32_t)strtoul(argv[i + 1], xnullptr, 10);
+                i++;
+            }
+        } else if (strcmp(argv[i], "impact") == 0) {
+            if (i + 1 < argc && strcmp(argv[i + 1], "record") == 0) {
+                options.impact_record = true;
+                i++;
+            } else if (i + 1 < argc && argv[i + 1][0] != '-' && strlen(argv[i + 1]) < sizeof(options.impact_index)) {
+                strcpy(options.impact_index, argv[i + 1]);
+                i++;
+            }
+        } else if (strcmp(argv[i], "changed") == 0) {
+            if (i + 1 < argc && argv[i + 1][0] != '-' && strlen(argv[i + 1]) < sizeof(options.changed_files)) {
+                options.changed_enabled = true;
+                strcpy(options.changed_files, argv[i + 1]);
+                i++;
+            }
+        } else if (strcmp(argv[i], "cache") == 0) {
+            if (i + 1 < argc && strcmp(argv[i + 1], "off") == 0) {
+                options.cache_enabled = false;
+                i++;
+            } else if (i + 1 < argc && strcmp(argv[i + 1], "on") == 0) {
+                options.cache_enabled = true;
+                i++;
+            } else if (i + 1 < argc && argv[i + 1][0] != '-' && strlen(argv[i + 1]) < sizeof(options.cache_dir)) {
+                strcpy(options.cache_dir, argv[i + 1]);
+                i++;
+            }
         }
     }
     
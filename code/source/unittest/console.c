@@ -15,6 +15,10 @@ Description:
 #include "fossil/unittest/commands.h"
 #include <stdarg.h>
 
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+#include <execinfo.h>
+#endif
+
 static const char* FOSSIL_TEST_NAME = "Fossil Test";
 static const char* FOSSIL_TEST_AUTH = "Michael Gene Brockus (Dreamer)";
 static const char* FOSSIL_TEST_VERSION = "1.0.1";
@@ -186,7 +190,7 @@ char* helpful_tester_tip(void) {
 }
 
 char *summary_message(fossil_env_t *env) {
-    if (env->stats.expected_failed_count == 0 && env->stats.expected_passed_count > 0) {
+    if (env->stats.expected_failed_count == 0 && env->stats.expected_passed_count + env->stats.cached_count > 0) {
         return passing_test_comment();
     } else if (env->stats.expected_failed_count > 0) {
         return failure_test_comment();
@@ -345,6 +349,17 @@ void fossil_test_io_information(void) {
         fossil_test_cout("cyan", "  summary [enable/disable]          Enables or disables the summary of test results after execution\n");
         fossil_test_cout("cyan", "  color [enable/disable]            Enables or disables colored output in the terminal\n");
         fossil_test_cout("cyan", "  sanity [enable/disable]           Enables or disables sanity checks before running the tests\n");
+        fossil_test_cout("cyan", "  shard <index>/<count>             Runs the cases and table rows that hash to index\n");
+        fossil_test_cout("cyan", "  seed <number>                     Replays the generated cases of property tests\n");
+        fossil_test_cout("cyan", "  fuzz <name> [runs]                Fuzzes one FOSSIL_FUZZ target instead of running the suite\n");
+        fossil_test_cout("cyan", "  update snapshots                  Rewrites the golden files of snapshot assertions\n");
+        fossil_test_cout("cyan", "  snapshots <directory>             Reads and writes golden files under directory\n");
+        fossil_test_cout("cyan", "  failures <count>                  Keeps at most count failures of a case, 0 keeps all\n");
+        fossil_test_cout("cyan", "  impact record                     Writes the functions every case runs to the impact index\n");
+        fossil_test_cout("cyan", "  impact <file>                     Reads and writes the impact index at file\n");
+        fossil_test_cout("cyan", "  changed <files>                   Runs only the cases that ran one of the changed files\n");
+        fossil_test_cout("cyan", "  cache [on/off]                    Skips cases that passed before and did not change\n");
+        fossil_test_cout("cyan", "  cache <directory>                 Keeps the cached results under directory\n");
         exit(0);
     }
 }
@@ -373,9 +388,18 @@ void fossil_test_io_unittest_start(fossil_test_t *test) {
         fossil_test_cout("cyan", " -> %s\n", test->tags);
         fossil_test_cout("blue", "marker    : ");
         fossil_test_cout("cyan", " -> %s\n", test->marks);
+        if (_ASSERT_INFO.row >= 0) {
+            fossil_test_cout("blue", "table row : ");
+            fossil_test_cout("cyan", " -> %lld\n", (long long)_ASSERT_INFO.row);
+        }
     } else if (_CLI.verbose_level == 1) {
         fossil_test_cout("blue", "[start] ");
-        fossil_test_cout("cyan", "%.4d: %s tag: %s mark: %s\n", _TEST_ENV.stats.expected_total_count + 1, replace_underscore(test->name), test->tags, test->marks);
+        if (_ASSERT_INFO.row >= 0) {
+            fossil_test_cout("cyan", "%.4d: %s row: %lld tag: %s mark: %s\n", _TEST_ENV.stats.expected_total_count + 1, replace_underscore(test->name),
+                (long long)_ASSERT_INFO.row, test->tags, test->marks);
+        } else {
+            fossil_test_cout("cyan", "%.4d: %s tag: %s mark: %s\n", _TEST_ENV.stats.expected_total_count + 1, replace_underscore(test->name), test->tags, test->marks);
+        }
     }
 }
 
@@ -441,14 +465,77 @@ void fossil_test_io_asserted(xassert_info *assume) {
         fossil_test_cout("red", "file name: -> %s\n", assume->file);
         fossil_test_cout("red", "line num : -> %d\n", assume->line);
         fossil_test_cout("red", "function : -> %s\n", assume->func);
+        if (assume->row >= 0) {
+            fossil_test_cout("red", "table row: -> %lld\n", (long long)assume->row);
+        }
         fossil_test_cout("red", "=========================================================================================[F]=\n");
     } else if (_CLI.verbose_level == 1) {
-        fossil_test_cout("red", "name: %s line: -> %d msg: -> %s\n", assume->func, assume->line, assume->message);
+        if (assume->row >= 0) {
+            fossil_test_cout("red", "name: %s row: -> %lld line: -> %d msg: -> %s\n", assume->func, (long long)assume->row, assume->line, assume->message);
+        } else {
+            fossil_test_cout("red", "name: %s line: -> %d msg: -> %s\n", assume->func, assume->line, assume->message);
+        }
     } else {
         fossil_test_cout("red", "[#]");
     }
 }
 
+void fossil_test_io_asserted_more(uint64_t count) {
+    if (_CLI.verbose_level == 2 || _CLI.verbose_level == 1) {
+        fossil_test_cout("red", "... %llu more failures not kept, see the failures option\n", (unsigned long long)count);
+    }
+}
+
+// Names are looked up here, well after the handler jumped out of the crash.
+static void fossil_test_io_backtrace(const fossil_test_crash_t *crash) {
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+    char **symbols = backtrace_symbols(crash->frames, crash->frame_count);
+    // The first frame is the signal handler itself.
+    for (int i = 1; i < crash->frame_count; i++) {
+        if (symbols != xnullptr) {
+            fossil_test_cout("red", "  #%-2d %s\n", i - 1, symbols[i]);
+        } else {
+            fossil_test_cout("red", "  #%-2d %p\n", i - 1, crash->frames[i]);
+        }
+    }
+    free(symbols);
+#else
+    (void)crash;
+#endif
+}
+
+void fossil_test_io_crashed(fossil_test_t *test, const fossil_test_crash_t *crash) {
+    if (_CLI.verbose_level == 2) {
+        fossil_test_cout("red", "=[C]=[test crashed]==========================================================================\n");
+        fossil_test_cout("red", "signal   : -> %s\n", fossil_test_crash_name(crash->signal));
+        fossil_test_cout("red", "address  : -> %p\n", crash->address);
+        fossil_test_cout("red", "test case: -> %s\n", test->name);
+        if (_ASSERT_INFO.row >= 0) {
+            fossil_test_cout("red", "table row: -> %lld\n", (long long)_ASSERT_INFO.row);
+        }
+        fossil_test_io_backtrace(crash);
+        fossil_test_cout("red", "=========================================================================================[C]=\n");
+    } else if (_CLI.verbose_level == 1) {
+        fossil_test_cout("red", "name: %s crashed: -> %s at %p\n", test->name, fossil_test_crash_name(crash->signal), crash->address);
+        fossil_test_io_backtrace(crash);
+    } else {
+        fossil_test_cout("red", "[!]");
+    }
+}
+
+void fossil_test_io_cached(fossil_test_t *test) {
+    if (_CLI.verbose_level == 2) {
+        fossil_test_cout("blue", "%s\n", "=[ cached case]==============================================================================");
+        fossil_test_cout("blue", "test name : ");
+        fossil_test_cout("cyan", " -> %s\n", replace_underscore(test->name));
+    } else if (_CLI.verbose_level == 1) {
+        fossil_test_cout("blue", "[cached] ");
+        fossil_test_cout("cyan", "%s passed before and did not change\n", replace_underscore(test->name));
+    } else {
+        fossil_test_cout("cyan", "[=]");
+    }
+}
+
 void fossil_test_io_summary_start(void) {
     fossil_test_cout("blue", "=============================================================================================\n");
     fossil_test_cout("blue", "%s\n", "platform meta data about the host system:");
@@ -461,7 +548,7 @@ void fossil_test_io_summary_ended(void) {
     char *color = "green";
     if (_TEST_ENV.stats.expected_failed_count > 0) {
         color = "red";
-    } else if (_TEST_ENV.stats.expected_passed_count == 0) {
+    } else if (_TEST_ENV.stats.expected_passed_count + _TEST_ENV.stats.cached_count == 0) {
         color = "yellow";
     }
 
@@ -471,7 +558,7 @@ void fossil_test_io_summary_ended(void) {
     fossil_test_cout(color, "%s\n", summary_message(&_TEST_ENV));
     fossil_test_cout("cyan", "> Expected Passed  : %3d   Expected Failed: %3d\n", _TEST_ENV.stats.expected_passed_count, _TEST_ENV.stats.expected_failed_count);
     fossil_test_cout("cyan", "> Unexpected Passed: %3d Unexpected Failed: %3d\n", _TEST_ENV.stats.unexpected_passed_count, _TEST_ENV.stats.expected_failed_count);
-    fossil_test_cout("cyan", "> Timeout: %3d Skipped: %3d Empty: %3d\n", _TEST_ENV.stats.expected_timeout_count, _TEST_ENV.stats.expected_skipped_count, _TEST_ENV.stats.expected_empty_count);
+    fossil_test_cout("cyan", "> Timeout: %3d Skipped: %3d Empty: %3d Crashed: %3d Cached: %3d\n", _TEST_ENV.stats.expected_timeout_count, _TEST_ENV.stats.expected_skipped_count, _TEST_ENV.stats.expected_empty_count, _TEST_ENV.stats.crashed_count, _TEST_ENV.stats.cached_count);
     fossil_test_cout("blue", "=============================================================================================\n");
     fossil_test_cout("blue", "Total Tests: %d\n", _TEST_ENV.stats.expected_total_count);
     fossil_test_cout("blue", "Total Ghost: %d\n", _TEST_ENV.stats.untested_count);
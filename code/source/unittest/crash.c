@@ -0,0 +1,155 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/crash.h"
+#include <signal.h>
+
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+#include <execinfo.h>
+#endif
+
+// Jump point of the running case and the crash noted for it. Only the
+// thread running the case ever has a jump point.
+static FOSSIL_TEST_THREAD_LOCAL fossil_test_jump_t *fossil_test_jump = xnullptr;
+static FOSSIL_TEST_THREAD_LOCAL fossil_test_crash_t fossil_test_crash;
+
+//
+// local functions
+//
+
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+static const int fossil_test_crash_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+
+// Runs on the alternate stack and only does what is async-signal-safe:
+// note the signal and the return addresses, then leave through the jump.
+static void fossil_test_crash_handler(int signal_number, siginfo_t *info, void *context) {
+    (void)context;
+    if (fossil_test_jump == xnullptr) {
+        // Nothing to return to, the default action ends the process once
+        // the handler returns.
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = SIG_DFL;
+        sigemptyset(&action.sa_mask);
+        sigaction(signal_number, &action, xnullptr);
+        raise(signal_number);
+        return;
+    }
+
+    fossil_test_crash.signal = signal_number;
+    fossil_test_crash.address = info != xnullptr ? info->si_addr : xnullptr;
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+    fossil_test_crash.frame_count = backtrace(fossil_test_crash.frames, FOSSIL_TEST_CRASH_FRAMES);
+#else
+    fossil_test_crash.frame_count = 0;
+#endif
+    fossil_test_jump_back();
+}
+#endif
+
+//
+// public functions
+//
+
+void fossil_test_crash_install(void) {
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    static bool installed = false;
+    if (installed) {
+        return;
+    }
+    installed = true;
+
+    // A stack overflow leaves no room for the handler on the faulting stack.
+    size_t size = (size_t)SIGSTKSZ < 65536 ? 65536 : (size_t)SIGSTKSZ;
+    stack_t stack;
+    stack.ss_sp = malloc(size);
+    if (stack.ss_sp == xnullptr) {
+        perror("Failed to allocate memory for signal stack");
+        exit(EXIT_FAILURE);
+    }
+    stack.ss_size = size;
+    stack.ss_flags = 0;
+    sigaltstack(&stack, xnullptr);
+
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+    // The unwinder is loaded on first use, which may allocate, so that
+    // happens here rather than inside the handler.
+    void *frames[1];
+    backtrace(frames, 1);
+#endif
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = fossil_test_crash_handler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    for (size_t i = 0; i < sizeof(fossil_test_crash_signals) / sizeof(fossil_test_crash_signals[0]); i++) {
+        sigaction(fossil_test_crash_signals[i], &action, xnullptr);
+    }
+#endif
+}
+
+fossil_test_jump_t* fossil_test_jump_swap(fossil_test_jump_t *point) {
+    fossil_test_jump_t *previous = fossil_test_jump;
+    fossil_test_jump = point;
+    return previous;
+}
+
+void fossil_test_jump_back(void) {
+    fossil_test_jump_t *point = fossil_test_jump;
+    if (point == xnullptr) {
+        return;
+    }
+    fossil_test_jump = xnullptr;
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    siglongjmp(*point, 1);
+#else
+    longjmp(*point, 1);
+#endif
+}
+
+bool fossil_test_crash_take(fossil_test_crash_t *crash) {
+    if (fossil_test_crash.signal == 0) {
+        return false;
+    }
+    if (crash != xnullptr) {
+        *crash = fossil_test_crash;
+    }
+    fossil_test_crash.signal = 0;
+    return true;
+}
+
+const char* fossil_test_crash_name(int signal) {
+    switch (signal) {
+        case SIGSEGV: return "SIGSEGV, segmentation fault";
+#ifdef SIGBUS
+        case SIGBUS:  return "SIGBUS, bus error";
+#endif
+        case SIGFPE:  return "SIGFPE, arithmetic exception";
+        case SIGILL:  return "SIGILL, illegal instruction";
+        case SIGABRT: return "SIGABRT, aborted";
+        default:      return "unknown signal";
+    }
+}
+
+bool fossil_test_crash_run(void (*function)(void *), void *context, fossil_test_crash_t *crash) {
+    fossil_test_jump_t point;
+    fossil_test_jump_t *previous = fossil_test_jump;
+
+    if (FOSSIL_TEST_SETJMP(point) == 0) {
+        fossil_test_jump = &point;
+        function(context);
+    }
+    fossil_test_jump = previous;
+    return fossil_test_crash_take(crash);
+}
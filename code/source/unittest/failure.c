@@ -0,0 +1,181 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/failure.h"
+#include "fossil/unittest/commands.h"
+#include "fossil/unittest/console.h"
+
+enum {
+    FOSSIL_TEST_ARENA_CHUNK = 64 * 1024,
+    FOSSIL_TEST_FAILURE_MESSAGE = 16384 + 256
+};
+
+// Chunks are chained in the order they were allocated and never freed, the
+// arena is rewound to the first one when a case starts.
+typedef struct fossil_test_arena_chunk_t {
+    struct fossil_test_arena_chunk_t *next;
+    size_t used;
+    size_t capacity;
+} fossil_test_arena_chunk_t;
+
+#define FOSSIL_TEST_ARENA_HEADER ((sizeof(fossil_test_arena_chunk_t) + 15) & ~(size_t)15)
+
+static struct {
+    fossil_test_arena_chunk_t *head;
+    fossil_test_arena_chunk_t *tail;
+    fossil_test_arena_chunk_t *current;
+    fossil_test_failure_t *first;
+    fossil_test_failure_t *last;
+    uint64_t kept;
+    uint64_t count;
+} fossil_test_failures;
+
+static FOSSIL_TEST_THREAD_LOCAL char fossil_test_failure_message[FOSSIL_TEST_FAILURE_MESSAGE];
+
+//
+// local functions
+//
+
+static void* fossil_test_arena_alloc(size_t size) {
+    size = (size + 15) & ~(size_t)15;
+
+    // Walk forward through chunks left over from earlier cases first.
+    fossil_test_arena_chunk_t *chunk = fossil_test_failures.current;
+    while (chunk != xnullptr && chunk->used + size > chunk->capacity) {
+        chunk = chunk->next;
+        if (chunk != xnullptr) {
+            chunk->used = 0;
+        }
+    }
+
+    if (chunk == xnullptr) {
+        size_t capacity = size > FOSSIL_TEST_ARENA_CHUNK ? size : FOSSIL_TEST_ARENA_CHUNK;
+        chunk = (fossil_test_arena_chunk_t *)malloc(FOSSIL_TEST_ARENA_HEADER + capacity);
+        if (chunk == xnullptr) {
+            perror("Failed to allocate memory for failure arena");
+            exit(EXIT_FAILURE);
+        }
+        chunk->next = xnullptr;
+        chunk->used = 0;
+        chunk->capacity = capacity;
+        if (fossil_test_failures.tail != xnullptr) {
+            fossil_test_failures.tail->next = chunk;
+        } else {
+            fossil_test_failures.head = chunk;
+        }
+        fossil_test_failures.tail = chunk;
+    }
+
+    fossil_test_failures.current = chunk;
+    void *memory = (char *)chunk + FOSSIL_TEST_ARENA_HEADER + chunk->used;
+    chunk->used += size;
+    return memory;
+}
+
+//
+// public functions
+//
+
+void fossil_test_failure_add(const xassert_info *info) {
+    fossil_test_failures.count++;
+    if (_CLI.failure_limit != 0 && fossil_test_failures.kept >= _CLI.failure_limit) {
+        return;
+    }
+
+    fossil_test_failure_t *failure = (fossil_test_failure_t *)fossil_test_arena_alloc(sizeof(fossil_test_failure_t));
+    failure->next = xnullptr;
+    failure->info = *info;
+
+    // Messages may live in buffers the next assertion reuses.
+    if (info->message != xnullptr) {
+        size_t length = strlen(info->message) + 1;
+        failure->info.message = (char *)fossil_test_arena_alloc(length);
+        memcpy(failure->info.message, info->message, length);
+    }
+
+    if (fossil_test_failures.last != xnullptr) {
+        fossil_test_failures.last->next = failure;
+    } else {
+        fossil_test_failures.first = failure;
+    }
+    fossil_test_failures.last = failure;
+    fossil_test_failures.kept++;
+}
+
+const fossil_test_failure_t* fossil_test_failure_first(void) {
+    return fossil_test_failures.first;
+}
+
+uint64_t fossil_test_failure_count(void) {
+    return fossil_test_failures.count;
+}
+
+size_t fossil_test_failure_format(const xassert_info *info, char *buffer, size_t size) {
+    const char *message = info->message != xnullptr ? info->message : "";
+    unsigned long long actual = (unsigned long long)info->actual.u;
+    unsigned long long expected = (unsigned long long)info->expected.u;
+    int length;
+
+    switch (info->kind) {
+        case FOSSIL_TEST_OPERAND_SIGNED:
+            length = snprintf(buffer, size, "%s (actual %lld, expected %lld)", message,
+                (long long)(int64_t)info->actual.u, (long long)(int64_t)info->expected.u);
+            break;
+        case FOSSIL_TEST_OPERAND_UNSIGNED:
+            length = snprintf(buffer, size, "%s (actual %llu, expected %llu)", message, actual, expected);
+            break;
+        case FOSSIL_TEST_OPERAND_HEX:
+            length = snprintf(buffer, size, "%s (actual 0x%llx, expected 0x%llx)", message, actual, expected);
+            break;
+        case FOSSIL_TEST_OPERAND_OCTAL:
+            length = snprintf(buffer, size, "%s (actual 0%llo, expected 0%llo)", message, actual, expected);
+            break;
+        case FOSSIL_TEST_OPERAND_FLOAT:
+            length = snprintf(buffer, size, "%s (actual %.17g, expected %.17g)", message,
+                info->actual.f, info->expected.f);
+            break;
+        case FOSSIL_TEST_OPERAND_NEAR:
+            length = snprintf(buffer, size, "%s (actual %.17g, expected %.17g, difference %.17g, tolerance %.17g)", message,
+                info->actual.f, info->expected.f, fabs(info->actual.f - info->expected.f), info->tolerance.f);
+            break;
+        case FOSSIL_TEST_OPERAND_NONE:
+        default:
+            length = snprintf(buffer, size, "%s", message);
+            break;
+    }
+    return length < 0 ? 0 : (size_t)length;
+}
+
+void fossil_test_failure_report(void) {
+    for (const fossil_test_failure_t *failure = fossil_test_failures.first; failure != xnullptr; failure = failure->next) {
+        xassert_info info = failure->info;
+        fossil_test_failure_format(&failure->info, fossil_test_failure_message, sizeof(fossil_test_failure_message));
+        info.message = fossil_test_failure_message;
+        fossil_test_io_asserted(&info);
+    }
+    if (fossil_test_failures.count > fossil_test_failures.kept) {
+        fossil_test_io_asserted_more(fossil_test_failures.count - fossil_test_failures.kept);
+    }
+    fossil_test_failure_reset();
+}
+
+void fossil_test_failure_reset(void) {
+    fossil_test_failures.first = xnullptr;
+    fossil_test_failures.last = xnullptr;
+    fossil_test_failures.kept = 0;
+    fossil_test_failures.count = 0;
+    fossil_test_failures.current = fossil_test_failures.head;
+    if (fossil_test_failures.head != xnullptr) {
+        fossil_test_failures.head->used = 0;
+    }
+}
@@ -0,0 +1,668 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/fuzz.h"
+#include "fossil/unittest/table.h"
+#include "fossil/unittest/commands.h"
+#include "fossil/unittest/console.h"
+#include "fossil/unittest/crash.h"
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#else
+#include <direct.h>
+#include <io.h>
+#endif
+
+enum {
+    FOSSIL_FUZZ_MAP_SIZE = 1 << 16, // coverage features tracked, a power of two
+    FOSSIL_FUZZ_REGION = 512,       // map bytes behind one dirty flag
+    FOSSIL_FUZZ_STACK = 8,          // most mutations stacked onto one input
+    FOSSIL_FUZZ_REPORT = 4096,      // runs between looks at the clock
+};
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} fossil_fuzz_input_t;
+
+typedef struct {
+    fossil_fuzz_input_t *inputs;
+    size_t count;
+    size_t capacity;
+} fossil_fuzz_corpus_t;
+
+// Hit counts of the run in progress, words so untouched stretches are skipped
+// eight entries at a time. Dirty flags mark the regions a run touched so only
+// those are scanned and cleared afterwards.
+static uint64_t fossil_fuzz_hits[FOSSIL_FUZZ_MAP_SIZE / 8];
+static uint8_t fossil_fuzz_dirty[FOSSIL_FUZZ_MAP_SIZE / FOSSIL_FUZZ_REGION];
+// Hit count buckets reached by any earlier run.
+static uint8_t fossil_fuzz_seen[FOSSIL_FUZZ_MAP_SIZE];
+static uint8_t fossil_fuzz_buckets[256];
+static uint32_t fossil_fuzz_guards;    // guard slots handed out, clang
+static uint64_t fossil_fuzz_previous;  // last block seen to form edges, gcc
+
+// The input being run, saved as a crash if the process dies underneath it.
+static const uint8_t *volatile fossil_fuzz_current;
+static volatile size_t fossil_fuzz_current_size;
+static char fossil_fuzz_crash_prefix[FILENAME_MAX];
+
+static const int fossil_fuzz_signals[] = {
+    SIGSEGV, SIGABRT, SIGFPE, SIGILL,
+#ifdef SIGBUS
+    SIGBUS,
+#endif
+};
+#define FOSSIL_FUZZ_SIGNAL_COUNT (sizeof(fossil_fuzz_signals) / sizeof(fossil_fuzz_signals[0]))
+
+// Handlers that were installed before the guard, the runner's crash handler
+// while a case runs.
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+static struct sigaction fossil_fuzz_previous_actions[FOSSIL_FUZZ_SIGNAL_COUNT];
+#else
+static void (*fossil_fuzz_previous_actions[FOSSIL_FUZZ_SIGNAL_COUNT])(int);
+#endif
+
+static const int8_t fossil_fuzz_interesting8[] = {-128, -1, 0, 1, 16, 32, 64, 100, 127};
+static const int16_t fossil_fuzz_interesting16[] = {-32768, -129, 128, 255, 256, 512, 1000, 1024, 4096, 32767};
+static const int32_t fossil_fuzz_interesting32[] = {INT32_MIN, -100663046, -32769, 32768, 65535, 65536, 100663045, INT32_MAX};
+
+//
+// coverage callbacks
+//
+
+// These are called by code built with -fsanitize-coverage. Only the test
+// program is instrumented, never this library, so they cannot recurse.
+#if defined(__GNUC__) || defined(__clang__)
+void __sanitizer_cov_trace_pc_guard_init(uint32_t *start, uint32_t *stop);
+void __sanitizer_cov_trace_pc_guard(uint32_t *guard);
+void __sanitizer_cov_trace_pc(void);
+extern void __sanitizer_set_death_callback(void (*callback)(void)) __attribute__((weak));
+
+void __sanitizer_cov_trace_pc_guard_init(uint32_t *start, uint32_t *stop) {
+    if (start == stop || *start != 0) {
+        return;
+    }
+    for (uint32_t *guard = start; guard < stop; guard++) {
+        *guard = 1 + fossil_fuzz_guards++ % (FOSSIL_FUZZ_MAP_SIZE - 1);
+    }
+}
+
+void __sanitizer_cov_trace_pc_guard(uint32_t *guard) {
+    ((uint8_t *)fossil_fuzz_hits)[*guard]++;
+    fossil_fuzz_dirty[*guard / FOSSIL_FUZZ_REGION] = 1;
+}
+
+// gcc only reports the block, so edges are formed from consecutive blocks.
+void __sanitizer_cov_trace_pc(void) {
+    uint64_t block = ((uint64_t)(uintptr_t)__builtin_return_address(0) * 0x9e3779b97f4a7c15ULL) >> 48;
+    uint64_t edge = (block ^ fossil_fuzz_previous) & (FOSSIL_FUZZ_MAP_SIZE - 1);
+    ((uint8_t *)fossil_fuzz_hits)[edge]++;
+    fossil_fuzz_dirty[edge / FOSSIL_FUZZ_REGION] = 1;
+    fossil_fuzz_previous = block >> 1;
+}
+#endif
+
+//
+// local functions
+//
+
+static uint64_t fossil_fuzz_random(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t fossil_fuzz_hash(const uint8_t *data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Appends 16 hex digits without stdio so it is safe inside a signal handler.
+static size_t fossil_fuzz_hex(char *out, uint64_t value) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = 15; i >= 0; i--) {
+        out[i] = digits[value & 0xf];
+        value >>= 4;
+    }
+    out[16] = '\0';
+    return 16;
+}
+
+static void fossil_fuzz_mkdirs(const char *path) {
+    char partial[FILENAME_MAX];
+    size_t length = strlen(path);
+    if (length >= sizeof(partial)) {
+        return;
+    }
+    memcpy(partial, path, length + 1);
+    for (size_t at = 1; at <= length; at++) {
+        if (partial[at] != '/' && partial[at] != '\\' && partial[at] != '\0') {
+            continue;
+        }
+        char saved = partial[at];
+        partial[at] = '\0';
+#ifndef _WIN32
+        mkdir(partial, 0755);
+#else
+        _mkdir(partial);
+#endif
+        partial[at] = saved;
+    }
+}
+
+static bool fossil_fuzz_write(const char *path, const uint8_t *data, size_t size) {
+#ifndef _WIN32
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    size_t done = 0;
+    while (done < size) {
+        ssize_t count = write(fd, data + done, size - done);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
+        }
+        done += (size_t)count;
+    }
+    close(fd);
+#else
+    int fd = _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    if (fd < 0) {
+        return false;
+    }
+    size_t done = 0;
+    while (done < size) {
+        int count = _write(fd, data + done, (unsigned int)(size - done));
+        if (count <= 0) {
+            break;
+        }
+        done += (size_t)count;
+    }
+    _close(fd);
+#endif
+    return done == size;
+}
+
+static void fossil_fuzz_note(const char *text) {
+#ifndef _WIN32
+    ssize_t ignored = write(STDERR_FILENO, text, strlen(text));
+    (void)ignored;
+#else
+    _write(2, text, (unsigned int)strlen(text));
+#endif
+}
+
+// Save the input being run as crash-<hash>. Runs from signal handlers and
+// sanitizer death callbacks, so it only uses async-signal-safe calls.
+static void fossil_fuzz_save_crash(void) {
+    const uint8_t *data = fossil_fuzz_current;
+    size_t size = fossil_fuzz_current_size;
+    if (data == xnullptr) {
+        return;
+    }
+    fossil_fuzz_current = xnullptr;
+
+    char path[FILENAME_MAX];
+    size_t length = strlen(fossil_fuzz_crash_prefix);
+    if (length + 17 > sizeof(path)) {
+        return;
+    }
+    memcpy(path, fossil_fuzz_crash_prefix, length);
+    fossil_fuzz_hex(path + length, fossil_fuzz_hash(data, size));
+    if (fossil_fuzz_write(path, data, size)) {
+        fossil_fuzz_note("fuzz input that failed was saved as ");
+        fossil_fuzz_note(path);
+        fossil_fuzz_note("\n");
+    }
+}
+
+// Save the input, then hand the signal on to the handler installed before
+// the guard. The runner's crash handler jumps back to the input's jump point,
+// without one the default action ends the process.
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+static void fossil_fuzz_crashed(int signal_number, siginfo_t *info, void *context) {
+    fossil_fuzz_save_crash();
+    for (size_t i = 0; i < FOSSIL_FUZZ_SIGNAL_COUNT; i++) {
+        if (fossil_fuzz_signals[i] != signal_number) {
+            continue;
+        }
+        const struct sigaction *previous = &fossil_fuzz_previous_actions[i];
+        if ((previous->sa_flags & SA_SIGINFO) != 0) {
+            previous->sa_sigaction(signal_number, info, context);
+            return;
+        }
+        if (previous->sa_handler != SIG_DFL && previous->sa_handler != SIG_IGN) {
+            previous->sa_handler(signal_number);
+            return;
+        }
+        break;
+    }
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_DFL;
+    sigemptyset(&action.sa_mask);
+    sigaction(signal_number, &action, xnullptr);
+    raise(signal_number);
+}
+#else
+static void fossil_fuzz_crashed(int signal_number) {
+    fossil_fuzz_save_crash();
+    for (size_t i = 0; i < FOSSIL_FUZZ_SIGNAL_COUNT; i++) {
+        void (*previous)(int) = fossil_fuzz_previous_actions[i];
+        if (fossil_fuzz_signals[i] == signal_number && previous != SIG_DFL && previous != SIG_IGN && previous != SIG_ERR) {
+            previous(signal_number);
+            return;
+        }
+    }
+    signal(signal_number, SIG_DFL);
+    raise(signal_number);
+}
+#endif
+
+static void fossil_fuzz_guard(bool enabled) {
+    static bool registered = false;
+    if (!registered) {
+        // A target that calls exit() still leaves its input behind.
+        atexit(fossil_fuzz_save_crash);
+        registered = true;
+    }
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    // The whole action is kept, the runner's handler needs its siginfo and
+    // the alternate stack to catch a blown stack.
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = fossil_fuzz_crashed;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+#endif
+    for (size_t i = 0; i < FOSSIL_FUZZ_SIGNAL_COUNT; i++) {
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+        if (enabled) {
+            sigaction(fossil_fuzz_signals[i], &action, &fossil_fuzz_previous_actions[i]);
+        } else {
+            sigaction(fossil_fuzz_signals[i], &fossil_fuzz_previous_actions[i], xnullptr);
+        }
+#else
+        if (enabled) {
+            fossil_fuzz_previous_actions[i] = signal(fossil_fuzz_signals[i], fossil_fuzz_crashed);
+        } else {
+            signal(fossil_fuzz_signals[i], fossil_fuzz_previous_actions[i]);
+        }
+#endif
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    if (__sanitizer_set_death_callback) {
+        __sanitizer_set_death_callback(enabled ? fossil_fuzz_save_crash : xnullptr);
+    }
+#endif
+}
+
+static void fossil_fuzz_buckets_init(void) {
+    for (int hits = 0; hits < 256; hits++) {
+        uint8_t bucket;
+        if (hits == 0) {
+            bucket = 0;
+        } else if (hits < 3) {
+            bucket = (uint8_t)hits;
+        } else if (hits == 3) {
+            bucket = 4;
+        } else if (hits < 8) {
+            bucket = 8;
+        } else if (hits < 16) {
+            bucket = 16;
+        } else if (hits < 32) {
+            bucket = 32;
+        } else if (hits < 128) {
+            bucket = 64;
+        } else {
+            bucket = 128;
+        }
+        fossil_fuzz_buckets[hits] = bucket;
+    }
+}
+
+static void fossil_fuzz_clear(void) {
+    memset(fossil_fuzz_hits, 0, sizeof(fossil_fuzz_hits));
+    memset(fossil_fuzz_dirty, 0, sizeof(fossil_fuzz_dirty));
+    fossil_fuzz_previous = 0;
+}
+
+// Fold the hit counts of the last run into the seen map and count the
+// features, an edge reaching a new hit count bucket, no earlier run had.
+static size_t fossil_fuzz_collect(void) {
+    const uint8_t *hits = (const uint8_t *)fossil_fuzz_hits;
+    size_t fresh = 0;
+    for (size_t region = 0; region < sizeof(fossil_fuzz_dirty); region++) {
+        if (!fossil_fuzz_dirty[region]) {
+            continue;
+        }
+        fossil_fuzz_dirty[region] = 0;
+        size_t first = region * (FOSSIL_FUZZ_REGION / 8);
+        for (size_t word = first; word < first + FOSSIL_FUZZ_REGION / 8; word++) {
+            if (fossil_fuzz_hits[word] == 0) {
+                continue;
+            }
+            for (size_t at = word * 8; at < word * 8 + 8; at++) {
+                uint8_t bucket = fossil_fuzz_buckets[hits[at]];
+                if ((bucket & ~fossil_fuzz_seen[at]) != 0) {
+                    fossil_fuzz_seen[at] |= bucket;
+                    fresh++;
+                }
+            }
+            fossil_fuzz_hits[word] = 0;
+        }
+    }
+    fossil_fuzz_previous = 0;
+    return fresh;
+}
+
+static void fossil_fuzz_corpus_push(fossil_fuzz_corpus_t *corpus, const uint8_t *data, size_t size) {
+    if (corpus->count == corpus->capacity) {
+        size_t capacity = corpus->capacity ? corpus->capacity * 2 : 64;
+        fossil_fuzz_input_t *inputs = (fossil_fuzz_input_t *)realloc(corpus->inputs, capacity * sizeof(fossil_fuzz_input_t));
+        if (inputs == xnullptr) {
+            perror("Failed to allocate memory for fuzz corpus");
+            exit(EXIT_FAILURE);
+        }
+        corpus->inputs = inputs;
+        corpus->capacity = capacity;
+    }
+    uint8_t *copy = (uint8_t *)malloc(size ? size : 1);
+    if (copy == xnullptr) {
+        perror("Failed to allocate memory for fuzz input");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(copy, data, size);
+    corpus->inputs[corpus->count].data = copy;
+    corpus->inputs[corpus->count].size = size;
+    corpus->count++;
+}
+
+// Each input runs under a jump point of its own, so a fatal assertion or a
+// crash ends the input rather than leaving the loop with the guard still up.
+static bool fossil_fuzz_call(fossil_test_t *test, const fossil_test_row_t *row) {
+    fossil_test_jump_t point;
+    fossil_test_jump_t *previous = fossil_test_jump_swap(xnullptr);
+    if (FOSSIL_TEST_SETJMP(point) != 0) {
+        fossil_test_jump_swap(previous);
+        return false;
+    }
+    fossil_test_jump_swap(&point);
+    test->table.row_function(row);
+    fossil_test_jump_swap(previous);
+    return true;
+}
+
+// Run one input. It gets a heap block of exactly its size so sanitizers catch
+// reads past the end, and the scoreboard tells whether an assertion failed.
+static bool fossil_fuzz_execute(fossil_test_t *test, const uint8_t *data, size_t size) {
+    uint8_t *input = (uint8_t *)malloc(size ? size : 1);
+    if (input == xnullptr) {
+        perror("Failed to allocate memory for fuzz input");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(input, data, size);
+
+    fossil_test_row_t row = { input, size, 0 };
+    bool passing = _TEST_ENV.rule.should_pass;
+    _TEST_ENV.rule.should_pass = true;
+    fossil_fuzz_current_size = size;
+    fossil_fuzz_current = input;
+    bool passed = fossil_fuzz_call(test, &row) && _TEST_ENV.rule.should_pass;
+    if (!passed) {
+        fossil_fuzz_save_crash();
+    }
+    fossil_fuzz_current = xnullptr;
+    _TEST_ENV.rule.should_pass = passing && passed;
+    free(input);
+    return passed;
+}
+
+static size_t fossil_fuzz_mutate(uint8_t *data, size_t size, size_t capacity, uint64_t *state, const fossil_fuzz_input_t *other) {
+    uint64_t random = fossil_fuzz_random(state);
+    size_t at = size ? (size_t)(fossil_fuzz_random(state) % size) : 0;
+    switch (random % 11) {
+        case 0:
+            if (size > 0) {
+                data[at] ^= (uint8_t)(1u << (random >> 8) % 8);
+                return size;
+            }
+            break;
+        case 1:
+            if (size > 0) {
+                data[at] = (uint8_t)(random >> 8);
+                return size;
+            }
+            break;
+        case 2:
+            if (size > 0) {
+                data[at] = (uint8_t)fossil_fuzz_interesting8[(random >> 8) % sizeof(fossil_fuzz_interesting8)];
+                return size;
+            }
+            break;
+        case 3:
+            if (size >= 2) {
+                uint16_t value = (uint16_t)fossil_fuzz_interesting16[(random >> 8) % (sizeof(fossil_fuzz_interesting16) / sizeof(int16_t))];
+                at %= size - 1;
+                if (random & 0x100000) {
+                    value = (uint16_t)((value >> 8) | (value << 8));
+                }
+                memcpy(data + at, &value, sizeof(value));
+                return size;
+            }
+            break;
+        case 4:
+            if (size >= 4) {
+                uint32_t value = (uint32_t)fossil_fuzz_interesting32[(random >> 8) % (sizeof(fossil_fuzz_interesting32) / sizeof(int32_t))];
+                at %= size - 3;
+                if (random & 0x100000) {
+                    value = (value >> 24) | ((value >> 8) & 0xff00) | ((value << 8) & 0xff0000) | (value << 24);
+                }
+                memcpy(data + at, &value, sizeof(value));
+                return size;
+            }
+            break;
+        case 5:
+            if (size > 0) {
+                uint8_t delta = (uint8_t)(1 + (random >> 8) % 35);
+                data[at] = (uint8_t)(random & 0x100000 ? data[at] + delta : data[at] - delta);
+                return size;
+            }
+            break;
+        case 6:
+            if (size > 1) {
+                size_t length = 1 + (size_t)((random >> 8) % (size - 1 < 16 ? size - 1 : 16));
+                if (at + length > size) {
+                    at = size - length;
+                }
+                memmove(data + at, data + at + length, size - at - length);
+                return size - length;
+            }
+            break;
+        case 7:
+            if (size > 1) {
+                size_t length = 1 + (size_t)((random >> 8) % (size / 2));
+                size_t from = (size_t)(fossil_fuzz_random(state) % (size - length + 1));
+                at %= size - length + 1;
+                memmove(data + at, data + from, length);
+                return size;
+            }
+            break;
+        case 8:
+        case 9:
+            if (other != xnullptr && other->size > 0) {
+                size_t length = 1 + (size_t)((random >> 8) % other->size);
+                size_t from = (size_t)(fossil_fuzz_random(state) % (other->size - length + 1));
+                if (random % 11 == 8 && size + length <= capacity) {
+                    memmove(data + at + length, data + at, size - at);
+                    memcpy(data + at, other->data + from, length);
+                    return size + length;
+                }
+                if (size > 0) {
+                    if (length > size - at) {
+                        length = size - at;
+                    }
+                    memcpy(data + at, other->data + from, length);
+                    return size;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    // Insert a few random or repeated bytes, which also grows empty inputs.
+    if (size >= capacity) {
+        if (size > 0) {
+            data[at] = (uint8_t)(random >> 16);
+        }
+        return size;
+    }
+    size_t room = capacity - size;
+    size_t length = 1 + (size_t)((random >> 24) % (room < 16 ? room : 16));
+    memmove(data + at + length, data + at, size - at);
+    uint8_t fill = (uint8_t)(random >> 40);
+    for (size_t i = 0; i < length; i++) {
+        data[at + i] = random & 0x1000 ? fill : (uint8_t)fossil_fuzz_random(state);
+    }
+    return size + length;
+}
+
+static void fossil_fuzz_report(const char *event, const fossil_fuzz_stats_t *stats, clock_t started) {
+    double seconds = (double)(clock() - started) / CLOCKS_PER_SEC;
+    fossil_test_cout("cyan", "#%llu %s corpus: %llu features: %llu exec/s: %.0f\n",
+                     (unsigned long long)stats->runs, event, (unsigned long long)stats->corpus_size,
+                     (unsigned long long)stats->features, seconds > 0.0 ? (double)stats->runs / seconds : 0.0);
+}
+
+//
+// public functions
+//
+
+bool fossil_fuzz_corpus_add(const fossil_test_t *test, const void *data, size_t size) {
+    if (test == xnullptr || test->table.kind != FOSSIL_TEST_TABLE_CORPUS || test->table.path == xnullptr) {
+        return false;
+    }
+    char path[FILENAME_MAX];
+    char name[17];
+    fossil_fuzz_hex(name, fossil_fuzz_hash((const uint8_t *)data, size));
+    if ((size_t)snprintf(path, sizeof(path), "%s/%s", test->table.path, name) >= sizeof(path)) {
+        return false;
+    }
+    FILE *existing = fopen(path, "rb");
+    if (existing != xnullptr) {
+        fclose(existing);
+        return true;
+    }
+    fossil_fuzz_mkdirs(test->table.path);
+    return fossil_fuzz_write(path, (const uint8_t *)data, size);
+}
+
+bool fossil_fuzz_loop(fossil_test_t *test, uint64_t runs, fossil_fuzz_stats_t *stats) {
+    fossil_fuzz_stats_t local = {0, 0, 0, false};
+    if (stats == xnullptr) {
+        stats = &local;
+    }
+    *stats = local;
+    if (test == xnullptr || test->table.kind != FOSSIL_TEST_TABLE_CORPUS) {
+        fprintf(stderr, "Test case '%s' is not a fuzz target\n", test ? test->name : "(null)");
+        stats->failed = true;
+        return false;
+    }
+
+    fossil_fuzz_buckets_init();
+    fossil_fuzz_mkdirs(test->table.path);
+    snprintf(fossil_fuzz_crash_prefix, sizeof(fossil_fuzz_crash_prefix), "%s/crash-", test->table.path);
+    fossil_fuzz_guard(true);
+    fossil_fuzz_clear();
+    clock_t started = clock();
+
+    // Seeds run first so their coverage is already known.
+    fossil_fuzz_corpus_t corpus = {xnullptr, 0, 0};
+    fossil_test_table_cursor_t cursor;
+    fossil_test_row_t row;
+    size_t capacity = FOSSIL_FUZZ_MAX_LENGTH;
+    if (fossil_test_table_open(&test->table, &cursor)) {
+        while (!stats->failed && fossil_test_table_next(&cursor, &row)) {
+            fossil_fuzz_corpus_push(&corpus, (const uint8_t *)row.data, row.length);
+            capacity = row.length > capacity ? row.length : capacity;
+            stats->failed = !fossil_fuzz_execute(test, (const uint8_t *)row.data, row.length);
+            stats->features += fossil_fuzz_collect();
+            stats->runs++;
+        }
+        fossil_test_table_close(&cursor);
+    }
+    stats->corpus_size = corpus.count;
+
+    uint64_t state = _CLI.seed_enabled ? _CLI.seed : (uint64_t)time(xnullptr) ^ ((uint64_t)clock() << 32);
+    fossil_test_cout("cyan", "fuzzing %s with seed %llu (rerun with: seed %llu)\n", test->name,
+                     (unsigned long long)state, (unsigned long long)state);
+    fossil_fuzz_report("seeded", stats, started);
+    if (!stats->failed && stats->features == 0) {
+        fossil_test_cout("yellow", "no coverage feedback, build the tests with -Dwith_fuzz=enabled\n");
+    }
+
+    uint8_t *buffer = (uint8_t *)malloc(capacity);
+    if (buffer == xnullptr) {
+        perror("Failed to allocate memory for fuzz input");
+        exit(EXIT_FAILURE);
+    }
+    clock_t last_report = clock();
+    uint64_t limit = runs == 0 ? UINT64_MAX : runs;
+    while (!stats->failed && stats->runs < limit && corpus.count > 0) {
+        const fossil_fuzz_input_t *parent = &corpus.inputs[fossil_fuzz_random(&state) % corpus.count];
+        const fossil_fuzz_input_t *other = &corpus.inputs[fossil_fuzz_random(&state) % corpus.count];
+        size_t size = parent->size;
+        memcpy(buffer, parent->data, size);
+        size_t stack = 1 + (size_t)(fossil_fuzz_random(&state) % FOSSIL_FUZZ_STACK);
+        for (size_t i = 0; i < stack; i++) {
+            size = fossil_fuzz_mutate(buffer, size, capacity, &state, other);
+        }
+
+        stats->failed = !fossil_fuzz_execute(test, buffer, size);
+        stats->runs++;
+        size_t fresh = fossil_fuzz_collect();
+        if (fresh > 0 && !stats->failed) {
+            stats->features += fresh;
+            fossil_fuzz_corpus_push(&corpus, buffer, size);
+            fossil_fuzz_corpus_add(test, buffer, size);
+            stats->corpus_size = corpus.count;
+            fossil_fuzz_report("new", stats, started);
+        }
+        if (stats->runs % FOSSIL_FUZZ_REPORT == 0 && clock() - last_report >= CLOCKS_PER_SEC) {
+            last_report = clock();
+            fossil_fuzz_report("pulse", stats, started);
+        }
+    }
+    fossil_fuzz_report(stats->failed ? "failed" : "done", stats, started);
+
+    fossil_fuzz_guard(false);
+    free(buffer);
+    for (size_t i = 0; i < corpus.count; i++) {
+        free(corpus.inputs[i].data);
+    }
+    free(corpus.inputs);
+    return !stats->failed;
+}
@@ -0,0 +1,556 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/impact.h"
+#include "fossil/unittest/commands.h"
+
+// Record tags and magic of the .gcda format, see gcov-io.h of GCC.
+#define FOSSIL_IMPACT_GCDA_MAGIC    UINT32_C(0x67636461)
+#define FOSSIL_IMPACT_TAG_FUNCTION  UINT32_C(0x01000000)
+#define FOSSIL_IMPACT_TAG_ARCS      UINT32_C(0x01a10000)
+
+#define FOSSIL_IMPACT_HEADER "fossil-impact 1"
+
+static fossil_test_impact_t *_fossil_test_impact = xnullptr;
+
+//
+// local functions
+//
+
+static void* fossil_test_impact_grow(void *array, size_t *capacity, size_t count, size_t size) {
+    if (count < *capacity) {
+        return array;
+    }
+    size_t grown = *capacity == 0 ? 16 : *capacity * 2;
+    void *larger = realloc(array, grown * size);
+    if (larger == xnullptr) {
+        perror("Failed to allocate memory for the impact index");
+        exit(EXIT_FAILURE);
+    }
+    *capacity = grown;
+    return larger;
+}
+
+static char* fossil_test_impact_strdup(const char *text, size_t length) {
+    char *copy = (char *)malloc(length + 1);
+    if (copy == xnullptr) {
+        perror("Failed to allocate memory for the impact index");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+static size_t fossil_test_impact_add_object(fossil_test_impact_t *impact, const char *path, size_t length) {
+    impact->objects = (fossil_test_impact_object_t *)fossil_test_impact_grow(impact->objects,
+        &impact->object_capacity, impact->object_count, sizeof(fossil_test_impact_object_t));
+    fossil_test_impact_object_t *object = &impact->objects[impact->object_count];
+    memset(object, 0, sizeof(*object));
+    object->path = fossil_test_impact_strdup(path, length);
+    return impact->object_count++;
+}
+
+static fossil_test_impact_case_t* fossil_test_impact_add_case(fossil_test_impact_t *impact, const char *name, size_t length) {
+    impact->cases = (fossil_test_impact_case_t *)fossil_test_impact_grow(impact->cases,
+        &impact->case_capacity, impact->case_count, sizeof(fossil_test_impact_case_t));
+    fossil_test_impact_case_t *test = &impact->cases[impact->case_count++];
+    memset(test, 0, sizeof(*test));
+    test->name = fossil_test_impact_strdup(name, length);
+    return test;
+}
+
+static void fossil_test_impact_touch(fossil_test_impact_case_t *test, size_t object, uint32_t ident) {
+    test->touches = (uint64_t *)fossil_test_impact_grow(test->touches, &test->capacity, test->count, sizeof(uint64_t));
+    test->touches[test->count++] = (uint64_t)object << 32 | ident;
+}
+
+static int fossil_test_impact_compare_touch(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static int fossil_test_impact_compare_case(const void *a, const void *b) {
+    return strcmp(((const fossil_test_impact_case_t *)a)->name, ((const fossil_test_impact_case_t *)b)->name);
+}
+
+// Sorted touches group by object and make repeated rows of a table collapse.
+static void fossil_test_impact_compact(fossil_test_impact_case_t *test) {
+    if (test->count < 2) {
+        return;
+    }
+    qsort(test->touches, test->count, sizeof(uint64_t), fossil_test_impact_compare_touch);
+    size_t kept = 1;
+    for (size_t i = 1; i < test->count; i++) {
+        if (test->touches[i] != test->touches[kept - 1]) {
+            test->touches[kept++] = test->touches[i];
+        }
+    }
+    test->count = kept;
+}
+
+// Compare the total of one function against the last dump and charge the
+// running case when it moved.
+static void fossil_test_impact_function(fossil_test_impact_t *impact, size_t slot, uint32_t ident, uint64_t total) {
+    fossil_test_impact_object_t *object = &impact->objects[impact->object];
+    if (slot >= object->count) {
+        object->idents = (uint32_t *)fossil_test_impact_grow(object->idents, &object->capacity, object->count, sizeof(uint32_t));
+        object->totals = (uint64_t *)realloc(object->totals, object->capacity * sizeof(uint64_t));
+        if (object->totals == xnullptr) {
+            perror("Failed to allocate memory for the impact index");
+            exit(EXIT_FAILURE);
+        }
+        object->idents[object->count] = ident;
+        object->totals[object->count] = 0;
+        slot = object->count++;
+    }
+    if (object->totals[slot] != total && impact->current != xnullptr) {
+        fossil_test_impact_touch(impact->current, impact->object, ident);
+    }
+    object->totals[slot] = total;
+}
+
+// Walk the .gcda stream of one object, written in host byte order. Since
+// GCC 12 the header carries a checksum after the stamp and record lengths
+// count bytes, a negative length stands for that many bytes of zero counters
+// left out of the stream.
+static void fossil_test_impact_stream_ended(fossil_test_impact_t *impact) {
+    if (!impact->streaming) {
+        return;
+    }
+    impact->streaming = false;
+
+    const unsigned char *bytes = impact->stream;
+    size_t words = impact->stream_length / 4;
+    uint32_t magic = 0;
+    if (words >= 4) {
+        memcpy(&magic, bytes, 4);
+    }
+    if (magic != FOSSIL_IMPACT_GCDA_MAGIC) {
+        return;
+    }
+
+    size_t slot = 0;
+    bool open = false;
+    uint32_t ident = 0;
+    uint64_t total = 0;
+    size_t at = 4;
+    while (at + 2 <= words) {
+        uint32_t tag;
+        uint32_t length;
+        memcpy(&tag, bytes + at * 4, 4);
+        memcpy(&length, bytes + at * 4 + 4, 4);
+        at += 2;
+        if (tag == 0) {
+            break;
+        }
+        if ((int32_t)length < 0) {
+            continue;
+        }
+        size_t size = length / 4;
+        if (at + size > words) {
+            break;
+        }
+        if (tag == FOSSIL_IMPACT_TAG_FUNCTION) {
+            if (open) {
+                fossil_test_impact_function(impact, slot++, ident, total);
+            }
+            open = size > 0;
+            ident = 0;
+            total = 0;
+            if (open) {
+                memcpy(&ident, bytes + at * 4, 4);
+            }
+        } else if (tag == FOSSIL_IMPACT_TAG_ARCS && open) {
+            for (size_t i = 0; i + 1 < size; i += 2) {
+                uint32_t low;
+                uint32_t high;
+                memcpy(&low, bytes + (at + i) * 4, 4);
+                memcpy(&high, bytes + (at + i + 1) * 4, 4);
+                total += (uint64_t)high << 32 | low;
+            }
+        }
+        at += size;
+    }
+    if (open) {
+        fossil_test_impact_function(impact, slot, ident, total);
+    }
+}
+
+static fossil_test_impact_case_t* fossil_test_impact_find_case(const fossil_test_impact_t *impact, const char *name) {
+    fossil_test_impact_case_t key;
+    key.name = (char *)name;
+    return (fossil_test_impact_case_t *)bsearch(&key, impact->cases, impact->case_count,
+        sizeof(fossil_test_impact_case_t), fossil_test_impact_compare_case);
+}
+
+static const char* fossil_test_impact_basename(const char *path, size_t *length) {
+    const char *base = path;
+    for (const char *p = path; *p != '\0'; p++) {
+        if (*p == '/' || *p == '\\') {
+            base = p + 1;
+        }
+    }
+    *length = strlen(base);
+    return base;
+}
+
+// An object built from dir/name.c is called name.gcda, name.c.gcda,
+// dir_name.c.gcda or program-name.gcda depending on the build system.
+static bool fossil_test_impact_names(const char *object, size_t object_length, const char *name, size_t length) {
+    if (object_length < length || memcmp(object + object_length - length, name, length) != 0) {
+        return false;
+    }
+    if (object_length == length) {
+        return true;
+    }
+    char before = object[object_length - length - 1];
+    return before == '_' || before == '-';
+}
+
+static bool fossil_test_impact_matches(const char *path, const char *file, size_t file_length) {
+    size_t object_length;
+    const char *object = fossil_test_impact_basename(path, &object_length);
+    if (object_length > 5 && strcmp(object + object_length - 5, ".gcda") == 0) {
+        object_length -= 5;
+    }
+
+    size_t name_length = file_length;
+    const char *name = file;
+    for (size_t i = 0; i < file_length; i++) {
+        if (file[i] == '/' || file[i] == '\\') {
+            name = file + i + 1;
+            name_length = file_length - i - 1;
+        }
+    }
+    size_t stem_length = name_length;
+    while (stem_length > 0 && name[stem_length - 1] != '.') {
+        stem_length--;
+    }
+    stem_length = stem_length > 1 ? stem_length - 1 : name_length;
+
+    return fossil_test_impact_names(object, object_length, name, name_length) ||
+           fossil_test_impact_names(object, object_length, name, stem_length);
+}
+
+static bool fossil_test_impact_extension(const char *file, size_t length, const char *const *extensions) {
+    size_t dot = length;
+    while (dot > 0 && file[dot - 1] != '.' && file[dot - 1] != '/' && file[dot - 1] != '\\') {
+        dot--;
+    }
+    if (dot == 0 || file[dot - 1] != '.') {
+        return false;
+    }
+    for (size_t i = 0; extensions[i] != xnullptr; i++) {
+        if (strlen(extensions[i]) == length - dot && strncmp(file + dot, extensions[i], length - dot) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void fossil_test_impact_change_one(fossil_test_impact_t *impact, const char *file, size_t length) {
+    static const char *const sources[] = { "c", "cc", "cpp", "cxx", "c++", "m", "mm", xnullptr };
+    static const char *const headers[] = { "h", "hh", "hpp", "hxx", "h++", "inl", "inc", "ipp", "tpp", xnullptr };
+
+    if (fossil_test_impact_extension(file, length, headers)) {
+        impact->select_all = true; // any object may include it
+        return;
+    }
+    if (!fossil_test_impact_extension(file, length, sources)) {
+        return;
+    }
+    bool placed = false;
+    for (size_t i = 0; i < impact->object_count; i++) {
+        if (fossil_test_impact_matches(impact->objects[i].path, file, length)) {
+            impact->objects[i].changed = true;
+            placed = true;
+        }
+    }
+    if (!placed) {
+        impact->select_all = true; // new or not instrumented
+    }
+}
+
+static char* fossil_test_impact_read(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == xnullptr) {
+        return xnullptr;
+    }
+    size_t length = 0;
+    size_t capacity = 0;
+    char *text = xnullptr;
+    for (;;) {
+        while (capacity < length + 4096) {
+            text = (char *)fossil_test_impact_grow(text, &capacity, capacity, 1);
+        }
+        size_t count = fread(text + length, 1, capacity - length - 1, file);
+        length += count;
+        if (count == 0) {
+            break;
+        }
+    }
+    fclose(file);
+    text[length] = '\0';
+    return text;
+}
+
+//
+// public functions
+//
+
+fossil_test_impact_t* fossil_test_impact_create(fossil_test_impact_collect_t collect) {
+    fossil_test_impact_t *impact = (fossil_test_impact_t *)calloc(1, sizeof(fossil_test_impact_t));
+    if (impact == xnullptr) {
+        perror("Failed to allocate memory for the impact index");
+        exit(EXIT_FAILURE);
+    }
+    impact->collect = collect;
+    return impact;
+}
+
+void fossil_test_impact_collect(fossil_test_impact_t *impact, const char *name) {
+    if (impact == xnullptr || impact->collect == xnullptr) {
+        return;
+    }
+    impact->current = xnullptr;
+    if (name != xnullptr) {
+        for (size_t i = impact->case_count; i > 0; i--) {
+            if (strcmp(impact->cases[i - 1].name, name) == 0) {
+                impact->current = &impact->cases[i - 1];
+                break;
+            }
+        }
+        if (impact->current == xnullptr) {
+            impact->current = fossil_test_impact_add_case(impact, name, strlen(name));
+        }
+    }
+    impact->collect(impact);
+    fossil_test_impact_stream_ended(impact);
+    if (impact->current != xnullptr) {
+        fossil_test_impact_compact(impact->current);
+    }
+    impact->current = xnullptr;
+}
+
+void fossil_test_impact_filename(const char *filename, void *arg) {
+    fossil_test_impact_t *impact = (fossil_test_impact_t *)arg;
+    fossil_test_impact_stream_ended(impact);
+
+    // Objects come in the same order on every dump
+    size_t next = impact->object + 1;
+    if (next < impact->object_count && strcmp(impact->objects[next].path, filename) == 0) {
+        impact->object = next;
+    } else {
+        size_t i = 0;
+        while (i < impact->object_count && strcmp(impact->objects[i].path, filename) != 0) {
+            i++;
+        }
+        impact->object = i < impact->object_count ? i : fossil_test_impact_add_object(impact, filename, strlen(filename));
+    }
+    impact->streaming = true;
+    impact->stream_length = 0;
+}
+
+void fossil_test_impact_data(const void *data, unsigned length, void *arg) {
+    fossil_test_impact_t *impact = (fossil_test_impact_t *)arg;
+    while (impact->stream_length + length > impact->stream_capacity) {
+        impact->stream = (unsigned char *)fossil_test_impact_grow(impact->stream, &impact->stream_capacity,
+            impact->stream_capacity, 1);
+    }
+    memcpy(impact->stream + impact->stream_length, data, length);
+    impact->stream_length += length;
+}
+
+// Only value profiling asks for memory, which coverage builds do not use.
+void* fossil_test_impact_allocate(unsigned length, void *arg) {
+    (void)arg;
+    return malloc(length);
+}
+
+bool fossil_test_impact_save(const fossil_test_impact_t *impact, const char *path) {
+    FILE *file = fopen(path, "w");
+    if (file == xnullptr) {
+        return false;
+    }
+    fprintf(file, "%s\n", FOSSIL_IMPACT_HEADER);
+    for (size_t i = 0; i < impact->object_count; i++) {
+        fprintf(file, "object %s\n", impact->objects[i].path);
+    }
+    for (size_t i = 0; i < impact->case_count; i++) {
+        const fossil_test_impact_case_t *test = &impact->cases[i];
+        fprintf(file, "case %s\n", test->name);
+        for (size_t j = 0; j < test->count; j++) {
+            uint64_t object = test->touches[j] >> 32;
+            if (j == 0 || object != test->touches[j - 1] >> 32) {
+                fprintf(file, "%stouch %llu", j == 0 ? "" : "\n", (unsigned long long)object);
+            }
+            fprintf(file, " %x", (unsigned)(test->touches[j] & UINT32_MAX));
+        }
+        if (test->count > 0) {
+            fputc('\n', file);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+fossil_test_impact_t* fossil_test_impact_load(const char *path) {
+    char *text = fossil_test_impact_read(path);
+    if (text == xnullptr) {
+        return xnullptr;
+    }
+    size_t header = strlen(FOSSIL_IMPACT_HEADER);
+    if (strncmp(text, FOSSIL_IMPACT_HEADER, header) != 0 || (text[header] != '\n' && text[header] != '\r')) {
+        free(text);
+        return xnullptr;
+    }
+
+    fossil_test_impact_t *impact = fossil_test_impact_create(xnullptr);
+    fossil_test_impact_case_t *test = xnullptr;
+    char *line = text;
+    while (*line != '\0') {
+        char *end = strchr(line, '\n');
+        char *next = end != xnullptr ? end + 1 : line + strlen(line);
+        if (end == xnullptr) {
+            end = next;
+        }
+        if (end > line && end[-1] == '\r') {
+            end--;
+        }
+        *end = '\0';
+
+        if (strncmp(line, "object ", 7) == 0) {
+            fossil_test_impact_add_object(impact, line + 7, strlen(line + 7));
+        } else if (strncmp(line, "case ", 5) == 0) {
+            test = fossil_test_impact_add_case(impact, line + 5, strlen(line + 5));
+        } else if (strncmp(line, "touch ", 6) == 0 && test != xnullptr) {
+            char *cursor;
+            unsigned long long object = strtoull(line + 6, &cursor, 10);
+            if (object < impact->object_count) {
+                while (*cursor == ' ') {
+                    char *after;
+                    unsigned long ident = strtoul(cursor, &after, 16);
+                    if (after == cursor) {
+                        break;
+                    }
+                    fossil_test_impact_touch(test, (size_t)object, (uint32_t)ident);
+                    cursor = after;
+                }
+            }
+        }
+        line = next;
+    }
+    free(text);
+
+    qsort(impact->cases, impact->case_count, sizeof(fossil_test_impact_case_t), fossil_test_impact_compare_case);
+    return impact;
+}
+
+void fossil_test_impact_change(fossil_test_impact_t *impact, const char *files) {
+    const char *file = files;
+    while (*file != '\0') {
+        while (*file == ',' || *file == ' ') {
+            file++;
+        }
+        size_t length = strcspn(file, ",");
+        while (length > 0 && file[length - 1] == ' ') {
+            length--;
+        }
+        if (length > 0) {
+            fossil_test_impact_change_one(impact, file, length);
+        }
+        file += length;
+    }
+}
+
+const fossil_test_impact_case_t* fossil_test_impact_find(const fossil_test_impact_t *impact, const char *name) {
+    return fossil_test_impact_find_case(impact, name);
+}
+
+bool fossil_test_impact_selects(const fossil_test_impact_t *impact, const char *name) {
+    if (impact->select_all) {
+        return true;
+    }
+    const fossil_test_impact_case_t *test = fossil_test_impact_find_case(impact, name);
+    if (test == xnullptr) {
+        return true; // not in the index yet
+    }
+    for (size_t i = 0; i < test->count; i++) {
+        if (impact->objects[test->touches[i] >> 32].changed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void fossil_test_impact_erase(fossil_test_impact_t *impact) {
+    if (impact == xnullptr) {
+        return;
+    }
+    for (size_t i = 0; i < impact->object_count; i++) {
+        free(impact->objects[i].path);
+        free(impact->objects[i].idents);
+        free(impact->objects[i].totals);
+    }
+    for (size_t i = 0; i < impact->case_count; i++) {
+        free(impact->cases[i].name);
+        free(impact->cases[i].touches);
+    }
+    free(impact->objects);
+    free(impact->cases);
+    free(impact->stream);
+    free(impact);
+}
+
+void fossil_test_impact_attach(fossil_test_impact_collect_t collect) {
+    if (_CLI.impact_record) {
+        if (collect == xnullptr) {
+            fprintf(stderr, "impact record needs a test program built with the with_impact option, nothing is recorded\n");
+            return;
+        }
+        _fossil_test_impact = fossil_test_impact_create(collect);
+        fossil_test_impact_collect(_fossil_test_impact, xnullptr);
+    } else if (_CLI.changed_enabled) {
+        _fossil_test_impact = fossil_test_impact_load(_CLI.impact_index);
+        if (_fossil_test_impact == xnullptr) {
+            fprintf(stderr, "No impact index at '%s', every case runs\n", _CLI.impact_index);
+            return;
+        }
+        fossil_test_impact_change(_fossil_test_impact, _CLI.changed_files);
+    }
+}
+
+bool fossil_test_impact_case_selected(const char *name) {
+    if (_fossil_test_impact == xnullptr || _fossil_test_impact->collect != xnullptr) {
+        return true;
+    }
+    return fossil_test_impact_selects(_fossil_test_impact, name);
+}
+
+void fossil_test_impact_case_ended(const char *name) {
+    if (_fossil_test_impact != xnullptr) {
+        fossil_test_impact_collect(_fossil_test_impact, name);
+    }
+}
+
+void fossil_test_impact_finish(void) {
+    if (_fossil_test_impact == xnullptr) {
+        return;
+    }
+    if (_fossil_test_impact->collect != xnullptr && !fossil_test_impact_save(_fossil_test_impact, _CLI.impact_index)) {
+        fprintf(stderr, "Failed to write the impact index '%s'\n", _CLI.impact_index);
+    }
+    fossil_test_impact_erase(_fossil_test_impact);
+    _fossil_test_impact = xnullptr;
+}
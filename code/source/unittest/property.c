@@ -0,0 +1,661 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/_common/atomic.h"
+#include "fossil/_common/thread.h"
+#include "fossil/unittest/property.h"
+#include "fossil/unittest/commands.h"
+#include "fossil/unittest/console.h"
+#include "fossil/unittest/crash.h"
+#include <float.h>
+#include <stdarg.h>
+
+enum {
+    FOSSIL_PROPERTY_MAX_THREADS = 64,
+    FOSSIL_PROPERTY_SHRINK_BUDGET = 10000, // replays spent minimizing one failure
+};
+
+// 2^53, the resolution of the fraction used by fossil_property_f64.
+#define FOSSIL_PROPERTY_F64_STEPS 9007199254740992ULL
+
+typedef struct {
+    const fossil_property_spec_t *spec;
+    uint64_t seed;
+    volatile uint64_t next;      // next case to hand out
+    volatile uint64_t failing;   // lowest failing case, UINT64_MAX while none
+    volatile uint64_t discarded;
+} fossil_property_runner_t;
+
+static uint64_t fossil_property_seed;
+static bool fossil_property_seeded;
+
+// Case running on this thread, its failed assertions end it.
+static FOSSIL_TEST_THREAD_LOCAL fossil_property_t *fossil_property_current = xnullptr;
+
+//
+// local functions
+//
+
+static uint64_t fossil_property_mix(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t fossil_property_random(fossil_property_t *prop) {
+    return fossil_property_mix(&prop->state);
+}
+
+// The seed is fixed once per process so every property of a run can be
+// replayed with the one printed number.
+static uint64_t fossil_property_base_seed(void) {
+    if (!fossil_property_seeded) {
+        if (_CLI.seed_enabled) {
+            fossil_property_seed = _CLI.seed;
+        } else {
+            uint64_t state = (uint64_t)time(xnullptr) ^ ((uint64_t)clock() << 32);
+            fossil_property_seed = fossil_property_mix(&state);
+        }
+        fossil_property_seeded = true;
+    }
+    return fossil_property_seed;
+}
+
+static uint64_t fossil_property_case_seed(const fossil_property_runner_t *runner, uint64_t index) {
+    uint64_t state = runner->seed;
+    for (const char *c = runner->spec->name; *c != '\0'; c++) {
+        state = (state ^ (uint64_t)(unsigned char)*c) * 0x100000001b3ULL;
+    }
+    state ^= index * 0xd1b54a32d192ed03ULL;
+    return fossil_property_mix(&state);
+}
+
+static void fossil_property_push(fossil_property_t *prop, uint64_t choice) {
+    if (prop->choice_count == prop->choice_capacity) {
+        size_t capacity = prop->choice_capacity ? prop->choice_capacity * 2 : 64;
+        uint64_t *choices = (uint64_t *)realloc(prop->choices, capacity * sizeof(uint64_t));
+        if (choices == xnullptr) {
+            perror("Failed to allocate memory for property choices");
+            exit(EXIT_FAILURE);
+        }
+        prop->choices = choices;
+        prop->choice_capacity = capacity;
+    }
+    prop->choices[prop->choice_count++] = choice;
+}
+
+// While shrinking, hand back the recorded choice, or zero past the end so a
+// shortened stream still decodes to the simplest values.
+static bool fossil_property_replay(fossil_property_t *prop, uint64_t *choice) {
+    if (!prop->replaying) {
+        return false;
+    }
+    *choice = prop->cursor < prop->choice_count ? prop->choices[prop->cursor] : 0;
+    prop->cursor++;
+    return true;
+}
+
+static void fossil_property_note(fossil_property_t *prop, const char *label, const char *format, ...) {
+    if (!prop->recording || label == xnullptr) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    char value[512];
+    vsnprintf(value, sizeof(value), format, args);
+    va_end(args);
+
+    size_t needed = strlen(label) + strlen(value) + 8;
+    if (prop->log_length + needed > prop->log_capacity) {
+        size_t capacity = prop->log_capacity ? prop->log_capacity : 256;
+        while (capacity < prop->log_length + needed) {
+            capacity *= 2;
+        }
+        char *log = (char *)realloc(prop->log, capacity);
+        if (log == xnullptr) {
+            perror("Failed to allocate memory for property log");
+            exit(EXIT_FAILURE);
+        }
+        prop->log = log;
+        prop->log_capacity = capacity;
+    }
+    prop->log_length += (size_t)snprintf(prop->log + prop->log_length, prop->log_capacity - prop->log_length,
+                                         "    %s = %s\n", label, value);
+}
+
+// Values are ranked by distance from target, alternating above and below it:
+// target, target + 1, target - 1, target + 2, ... so smaller choices are
+// simpler values. All three arguments use an order-preserving unsigned scale.
+static uint64_t fossil_property_unrank(uint64_t target, uint64_t min, uint64_t max, uint64_t rank) {
+    uint64_t up = max - target;
+    uint64_t down = target - min;
+    uint64_t near = up < down ? up : down;
+    if (rank == 0) {
+        return target;
+    }
+    if (rank / 2 < near || (rank / 2 == near && rank % 2 == 0)) {
+        uint64_t step = rank / 2 + rank % 2;
+        return rank % 2 ? target + step : target - step;
+    }
+    uint64_t step = rank - near;
+    return up > down ? target + step : target - step;
+}
+
+static uint64_t fossil_property_rank(uint64_t target, uint64_t min, uint64_t max, uint64_t value) {
+    uint64_t up = max - target;
+    uint64_t down = target - min;
+    uint64_t near = up < down ? up : down;
+    if (value == target) {
+        return 0;
+    }
+    uint64_t distance = value > target ? value - target : target - value;
+    if (distance <= near) {
+        return value > target ? 2 * distance - 1 : 2 * distance;
+    }
+    return distance + near;
+}
+
+static uint64_t fossil_property_ordered(fossil_property_t *prop, uint64_t target, uint64_t min, uint64_t max) {
+    uint64_t span = max - min;
+    uint64_t choice;
+    if (!fossil_property_replay(prop, &choice)) {
+        // Bounds, the target and its neighbours are where bugs live, so they
+        // come up far more often than a uniform draw would pick them.
+        uint64_t random = fossil_property_random(prop);
+        switch (random % 16) {
+            case 0:
+                choice = fossil_property_rank(target, min, max, min);
+                break;
+            case 1:
+                choice = fossil_property_rank(target, min, max, max);
+                break;
+            case 2:
+                choice = fossil_property_random(prop) % 8;
+                break;
+            default:
+                choice = fossil_property_random(prop);
+                break;
+        }
+        // Store the rank itself so shrinking searches a monotone range.
+        choice = span == UINT64_MAX ? choice : choice % (span + 1);
+        fossil_property_push(prop, choice);
+    }
+    uint64_t rank = span == UINT64_MAX ? choice : choice % (span + 1);
+    return fossil_property_unrank(target, min, max, rank);
+}
+
+static char* fossil_property_string(fossil_property_t *prop, size_t length) {
+    if (prop->string_count == prop->string_capacity) {
+        size_t capacity = prop->string_capacity ? prop->string_capacity * 2 : 8;
+        char **strings = (char **)realloc(prop->strings, capacity * sizeof(char *));
+        if (strings == xnullptr) {
+            perror("Failed to allocate memory for property strings");
+            exit(EXIT_FAILURE);
+        }
+        prop->strings = strings;
+        prop->string_capacity = capacity;
+    }
+    char *string = (char *)malloc(length + 1);
+    if (string == xnullptr) {
+        perror("Failed to allocate memory for property string");
+        exit(EXIT_FAILURE);
+    }
+    prop->strings[prop->string_count++] = string;
+    return string;
+}
+
+// Returns how many input bytes fit in out.
+static size_t fossil_property_escape(char *out, size_t capacity, const unsigned char *data, size_t length, bool hex) {
+    size_t used = 0;
+    size_t i = 0;
+    out[0] = '\0';
+    for (; i < length && used + 8 < capacity; i++) {
+        if (hex) {
+            used += (size_t)snprintf(out + used, capacity - used, "%02x", data[i]);
+        } else if (data[i] == '"' || data[i] == '\\') {
+            used += (size_t)snprintf(out + used, capacity - used, "\\%c", data[i]);
+        } else if (isprint(data[i])) {
+            out[used++] = (char)data[i];
+            out[used] = '\0';
+        } else {
+            used += (size_t)snprintf(out + used, capacity - used, "\\x%02x", data[i]);
+        }
+    }
+    return i;
+}
+
+static void fossil_property_begin(fossil_property_t *prop) {
+    prop->cursor = 0;
+    prop->failed = false;
+    prop->discarded = false;
+    prop->expression = xnullptr;
+    prop->file = xnullptr;
+    prop->line = 0;
+    prop->log_length = 0;
+    if (!prop->replaying) {
+        prop->choice_count = 0;
+    }
+}
+
+static void fossil_property_end(fossil_property_t *prop) {
+    for (size_t i = 0; i < prop->string_count; i++) {
+        free(prop->strings[i]);
+    }
+    prop->string_count = 0;
+}
+
+static void fossil_property_release(fossil_property_t *prop) {
+    fossil_property_end(prop);
+    free(prop->strings);
+    free(prop->choices);
+    free(prop->log);
+    memset(prop, 0, sizeof(*prop));
+}
+
+static void fossil_property_assert_hook(const char *message, const char *file, int line) {
+    fossil_property_fail(fossil_property_current, message, file, line);
+}
+
+// Every case runs under a jump point of its own thread, so a failed check, a
+// failed assertion or a crash ends the case wherever in the body it happens.
+static void fossil_property_call(const fossil_property_spec_t *spec, fossil_property_t *prop) {
+    fossil_test_jump_t point;
+    fossil_test_jump_t *outer = fossil_test_jump_swap(&point);
+    fossil_test_assert_hook_t hook = fossil_test_assert_hook_swap(fossil_property_assert_hook);
+    fossil_property_current = prop;
+    if (FOSSIL_TEST_SETJMP(point) == 0) {
+        spec->body(prop);
+    }
+    fossil_property_current = xnullptr;
+    fossil_test_assert_hook_swap(hook);
+    fossil_test_jump_swap(outer);
+
+    fossil_test_crash_t crash;
+    if (fossil_test_crash_take(&crash)) {
+        prop->failed = true;
+        prop->expression = fossil_test_crash_name(crash.signal);
+        prop->file = xnullptr;
+        prop->line = 0;
+    }
+}
+
+static void* fossil_property_worker(void *arg) {
+    fossil_property_runner_t *runner = (fossil_property_runner_t *)arg;
+    fossil_property_t prop;
+    memset(&prop, 0, sizeof(prop));
+
+    for (;;) {
+        uint64_t index = fossil_atomic_fetch_add_u64(&runner->next, 1);
+        if (index >= runner->spec->cases || index > fossil_atomic_load_u64(&runner->failing)) {
+            break;
+        }
+        prop.state = fossil_property_case_seed(runner, index);
+        fossil_property_begin(&prop);
+        fossil_property_call(runner->spec, &prop);
+        fossil_property_end(&prop);
+
+        if (prop.failed) {
+            // Keep the lowest failing case so the outcome does not depend on
+            // how the cases were spread over the threads.
+            uint64_t current = fossil_atomic_load_u64(&runner->failing);
+            while (index < current && !fossil_atomic_compare_exchange_u64(&runner->failing, &current, index)) {
+            }
+        } else if (prop.discarded) {
+            fossil_atomic_fetch_add_u64(&runner->discarded, 1);
+        }
+    }
+    fossil_property_release(&prop);
+    return xnullptr;
+}
+
+// Replay a candidate stream, keeping it when the property still fails. The
+// stream is cut to the choices the body actually used.
+static bool fossil_property_attempt(const fossil_property_spec_t *spec, fossil_property_t *prop,
+                                    uint64_t *best, size_t *best_count, const uint64_t *candidate, size_t count, size_t *budget) {
+    if (*budget == 0) {
+        return false;
+    }
+    (*budget)--;
+    prop->choice_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        fossil_property_push(prop, candidate[i]);
+    }
+    fossil_property_begin(prop);
+    fossil_property_call(spec, prop);
+    fossil_property_end(prop);
+    if (!prop->failed) {
+        return false;
+    }
+    size_t used = prop->cursor < count ? prop->cursor : count;
+    memcpy(best, candidate, used * sizeof(uint64_t));
+    *best_count = used;
+    return true;
+}
+
+static size_t fossil_property_shrink(const fossil_property_spec_t *spec, fossil_property_t *prop, uint64_t *best, size_t *length) {
+    size_t count = *length;
+    uint64_t *candidate = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    if (candidate == xnullptr) {
+        perror("Failed to allocate memory for property shrinking");
+        exit(EXIT_FAILURE);
+    }
+    size_t budget = FOSSIL_PROPERTY_SHRINK_BUDGET;
+    size_t steps = 0;
+    bool progress = true;
+    prop->replaying = true;
+
+    while (progress && budget > 0) {
+        progress = false;
+
+        // Drop runs of choices, which shortens strings, buffers and lists.
+        for (size_t block = 8; block > 0; block /= 2) {
+            for (size_t at = 0; at + block <= count && budget > 0;) {
+                memcpy(candidate, best, at * sizeof(uint64_t));
+                memcpy(candidate + at, best + at + block, (count - at - block) * sizeof(uint64_t));
+                if (fossil_property_attempt(spec, prop, best, &count, candidate, count - block, &budget)) {
+                    progress = true;
+                    steps++;
+                } else {
+                    at++;
+                }
+            }
+        }
+
+        // Lower every choice as far as it goes while the property still fails.
+        // Ranks alternate sides of the target, so the search keeps the parity
+        // and only the last step may cross over to the other side.
+        for (size_t at = 0; at < count && budget > 0; at++) {
+            uint64_t side = best[at] & 1;
+            uint64_t low = 0;
+            uint64_t high = best[at] >> 1;
+            while (low < high && budget > 0 && at < count) {
+                uint64_t middle = low + (high - low) / 2;
+                memcpy(candidate, best, count * sizeof(uint64_t));
+                candidate[at] = (middle << 1) | side;
+                if (fossil_property_attempt(spec, prop, best, &count, candidate, count, &budget)) {
+                    high = middle;
+                    progress = true;
+                    steps++;
+                } else {
+                    low = middle + 1;
+                }
+            }
+            if (at < count && best[at] > 0 && budget > 0) {
+                memcpy(candidate, best, count * sizeof(uint64_t));
+                candidate[at] = best[at] - 1;
+                if (fossil_property_attempt(spec, prop, best, &count, candidate, count, &budget)) {
+                    progress = true;
+                    steps++;
+                }
+            }
+        }
+    }
+    free(candidate);
+    *length = count;
+    return steps;
+}
+
+//
+// public functions
+//
+
+void fossil_property_fail(fossil_property_t *prop, const char *expression, const char *file, int32_t line) {
+    prop->failed = true;
+    prop->expression = expression;
+    prop->file = file;
+    prop->line = line;
+    if (prop == fossil_property_current) {
+        fossil_test_jump_back();
+    }
+}
+
+void fossil_property_discard(fossil_property_t *prop) {
+    prop->discarded = true;
+    if (prop == fossil_property_current) {
+        fossil_test_jump_back();
+    }
+}
+
+uint64_t fossil_property_u64(fossil_property_t *prop, const char *label, uint64_t min, uint64_t max) {
+    if (max < min) {
+        uint64_t swap = min;
+        min = max;
+        max = swap;
+    }
+    uint64_t value = fossil_property_ordered(prop, min, min, max);
+    fossil_property_note(prop, label, "%llu", (unsigned long long)value);
+    return value;
+}
+
+int64_t fossil_property_i64(fossil_property_t *prop, const char *label, int64_t min, int64_t max) {
+    if (max < min) {
+        int64_t swap = min;
+        min = max;
+        max = swap;
+    }
+    // Flipping the sign bit maps signed order onto unsigned order.
+    const uint64_t sign = 0x8000000000000000ULL;
+    int64_t target = min > 0 ? min : (max < 0 ? max : 0);
+    uint64_t value = fossil_property_ordered(prop, (uint64_t)target ^ sign, (uint64_t)min ^ sign, (uint64_t)max ^ sign);
+    int64_t result = (int64_t)(value ^ sign);
+    fossil_property_note(prop, label, "%lld", (long long)result);
+    return result;
+}
+
+double fossil_property_f64(fossil_property_t *prop, const char *label, double min, double max) {
+    if (max < min) {
+        double swap = min;
+        min = max;
+        max = swap;
+    }
+    double target = min > 0.0 ? min : (max < 0.0 ? max : 0.0);
+    uint64_t choice;
+    if (!fossil_property_replay(prop, &choice)) {
+        uint64_t random = fossil_property_random(prop);
+        switch (random % 16) {
+            case 0:
+                choice = (FOSSIL_PROPERTY_F64_STEPS << 1) | 1; // min
+                break;
+            case 1:
+                choice = FOSSIL_PROPERTY_F64_STEPS << 1; // max
+                break;
+            case 2:
+                choice = 0; // target
+                break;
+            default: {
+                // Pick a side in proportion to its width, then a point on it.
+                double width = (max - target) + (target - min);
+                double u = (double)(fossil_property_random(prop) >> 11) / (double)FOSSIL_PROPERTY_F64_STEPS;
+                uint64_t below = width > 0.0 && u * width >= (max - target) ? 1 : 0;
+                choice = ((fossil_property_random(prop) % (FOSSIL_PROPERTY_F64_STEPS + 1)) << 1) | below;
+                break;
+            }
+        }
+        fossil_property_push(prop, choice);
+    }
+    // Low bit picks the side, the rest is the distance from the target as a
+    // fraction of that side, so halving a choice halves the distance.
+    double fraction = (double)((choice >> 1) % (FOSSIL_PROPERTY_F64_STEPS + 1)) / (double)FOSSIL_PROPERTY_F64_STEPS;
+    double value = (choice & 1) ? target - fraction * (target - min) : target + fraction * (max - target);
+    if (value < min) {
+        value = min;
+    } else if (value > max) {
+        value = max;
+    }
+    fossil_property_note(prop, label, "%.17g", value);
+    return value;
+}
+
+double fossil_property_f64_any(fossil_property_t *prop, const char *label) {
+    static const double special[] = {
+        -0.0, 1.0, -1.0, 0.5, DBL_EPSILON, DBL_MIN, -DBL_MIN, 4.9406564584124654e-324,
+        DBL_MAX, -DBL_MAX, INFINITY, -INFINITY, NAN
+    };
+    const uint64_t special_count = sizeof(special) / sizeof(special[0]);
+    uint64_t choice;
+    if (!fossil_property_replay(prop, &choice)) {
+        uint64_t random = fossil_property_random(prop);
+        if (random % 4 == 0) {
+            choice = 1 + fossil_property_random(prop) % special_count;
+        } else {
+            choice = fossil_property_random(prop);
+        }
+        fossil_property_push(prop, choice);
+    }
+    double value = 0.0;
+    if (choice > 0 && choice <= special_count) {
+        value = special[choice - 1];
+    } else if (choice > special_count) {
+        memcpy(&value, &choice, sizeof(value));
+    }
+    fossil_property_note(prop, label, "%.17g", value);
+    return value;
+}
+
+bool fossil_property_bool(fossil_property_t *prop, const char *label) {
+    uint64_t choice;
+    if (!fossil_property_replay(prop, &choice)) {
+        choice = fossil_property_random(prop) & 1;
+        fossil_property_push(prop, choice);
+    }
+    bool value = (choice & 1) != 0;
+    fossil_property_note(prop, label, "%s", value ? "true" : "false");
+    return value;
+}
+
+const char* fossil_property_cstr(fossil_property_t *prop, const char *label, size_t max_length, const char *alphabet) {
+    static const char printable[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+    if (alphabet == xnullptr || alphabet[0] == '\0') {
+        alphabet = printable;
+    }
+    uint64_t last = (uint64_t)strlen(alphabet) - 1;
+    size_t length = (size_t)fossil_property_ordered(prop, 0, 0, (uint64_t)max_length);
+    char *string = fossil_property_string(prop, length);
+    for (size_t i = 0; i < length; i++) {
+        string[i] = alphabet[fossil_property_ordered(prop, 0, 0, last)];
+    }
+    string[length] = '\0';
+
+    if (prop->recording && label != xnullptr) {
+        char escaped[400];
+        size_t shown = fossil_property_escape(escaped, sizeof(escaped), (const unsigned char *)string, length, false);
+        fossil_property_note(prop, label, "\"%s\"%s (%zu chars)", escaped, shown < length ? "..." : "", length);
+    }
+    return string;
+}
+
+size_t fossil_property_bytes(fossil_property_t *prop, const char *label, void *buffer, size_t max_length) {
+    unsigned char *bytes = (unsigned char *)buffer;
+    size_t length = (size_t)fossil_property_ordered(prop, 0, 0, (uint64_t)max_length);
+    for (size_t i = 0; i < length; i++) {
+        bytes[i] = (unsigned char)fossil_property_ordered(prop, 0, 0, 255);
+    }
+
+    if (prop->recording && label != xnullptr) {
+        char hex[400];
+        size_t shown = fossil_property_escape(hex, sizeof(hex), bytes, length, true);
+        fossil_property_note(prop, label, "%s%s (%zu bytes)", hex, shown < length ? "..." : "", length);
+    }
+    return length;
+}
+
+bool fossil_property_falsified(const fossil_property_spec_t *spec, uint64_t *index, uint64_t *discarded) {
+    fossil_property_runner_t runner;
+    runner.spec = spec;
+    runner.seed = fossil_property_base_seed();
+    runner.next = 0;
+    runner.failing = UINT64_MAX;
+    runner.discarded = 0;
+
+    int32_t cpus = _fossil_test_get_num_cpus();
+    size_t thread_count = cpus > 0 ? (size_t)cpus : 1;
+    if (thread_count > FOSSIL_PROPERTY_MAX_THREADS) {
+        thread_count = FOSSIL_PROPERTY_MAX_THREADS;
+    }
+    if (thread_count > spec->cases) {
+        thread_count = spec->cases > 0 ? spec->cases : 1;
+    }
+
+    // The calling thread works too, so one core needs no extra thread.
+    fossil_thread_t threads[FOSSIL_PROPERTY_MAX_THREADS];
+    size_t started = 0;
+    for (size_t i = 1; i < thread_count; i++) {
+        if (fossil_thread_create(&threads[started], fossil_property_worker, &runner) == 0) {
+            started++;
+        }
+    }
+    fossil_property_worker(&runner);
+    for (size_t i = 0; i < started; i++) {
+        fossil_thread_join(threads[i]);
+    }
+    *index = runner.failing;
+    *discarded = runner.discarded;
+    return runner.failing != UINT64_MAX;
+}
+
+void fossil_property_run(const fossil_property_spec_t *spec) {
+    fossil_property_runner_t runner;
+    runner.spec = spec;
+    runner.seed = fossil_property_base_seed();
+    uint64_t failing = 0;
+    uint64_t discarded = 0;
+
+    if (!fossil_property_falsified(spec, &failing, &discarded)) {
+        bool all_discarded = spec->cases > 0 && discarded == spec->cases;
+        if (all_discarded) {
+            fossil_test_cout("red", "property %s discarded all %u cases\n", spec->name, spec->cases);
+        }
+        _fossil_test_assert_class(!all_discarded, TEST_ASSERT_AS_CLASS_ASSUME, (char*)"Property must hold for every generated case",
+                                  (char*)__FILE__, __LINE__, (char*)spec->name);
+        return;
+    }
+    runner.failing = failing;
+
+    // Regenerate the failing case on this thread to capture its choices.
+    fossil_property_t prop;
+    memset(&prop, 0, sizeof(prop));
+    prop.state = fossil_property_case_seed(&runner, runner.failing);
+    fossil_property_begin(&prop);
+    fossil_property_call(spec, &prop);
+    fossil_property_end(&prop);
+
+    size_t count = prop.choice_count;
+    uint64_t *stream = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    if (stream == xnullptr) {
+        perror("Failed to allocate memory for property shrinking");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(stream, prop.choices, count * sizeof(uint64_t));
+    size_t steps = fossil_property_shrink(spec, &prop, stream, &count);
+
+    // One last replay of the minimal stream describes its values.
+    prop.choice_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        fossil_property_push(&prop, stream[i]);
+    }
+    prop.recording = true;
+    fossil_property_begin(&prop);
+    fossil_property_call(spec, &prop);
+    fossil_property_end(&prop);
+
+    fossil_test_cout("red", "property %s falsified by case %llu, seed %llu (rerun with: seed %llu)\n",
+                     spec->name, (unsigned long long)runner.failing, (unsigned long long)runner.seed,
+                     (unsigned long long)runner.seed);
+    fossil_test_cout("red", "counterexample after %zu shrink steps:\n%s", steps, prop.log ? prop.log : "    (no values drawn)\n");
+    _fossil_test_assert_class(false, TEST_ASSERT_AS_CLASS_ASSUME, (char*)(prop.expression ? prop.expression : "property failed"),
+                              (char*)(prop.file ? prop.file : __FILE__), prop.line, (char*)spec->name);
+    free(stream);
+    fossil_property_release(&prop);
+}
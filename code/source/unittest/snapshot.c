@@ -0,0 +1,448 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/snapshot.h"
+#include "fossil/unittest/commands.h"
+#include "fossil/unittest/console.h"
+#include "fossil/unittest/text.h"
+#include "fossil/unittest/vector.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include <direct.h>
+#include <io.h>
+#endif
+
+#define FOSSIL_SNAPSHOT_PRIME1 UINT64_C(0x9E3779B185EBCA87)
+#define FOSSIL_SNAPSHOT_PRIME2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define FOSSIL_SNAPSHOT_PRIME3 UINT64_C(0x165667B19E3779F9)
+#define FOSSIL_SNAPSHOT_PRIME4 UINT64_C(0x85EBCA77C2B2AE63)
+#define FOSSIL_SNAPSHOT_PRIME5 UINT64_C(0x27D4EB2F165667C5)
+
+enum {
+    FOSSIL_SNAPSHOT_SNIFF = 8192,   // bytes looked at to tell text from binary
+};
+
+// A golden file mapped into memory, or read when mapping is not possible.
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    bool mapped;
+} fossil_snapshot_map_t;
+
+static FOSSIL_TEST_THREAD_LOCAL char fossil_snapshot_names[2 * FILENAME_MAX + 256];
+
+//
+// local functions
+//
+
+static uint64_t fossil_snapshot_rotl(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Little endian loads keep the hash files portable between hosts.
+static uint64_t fossil_snapshot_read64(const uint8_t *p) {
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+static uint32_t fossil_snapshot_read32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t fossil_snapshot_round(uint64_t lane, uint64_t input) {
+    lane += input * FOSSIL_SNAPSHOT_PRIME2;
+    return fossil_snapshot_rotl(lane, 31) * FOSSIL_SNAPSHOT_PRIME1;
+}
+
+static uint64_t fossil_snapshot_merge(uint64_t hash, uint64_t lane) {
+    hash ^= fossil_snapshot_round(0, lane);
+    return hash * FOSSIL_SNAPSHOT_PRIME1 + FOSSIL_SNAPSHOT_PRIME4;
+}
+
+static void fossil_snapshot_stripes(uint64_t lanes[4], const uint8_t *data, size_t stripes) {
+    uint64_t a = lanes[0];
+    uint64_t b = lanes[1];
+    uint64_t c = lanes[2];
+    uint64_t d = lanes[3];
+    for (size_t i = 0; i < stripes; i++, data += 32) {
+        a = fossil_snapshot_round(a, fossil_snapshot_read64(data));
+        b = fossil_snapshot_round(b, fossil_snapshot_read64(data + 8));
+        c = fossil_snapshot_round(c, fossil_snapshot_read64(data + 16));
+        d = fossil_snapshot_round(d, fossil_snapshot_read64(data + 24));
+    }
+    lanes[0] = a;
+    lanes[1] = b;
+    lanes[2] = c;
+    lanes[3] = d;
+}
+
+static void fossil_snapshot_mkdirs(const char *path) {
+    char partial[FILENAME_MAX];
+    size_t length = strlen(path);
+    if (length >= sizeof(partial)) {
+        return;
+    }
+    memcpy(partial, path, length + 1);
+    for (size_t at = 1; at < length; at++) {
+        if (partial[at] != '/' && partial[at] != '\\') {
+            continue;
+        }
+        char saved = partial[at];
+        partial[at] = '\0';
+#ifndef _WIN32
+        mkdir(partial, 0755);
+#else
+        _mkdir(partial);
+#endif
+        partial[at] = saved;
+    }
+}
+
+// Write through a temporary file and rename it over the old one, so an
+// interrupted update never leaves a half written golden file.
+static bool fossil_snapshot_write_file(const char *path, const void *data, size_t size) {
+    char temporary[FILENAME_MAX];
+    if ((size_t)snprintf(temporary, sizeof(temporary), "%s.tmp", path) >= sizeof(temporary)) {
+        return false;
+    }
+    fossil_snapshot_mkdirs(path);
+    FILE *file = fopen(temporary, "wb");
+    if (file == xnullptr) {
+        return false;
+    }
+    bool written = size == 0 || fwrite(data, 1, size, file) == size;
+    written = fclose(file) == 0 && written;
+#ifdef _WIN32
+    remove(path);
+#endif
+    if (!written || rename(temporary, path) != 0) {
+        remove(temporary);
+        return false;
+    }
+    return true;
+}
+
+static bool fossil_snapshot_path(char *out, size_t capacity, const char *name, const char *suffix) {
+    return (size_t)snprintf(out, capacity, "%s/%s%s", _CLI.snapshot_dir, name, suffix) < capacity;
+}
+
+// Size and modification time of the golden file, recorded in the hash file
+// so an edit made behind its back is noticed without reading it.
+static bool fossil_snapshot_stamp(const char *path, uint64_t *size, int64_t *modified) {
+    struct stat status;
+    if (stat(path, &status) != 0) {
+        return false;
+    }
+    *size = (uint64_t)status.st_size;
+    *modified = (int64_t)status.st_mtime;
+    return true;
+}
+
+// The hash file holds one line, the hash in hex, the length in bytes and the
+// modification time of the golden file.
+static bool fossil_snapshot_read_hash(const char *name, uint64_t *hash, uint64_t *size, int64_t *modified) {
+    char path[FILENAME_MAX];
+    if (!fossil_snapshot_path(path, sizeof(path), name, ".hash")) {
+        return false;
+    }
+    FILE *file = fopen(path, "r");
+    if (file == xnullptr) {
+        return false;
+    }
+    unsigned long long stored_hash = 0;
+    unsigned long long stored_size = 0;
+    long long stored_modified = 0;
+    bool parsed = fscanf(file, "%16llx %llu %lld", &stored_hash, &stored_size, &stored_modified) == 3;
+    fclose(file);
+    *hash = stored_hash;
+    *size = stored_size;
+    *modified = stored_modified;
+    return parsed;
+}
+
+static bool fossil_snapshot_map(const char *path, fossil_snapshot_map_t *map) {
+    map->data = xnullptr;
+    map->size = 0;
+    map->mapped = false;
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    map->size = (size_t)info.st_size;
+    if (map->size > 0) {
+        void *address = mmap(xnullptr, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            map->data = (const uint8_t *)address;
+            map->mapped = true;
+        }
+    }
+    close(fd);
+    if (map->mapped || map->size == 0) {
+        return true;
+    }
+#endif
+    // Windows, or a file system that cannot map, reads the file instead.
+    FILE *file = fopen(path, "rb");
+    if (file == xnullptr) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0) {
+        fclose(file);
+        return false;
+    }
+    map->size = (size_t)length;
+    uint8_t *data = (uint8_t *)malloc(map->size > 0 ? map->size : 1);
+    if (data == xnullptr) {
+        perror("Failed to allocate memory for snapshot");
+        exit(EXIT_FAILURE);
+    }
+    map->size = fread(data, 1, map->size, file);
+    fclose(file);
+    map->data = data;
+    return true;
+}
+
+static void fossil_snapshot_unmap(fossil_snapshot_map_t *map) {
+#ifndef _WIN32
+    if (map->mapped) {
+        munmap((void *)map->data, map->size);
+        return;
+    }
+#endif
+    free((void *)map->data);
+}
+
+// The hash only stands in for the golden file while the file is the one it
+// was taken from, otherwise the bytes have to be compared.
+static bool fossil_snapshot_vouched(const char *name, const char *path, const void *data, size_t size) {
+    uint64_t stored_hash = 0;
+    uint64_t stored_size = 0;
+    int64_t stored_modified = 0;
+    uint64_t golden_size = 0;
+    int64_t golden_modified = 0;
+    return fossil_snapshot_read_hash(name, &stored_hash, &stored_size, &stored_modified) && stored_size == (uint64_t)size &&
+           fossil_snapshot_stamp(path, &golden_size, &golden_modified) && golden_size == stored_size &&
+           golden_modified == stored_modified && stored_hash == fossil_snapshot_hash(data, size);
+}
+
+static bool fossil_snapshot_is_text(const uint8_t *data, size_t size) {
+    size_t length = size < FOSSIL_SNAPSHOT_SNIFF ? size : FOSSIL_SNAPSHOT_SNIFF;
+    return length == 0 || memchr(data, '\0', length) == xnullptr;
+}
+
+static void fossil_snapshot_pass(xassert_type_t behavior, const char *file, int line, const char *func) {
+    if (!_ASSERT_INFO.should_fail) {
+        _fossil_test_pass_count++;
+        return;
+    }
+    _fossil_test_assert_class(true, behavior, (char*)"Snapshot must match", (char*)file, line, (char*)func);
+}
+
+static void fossil_snapshot_fail(xassert_type_t behavior, const char *message, const char *file, int line, const char *func) {
+    _fossil_test_assert_class(false, behavior, (char*)message, (char*)file, line, (char*)func);
+}
+
+//
+// public functions
+//
+
+void fossil_snapshot_hash_init(fossil_snapshot_hash_t *hash) {
+    hash->lanes[0] = FOSSIL_SNAPSHOT_PRIME1 + FOSSIL_SNAPSHOT_PRIME2;
+    hash->lanes[1] = FOSSIL_SNAPSHOT_PRIME2;
+    hash->lanes[2] = 0;
+    hash->lanes[3] = UINT64_C(0) - FOSSIL_SNAPSHOT_PRIME1;
+    hash->pending_size = 0;
+    hash->total = 0;
+}
+
+void fossil_snapshot_hash_update(fossil_snapshot_hash_t *hash, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    hash->total += size;
+    if (hash->pending_size > 0) {
+        size_t take = 32 - hash->pending_size < size ? 32 - hash->pending_size : size;
+        memcpy(hash->pending + hash->pending_size, bytes, take);
+        hash->pending_size += take;
+        bytes += take;
+        size -= take;
+        if (hash->pending_size < 32) {
+            return;
+        }
+        fossil_snapshot_stripes(hash->lanes, hash->pending, 1);
+        hash->pending_size = 0;
+    }
+    fossil_snapshot_stripes(hash->lanes, bytes, size / 32);
+    bytes += size - size % 32;
+    memcpy(hash->pending, bytes, size % 32);
+    hash->pending_size = size % 32;
+}
+
+uint64_t fossil_snapshot_hash_final(const fossil_snapshot_hash_t *hash) {
+    uint64_t result;
+    if (hash->total >= 32) {
+        const uint64_t *lanes = hash->lanes;
+        result = fossil_snapshot_rotl(lanes[0], 1) + fossil_snapshot_rotl(lanes[1], 7) +
+                 fossil_snapshot_rotl(lanes[2], 12) + fossil_snapshot_rotl(lanes[3], 18);
+        for (int i = 0; i < 4; i++) {
+            result = fossil_snapshot_merge(result, lanes[i]);
+        }
+    } else {
+        result = FOSSIL_SNAPSHOT_PRIME5;
+    }
+    result += hash->total;
+
+    const uint8_t *tail = hash->pending;
+    size_t left = hash->pending_size;
+    for (; left >= 8; tail += 8, left -= 8) {
+        result ^= fossil_snapshot_round(0, fossil_snapshot_read64(tail));
+        result = fossil_snapshot_rotl(result, 27) * FOSSIL_SNAPSHOT_PRIME1 + FOSSIL_SNAPSHOT_PRIME4;
+    }
+    if (left >= 4) {
+        result ^= (uint64_t)fossil_snapshot_read32(tail) * FOSSIL_SNAPSHOT_PRIME1;
+        result = fossil_snapshot_rotl(result, 23) * FOSSIL_SNAPSHOT_PRIME2 + FOSSIL_SNAPSHOT_PRIME3;
+        tail += 4;
+        left -= 4;
+    }
+    for (; left > 0; tail++, left--) {
+        result ^= (uint64_t)*tail * FOSSIL_SNAPSHOT_PRIME5;
+        result = fossil_snapshot_rotl(result, 11) * FOSSIL_SNAPSHOT_PRIME1;
+    }
+
+    result ^= result >> 33;
+    result *= FOSSIL_SNAPSHOT_PRIME2;
+    result ^= result >> 29;
+    result *= FOSSIL_SNAPSHOT_PRIME3;
+    result ^= result >> 32;
+    return result;
+}
+
+uint64_t fossil_snapshot_hash(const void *data, size_t size) {
+    fossil_snapshot_hash_t hash;
+    fossil_snapshot_hash_init(&hash);
+    fossil_snapshot_hash_update(&hash, data, size);
+    return fossil_snapshot_hash_final(&hash);
+}
+
+bool fossil_snapshot_write(const char *name, const void *data, size_t size) {
+    char path[FILENAME_MAX];
+    char hash_path[FILENAME_MAX];
+    char stale[FILENAME_MAX];
+    if (!fossil_snapshot_path(path, sizeof(path), name, "") ||
+        !fossil_snapshot_path(hash_path, sizeof(hash_path), name, ".hash") ||
+        !fossil_snapshot_path(stale, sizeof(stale), name, ".new")) {
+        return false;
+    }
+    uint64_t written = 0;
+    int64_t modified = 0;
+    if (!fossil_snapshot_write_file(path, data, size) || !fossil_snapshot_stamp(path, &written, &modified)) {
+        return false;
+    }
+    char line[80];
+    int length = snprintf(line, sizeof(line), "%016llx %llu %lld\n",
+                          (unsigned long long)fossil_snapshot_hash(data, size), (unsigned long long)size, (long long)modified);
+    if (!fossil_snapshot_write_file(hash_path, line, (size_t)length)) {
+        return false;
+    }
+    remove(stale);
+    return true;
+}
+
+bool fossil_snapshot_matches(const char *name, const void *data, size_t size) {
+    char path[FILENAME_MAX];
+    if (name == xnullptr || (data == xnullptr && size > 0) || !fossil_snapshot_path(path, sizeof(path), name, "")) {
+        return false;
+    }
+    if (fossil_snapshot_vouched(name, path, data, size)) {
+        return true;
+    }
+    fossil_snapshot_map_t golden;
+    if (!fossil_snapshot_map(path, &golden)) {
+        return false;
+    }
+    bool same = golden.size == size && fossil_test_memory_mismatch(data, golden.data, size) == size;
+    fossil_snapshot_unmap(&golden);
+    return same;
+}
+
+void _fossil_snapshot_check(xassert_type_t behavior, const char *name, const void *data, size_t size,
+                            const char *file, int line, const char *func) {
+    char *message = fossil_snapshot_names;
+    char path[FILENAME_MAX];
+    char output[FILENAME_MAX];
+    if (name == xnullptr || (data == xnullptr && size > 0) ||
+        !fossil_snapshot_path(path, sizeof(path), name, "") || !fossil_snapshot_path(output, sizeof(output), name, ".new")) {
+        snprintf(message, sizeof(fossil_snapshot_names), "Expected snapshot %s, but the name or output is not usable", name ? name : "(null)");
+        fossil_snapshot_fail(behavior, message, file, line, func);
+        return;
+    }
+
+    if (_CLI.snapshot_update) {
+        if (!fossil_snapshot_write(name, data, size)) {
+            snprintf(message, sizeof(fossil_snapshot_names), "Expected to update snapshot %s, but it could not be written", path);
+            fossil_snapshot_fail(behavior, message, file, line, func);
+            return;
+        }
+        fossil_test_cout("yellow", "snapshot %s updated\n", path);
+        fossil_snapshot_pass(behavior, file, line, func);
+        return;
+    }
+
+    if (fossil_snapshot_vouched(name, path, data, size)) {
+        fossil_snapshot_pass(behavior, file, line, func);
+        return;
+    }
+
+    fossil_snapshot_map_t golden;
+    if (!fossil_snapshot_map(path, &golden)) {
+        fossil_snapshot_write_file(output, data, size);
+        snprintf(message, sizeof(fossil_snapshot_names),
+                 "Expected snapshot %s to exist, the output was saved as %s, run with 'update snapshots' to accept it", path, output);
+        fossil_snapshot_fail(behavior, message, file, line, func);
+        return;
+    }
+    size_t shorter = size < golden.size ? size : golden.size;
+    size_t index = fossil_test_memory_mismatch(data, golden.data, shorter);
+    if (index == size && index == golden.size) {
+        fossil_snapshot_unmap(&golden);
+        fossil_snapshot_pass(behavior, file, line, func);
+        return;
+    }
+
+    fossil_snapshot_write_file(output, data, size);
+    snprintf(message, sizeof(fossil_snapshot_names), "output to match snapshot %s (saved as %s)", path, output);
+    if (fossil_snapshot_is_text((const uint8_t *)data, size) && fossil_snapshot_is_text(golden.data, golden.size)) {
+        _fossil_test_text_equal(behavior, (const char *)data, size, (const char *)golden.data, golden.size, message, file, line, func);
+    } else if (size == golden.size) {
+        _fossil_test_memory_equal(behavior, data, golden.data, size, message, file, line, func);
+    } else {
+        snprintf(message, sizeof(fossil_snapshot_names),
+                 "Expected output to match snapshot %s (saved as %s), but it has %zu bytes where %zu were expected, first difference at offset 0x%zx",
+                 path, output, size, golden.size, index);
+        fossil_snapshot_fail(behavior, message, file, line, func);
+    }
+    fossil_snapshot_unmap(&golden);
+}
@@ -0,0 +1,375 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/table.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+typedef struct {
+    HANDLE handle;
+    WIN32_FIND_DATAA entry;
+    bool pending; // entry holds the first file, not yet handed out
+} fossil_test_table_listing_t;
+#endif
+
+//
+// local functions
+//
+
+static bool fossil_test_table_map(fossil_test_table_cursor_t *cursor, const char *path) {
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        return true;
+    }
+    void *mapped = mmap(xnullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped != MAP_FAILED) {
+        cursor->base = (const char *)mapped;
+        cursor->size = (size_t)info.st_size;
+        cursor->mapped = true;
+        return true;
+    }
+#endif
+    // No mapping available, read the data file into memory instead.
+    FILE *stream = fopen(path, "rb");
+    if (stream == xnullptr) {
+        return false;
+    }
+    size_t capacity = 65536;
+    size_t size = 0;
+    char *buffer = (char *)malloc(capacity);
+    if (buffer == xnullptr) {
+        perror("Failed to allocate memory for test table");
+        exit(EXIT_FAILURE);
+    }
+    size_t count;
+    while ((count = fread(buffer + size, 1, capacity - size, stream)) > 0) {
+        size += count;
+        if (size == capacity) {
+            capacity *= 2;
+            char *grown = (char *)realloc(buffer, capacity);
+            if (grown == xnullptr) {
+                perror("Failed to allocate memory for test table");
+                exit(EXIT_FAILURE);
+            }
+            buffer = grown;
+        }
+    }
+    fclose(stream);
+    cursor->base = buffer;
+    cursor->size = size;
+    cursor->owned = true;
+    return true;
+}
+
+static void fossil_test_table_release(fossil_test_table_cursor_t *cursor) {
+#ifndef _WIN32
+    if (cursor->mapped) {
+        munmap((void *)cursor->base, cursor->size);
+    }
+#endif
+    if (cursor->owned) {
+        free((void *)cursor->base);
+    }
+    cursor->base = xnullptr;
+    cursor->size = 0;
+    cursor->mapped = false;
+    cursor->owned = false;
+}
+
+// A missing corpus directory is not an error, it simply has no files yet.
+static void fossil_test_table_list_open(fossil_test_table_cursor_t *cursor, const char *path) {
+#ifndef _WIN32
+    cursor->directory = opendir(path);
+#else
+    char pattern[FILENAME_MAX];
+    snprintf(pattern, sizeof(pattern), "%s\\*", path);
+    fossil_test_table_listing_t *listing = (fossil_test_table_listing_t *)malloc(sizeof(fossil_test_table_listing_t));
+    if (listing == xnullptr) {
+        perror("Failed to allocate memory for corpus listing");
+        exit(EXIT_FAILURE);
+    }
+    listing->handle = FindFirstFileA(pattern, &listing->entry);
+    listing->pending = true;
+    if (listing->handle == INVALID_HANDLE_VALUE) {
+        free(listing);
+        listing = xnullptr;
+    }
+    cursor->directory = listing;
+#endif
+}
+
+// Name of the next regular file in the corpus, NULL at the end.
+static const char* fossil_test_table_list_next(fossil_test_table_cursor_t *cursor, char *path, size_t capacity) {
+    if (cursor->directory == xnullptr) {
+        return xnullptr;
+    }
+    for (;;) {
+#ifndef _WIN32
+        struct dirent *entry = readdir((DIR *)cursor->directory);
+        if (entry == xnullptr) {
+            return xnullptr;
+        }
+        const char *name = entry->d_name;
+        struct stat info;
+        snprintf(path, capacity, "%s/%s", cursor->table->path, name);
+        if (name[0] == '.' || stat(path, &info) != 0 || !S_ISREG(info.st_mode)) {
+            continue;
+        }
+        return name;
+#else
+        fossil_test_table_listing_t *listing = (fossil_test_table_listing_t *)cursor->directory;
+        if (!listing->pending && !FindNextFileA(listing->handle, &listing->entry)) {
+            return xnullptr;
+        }
+        listing->pending = false;
+        const char *name = listing->entry.cFileName;
+        if (name[0] == '.' || (listing->entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+            continue;
+        }
+        snprintf(path, capacity, "%s\\%s", cursor->table->path, name);
+        return name;
+#endif
+    }
+}
+
+static void fossil_test_table_list_close(fossil_test_table_cursor_t *cursor) {
+    if (cursor->directory == xnullptr) {
+        return;
+    }
+#ifndef _WIN32
+    closedir((DIR *)cursor->directory);
+#else
+    fossil_test_table_listing_t *listing = (fossil_test_table_listing_t *)cursor->directory;
+    FindClose(listing->handle);
+    free(listing);
+#endif
+    cursor->directory = xnullptr;
+}
+
+// Every corpus file is one row. A corpus without files still runs the test
+// once on empty input so a fresh target is exercised before it is fuzzed.
+static bool fossil_test_table_next_file(fossil_test_table_cursor_t *cursor, fossil_test_row_t *row) {
+    char path[FILENAME_MAX];
+    fossil_test_table_release(cursor);
+    while (fossil_test_table_list_next(cursor, path, sizeof(path)) != xnullptr) {
+        if (!fossil_test_table_map(cursor, path)) {
+            continue;
+        }
+        row->data = cursor->base != xnullptr ? cursor->base : "";
+        row->length = cursor->size;
+        row->index = cursor->index++;
+        return true;
+    }
+    if (!cursor->listed) {
+        cursor->listed = true;
+        if (cursor->index == 0) {
+            row->data = "";
+            row->length = 0;
+            row->index = cursor->index++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Find where a field ends, honoring double quotes, and where its contents lie.
+static size_t fossil_test_row_scan(const char *text, size_t length, const char **contents, size_t *contents_length) {
+    if (length > 0 && text[0] == '"') {
+        size_t at = 1;
+        while (at < length) {
+            if (text[at] == '"') {
+                if (at + 1 < length && text[at + 1] == '"') {
+                    at += 2;
+                    continue;
+                }
+                break;
+            }
+            at++;
+        }
+        *contents = text + 1;
+        *contents_length = at - 1;
+        // Skip the closing quote and anything up to the separator.
+        const char *comma = at < length ? (const char *)memchr(text + at, ',', length - at) : xnullptr;
+        return comma ? (size_t)(comma - text) : length;
+    }
+    const char *comma = (const char *)memchr(text, ',', length);
+    *contents = text;
+    *contents_length = comma ? (size_t)(comma - text) : length;
+    return *contents_length;
+}
+
+// Copy a field collapsing doubled quotes, returns the unescaped length.
+static size_t fossil_test_row_unescape(const char *field, size_t length, char *buffer, size_t capacity) {
+    size_t written = 0;
+    for (size_t at = 0; at < length; at++) {
+        if (field[at] == '"' && at + 1 < length && field[at + 1] == '"') {
+            at++;
+        }
+        if (written < capacity) {
+            buffer[written] = field[at];
+        }
+        written++;
+    }
+    return written;
+}
+
+//
+// public functions
+//
+bool fossil_test_table_open(const fossil_test_table_t *table, fossil_test_table_cursor_t *cursor) {
+    memset(cursor, 0, sizeof(*cursor));
+    cursor->table = table;
+    if (table->kind == FOSSIL_TEST_TABLE_INLINE) {
+        cursor->base = (const char *)table->rows;
+        cursor->size = table->row_size * table->row_count;
+        return true;
+    }
+    if (table->kind == FOSSIL_TEST_TABLE_CORPUS) {
+        if (table->path != xnullptr) {
+            fossil_test_table_list_open(cursor, table->path);
+        }
+        return true;
+    }
+    if (table->path == xnullptr || !fossil_test_table_map(cursor, table->path)) {
+        fprintf(stderr, "Failed to open test table '%s'\n", table->path ? table->path : "(null)");
+        return false;
+    }
+    return true;
+}
+
+bool fossil_test_table_next(fossil_test_table_cursor_t *cursor, fossil_test_row_t *row) {
+    const fossil_test_table_t *table = cursor->table;
+    if (table->kind == FOSSIL_TEST_TABLE_CORPUS) {
+        return fossil_test_table_next_file(cursor, row);
+    }
+    if (table->kind == FOSSIL_TEST_TABLE_CSV) {
+        while (cursor->position < cursor->size) {
+            const char *start = cursor->base + cursor->position;
+            size_t remaining = cursor->size - cursor->position;
+            const char *end = (const char *)memchr(start, '\n', remaining);
+            size_t length = end ? (size_t)(end - start) : remaining;
+            cursor->position += length + (end ? 1 : 0);
+            if (length > 0 && start[length - 1] == '\r') {
+                length--;
+            }
+            if (length == 0 || start[0] == '#') {
+                continue;
+            }
+            row->data = start;
+            row->length = length;
+            row->index = cursor->index++;
+            return true;
+        }
+        return false;
+    }
+
+    // Inline arrays and binary records, a trailing partial record is ignored.
+    if (table->row_size == 0 || cursor->size - cursor->position < table->row_size) {
+        return false;
+    }
+    row->data = cursor->base + cursor->position;
+    row->length = table->row_size;
+    row->index = cursor->index++;
+    cursor->position += table->row_size;
+    return true;
+}
+
+void fossil_test_table_close(fossil_test_table_cursor_t *cursor) {
+    fossil_test_table_release(cursor);
+    fossil_test_table_list_close(cursor);
+    memset(cursor, 0, sizeof(*cursor));
+}
+
+size_t fossil_test_row_field(const fossil_test_row_t *row, size_t column, const char **field) {
+    const char *text = (const char *)row->data;
+    size_t length = row->length;
+    for (size_t current = 0;; current++) {
+        const char *contents;
+        size_t contents_length;
+        size_t consumed = fossil_test_row_scan(text, length, &contents, &contents_length);
+        if (current == column) {
+            *field = contents;
+            return contents_length;
+        }
+        if (consumed >= length) {
+            *field = xnullptr;
+            return 0;
+        }
+        text += consumed + 1;
+        length -= consumed + 1;
+    }
+}
+
+bool fossil_test_row_copy(const fossil_test_row_t *row, size_t column, char *buffer, size_t capacity) {
+    const char *field;
+    size_t length = fossil_test_row_field(row, column, &field);
+    if (capacity == 0) {
+        return false;
+    }
+    if (field == xnullptr) {
+        buffer[0] = '\0';
+        return false;
+    }
+    size_t written = fossil_test_row_unescape(field, length, buffer, capacity - 1);
+    buffer[written < capacity - 1 ? written : capacity - 1] = '\0';
+    return written < capacity;
+}
+
+int64_t fossil_test_row_i64(const fossil_test_row_t *row, size_t column) {
+    char buffer[64];
+    fossil_test_row_copy(row, column, buffer, sizeof(buffer));
+    return (int64_t)strtoll(buffer, xnullptr, 0);
+}
+
+double fossil_test_row_f64(const fossil_test_row_t *row, size_t column) {
+    char buffer[64];
+    fossil_test_row_copy(row, column, buffer, sizeof(buffer));
+    return strtod(buffer, xnullptr);
+}
+
+bool fossil_test_row_equal(const fossil_test_row_t *row, size_t column, const char *text) {
+    const char *field;
+    size_t length = fossil_test_row_field(row, column, &field);
+    if (field == xnullptr) {
+        return false;
+    }
+    size_t expected = strlen(text);
+    if (memchr(field, '"', length) == xnullptr) {
+        return length == expected && memcmp(field, text, length) == 0;
+    }
+    size_t at = 0;
+    for (size_t i = 0; i < length; i++, at++) {
+        if (field[i] == '"' && i + 1 < length && field[i + 1] == '"') {
+            i++;
+        }
+        if (at >= expected || text[at] != field[i]) {
+            return false;
+        }
+    }
+    return at == expected;
+}
@@ -0,0 +1,837 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/unittest/text.h"
+#include "fossil/unittest/vector.h"
+#include "fossil/_common/atomic.h"
+
+#include <stdarg.h>
+
+#ifndef _WIN32
+#include <regex.h>
+#define FOSSIL_TEST_REGEX 1
+#endif
+
+enum {
+    FOSSIL_TEST_TEXT_MESSAGE = 16384,
+    FOSSIL_TEST_TEXT_WINDOW = 24,   // characters shown on each side of a wide string difference
+};
+
+typedef enum {
+    FOSSIL_TEST_DIFF_SAME,
+    FOSSIL_TEST_DIFF_REMOVED,
+    FOSSIL_TEST_DIFF_ADDED
+} fossil_test_diff_op_t;
+
+// A line includes its newline, so a missing newline at the end is a change.
+typedef struct {
+    const char *start;
+    size_t length;
+} fossil_test_line_t;
+
+typedef struct {
+    fossil_test_diff_op_t op;
+    fossil_test_line_t line;
+    size_t old_number;   // one based, of the line or the one before an insert
+    size_t new_number;
+} fossil_test_edit_t;
+
+typedef struct {
+    fossil_test_edit_t *items;
+    size_t count;
+    size_t capacity;
+} fossil_test_script_t;
+
+typedef struct {
+    char *out;
+    size_t capacity;
+    size_t used;
+    size_t lines;
+    bool full;
+} fossil_test_writer_t;
+
+enum {
+    FOSSIL_TEST_PATTERN_EMPTY,
+    FOSSIL_TEST_PATTERN_COMPILING,
+    FOSSIL_TEST_PATTERN_READY
+};
+
+static FOSSIL_TEST_THREAD_LOCAL char fossil_test_text_message[FOSSIL_TEST_TEXT_MESSAGE];
+
+//
+// local functions
+//
+
+static void fossil_test_write(fossil_test_writer_t *writer, const char *format, ...) {
+    if (writer->full) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(writer->out + writer->used, writer->capacity - writer->used, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= writer->capacity - writer->used) {
+        writer->out[writer->used] = '\0';
+        writer->full = true;
+        return;
+    }
+    writer->used += (size_t)written;
+}
+
+// Print one diff line, cut to FOSSIL_TEST_DIFF_WIDTH with control characters
+// shown as '?' so the report stays on its own lines.
+static void fossil_test_write_line(fossil_test_writer_t *writer, char sign, fossil_test_line_t line) {
+    if (writer->lines == FOSSIL_TEST_DIFF_OUTPUT) {
+        fossil_test_write(writer, "\n    ... diff cut after %d lines", FOSSIL_TEST_DIFF_OUTPUT);
+    }
+    if (writer->lines++ >= FOSSIL_TEST_DIFF_OUTPUT) {
+        return;
+    }
+    bool newline = line.length > 0 && line.start[line.length - 1] == '\n';
+    size_t length = newline ? line.length - 1 : line.length;
+    char text[FOSSIL_TEST_DIFF_WIDTH + 1];
+    size_t shown = length < FOSSIL_TEST_DIFF_WIDTH ? length : FOSSIL_TEST_DIFF_WIDTH;
+    for (size_t i = 0; i < shown; i++) {
+        unsigned char c = (unsigned char)line.start[i];
+        text[i] = (c < 0x20 && c != '\t') || c == 0x7f ? '?' : (char)c;
+    }
+    text[shown] = '\0';
+    fossil_test_write(writer, "\n    %c%s%s", sign, text, shown < length ? "..." : "");
+    if (!newline) {
+        fossil_test_write(writer, "\n    \\ No newline at end of text");
+    }
+}
+
+static void fossil_test_script_push(fossil_test_script_t *script, fossil_test_diff_op_t op, fossil_test_line_t line,
+                                    size_t old_number, size_t new_number) {
+    if (script->count == script->capacity) {
+        script->capacity = script->capacity ? script->capacity * 2 : 64;
+        script->items = (fossil_test_edit_t *)realloc(script->items, script->capacity * sizeof(fossil_test_edit_t));
+        if (script->items == xnullptr) {
+            perror("Failed to allocate memory for text diff");
+            exit(EXIT_FAILURE);
+        }
+    }
+    fossil_test_edit_t *edit = &script->items[script->count++];
+    edit->op = op;
+    edit->line = line;
+    edit->old_number = old_number;
+    edit->new_number = new_number;
+}
+
+// Split text into lines, stopping after limit lines. Returns the count and
+// sets *rest to the bytes left over.
+static size_t fossil_test_split_lines(const char *text, size_t length, fossil_test_line_t *lines, size_t limit, size_t *rest) {
+    size_t count = 0;
+    size_t at = 0;
+    while (at < length && count < limit) {
+        const char *end = (const char *)memchr(text + at, '\n', length - at);
+        size_t next = end != xnullptr ? (size_t)(end - text) + 1 : length;
+        lines[count].start = text + at;
+        lines[count].length = next - at;
+        count++;
+        at = next;
+    }
+    *rest = length - at;
+    return count;
+}
+
+static bool fossil_test_line_equal(fossil_test_line_t a, fossil_test_line_t b) {
+    return a.length == b.length && memcmp(a.start, b.start, a.length) == 0;
+}
+
+static bool fossil_test_line_start(const char *text, size_t at) {
+    return at == 0 || text[at - 1] == '\n';
+}
+
+static size_t fossil_test_count_lines(const char *text, size_t length) {
+    size_t count = 0;
+    const char *end = text + length;
+    while (text < end && (text = (const char *)memchr(text, '\n', (size_t)(end - text))) != xnullptr) {
+        count++;
+        text++;
+    }
+    return count;
+}
+
+// Myers' greedy O(ND) diff of old against new, keeping every round of the
+// furthest reaching paths so the script can be walked back. Returns false
+// when more than max_edits edits would be needed.
+static bool fossil_test_myers(const fossil_test_line_t *old_lines, size_t old_count, const fossil_test_line_t *new_lines, size_t new_count,
+                              size_t old_base, size_t new_base, size_t max_edits, fossil_test_script_t *script) {
+    size_t limit = old_count + new_count < max_edits ? old_count + new_count : max_edits;
+    size_t width = 2 * limit + 3;
+    ptrdiff_t offset = (ptrdiff_t)limit + 1;
+    ptrdiff_t n = (ptrdiff_t)old_count;
+    ptrdiff_t m = (ptrdiff_t)new_count;
+    ptrdiff_t *trace = (ptrdiff_t *)calloc((limit + 1) * width, sizeof(ptrdiff_t));
+    if (trace == xnullptr) {
+        perror("Failed to allocate memory for text diff");
+        exit(EXIT_FAILURE);
+    }
+    ptrdiff_t found = -1;
+    for (ptrdiff_t d = 0; d <= (ptrdiff_t)limit && found < 0; d++) {
+        ptrdiff_t *round = trace + (size_t)d * width;
+        if (d > 0) {
+            memcpy(round, round - width, width * sizeof(ptrdiff_t));
+        }
+        const ptrdiff_t *before = d > 0 ? round - width : round;
+        for (ptrdiff_t k = -d; k <= d; k += 2) {
+            ptrdiff_t x;
+            if (k == -d || (k != d && before[offset + k - 1] < before[offset + k + 1])) {
+                x = before[offset + k + 1];
+            } else {
+                x = before[offset + k - 1] + 1;
+            }
+            ptrdiff_t y = x - k;
+            while (x < n && y < m && fossil_test_line_equal(old_lines[x], new_lines[y])) {
+                x++;
+                y++;
+            }
+            round[offset + k] = x;
+            if (x >= n && y >= m) {
+                found = d;
+                break;
+            }
+        }
+    }
+    if (found < 0) {
+        free(trace);
+        return false;
+    }
+
+    // Walk back from the end, collecting the script in reverse.
+    size_t first = script->count;
+    ptrdiff_t x = n;
+    ptrdiff_t y = m;
+    for (ptrdiff_t d = found; d >= 0; d--) {
+        const ptrdiff_t *before = d > 0 ? trace + (size_t)(d - 1) * width : trace;
+        ptrdiff_t k = x - y;
+        ptrdiff_t previous_k;
+        if (d == 0) {
+            previous_k = k;
+        } else if (k == -d || (k != d && before[offset + k - 1] < before[offset + k + 1])) {
+            previous_k = k + 1;
+        } else {
+            previous_k = k - 1;
+        }
+        ptrdiff_t previous_x = d > 0 ? before[offset + previous_k] : 0;
+        ptrdiff_t previous_y = previous_x - previous_k;
+        while (x > previous_x && y > previous_y) {
+            x--;
+            y--;
+            fossil_test_script_push(script, FOSSIL_TEST_DIFF_SAME, old_lines[x], old_base + (size_t)x + 1, new_base + (size_t)y + 1);
+        }
+        if (d > 0) {
+            if (x == previous_x) {
+                y--;
+                fossil_test_script_push(script, FOSSIL_TEST_DIFF_ADDED, new_lines[y], old_base + (size_t)x, new_base + (size_t)y + 1);
+            } else {
+                x--;
+                fossil_test_script_push(script, FOSSIL_TEST_DIFF_REMOVED, old_lines[x], old_base + (size_t)x + 1, new_base + (size_t)y);
+            }
+        }
+    }
+    for (size_t i = first, j = script->count - 1; i < j; i++, j--) {
+        fossil_test_edit_t swap = script->items[i];
+        script->items[i] = script->items[j];
+        script->items[j] = swap;
+    }
+    free(trace);
+    return true;
+}
+
+// Print the script as unified hunks, keeping FOSSIL_TEST_DIFF_CONTEXT
+// unchanged lines around every change.
+static void fossil_test_write_hunks(fossil_test_writer_t *writer, const fossil_test_script_t *script) {
+    const size_t context = FOSSIL_TEST_DIFF_CONTEXT;
+    size_t at = 0;
+    while (at < script->count) {
+        while (at < script->count && script->items[at].op == FOSSIL_TEST_DIFF_SAME) {
+            at++;
+        }
+        if (at == script->count) {
+            break;
+        }
+        size_t start = at > context ? at - context : 0;
+        size_t end = at;
+        size_t same_run = 0;
+        for (; end < script->count; end++) {
+            if (script->items[end].op == FOSSIL_TEST_DIFF_SAME) {
+                if (++same_run > 2 * context) {
+                    end++;
+                    break;
+                }
+            } else {
+                same_run = 0;
+            }
+        }
+        if (same_run > context) {
+            end -= same_run - context;
+        }
+
+        size_t old_count = 0;
+        size_t new_count = 0;
+        for (size_t i = start; i < end; i++) {
+            old_count += script->items[i].op != FOSSIL_TEST_DIFF_ADDED;
+            new_count += script->items[i].op != FOSSIL_TEST_DIFF_REMOVED;
+        }
+        const fossil_test_edit_t *head = &script->items[start];
+        size_t old_start = head->op == FOSSIL_TEST_DIFF_ADDED ? head->old_number + 1 : head->old_number;
+        size_t new_start = head->op == FOSSIL_TEST_DIFF_REMOVED ? head->new_number + 1 : head->new_number;
+        fossil_test_write(writer, "\n    @@ -%zu,%zu +%zu,%zu @@",
+                          old_count ? old_start : old_start - 1, old_count, new_count ? new_start : new_start - 1, new_count);
+        for (size_t i = start; i < end; i++) {
+            static const char signs[] = {' ', '-', '+'};
+            fossil_test_write_line(writer, signs[script->items[i].op], script->items[i].line);
+        }
+        at = end;
+    }
+}
+
+//
+// public functions
+//
+
+size_t fossil_test_text_mismatch(const char *actual, size_t actual_length, const char *expected, size_t expected_length) {
+    size_t shorter = actual_length < expected_length ? actual_length : expected_length;
+    return fossil_test_memory_mismatch(actual, expected, shorter);
+}
+
+size_t fossil_test_text_diff(const char *actual, size_t actual_length, const char *expected, size_t expected_length,
+                             char *out, size_t capacity) {
+    fossil_test_writer_t writer = { out, capacity, 0, 0, capacity == 0 };
+    if (capacity > 0) {
+        out[0] = '\0';
+    }
+    size_t index = fossil_test_text_mismatch(actual, actual_length, expected, expected_length);
+    if (index == actual_length && index == expected_length) {
+        return 0;
+    }
+
+    // The diff covers whole lines from the one holding the first difference
+    // up to the common tail, again on a line boundary.
+    const char *newline = xnullptr;
+    for (size_t at = index; at > 0; at--) {
+        if (expected[at - 1] == '\n') {
+            newline = expected + at - 1;
+            break;
+        }
+    }
+    size_t head = newline != xnullptr ? (size_t)(newline - expected) + 1 : 0;
+    size_t tail = 0;
+    while (tail < actual_length - head && tail < expected_length - head &&
+           actual[actual_length - 1 - tail] == expected[expected_length - 1 - tail]) {
+        tail++;
+    }
+    while (tail > 0 && !(fossil_test_line_start(actual, actual_length - tail) && fossil_test_line_start(expected, expected_length - tail))) {
+        tail--;
+    }
+
+    fossil_test_line_t *old_lines = (fossil_test_line_t *)malloc(2 * (FOSSIL_TEST_DIFF_LINES + FOSSIL_TEST_DIFF_CONTEXT) * sizeof(fossil_test_line_t));
+    if (old_lines == xnullptr) {
+        perror("Failed to allocate memory for text diff");
+        exit(EXIT_FAILURE);
+    }
+    fossil_test_line_t *new_lines = old_lines + FOSSIL_TEST_DIFF_LINES + FOSSIL_TEST_DIFF_CONTEXT;
+    size_t old_rest = 0;
+    size_t new_rest = 0;
+    size_t old_count = fossil_test_split_lines(expected + head, expected_length - head - tail, old_lines, FOSSIL_TEST_DIFF_LINES, &old_rest);
+    size_t new_count = fossil_test_split_lines(actual + head, actual_length - head - tail, new_lines, FOSSIL_TEST_DIFF_LINES, &new_rest);
+    size_t base = fossil_test_count_lines(expected, head);
+
+    fossil_test_script_t script = { xnullptr, 0, 0 };
+    size_t context_start = head;
+    for (int i = 0; i < FOSSIL_TEST_DIFF_CONTEXT && context_start > 0; i++) {
+        context_start--;
+        while (context_start > 0 && expected[context_start - 1] != '\n') {
+            context_start--;
+        }
+    }
+    fossil_test_line_t before[FOSSIL_TEST_DIFF_CONTEXT];
+    size_t unused;
+    size_t before_count = fossil_test_split_lines(expected + context_start, head - context_start, before, FOSSIL_TEST_DIFF_CONTEXT, &unused);
+    for (size_t i = 0; i < before_count; i++) {
+        size_t number = base - before_count + i + 1;
+        fossil_test_script_push(&script, FOSSIL_TEST_DIFF_SAME, before[i], number, number);
+    }
+
+    // Past the edit budget the region is shown as removed then added, each
+    // side cut to half the output so both are visible.
+    bool partial = old_rest > 0 || new_rest > 0;
+    if (!fossil_test_myers(old_lines, old_count, new_lines, new_count, base, base, FOSSIL_TEST_DIFF_EDITS, &script)) {
+        size_t half = FOSSIL_TEST_DIFF_OUTPUT / 2;
+        partial = partial || old_count > half || new_count > half;
+        old_count = old_count < half ? old_count : half;
+        new_count = new_count < half ? new_count : half;
+        for (size_t i = 0; i < old_count; i++) {
+            fossil_test_script_push(&script, FOSSIL_TEST_DIFF_REMOVED, old_lines[i], base + i + 1, base);
+        }
+        for (size_t i = 0; i < new_count; i++) {
+            fossil_test_script_push(&script, FOSSIL_TEST_DIFF_ADDED, new_lines[i], base + old_count, base + i + 1);
+        }
+    }
+
+    if (!partial) {
+        fossil_test_line_t after[FOSSIL_TEST_DIFF_CONTEXT];
+        size_t after_count = fossil_test_split_lines(expected + expected_length - tail, tail, after, FOSSIL_TEST_DIFF_CONTEXT, &unused);
+        for (size_t i = 0; i < after_count; i++) {
+            fossil_test_script_push(&script, FOSSIL_TEST_DIFF_SAME, after[i], base + old_count + i + 1, base + new_count + i + 1);
+        }
+    }
+
+    fossil_test_write(&writer, "\n    --- expected\n    +++ actual");
+    fossil_test_write_hunks(&writer, &script);
+    if (partial) {
+        fossil_test_write(&writer, "\n    ... the changed region is longer than shown");
+    }
+    free(script.items);
+    free(old_lines);
+    return writer.used;
+}
+
+void _fossil_test_text_equal(xassert_type_t behavior, const char *actual, size_t actual_length, const char *expected, size_t expected_length,
+                             const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_text_message;
+    if ((actual == xnullptr && actual_length > 0) || (expected == xnullptr && expected_length > 0)) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but a text is xnull", names);
+        _fossil_test_assert_class(false, behavior, message, (char*)file, line, (char*)func);
+        return;
+    }
+    size_t index = fossil_test_text_mismatch(actual, actual_length, expected, expected_length);
+    bool passed = index == actual_length && index == expected_length;
+    if (passed && !_ASSERT_INFO.should_fail) {
+        _fossil_test_pass_count++;
+        return;
+    }
+    if (passed) {
+        _fossil_test_assert_class(true, behavior, (char*)names, (char*)file, line, (char*)func);
+        return;
+    }
+
+    size_t line_number = fossil_test_count_lines(expected, index) + 1;
+    size_t column = index + 1;
+    for (size_t at = index; at > 0; at--) {
+        if (expected[at - 1] == '\n') {
+            column = index - at + 1;
+            break;
+        }
+    }
+    size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE,
+                                   "Expected %s, first difference at byte %zu (line %zu, column %zu), lengths %zu and %zu",
+                                   names, index, line_number, column, actual_length, expected_length);
+    if (used < FOSSIL_TEST_TEXT_MESSAGE) {
+        fossil_test_text_diff(actual, actual_length, expected, expected_length, message + used, FOSSIL_TEST_TEXT_MESSAGE - used);
+    }
+    _fossil_test_assert_class(false, behavior, message, (char*)file, line, (char*)func);
+}
+
+void _fossil_test_cstr_equal(xassert_type_t behavior, const char *actual, const char *expected,
+                             const char *names, const char *file, int line, const char *func) {
+    if (actual == xnullptr || expected == xnullptr) {
+        bool passed = actual == expected;
+        snprintf(fossil_test_text_message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but %s is xnull", names,
+                 actual == xnullptr ? "the actual string" : "the expected string");
+        _fossil_test_assert_class(passed, behavior, passed ? (char*)names : fossil_test_text_message, (char*)file, line, (char*)func);
+        return;
+    }
+    _fossil_test_text_equal(behavior, actual, strlen(actual), expected, strlen(expected), names, file, line, func);
+}
+
+static size_t fossil_test_wide_window(char *out, size_t capacity, const wchar_t *text, size_t length, size_t index) {
+    size_t used = 0;
+    size_t first = index > FOSSIL_TEST_TEXT_WINDOW ? index - FOSSIL_TEST_TEXT_WINDOW : 0;
+    size_t last = length - index > FOSSIL_TEST_TEXT_WINDOW ? index + FOSSIL_TEST_TEXT_WINDOW : length;
+    used += (size_t)snprintf(out + used, capacity - used, "%s\"", first > 0 ? "..." : "");
+    for (size_t at = first; at < last && used + 16 < capacity; at++) {
+        unsigned long c = (unsigned long)text[at];
+        if (c >= 0x20 && c < 0x7f && c != '"' && c != '\\') {
+            out[used++] = (char)c;
+        } else {
+            used += (size_t)snprintf(out + used, capacity - used, "\\u{%lx}", c);
+        }
+    }
+    used += (size_t)snprintf(out + used, capacity - used, "\"%s", last < length ? "..." : "");
+    return used;
+}
+
+void _fossil_test_wstr_equal(xassert_type_t behavior, const wchar_t *actual, const wchar_t *expected,
+                             const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_text_message;
+    if (actual == xnullptr || expected == xnullptr) {
+        bool passed = actual == expected;
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but %s is xnull", names,
+                 actual == xnullptr ? "the actual string" : "the expected string");
+        _fossil_test_assert_class(passed, behavior, passed ? (char*)names : message, (char*)file, line, (char*)func);
+        return;
+    }
+    size_t actual_length = wcslen(actual);
+    size_t expected_length = wcslen(expected);
+    size_t shorter = actual_length < expected_length ? actual_length : expected_length;
+    size_t index = fossil_test_memory_mismatch(actual, expected, shorter * sizeof(wchar_t)) / sizeof(wchar_t);
+    bool passed = index == actual_length && index == expected_length;
+    if (passed && !_ASSERT_INFO.should_fail) {
+        _fossil_test_pass_count++;
+        return;
+    }
+    if (passed) {
+        _fossil_test_assert_class(true, behavior, (char*)names, (char*)file, line, (char*)func);
+        return;
+    }
+
+    size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE,
+                                   "Expected %s, first difference at character %zu, lengths %zu and %zu\n    actual   ",
+                                   names, index, actual_length, expected_length);
+    used += fossil_test_wide_window(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, actual, actual_length, index);
+    used += (size_t)snprintf(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, "\n    expected ");
+    fossil_test_wide_window(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, expected, expected_length, index);
+    _fossil_test_assert_class(false, behavior, message, (char*)file, line, (char*)func);
+}
+
+//
+// substring and pattern checks
+//
+
+static void fossil_test_text_score(xassert_type_t behavior, bool passed, const char *message, const char *names,
+                                   const char *file, int line, const char *func) {
+    if (passed && !_ASSERT_INFO.should_fail) {
+        _fossil_test_pass_count++;
+        return;
+    }
+    _fossil_test_assert_class(passed, behavior, (char*)(passed ? names : message), (char*)file, line, (char*)func);
+}
+
+// The line holding index, escaped and cut to a window around index when it
+// is too long to print whole.
+static size_t fossil_test_text_excerpt(char *out, size_t capacity, const char *text, size_t length, size_t index) {
+    size_t first = index;
+    while (first > 0 && text[first - 1] != '\n') {
+        first--;
+    }
+    const char *newline = (const char *)memchr(text + index, '\n', length - index);
+    size_t last = newline != xnullptr ? (size_t)(newline - text) : length;
+    bool cut_front = false;
+    bool cut_back = false;
+    if (last - first > FOSSIL_TEST_DIFF_WIDTH) {
+        if (index - first > FOSSIL_TEST_DIFF_WIDTH / 2) {
+            first = index - FOSSIL_TEST_DIFF_WIDTH / 2;
+            cut_front = true;
+        }
+        if (last - first > FOSSIL_TEST_DIFF_WIDTH) {
+            last = first + FOSSIL_TEST_DIFF_WIDTH;
+            cut_back = true;
+        }
+    }
+    size_t used = (size_t)snprintf(out, capacity, "\n    %s\"", cut_front ? "..." : "");
+    for (size_t at = first; at < last && used + 8 < capacity; at++) {
+        unsigned char c = (unsigned char)text[at];
+        if (c >= 0x20 && c < 0x7f && c != '"' && c != '\\') {
+            out[used++] = (char)c;
+        } else {
+            used += (size_t)snprintf(out + used, capacity - used, "\\x%02x", c);
+        }
+    }
+    if (used < capacity) {
+        used += (size_t)snprintf(out + used, capacity - used, "\"%s", cut_back ? "..." : "");
+    }
+    return used < capacity ? used : capacity - 1;
+}
+
+// Appends where index lies and the line around it to a failure message.
+static void fossil_test_text_where(char *message, size_t used, const char *text, size_t length, size_t index) {
+    if (used >= FOSSIL_TEST_TEXT_MESSAGE) {
+        return;
+    }
+    size_t column = 1;
+    while (column <= index && text[index - column] != '\n') {
+        column++;
+    }
+    used += (size_t)snprintf(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, " (line %zu, column %zu)",
+                             fossil_test_count_lines(text, index) + 1, column);
+    if (used < FOSSIL_TEST_TEXT_MESSAGE) {
+        fossil_test_text_excerpt(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, text, length, index);
+    }
+}
+
+#ifdef FOSSIL_TEST_REGEX
+static void* fossil_test_pattern_compile(const char *pattern, char *error, size_t capacity) {
+    regex_t *regex = (regex_t *)malloc(sizeof(regex_t));
+    if (regex == xnullptr) {
+        perror("Failed to allocate memory for pattern");
+        exit(EXIT_FAILURE);
+    }
+    int status = regcomp(regex, pattern, REG_EXTENDED | REG_NEWLINE);
+    if (status != 0) {
+        regerror(status, regex, error, capacity);
+        free(regex);
+        return xnullptr;
+    }
+    return regex;
+}
+
+static void fossil_test_pattern_release(void *compiled) {
+    regfree((regex_t *)compiled);
+    free(compiled);
+}
+
+// The compiled pattern of the slot when it was built from the same pattern.
+// The first caller compiles into the slot, anyone else, or a call site whose
+// pattern changes between calls, compiles a private copy to release.
+static void* fossil_test_pattern_acquire(fossil_test_pattern_t *slot, const char *pattern, bool *owned, char *error, size_t capacity) {
+    *owned = false;
+    if (slot != xnullptr) {
+        uint64_t state = fossil_atomic_load_u64(&slot->state);
+        uint64_t expected = FOSSIL_TEST_PATTERN_EMPTY;
+        if (state == FOSSIL_TEST_PATTERN_EMPTY &&
+            fossil_atomic_compare_exchange_u64(&slot->state, &expected, FOSSIL_TEST_PATTERN_COMPILING)) {
+            size_t length = strlen(pattern);
+            slot->pattern = (char *)malloc(length + 1);
+            if (slot->pattern == xnullptr) {
+                perror("Failed to allocate memory for pattern");
+                exit(EXIT_FAILURE);
+            }
+            memcpy(slot->pattern, pattern, length + 1);
+            slot->compiled = fossil_test_pattern_compile(pattern, slot->error, sizeof(slot->error));
+            fossil_atomic_store_u64(&slot->state, FOSSIL_TEST_PATTERN_READY);
+            state = FOSSIL_TEST_PATTERN_READY;
+        }
+        if (state == FOSSIL_TEST_PATTERN_READY && strcmp(slot->pattern, pattern) == 0) {
+            if (slot->compiled == xnullptr) {
+                snprintf(error, capacity, "%s", slot->error);
+            }
+            return slot->compiled;
+        }
+    }
+    void *compiled = fossil_test_pattern_compile(pattern, error, capacity);
+    *owned = compiled != xnullptr;
+    return compiled;
+}
+
+// A match that starts right after a newline may still use '^'.
+static bool fossil_test_pattern_next(const void *compiled, const char *text, size_t at, size_t *start, size_t *end) {
+    regmatch_t match;
+    int flags = fossil_test_line_start(text, at) ? 0 : REG_NOTBOL;
+    if (regexec((const regex_t *)compiled, text + at, 1, &match, flags) != 0) {
+        return false;
+    }
+    *start = at + (size_t)match.rm_so;
+    *end = at + (size_t)match.rm_eo;
+    return true;
+}
+#endif
+
+// Matches of a pattern from its first one on, up to limit of them. Returns
+// false when the pattern does not compile, with the reason in error.
+static bool fossil_test_pattern_scan(fossil_test_pattern_t *slot, const char *pattern, const char *text, size_t limit,
+                                     size_t *count, size_t *first, char *error, size_t capacity) {
+    *count = 0;
+    *first = 0;
+#ifdef FOSSIL_TEST_REGEX
+    bool owned;
+    void *compiled = fossil_test_pattern_acquire(slot, pattern, &owned, error, capacity);
+    if (compiled == xnullptr) {
+        return false;
+    }
+    size_t length = strlen(text);
+    size_t at = 0;
+    size_t start;
+    size_t end;
+    while (*count < limit && at <= length && fossil_test_pattern_next(compiled, text, at, &start, &end)) {
+        if (*count == 0) {
+            *first = start;
+        }
+        (*count)++;
+        at = end > start ? end : end + 1;
+    }
+    if (owned) {
+        fossil_test_pattern_release(compiled);
+    }
+    return true;
+#else
+    // Without <regex.h> the pattern is plain text.
+    (void)slot;
+    (void)error;
+    (void)capacity;
+    size_t length = strlen(text);
+    size_t pattern_length = strlen(pattern);
+    size_t at = 0;
+    while (*count < limit && pattern_length > 0) {
+        size_t found = fossil_test_text_find(text + at, length - at, pattern, pattern_length);
+        if (found == length - at) {
+            break;
+        }
+        if (*count == 0) {
+            *first = at + found;
+        }
+        (*count)++;
+        at += found + pattern_length;
+    }
+    return true;
+#endif
+}
+
+size_t fossil_test_text_find(const char *text, size_t length, const char *needle, size_t needle_length) {
+    return fossil_test_memory_find(text, length, needle, needle_length);
+}
+
+size_t fossil_test_text_count(const char *text, size_t length, const char *needle, size_t needle_length) {
+    size_t count = 0;
+    size_t at = 0;
+    while (needle_length > 0 && at + needle_length <= length) {
+        size_t found = fossil_test_memory_find(text + at, length - at, needle, needle_length);
+        if (found == length - at) {
+            break;
+        }
+        count++;
+        at += found + needle_length;
+    }
+    return count;
+}
+
+bool fossil_test_pattern_find(fossil_test_pattern_t *slot, const char *pattern, const char *text, size_t *offset) {
+    char error[128];
+    size_t count;
+    size_t first;
+    if (pattern == xnullptr || text == xnullptr || !fossil_test_pattern_scan(slot, pattern, text, 1, &count, &first, error, sizeof(error))) {
+        return false;
+    }
+    if (offset != xnullptr) {
+        *offset = first;
+    }
+    return count > 0;
+}
+
+size_t fossil_test_pattern_count(fossil_test_pattern_t *slot, const char *pattern, const char *text) {
+    char error[128];
+    size_t count;
+    size_t first;
+    if (pattern == xnullptr || text == xnullptr || !fossil_test_pattern_scan(slot, pattern, text, SIZE_MAX, &count, &first, error, sizeof(error))) {
+        return 0;
+    }
+    return count;
+}
+
+void _fossil_test_text_contains(xassert_type_t behavior, const char *text, const char *needle, bool wanted, size_t count,
+                                const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_text_message;
+    if (text == xnullptr || needle == xnullptr) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but %s is xnull", names, text == xnullptr ? "the text" : "the needle");
+        fossil_test_text_score(behavior, false, message, names, file, line, func);
+        return;
+    }
+    size_t length = strlen(text);
+    size_t needle_length = strlen(needle);
+    size_t index = fossil_test_text_find(text, length, needle, needle_length);
+    bool found = index < length || needle_length == 0;
+
+    if (wanted && count == FOSSIL_TEST_TEXT_ANY) {
+        if (!found) {
+            size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but it is not in the %zu bytes of text, which start with",
+                                           names, length);
+            if (used < FOSSIL_TEST_TEXT_MESSAGE) {
+                fossil_test_text_excerpt(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, text, length, 0);
+            }
+        }
+        fossil_test_text_score(behavior, found, message, names, file, line, func);
+        return;
+    }
+    if (!wanted) {
+        if (found) {
+            size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but it occurs at byte %zu", names, index);
+            fossil_test_text_where(message, used, text, length, index);
+        }
+        fossil_test_text_score(behavior, !found, message, names, file, line, func);
+        return;
+    }
+    size_t occurrences = found ? fossil_test_text_count(text + index, length - index, needle, needle_length) : 0;
+    bool passed = occurrences == count;
+    if (!passed) {
+        size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but it occurs %zu times", names, occurrences);
+        if (found) {
+            used += (size_t)snprintf(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, ", first at byte %zu", index);
+            fossil_test_text_where(message, used, text, length, index);
+        }
+    }
+    fossil_test_text_score(behavior, passed, message, names, file, line, func);
+}
+
+void _fossil_test_text_affix(xassert_type_t behavior, const char *text, const char *affix, bool at_end,
+                             const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_text_message;
+    if (text == xnullptr || affix == xnullptr) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but %s is xnull", names, text == xnullptr ? "the text" : "the affix");
+        fossil_test_text_score(behavior, false, message, names, file, line, func);
+        return;
+    }
+    size_t length = strlen(text);
+    size_t affix_length = strlen(affix);
+    if (affix_length > length) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but the text has %zu bytes and the %s %zu",
+                 names, length, at_end ? "suffix" : "prefix", affix_length);
+        fossil_test_text_score(behavior, false, message, names, file, line, func);
+        return;
+    }
+    size_t base = at_end ? length - affix_length : 0;
+    size_t index = fossil_test_text_mismatch(text + base, affix_length, affix, affix_length);
+    bool passed = index == affix_length;
+    if (!passed) {
+        size_t used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but byte %zu of the %s differs",
+                                       names, index, at_end ? "suffix" : "prefix");
+        fossil_test_text_where(message, used, text, length, base + index);
+    }
+    fossil_test_text_score(behavior, passed, message, names, file, line, func);
+}
+
+void _fossil_test_text_matches(xassert_type_t behavior, fossil_test_pattern_t *slot, const char *text, const char *pattern, bool wanted,
+                               size_t count, const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_text_message;
+    if (text == xnullptr || pattern == xnullptr) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but %s is xnull", names, text == xnullptr ? "the text" : "the pattern");
+        fossil_test_text_score(behavior, false, message, names, file, line, func);
+        return;
+    }
+    char error[128];
+    size_t matches;
+    size_t first;
+    size_t limit = wanted && count != FOSSIL_TEST_TEXT_ANY ? count + 1 : 1;
+    if (!fossil_test_pattern_scan(slot, pattern, text, limit, &matches, &first, error, sizeof(error))) {
+        snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but the pattern does not compile: %s", names, error);
+        fossil_test_text_score(behavior, false, message, names, file, line, func);
+        return;
+    }
+
+    size_t length = strlen(text);
+    bool passed;
+    size_t used;
+    if (!wanted) {
+        passed = matches == 0;
+        used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but it matches at byte %zu", names, first);
+    } else if (count == FOSSIL_TEST_TEXT_ANY) {
+        passed = matches > 0;
+        used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but nothing in the %zu bytes of text matches", names, length);
+    } else {
+        // Counting stopped one past the wanted count, so count them all for the report.
+        if (matches > count) {
+            matches = fossil_test_pattern_count(slot, pattern, text);
+        }
+        passed = matches == count;
+        used = (size_t)snprintf(message, FOSSIL_TEST_TEXT_MESSAGE, "Expected %s, but it matches %zu times", names, matches);
+        if (matches > 0 && used < FOSSIL_TEST_TEXT_MESSAGE) {
+            used += (size_t)snprintf(message + used, FOSSIL_TEST_TEXT_MESSAGE - used, ", first at byte %zu", first);
+        }
+    }
+    if (!passed && matches > 0) {
+        fossil_test_text_where(message, used, text, length, first);
+    }
+    fossil_test_text_score(behavior, passed, message, names, file, line, func);
+}
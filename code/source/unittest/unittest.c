@@ -14,10 +14,19 @@ Description:
 #include "fossil/_common/common.h"
 #include "fossil/unittest/console.h"
 #include "fossil/unittest/commands.h"
+#include "fossil/unittest/table.h"
+#include "fossil/unittest/fuzz.h"
+#include "fossil/unittest/failure.h"
+#include "fossil/unittest/crash.h"
+#include "fossil/unittest/impact.h"
+#include "fossil/unittest/cache.h"
+#include "fossil/unittest/snapshot.h"
 #include <stdarg.h>
 
 fossil_env_t _TEST_ENV;
 xassert_info _ASSERT_INFO;
+FOSSIL_TEST_THREAD_LOCAL uint64_t _fossil_test_pass_count = 0;
+static FOSSIL_TEST_THREAD_LOCAL fossil_test_assert_hook_t fossil_test_assert_hook = xnullptr;
 
 fossil_test_queue_t* fossil_test_queue_create(void) {
     fossil_test_queue_t* queue = (fossil_test_queue_t*)malloc(sizeof(fossil_test_queue_t));
@@ -239,7 +248,7 @@ void array_to_queue(fossil_test_t **array, int size, fossil_test_queue_t *queue)
     }
 }
 
-// Fisher-Yates shuffle algorithm
+// Fisher-Yates shuffle algorithm, the order repeats when a seed is given.
 void fossil_test_queue_shuffle(fossil_test_queue_t *queue) {
     if (queue == xnullptr) {
         return;
@@ -251,7 +260,7 @@ void fossil_test_queue_shuffle(fossil_test_queue_t *queue) {
         return;
     }
 
-    srand(time(xnullptr));
+    srand(_CLI.seed_enabled ? (unsigned int)(_CLI.seed ^ (_CLI.seed >> 32)) : (unsigned int)time(xnullptr));
     for (int i = size - 1; i > 0; i--) {
         int j = rand() % (i + 1);
         fossil_test_t *temp = array[i];
@@ -289,6 +298,8 @@ fossil_env_t fossil_test_environment_create(int argc, char **argv) {
     env.stats.expected_timeout_count = 0;
     env.stats.expected_total_count = 0;
     env.stats.untested_count = 0;
+    env.stats.crashed_count = 0;
+    env.stats.cached_count = 0;
 
     // Initialize test rules
     env.rule.should_pass = true;
@@ -314,6 +325,9 @@ fossil_env_t fossil_test_environment_create(int argc, char **argv) {
     env.current_except_count = 0;
     env.current_assume_count = 0;
 
+    // Crashing cases jump back to the runner instead of ending the run
+    fossil_test_crash_install();
+
     fossil_test_io_summary_start();
     
     return env;
@@ -383,14 +397,53 @@ void fossil_test_environment_scoreboard(fossil_test_t *test) {
     _TEST_ENV.rule.should_pass = true; // reset counter for next test
 }
 
-void fossil_test_run_testcase(fossil_test_t *test) {
-    if (test == xnullptr) {
-        return;
+// Shards are picked by hashing the name and row, so each process can shuffle
+// or reverse its own queue and the shards still split the suite exactly.
+bool fossil_test_shard_owns(const char *name, uint64_t row, int index, int count) {
+    if (count <= 1) {
+        return true;
+    }
+    fossil_snapshot_hash_t hash;
+    fossil_snapshot_hash_init(&hash);
+    fossil_snapshot_hash_update(&hash, name, strlen(name) + 1);
+    fossil_snapshot_hash_update(&hash, &row, sizeof(row));
+    return fossil_snapshot_hash_final(&hash) % (uint64_t)count == (uint64_t)index;
+}
+
+static bool fossil_test_shard_claim(const fossil_test_t *test, uint64_t row) {
+    return fossil_test_shard_owns(test->name, row, _CLI.shard_index, _CLI.shard_count);
+}
+
+// A crash fails the case, the report says where it happened.
+static bool fossil_test_case_crashed(fossil_test_t *test) {
+    fossil_test_crash_t crash;
+    if (!fossil_test_crash_take(&crash)) {
+        return false;
     }
+    _TEST_ENV.rule.should_pass = false;
+    fossil_test_io_crashed(test, &crash);
+    return true;
+}
+
+// The teardown gets its own jump point in its own frame, so nothing the case
+// keeps in locals can be clobbered when a crash in it jumps back.
+static bool fossil_test_run_teardown(fossil_test_t *test) {
+    fossil_test_jump_t point;
+    if (FOSSIL_TEST_SETJMP(point) == 0) {
+        fossil_test_jump_swap(&point);
+        test->fixture.teardown();
+    }
+    fossil_test_jump_swap(xnullptr);
+    fossil_test_failure_report();
+    return fossil_test_case_crashed(test);
+}
+
+static void fossil_test_run_case(fossil_test_t *test, const fossil_test_row_t *row) {
     // set and reset step for assert scanning
     _ASSERT_INFO.has_assert     = false;
     _ASSERT_INFO.should_fail    = false;
     _ASSERT_INFO.shoudl_timeout = false;
+    _ASSERT_INFO.row            = row != xnullptr ? (int64_t)row->index : -1;
 
     if (_TEST_ENV.rule.skipped && strcmp(test->marks, "skip") == 0) {
         return;
@@ -398,19 +451,157 @@ void fossil_test_run_testcase(fossil_test_t *test) {
         _ASSERT_INFO.should_fail = true;
     }
 
+    // Passing assertions only bump a counter, so any change means the case asserted.
+    uint64_t passes = _fossil_test_pass_count;
+    fossil_test_failure_reset();
+    _TEST_ENV.current_assume_count = 0;
+
     fossil_test_io_unittest_start(test);
-    if (test->fixture.setup != xnullptr) {
-        test->fixture.setup();
+
+    // A fatal assertion or a crash in setup or the test function jumps back
+    // here and the case goes on with its teardown.
+    fossil_test_jump_t point;
+    if (FOSSIL_TEST_SETJMP(point) == 0) {
+        fossil_test_jump_swap(&point);
+        if (test->fixture.setup != xnullptr) {
+            test->fixture.setup();
+        }
+
+        // Run the test function
+        for (int32_t iter = 0; iter < _CLI.repeat_count; iter++) {
+            if (row != xnullptr) {
+                test->table.row_function(row);
+            } else {
+                test->test_function();
+            }
+        }
     }
+    fossil_test_jump_swap(xnullptr);
 
-    // Run the test function
-    for (int32_t iter = 0; iter < _CLI.repeat_count; iter++) {
-        test->test_function();
+    if (_fossil_test_pass_count != passes) {
+        _ASSERT_INFO.has_assert = true;
     }
+    fossil_test_failure_report();
+    bool crashed = fossil_test_case_crashed(test);
     fossil_test_io_unittest_step(&_ASSERT_INFO);
 
-    if (test->fixture.teardown != xnullptr) {
-        test->fixture.teardown();
+    if (test->fixture.teardown != xnullptr && fossil_test_run_teardown(test)) {
+        crashed = true;
+    }
+    if (crashed) {
+        _TEST_ENV.stats.crashed_count++;
+    }
+
+    fossil_test_io_unittest_ended(test);
+    fossil_test_environment_scoreboard(test);
+}
+
+// Every row of a parameterized test is scheduled, reported and scored as a
+// case of its own, rows are fetched one at a time from the table.
+static void fossil_test_run_table(fossil_test_t *test) {
+    fossil_test_table_cursor_t cursor;
+    fossil_test_row_t row;
+
+    if (!fossil_test_table_open(&test->table, &cursor)) {
+        // An unreadable table counts as one failed case.
+        _TEST_ENV.rule.should_pass = false;
+        fossil_test_environment_scoreboard(test);
+        return;
+    }
+
+    _TEST_ENV.stats.untested_count--; // the rows stand in for the table
+    for (uint64_t index = 0; fossil_test_table_next(&cursor, &row); index++) {
+        if (!fossil_test_shard_claim(test, index)) {
+            continue;
+        }
+        _TEST_ENV.stats.untested_count++;
+        fossil_test_run_case(test, &row);
+    }
+    fossil_test_table_close(&cursor);
+}
+
+// A case whose key is in the cache passed with the same code before and is
+// counted as cached instead of running again. Only clean passes are kept.
+static void fossil_test_run_cached(fossil_test_t *test) {
+    uint64_t key = 0;
+    bool cacheable = fossil_test_cache_active() && strcmp(test->marks, "fossil") == 0 &&
+                     fossil_test_cache_key(fossil_test_cache_index(), test, &key);
+    if (cacheable && fossil_test_cache_hit(_CLI.cache_dir, key)) {
+        _TEST_ENV.stats.untested_count--;
+        _TEST_ENV.stats.cached_count++;
+        fossil_test_io_cached(test);
+        return;
+    }
+
+    uint32_t passed = _TEST_ENV.stats.expected_passed_count;
+    fossil_test_run_case(test, xnullptr);
+    if (cacheable && _TEST_ENV.stats.expected_passed_count == passed + 1) {
+        fossil_test_cache_store(_CLI.cache_dir, key, test->name);
+    }
+}
+
+void fossil_test_run_testcase(fossil_test_t *test) {
+    if (test == xnullptr) {
+        return;
+    }
+
+    if (!fossil_test_impact_case_selected(test->name)) {
+        _TEST_ENV.stats.untested_count--; // runs none of the changed files
+        return;
+    }
+
+    if (test->table.kind != FOSSIL_TEST_TABLE_NONE) {
+        fossil_test_run_table(test);
+    } else if (fossil_test_shard_claim(test, 0)) {
+        fossil_test_run_cached(test);
+    } else {
+        _TEST_ENV.stats.untested_count--; // another shard runs this case
+        return;
+    }
+    fossil_test_impact_case_ended(test->name);
+}
+
+// Fuzz mode loops over one target in process instead of running the suite,
+// it is scored as a single case that fails when an input fails.
+static void fossil_test_run_fuzz(fossil_env_t *env) {
+    fossil_test_t *test = fossil_test_queue_search_by_name(env->queue, _CLI.fuzz_name);
+    _TEST_ENV.stats.untested_count = 1;
+    if (test == xnullptr || test->table.kind != FOSSIL_TEST_TABLE_CORPUS) {
+        fprintf(stderr, "No fuzz target named '%s'\n", _CLI.fuzz_name);
+        return;
+    }
+
+    _ASSERT_INFO.has_assert     = true;
+    _ASSERT_INFO.should_fail    = false;
+    _ASSERT_INFO.shoudl_timeout = false;
+    _ASSERT_INFO.row            = -1;
+
+    fossil_test_failure_reset();
+    _TEST_ENV.current_assume_count = 0;
+
+    fossil_test_io_unittest_start(test);
+
+    // Reported like any other case, a failing input leaves its messages and
+    // a fatal assertion or crash in setup jumps back to the teardown.
+    fossil_test_jump_t point;
+    if (FOSSIL_TEST_SETJMP(point) == 0) {
+        fossil_test_jump_swap(&point);
+        if (test->fixture.setup != xnullptr) {
+            test->fixture.setup();
+        }
+        fossil_fuzz_loop(test, _CLI.fuzz_runs, xnullptr);
+    }
+    fossil_test_jump_swap(xnullptr);
+
+    fossil_test_failure_report();
+    bool crashed = fossil_test_case_crashed(test);
+    fossil_test_io_unittest_step(&_ASSERT_INFO);
+
+    if (test->fixture.teardown != xnullptr && fossil_test_run_teardown(test)) {
+        crashed = true;
+    }
+    if (crashed) {
+        _TEST_ENV.stats.crashed_count++;
     }
 
     fossil_test_io_unittest_ended(test);
@@ -449,10 +640,12 @@ void fossil_test_environment_run(fossil_env_t *env) {
     // Apply the test environment algorithms for the given test cases
     fossil_test_environment_algorithms(env);
 
-    
+    if (_CLI.fuzz_enabled) {
+        fossil_test_run_fuzz(env);
+    }
 
     // Iterate through the test queue and run each test
-    fossil_test_t *current_test = env->queue->front;
+    fossil_test_t *current_test = _CLI.fuzz_enabled ? xnullptr : env->queue->front;
     while (current_test != xnullptr) {
         // Run the test function
         fossil_test_run_testcase(current_test);
@@ -460,6 +653,8 @@ void fossil_test_environment_run(fossil_env_t *env) {
         // Move to the next test
         current_test = current_test->next;
     }
+    fossil_test_impact_finish();
+    fossil_test_cache_finish();
 
     // Stop the timer
     env->timer.end = clock();
@@ -647,10 +842,19 @@ void fossil_test_apply_priority(fossil_test_t *test, const char *priority) {
 // Assertion function implementations
 //
 
+// Ends the running case, the runner reports it and runs its teardown. Outside
+// of a case, or on another thread, there is nothing to return to and the
+// process exits as before.
+static void fossil_test_abort_case(void) {
+    fossil_test_jump_back();
+    fossil_test_failure_report();
+    exit(FOSSIL_TEST_ABORT_FAIL);
+}
+
 // Custom assumptions function with optional message.
 void fossil_test_assert_impl_assume(bool expression, xassert_info *assume) {
     if (_TEST_ENV.current_assume_count == FOSSIL_TEST_ASSUME_MAX) {
-        exit(FOSSIL_TEST_ABORT_FAIL);
+        fossil_test_abort_case();
         return;
     }
 
@@ -658,7 +862,7 @@ void fossil_test_assert_impl_assume(bool expression, xassert_info *assume) {
         if (!expression) {
             _TEST_ENV.rule.should_pass = false;
             _TEST_ENV.current_assume_count++;
-            fossil_test_io_asserted(assume);
+            fossil_test_failure_add(assume);
         }
     } else {
         if (!expression) {
@@ -666,7 +870,7 @@ void fossil_test_assert_impl_assume(bool expression, xassert_info *assume) {
         } else if (expression) {
             _TEST_ENV.rule.should_pass = false;
             _TEST_ENV.current_assume_count++;
-            fossil_test_io_asserted(assume);
+            fossil_test_failure_add(assume);
         }
     }
 } // end of func
@@ -675,17 +879,20 @@ void fossil_test_assert_impl_assume(bool expression, xassert_info *assume) {
 void fossil_test_assert_impl_assert(bool expression, xassert_info *assume) {
     if (_ASSERT_INFO.should_fail) {
         if (!expression) {
+            // Failing as the case expects still ends it, the code after a
+            // fatal assertion relies on it holding.
             _TEST_ENV.rule.should_pass = true;
+            fossil_test_abort_case();
         } else if (expression) {
             _TEST_ENV.rule.should_pass = false;
-            fossil_test_io_asserted(assume);
-            exit(FOSSIL_TEST_ABORT_FAIL);
+            fossil_test_failure_add(assume);
+            fossil_test_abort_case();
         }
     } else {
         if (!expression) {
             _TEST_ENV.rule.should_pass = false;
-            fossil_test_io_asserted(assume);
-            exit(FOSSIL_TEST_ABORT_FAIL);
+            fossil_test_failure_add(assume);
+            fossil_test_abort_case();
         }
     }
 } // end of func
@@ -697,22 +904,19 @@ void fossil_test_assert_impl_expect(bool expression, xassert_info *assume) {
             _TEST_ENV.rule.should_pass = true;
         } else if (expression) {
             _TEST_ENV.rule.should_pass = false;
-            fossil_test_io_asserted(assume);
+            fossil_test_failure_add(assume);
         }
     } else {
         if (!expression) {
             _TEST_ENV.rule.should_pass = false;
-            fossil_test_io_asserted(assume);
+            fossil_test_failure_add(assume);
         }
     }
 } // end of func
 
-void _fossil_test_assert_class(bool expression, xassert_type_t behavor, char* message, char* file, int line, char* func) {
-    _ASSERT_INFO.func = func;
-    _ASSERT_INFO.file = file;
-    _ASSERT_INFO.line = line;
-    _ASSERT_INFO.message = message;
-
+static void fossil_test_assert_dispatch(bool expression, xassert_type_t behavor) {
+    // Noted first, a fatal assertion does not return here.
+    _ASSERT_INFO.has_assert = true; // Make note of an assert being added in a given test case
     if (behavor == TEST_ASSERT_AS_CLASS_ASSUME) {
         fossil_test_assert_impl_assume(expression, &_ASSERT_INFO);
     } else if (behavor == TEST_ASSERT_AS_CLASS_ASSERT) {
@@ -720,5 +924,64 @@ void _fossil_test_assert_class(bool expression, xassert_type_t behavor, char* me
     } else if (behavor == TEST_ASSERT_AS_CLASS_EXPECT) {
         fossil_test_assert_impl_expect(expression, &_ASSERT_INFO);
     }
-    _ASSERT_INFO.has_assert = true; // Make note of an assert being added in a given test case
+}
+
+// A hooked thread never touches the shared assertion state.
+static bool fossil_test_assert_hooked(bool expression, const char *message, const char *file, int line) {
+    if (fossil_test_assert_hook == xnullptr) {
+        return false;
+    }
+    if (!expression) {
+        fossil_test_assert_hook(message, file, line);
+    }
+    return true;
+}
+
+fossil_test_assert_hook_t fossil_test_assert_hook_swap(fossil_test_assert_hook_t hook) {
+    fossil_test_assert_hook_t previous = fossil_test_assert_hook;
+    fossil_test_assert_hook = hook;
+    return previous;
+}
+
+void _fossil_test_assert_class(bool expression, xassert_type_t behavor, char* message, char* file, int line, char* func) {
+    if (fossil_test_assert_hooked(expression, message, file, line)) {
+        return;
+    }
+    _ASSERT_INFO.func = func;
+    _ASSERT_INFO.file = file;
+    _ASSERT_INFO.line = line;
+    _ASSERT_INFO.message = message;
+    _ASSERT_INFO.kind = FOSSIL_TEST_OPERAND_NONE;
+    fossil_test_assert_dispatch(expression, behavor);
+}
+
+// Comparisons hand over their operands untouched, they are only formatted
+// when the failures of the case are reported.
+void _fossil_test_assert_integer(bool expression, xassert_type_t behavior, fossil_test_operand_t kind, const char* message, uint64_t actual, uint64_t expected, const char* file, int line, const char* func) {
+    if (fossil_test_assert_hooked(expression, message, file, line)) {
+        return;
+    }
+    _ASSERT_INFO.func = (char *)func;
+    _ASSERT_INFO.file = (char *)file;
+    _ASSERT_INFO.line = line;
+    _ASSERT_INFO.message = (char *)message;
+    _ASSERT_INFO.kind = kind;
+    _ASSERT_INFO.actual.u = actual;
+    _ASSERT_INFO.expected.u = expected;
+    fossil_test_assert_dispatch(expression, behavior);
+}
+
+void _fossil_test_assert_float(bool expression, xassert_type_t behavior, fossil_test_operand_t kind, const char* message, double actual, double expected, double tolerance, const char* file, int line, const char* func) {
+    if (fossil_test_assert_hooked(expression, message, file, line)) {
+        return;
+    }
+    _ASSERT_INFO.func = (char *)func;
+    _ASSERT_INFO.file = (char *)file;
+    _ASSERT_INFO.line = line;
+    _ASSERT_INFO.message = (char *)message;
+    _ASSERT_INFO.kind = kind;
+    _ASSERT_INFO.actual.f = actual;
+    _ASSERT_INFO.expected.f = expected;
+    _ASSERT_INFO.tolerance.f = tolerance;
+    fossil_test_assert_dispatch(expression, behavior);
 }
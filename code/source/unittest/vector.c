@@ -0,0 +1,1793 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/_common/common.h"
+#include "fossil/_common/atomic.h"
+#include "fossil/_common/thread.h"
+#include "fossil/unittest/vector.h"
+
+#include <math.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FOSSIL_TEST_SSE2 1
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define FOSSIL_TEST_AVX2 1
+#define FOSSIL_TEST_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define FOSSIL_TEST_NEON 1
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+enum {
+    FOSSIL_TEST_ARRAY_BLOCK = 64,   // elements checked branch free before looking closer
+    FOSSIL_TEST_ARRAY_WINDOW = 3,   // neighbours shown on each side of a failure
+    FOSSIL_TEST_MEMORY_CHUNK = 4 << 20,   // bytes a worker compares at a time
+    FOSSIL_TEST_MEMORY_THREADS = 16,
+    FOSSIL_TEST_MEMORY_TILE = 4096,       // bytes of repeated pattern compared per step
+    FOSSIL_TEST_MEMORY_ROW = 16,          // bytes per hexdump row
+    FOSSIL_TEST_MEMORY_ROWS = 8,          // most hexdump rows in a failure
+};
+
+static FOSSIL_TEST_THREAD_LOCAL char fossil_test_array_message[4096];
+
+// Error totals of one block of float elements.
+typedef struct {
+    double max;
+    double sum;
+    size_t failures;
+} fossil_test_block_error_t;
+
+#define FOSSIL_TEST_ULP_SUM_CAP (UINT64_C(1) << 56)
+
+// Work shared by the threads comparing one large buffer. A pattern check
+// compares against tile, which repeats the pattern for tile_size bytes plus
+// two more copies so it can be read from any phase.
+typedef struct {
+    const uint8_t *data;
+    const uint8_t *expected;
+    const uint8_t *tile;
+    size_t pattern_size;
+    size_t tile_size;
+    size_t size;
+    volatile uint64_t next;
+    volatile uint64_t failing;
+} fossil_test_memory_job_t;
+
+//
+// local functions
+//
+
+static unsigned fossil_test_first_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    unsigned index = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+static size_t fossil_test_array_width(fossil_test_array_type_t type) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8:
+        case FOSSIL_TEST_ARRAY_U8:
+            return 1;
+        case FOSSIL_TEST_ARRAY_I16:
+        case FOSSIL_TEST_ARRAY_U16:
+            return 2;
+        case FOSSIL_TEST_ARRAY_I32:
+        case FOSSIL_TEST_ARRAY_U32:
+        case FOSSIL_TEST_ARRAY_F32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+// Integer arrays are equal exactly when their bytes are, so one byte kernel
+// serves every integer width.
+static size_t fossil_test_bytes_scalar(const uint8_t *a, const uint8_t *b, size_t size, size_t at) {
+    for (; at + 8 <= size; at += 8) {
+        uint64_t x;
+        uint64_t y;
+        memcpy(&x, a + at, sizeof(x));
+        memcpy(&y, b + at, sizeof(y));
+        if (x != y) {
+            break;
+        }
+    }
+    for (; at < size; at++) {
+        if (a[at] != b[at]) {
+            return at;
+        }
+    }
+    return size;
+}
+
+#ifdef FOSSIL_TEST_AVX2
+static bool fossil_test_cpu_avx2(void) {
+    static int supported = -1;
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return supported == 1;
+}
+
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_bytes_avx2(const uint8_t *a, const uint8_t *b, size_t size) {
+    size_t at = 0;
+    for (; at + 32 <= size; at += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(const void *)(a + at));
+        __m256i y = _mm256_loadu_si256((const __m256i *)(const void *)(b + at));
+        uint32_t same = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (same != 0xffffffffu) {
+            return at + fossil_test_first_bit(~same);
+        }
+    }
+    return fossil_test_bytes_scalar(a, b, size, at);
+}
+
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_f32_avx2(const float *a, const float *b, size_t count, float tolerance) {
+    const __m256 limit = _mm256_set1_ps(tolerance);
+    const __m256 magnitude = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    size_t at = 0;
+    for (; at + 8 <= count; at += 8) {
+        __m256 x = _mm256_loadu_ps(a + at);
+        __m256 y = _mm256_loadu_ps(b + at);
+        __m256 close = _mm256_cmp_ps(_mm256_and_ps(_mm256_sub_ps(x, y), magnitude), limit, _CMP_LE_OQ);
+        uint32_t same = (uint32_t)_mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ), close));
+        if (same != 0xffu) {
+            return at + fossil_test_first_bit(~same & 0xffu);
+        }
+    }
+    return at;
+}
+
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_f64_avx2(const double *a, const double *b, size_t count, double tolerance) {
+    const __m256d limit = _mm256_set1_pd(tolerance);
+    const __m256d magnitude = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    size_t at = 0;
+    for (; at + 4 <= count; at += 4) {
+        __m256d x = _mm256_loadu_pd(a + at);
+        __m256d y = _mm256_loadu_pd(b + at);
+        __m256d close = _mm256_cmp_pd(_mm256_and_pd(_mm256_sub_pd(x, y), magnitude), limit, _CMP_LE_OQ);
+        uint32_t same = (uint32_t)_mm256_movemask_pd(_mm256_or_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ), close));
+        if (same != 0xfu) {
+            return at + fossil_test_first_bit(~same & 0xfu);
+        }
+    }
+    return at;
+}
+#endif
+
+#ifdef FOSSIL_TEST_SSE2
+static size_t fossil_test_bytes_sse2(const uint8_t *a, const uint8_t *b, size_t size) {
+    size_t at = 0;
+    for (; at + 16 <= size; at += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(const void *)(a + at));
+        __m128i y = _mm_loadu_si128((const __m128i *)(const void *)(b + at));
+        uint32_t same = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+        if (same != 0xffffu) {
+            return at + fossil_test_first_bit(~same & 0xffffu);
+        }
+    }
+    return fossil_test_bytes_scalar(a, b, size, at);
+}
+
+static size_t fossil_test_f32_sse2(const float *a, const float *b, size_t count, float tolerance) {
+    const __m128 limit = _mm_set1_ps(tolerance);
+    const __m128 magnitude = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    size_t at = 0;
+    for (; at + 4 <= count; at += 4) {
+        __m128 x = _mm_loadu_ps(a + at);
+        __m128 y = _mm_loadu_ps(b + at);
+        __m128 close = _mm_cmple_ps(_mm_and_ps(_mm_sub_ps(x, y), magnitude), limit);
+        uint32_t same = (uint32_t)_mm_movemask_ps(_mm_or_ps(_mm_cmpeq_ps(x, y), close));
+        if (same != 0xfu) {
+            return at + fossil_test_first_bit(~same & 0xfu);
+        }
+    }
+    return at;
+}
+
+static size_t fossil_test_f64_sse2(const double *a, const double *b, size_t count, double tolerance) {
+    const __m128d limit = _mm_set1_pd(tolerance);
+    const __m128d magnitude = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        __m128d x = _mm_loadu_pd(a + at);
+        __m128d y = _mm_loadu_pd(b + at);
+        __m128d close = _mm_cmple_pd(_mm_and_pd(_mm_sub_pd(x, y), magnitude), limit);
+        uint32_t same = (uint32_t)_mm_movemask_pd(_mm_or_pd(_mm_cmpeq_pd(x, y), close));
+        if (same != 0x3u) {
+            return at + fossil_test_first_bit(~same & 0x3u);
+        }
+    }
+    return at;
+}
+#endif
+
+#ifdef FOSSIL_TEST_NEON
+static size_t fossil_test_bytes_neon(const uint8_t *a, const uint8_t *b, size_t size) {
+    size_t at = 0;
+    for (; at + 16 <= size; at += 16) {
+        uint8x16_t same = vceqq_u8(vld1q_u8(a + at), vld1q_u8(b + at));
+        if (vminvq_u8(same) != 0xff) {
+            return fossil_test_bytes_scalar(a, b, at + 16, at);
+        }
+    }
+    return fossil_test_bytes_scalar(a, b, size, at);
+}
+
+static size_t fossil_test_f32_neon(const float *a, const float *b, size_t count, float tolerance) {
+    const float32x4_t limit = vdupq_n_f32(tolerance);
+    size_t at = 0;
+    for (; at + 4 <= count; at += 4) {
+        float32x4_t x = vld1q_f32(a + at);
+        float32x4_t y = vld1q_f32(b + at);
+        uint32x4_t same = vorrq_u32(vceqq_f32(x, y), vcleq_f32(vabdq_f32(x, y), limit));
+        if (vminvq_u32(same) != 0xffffffffu) {
+            return at;
+        }
+    }
+    return at;
+}
+
+static size_t fossil_test_f64_neon(const double *a, const double *b, size_t count, double tolerance) {
+    const float64x2_t limit = vdupq_n_f64(tolerance);
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        float64x2_t x = vld1q_f64(a + at);
+        float64x2_t y = vld1q_f64(b + at);
+        uint64x2_t same = vorrq_u64(vceqq_f64(x, y), vcleq_f64(vabdq_f64(x, y), limit));
+        if ((vgetq_lane_u64(same, 0) & vgetq_lane_u64(same, 1)) != UINT64_MAX) {
+            return at;
+        }
+    }
+    return at;
+}
+#endif
+
+static size_t fossil_test_bytes_mismatch(const uint8_t *a, const uint8_t *b, size_t size) {
+#ifdef FOSSIL_TEST_AVX2
+    if (fossil_test_cpu_avx2()) {
+        return fossil_test_bytes_avx2(a, b, size);
+    }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+    return fossil_test_bytes_sse2(a, b, size);
+#elif defined(FOSSIL_TEST_NEON)
+    return fossil_test_bytes_neon(a, b, size);
+#else
+    return fossil_test_bytes_scalar(a, b, size, 0);
+#endif
+}
+
+// Substring search compares the first and the last byte of the needle at
+// every position of a block at once, and only the few positions where both
+// agree are compared in full. The scalar loop jumps between first bytes.
+static size_t fossil_test_find_scalar(const uint8_t *data, size_t size, const uint8_t *needle, size_t needle_size, size_t at) {
+    while (at + needle_size <= size) {
+        const uint8_t *next = (const uint8_t *)memchr(data + at, needle[0], size - needle_size + 1 - at);
+        if (next == xnullptr) {
+            break;
+        }
+        at = (size_t)(next - data);
+        if (memcmp(next + 1, needle + 1, needle_size - 1) == 0) {
+            return at;
+        }
+        at++;
+    }
+    return size;
+}
+
+#if defined(FOSSIL_TEST_AVX2) || defined(FOSSIL_TEST_SSE2)
+static bool fossil_test_find_candidates(const uint8_t *data, const uint8_t *needle, size_t needle_size, size_t at, uint32_t bits, size_t *found) {
+    while (bits != 0) {
+        size_t index = at + fossil_test_first_bit(bits);
+        if (memcmp(data + index + 1, needle + 1, needle_size - 2) == 0) {
+            *found = index;
+            return true;
+        }
+        bits &= bits - 1;
+    }
+    return false;
+}
+#endif
+
+#ifdef FOSSIL_TEST_AVX2
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_find_avx2(const uint8_t *data, size_t size, const uint8_t *needle, size_t needle_size) {
+    const __m256i first = _mm256_set1_epi8((char)needle[0]);
+    const __m256i last = _mm256_set1_epi8((char)needle[needle_size - 1]);
+    size_t at = 0;
+    size_t found;
+    for (; at + 32 + needle_size - 1 <= size; at += 32) {
+        __m256i head = _mm256_loadu_si256((const __m256i *)(const void *)(data + at));
+        __m256i tail = _mm256_loadu_si256((const __m256i *)(const void *)(data + at + needle_size - 1));
+        __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last));
+        uint32_t bits = (uint32_t)_mm256_movemask_epi8(both);
+        if (bits != 0 && fossil_test_find_candidates(data, needle, needle_size, at, bits, &found)) {
+            return found;
+        }
+    }
+    return fossil_test_find_scalar(data, size, needle, needle_size, at);
+}
+#endif
+
+#ifdef FOSSIL_TEST_SSE2
+static size_t fossil_test_find_sse2(const uint8_t *data, size_t size, const uint8_t *needle, size_t needle_size) {
+    const __m128i first = _mm_set1_epi8((char)needle[0]);
+    const __m128i last = _mm_set1_epi8((char)needle[needle_size - 1]);
+    size_t at = 0;
+    size_t found;
+    for (; at + 16 + needle_size - 1 <= size; at += 16) {
+        __m128i head = _mm_loadu_si128((const __m128i *)(const void *)(data + at));
+        __m128i tail = _mm_loadu_si128((const __m128i *)(const void *)(data + at + needle_size - 1));
+        uint32_t bits = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last)));
+        if (bits != 0 && fossil_test_find_candidates(data, needle, needle_size, at, bits, &found)) {
+            return found;
+        }
+    }
+    return fossil_test_find_scalar(data, size, needle, needle_size, at);
+}
+#endif
+
+#ifdef FOSSIL_TEST_NEON
+static size_t fossil_test_find_neon(const uint8_t *data, size_t size, const uint8_t *needle, size_t needle_size) {
+    const uint8x16_t first = vdupq_n_u8(needle[0]);
+    const uint8x16_t last = vdupq_n_u8(needle[needle_size - 1]);
+    size_t at = 0;
+    for (; at + 16 + needle_size - 1 <= size; at += 16) {
+        uint8x16_t both = vandq_u8(vceqq_u8(vld1q_u8(data + at), first), vceqq_u8(vld1q_u8(data + at + needle_size - 1), last));
+        if (vmaxvq_u8(both) == 0) {
+            continue;
+        }
+        size_t found = fossil_test_find_scalar(data, at + 16 + needle_size - 1, needle, needle_size, at);
+        if (found != at + 16 + needle_size - 1) {
+            return found;
+        }
+    }
+    return fossil_test_find_scalar(data, size, needle, needle_size, at);
+}
+#endif
+
+static size_t fossil_test_bytes_find(const uint8_t *data, size_t size, const uint8_t *needle, size_t needle_size) {
+    if (needle_size == 1) {
+        const uint8_t *found = (const uint8_t *)memchr(data, needle[0], size);
+        return found != xnullptr ? (size_t)(found - data) : size;
+    }
+#ifdef FOSSIL_TEST_AVX2
+    if (fossil_test_cpu_avx2()) {
+        return fossil_test_find_avx2(data, size, needle, needle_size);
+    }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+    return fossil_test_find_sse2(data, size, needle, needle_size);
+#elif defined(FOSSIL_TEST_NEON)
+    return fossil_test_find_neon(data, size, needle, needle_size);
+#else
+    return fossil_test_find_scalar(data, size, needle, needle_size, 0);
+#endif
+}
+
+// The vector kernels stop at the first block holding a mismatch, or before a
+// partial block, the scalar loop finishes from there.
+static size_t fossil_test_f32_mismatch(const float *a, const float *b, size_t count, float tolerance) {
+    size_t at = 0;
+#ifdef FOSSIL_TEST_AVX2
+    if (fossil_test_cpu_avx2()) {
+        at = fossil_test_f32_avx2(a, b, count, tolerance);
+    }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+    at += fossil_test_f32_sse2(a + at, b + at, count - at, tolerance);
+#elif defined(FOSSIL_TEST_NEON)
+    at = fossil_test_f32_neon(a, b, count, tolerance);
+#endif
+    for (; at < count; at++) {
+        if (!(a[at] == b[at] || (a[at] > b[at] ? a[at] - b[at] : b[at] - a[at]) <= tolerance)) {
+            return at;
+        }
+    }
+    return count;
+}
+
+static size_t fossil_test_f64_mismatch(const double *a, const double *b, size_t count, double tolerance) {
+    size_t at = 0;
+#ifdef FOSSIL_TEST_AVX2
+    if (fossil_test_cpu_avx2()) {
+        at = fossil_test_f64_avx2(a, b, count, tolerance);
+    }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+    at += fossil_test_f64_sse2(a + at, b + at, count - at, tolerance);
+#elif defined(FOSSIL_TEST_NEON)
+    at = fossil_test_f64_neon(a, b, count, tolerance);
+#endif
+    for (; at < count; at++) {
+        if (!(a[at] == b[at] || (a[at] > b[at] ? a[at] - b[at] : b[at] - a[at]) <= tolerance)) {
+            return at;
+        }
+    }
+    return count;
+}
+
+// Order and range checks OR a whole block of comparisons together without
+// branching, which compilers turn into vector compares for every element
+// type, and only walk the block again when it holds the failure. Elements
+// are compared through their widest type so any bound can be given.
+#define FOSSIL_TEST_ARRAY_SCANS(name, type, wide) \
+    static size_t fossil_test_unsorted_##name(const type *data, size_t count) { \
+        for (size_t start = 1; start < count; start += FOSSIL_TEST_ARRAY_BLOCK) { \
+            size_t end = count - start > FOSSIL_TEST_ARRAY_BLOCK ? start + FOSSIL_TEST_ARRAY_BLOCK : count; \
+            int bad = 0; \
+            for (size_t i = start; i < end; i++) { \
+                bad |= !(data[i] >= data[i - 1]); \
+            } \
+            for (size_t i = start; bad && i < end; i++) { \
+                if (!(data[i] >= data[i - 1])) { \
+                    return i; \
+                } \
+            } \
+        } \
+        return count; \
+    } \
+    static size_t fossil_test_outside_##name(const type *data, size_t count, wide min, wide max) { \
+        for (size_t start = 0; start < count; start += FOSSIL_TEST_ARRAY_BLOCK) { \
+            size_t end = count - start > FOSSIL_TEST_ARRAY_BLOCK ? start + FOSSIL_TEST_ARRAY_BLOCK : count; \
+            int bad = 0; \
+            for (size_t i = start; i < end; i++) { \
+                bad |= !((wide)data[i] >= min && (wide)data[i] <= max); \
+            } \
+            for (size_t i = start; bad && i < end; i++) { \
+                if (!((wide)data[i] >= min && (wide)data[i] <= max)) { \
+                    return i; \
+                } \
+            } \
+        } \
+        return count; \
+    }
+
+FOSSIL_TEST_ARRAY_SCANS(i8, int8_t, int64_t)
+FOSSIL_TEST_ARRAY_SCANS(i16, int16_t, int64_t)
+FOSSIL_TEST_ARRAY_SCANS(i32, int32_t, int64_t)
+FOSSIL_TEST_ARRAY_SCANS(i64, int64_t, int64_t)
+FOSSIL_TEST_ARRAY_SCANS(u8, uint8_t, uint64_t)
+FOSSIL_TEST_ARRAY_SCANS(u16, uint16_t, uint64_t)
+FOSSIL_TEST_ARRAY_SCANS(u32, uint32_t, uint64_t)
+FOSSIL_TEST_ARRAY_SCANS(u64, uint64_t, uint64_t)
+FOSSIL_TEST_ARRAY_SCANS(f32, float, double)
+FOSSIL_TEST_ARRAY_SCANS(f64, double, double)
+
+static int fossil_test_array_format(fossil_test_array_type_t type, const void *data, size_t index, char *out, size_t capacity) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8:
+            return snprintf(out, capacity, "%d", (int)((const int8_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_I16:
+            return snprintf(out, capacity, "%d", (int)((const int16_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_I32:
+            return snprintf(out, capacity, "%ld", (long)((const int32_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_I64:
+            return snprintf(out, capacity, "%lld", (long long)((const int64_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_U8:
+            return snprintf(out, capacity, "%u", (unsigned)((const uint8_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_U16:
+            return snprintf(out, capacity, "%u", (unsigned)((const uint16_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_U32:
+            return snprintf(out, capacity, "%lu", (unsigned long)((const uint32_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_U64:
+            return snprintf(out, capacity, "%llu", (unsigned long long)((const uint64_t *)data)[index]);
+        case FOSSIL_TEST_ARRAY_F32:
+            return snprintf(out, capacity, "%.9g", (double)((const float *)data)[index]);
+        case FOSSIL_TEST_ARRAY_F64:
+        default:
+            return snprintf(out, capacity, "%.17g", ((const double *)data)[index]);
+    }
+}
+
+static int fossil_test_scalar_format(fossil_test_array_type_t type, fossil_test_scalar_t value, char *out, size_t capacity) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8:
+        case FOSSIL_TEST_ARRAY_I16:
+        case FOSSIL_TEST_ARRAY_I32:
+        case FOSSIL_TEST_ARRAY_I64:
+            return snprintf(out, capacity, "%lld", (long long)value.i);
+        case FOSSIL_TEST_ARRAY_F32:
+        case FOSSIL_TEST_ARRAY_F64:
+            return snprintf(out, capacity, "%.17g", value.f);
+        default:
+            return snprintf(out, capacity, "%llu", (unsigned long long)value.u);
+    }
+}
+
+// Append the elements around index, one per line, with the offending one
+// marked. other may be NULL when there is no reference array.
+static size_t fossil_test_array_window(char *out, size_t capacity, fossil_test_array_type_t type,
+                                       const void *data, const void *other, size_t count, size_t index) {
+    size_t used = 0;
+    size_t first = index > FOSSIL_TEST_ARRAY_WINDOW ? index - FOSSIL_TEST_ARRAY_WINDOW : 0;
+    size_t last = count - index > FOSSIL_TEST_ARRAY_WINDOW ? index + FOSSIL_TEST_ARRAY_WINDOW : count - 1;
+    for (size_t at = first; at <= last && used + 128 < capacity; at++) {
+        char value[48];
+        fossil_test_array_format(type, data, at, value, sizeof(value));
+        used += (size_t)snprintf(out + used, capacity - used, "\n    %s [%zu] %s", at == index ? ">" : " ", at, value);
+        if (other != xnullptr) {
+            char expected[48];
+            fossil_test_array_format(type, other, at, expected, sizeof(expected));
+            used += (size_t)snprintf(out + used, capacity - used, " | %s", expected);
+        }
+    }
+    return used;
+}
+
+static unsigned fossil_test_bit_count(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcount(mask);
+#else
+    unsigned count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+// ULP distances compare the float bit patterns as sign and magnitude
+// integers, so both zeroes are the same value and neighbouring floats are one
+// apart. NaN gets the largest distance, which no finite pair reaches.
+static uint32_t fossil_test_ulp_f32(uint32_t x, uint32_t y) {
+    uint32_t mx = x & 0x7fffffffu;
+    uint32_t my = y & 0x7fffffffu;
+    uint32_t sx = 0u - (x >> 31);
+    uint32_t sy = 0u - (y >> 31);
+    int32_t kx = (int32_t)((mx ^ sx) - sx);
+    int32_t ky = (int32_t)((my ^ sy) - sy);
+    uint32_t distance = kx > ky ? (uint32_t)kx - (uint32_t)ky : (uint32_t)ky - (uint32_t)kx;
+    return (mx > 0x7f800000u) | (my > 0x7f800000u) ? UINT32_MAX : distance;
+}
+
+static uint64_t fossil_test_ulp_f64(uint64_t x, uint64_t y) {
+    uint64_t mx = x & UINT64_C(0x7fffffffffffffff);
+    uint64_t my = y & UINT64_C(0x7fffffffffffffff);
+    uint64_t sx = UINT64_C(0) - (x >> 63);
+    uint64_t sy = UINT64_C(0) - (y >> 63);
+    int64_t kx = (int64_t)((mx ^ sx) - sx);
+    int64_t ky = (int64_t)((my ^ sy) - sy);
+    uint64_t distance = kx > ky ? (uint64_t)kx - (uint64_t)ky : (uint64_t)ky - (uint64_t)kx;
+    return (mx > UINT64_C(0x7ff0000000000000)) | (my > UINT64_C(0x7ff0000000000000)) ? UINT64_MAX : distance;
+}
+
+// Like the order scans these blocks are plain integer loops without
+// branches, which compilers vectorize.
+static void fossil_test_ulp_block_f32(const float *a, const float *e, size_t n, uint64_t ulps, fossil_test_block_error_t *out) {
+    uint32_t limit = ulps < UINT32_MAX ? (uint32_t)ulps : UINT32_MAX - 1;
+    uint32_t max = 0;
+    uint64_t sum = 0;
+    size_t failures = 0;
+    size_t nans = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t x;
+        uint32_t y;
+        memcpy(&x, a + i, sizeof(x));
+        memcpy(&y, e + i, sizeof(y));
+        uint32_t distance = fossil_test_ulp_f32(x, y);
+        max = distance > max ? distance : max;
+        sum += distance;
+        failures += distance > limit;
+        nans += distance == UINT32_MAX;
+    }
+    out->max = max == UINT32_MAX ? INFINITY : (double)max;
+    out->sum = nans > 0 ? INFINITY : (double)sum;
+    out->failures = failures;
+}
+
+static void fossil_test_ulp_block_f64(const double *a, const double *e, size_t n, uint64_t ulps, fossil_test_block_error_t *out) {
+    uint64_t limit = ulps < UINT64_MAX ? ulps : UINT64_MAX - 1;
+    uint64_t max = 0;
+    uint64_t sum = 0;
+    size_t failures = 0;
+    size_t nans = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t x;
+        uint64_t y;
+        memcpy(&x, a + i, sizeof(x));
+        memcpy(&y, e + i, sizeof(y));
+        uint64_t distance = fossil_test_ulp_f64(x, y);
+        max = distance > max ? distance : max;
+        sum += distance < FOSSIL_TEST_ULP_SUM_CAP ? distance : FOSSIL_TEST_ULP_SUM_CAP;
+        failures += distance > limit;
+        nans += distance == UINT64_MAX;
+    }
+    out->max = max == UINT64_MAX ? INFINITY : (double)max;
+    out->sum = nans > 0 ? INFINITY : (double)sum;
+    out->failures = failures;
+}
+
+// Error of one element, the scalar twin of the block kernels.
+static double fossil_test_float_error(fossil_test_array_type_t type, const void *actual, const void *expected, size_t index,
+                                      const fossil_test_tolerance_t *tolerance, bool *failed) {
+    if (tolerance->kind == FOSSIL_TEST_TOLERANCE_ULP) {
+        uint64_t distance;
+        if (type == FOSSIL_TEST_ARRAY_F32) {
+            uint32_t x;
+            uint32_t y;
+            memcpy(&x, (const float *)actual + index, sizeof(x));
+            memcpy(&y, (const float *)expected + index, sizeof(y));
+            uint32_t narrow = fossil_test_ulp_f32(x, y);
+            distance = narrow == UINT32_MAX ? UINT64_MAX : narrow;
+        } else {
+            uint64_t x;
+            uint64_t y;
+            memcpy(&x, (const double *)actual + index, sizeof(x));
+            memcpy(&y, (const double *)expected + index, sizeof(y));
+            distance = fossil_test_ulp_f64(x, y);
+        }
+        *failed = distance == UINT64_MAX || distance > tolerance->ulps;
+        return distance == UINT64_MAX ? INFINITY : (double)distance;
+    }
+
+    double difference;
+    if (type == FOSSIL_TEST_ARRAY_F32) {
+        float x = ((const float *)actual)[index];
+        float y = ((const float *)expected)[index];
+        float gap = x == y ? 0.0f : (x > y ? x - y : y - x);
+        float bound = (float)tolerance->absolute + (float)tolerance->relative * (y < 0.0f ? -y : y);
+        *failed = !(x == y || gap <= bound);
+        difference = gap;
+    } else {
+        double x = ((const double *)actual)[index];
+        double y = ((const double *)expected)[index];
+        double gap = x == y ? 0.0 : (x > y ? x - y : y - x);
+        double bound = tolerance->absolute + tolerance->relative * (y < 0.0 ? -y : y);
+        *failed = !(x == y || gap <= bound);
+        difference = gap;
+    }
+    return difference == difference ? difference : INFINITY;
+}
+
+static void fossil_test_float_tail(fossil_test_array_type_t type, const void *actual, const void *expected, size_t at, size_t n,
+                                   const fossil_test_tolerance_t *tolerance, fossil_test_block_error_t *out) {
+    for (; at < n; at++) {
+        bool failed;
+        double error = fossil_test_float_error(type, actual, expected, at, tolerance, &failed);
+        out->max = error > out->max ? error : out->max;
+        out->sum += error;
+        out->failures += failed;
+    }
+}
+
+// The close kernels take the difference, turn NaN into infinity and keep the
+// running maximum, sum and count of elements past the bound in registers.
+#ifdef FOSSIL_TEST_AVX2
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_close_f32_avx2(const float *a, const float *e, size_t n, float relative, float absolute,
+                                                                 fossil_test_block_error_t *out) {
+    const __m256 magnitude = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 infinity = _mm256_set1_ps(INFINITY);
+    const __m256 scale = _mm256_set1_ps(relative);
+    const __m256 least = _mm256_set1_ps(absolute);
+    __m256 max = _mm256_setzero_ps();
+    __m256 sum = _mm256_setzero_ps();
+    size_t at = 0;
+    for (; at + 8 <= n; at += 8) {
+        __m256 x = _mm256_loadu_ps(a + at);
+        __m256 y = _mm256_loadu_ps(e + at);
+        __m256 same = _mm256_cmp_ps(x, y, _CMP_EQ_OQ);
+        __m256 gap = _mm256_andnot_ps(same, _mm256_and_ps(_mm256_sub_ps(x, y), magnitude));
+        __m256 bound = _mm256_add_ps(least, _mm256_mul_ps(scale, _mm256_and_ps(y, magnitude)));
+        uint32_t inside = (uint32_t)_mm256_movemask_ps(_mm256_or_ps(same, _mm256_cmp_ps(gap, bound, _CMP_LE_OQ)));
+        gap = _mm256_blendv_ps(infinity, gap, _mm256_cmp_ps(gap, gap, _CMP_ORD_Q));
+        max = _mm256_max_ps(max, gap);
+        sum = _mm256_add_ps(sum, gap);
+        out->failures += fossil_test_bit_count(~inside & 0xffu);
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, max);
+    for (int i = 0; i < 8; i++) {
+        out->max = lanes[i] > out->max ? lanes[i] : out->max;
+    }
+    _mm256_storeu_ps(lanes, sum);
+    for (int i = 0; i < 8; i++) {
+        out->sum += lanes[i];
+    }
+    return at;
+}
+
+FOSSIL_TEST_TARGET_AVX2 static size_t fossil_test_close_f64_avx2(const double *a, const double *e, size_t n, double relative, double absolute,
+                                                                 fossil_test_block_error_t *out) {
+    const __m256d magnitude = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d infinity = _mm256_set1_pd(INFINITY);
+    const __m256d scale = _mm256_set1_pd(relative);
+    const __m256d least = _mm256_set1_pd(absolute);
+    __m256d max = _mm256_setzero_pd();
+    __m256d sum = _mm256_setzero_pd();
+    size_t at = 0;
+    for (; at + 4 <= n; at += 4) {
+        __m256d x = _mm256_loadu_pd(a + at);
+        __m256d y = _mm256_loadu_pd(e + at);
+        __m256d same = _mm256_cmp_pd(x, y, _CMP_EQ_OQ);
+        __m256d gap = _mm256_andnot_pd(same, _mm256_and_pd(_mm256_sub_pd(x, y), magnitude));
+        __m256d bound = _mm256_add_pd(least, _mm256_mul_pd(scale, _mm256_and_pd(y, magnitude)));
+        uint32_t inside = (uint32_t)_mm256_movemask_pd(_mm256_or_pd(same, _mm256_cmp_pd(gap, bound, _CMP_LE_OQ)));
+        gap = _mm256_blendv_pd(infinity, gap, _mm256_cmp_pd(gap, gap, _CMP_ORD_Q));
+        max = _mm256_max_pd(max, gap);
+        sum = _mm256_add_pd(sum, gap);
+        out->failures += fossil_test_bit_count(~inside & 0xfu);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, max);
+    for (int i = 0; i < 4; i++) {
+        out->max = lanes[i] > out->max ? lanes[i] : out->max;
+    }
+    _mm256_storeu_pd(lanes, sum);
+    for (int i = 0; i < 4; i++) {
+        out->sum += lanes[i];
+    }
+    return at;
+}
+#endif
+
+#if defined(FOSSIL_TEST_SSE2)
+static size_t fossil_test_close_f32_sse2(const float *a, const float *e, size_t n, float relative, float absolute,
+                                         fossil_test_block_error_t *out) {
+    const __m128 magnitude = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 infinity = _mm_set1_ps(INFINITY);
+    const __m128 scale = _mm_set1_ps(relative);
+    const __m128 least = _mm_set1_ps(absolute);
+    __m128 max = _mm_setzero_ps();
+    __m128 sum = _mm_setzero_ps();
+    size_t at = 0;
+    for (; at + 4 <= n; at += 4) {
+        __m128 x = _mm_loadu_ps(a + at);
+        __m128 y = _mm_loadu_ps(e + at);
+        __m128 same = _mm_cmpeq_ps(x, y);
+        __m128 gap = _mm_andnot_ps(same, _mm_and_ps(_mm_sub_ps(x, y), magnitude));
+        __m128 bound = _mm_add_ps(least, _mm_mul_ps(scale, _mm_and_ps(y, magnitude)));
+        uint32_t inside = (uint32_t)_mm_movemask_ps(_mm_or_ps(same, _mm_cmple_ps(gap, bound)));
+        __m128 number = _mm_cmpord_ps(gap, gap);
+        gap = _mm_or_ps(_mm_and_ps(number, gap), _mm_andnot_ps(number, infinity));
+        max = _mm_max_ps(max, gap);
+        sum = _mm_add_ps(sum, gap);
+        out->failures += fossil_test_bit_count(~inside & 0xfu);
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, max);
+    for (int i = 0; i < 4; i++) {
+        out->max = lanes[i] > out->max ? lanes[i] : out->max;
+    }
+    _mm_storeu_ps(lanes, sum);
+    for (int i = 0; i < 4; i++) {
+        out->sum += lanes[i];
+    }
+    return at;
+}
+
+static size_t fossil_test_close_f64_sse2(const double *a, const double *e, size_t n, double relative, double absolute,
+                                         fossil_test_block_error_t *out) {
+    const __m128d magnitude = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    const __m128d infinity = _mm_set1_pd(INFINITY);
+    const __m128d scale = _mm_set1_pd(relative);
+    const __m128d least = _mm_set1_pd(absolute);
+    __m128d max = _mm_setzero_pd();
+    __m128d sum = _mm_setzero_pd();
+    size_t at = 0;
+    for (; at + 2 <= n; at += 2) {
+        __m128d x = _mm_loadu_pd(a + at);
+        __m128d y = _mm_loadu_pd(e + at);
+        __m128d same = _mm_cmpeq_pd(x, y);
+        __m128d gap = _mm_andnot_pd(same, _mm_and_pd(_mm_sub_pd(x, y), magnitude));
+        __m128d bound = _mm_add_pd(least, _mm_mul_pd(scale, _mm_and_pd(y, magnitude)));
+        uint32_t inside = (uint32_t)_mm_movemask_pd(_mm_or_pd(same, _mm_cmple_pd(gap, bound)));
+        __m128d number = _mm_cmpord_pd(gap, gap);
+        gap = _mm_or_pd(_mm_and_pd(number, gap), _mm_andnot_pd(number, infinity));
+        max = _mm_max_pd(max, gap);
+        sum = _mm_add_pd(sum, gap);
+        out->failures += fossil_test_bit_count(~inside & 0x3u);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, max);
+    out->max = lanes[0] > out->max ? lanes[0] : out->max;
+    out->max = lanes[1] > out->max ? lanes[1] : out->max;
+    _mm_storeu_pd(lanes, sum);
+    out->sum += lanes[0] + lanes[1];
+    return at;
+}
+#elif defined(FOSSIL_TEST_NEON)
+static size_t fossil_test_close_f32_neon(const float *a, const float *e, size_t n, float relative, float absolute,
+                                         fossil_test_block_error_t *out) {
+    const float32x4_t infinity = vdupq_n_f32(INFINITY);
+    const float32x4_t scale = vdupq_n_f32(relative);
+    const float32x4_t least = vdupq_n_f32(absolute);
+    float32x4_t max = vdupq_n_f32(0.0f);
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    size_t at = 0;
+    for (; at + 4 <= n; at += 4) {
+        float32x4_t x = vld1q_f32(a + at);
+        float32x4_t y = vld1q_f32(e + at);
+        uint32x4_t same = vceqq_f32(x, y);
+        float32x4_t gap = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vabdq_f32(x, y)), same));
+        float32x4_t bound = vmlaq_f32(least, scale, vabsq_f32(y));
+        uint32x4_t inside = vorrq_u32(same, vcleq_f32(gap, bound));
+        gap = vbslq_f32(vceqq_f32(gap, gap), gap, infinity);
+        max = vmaxq_f32(max, gap);
+        sum = vaddq_f32(sum, gap);
+        out->failures += 4 - (size_t)vaddvq_u32(vshrq_n_u32(inside, 31));
+    }
+    float top = vmaxvq_f32(max);
+    out->max = top > out->max ? top : out->max;
+    out->sum += vaddvq_f32(sum);
+    return at;
+}
+
+static size_t fossil_test_close_f64_neon(const double *a, const double *e, size_t n, double relative, double absolute,
+                                         fossil_test_block_error_t *out) {
+    const float64x2_t infinity = vdupq_n_f64(INFINITY);
+    const float64x2_t scale = vdupq_n_f64(relative);
+    const float64x2_t least = vdupq_n_f64(absolute);
+    float64x2_t max = vdupq_n_f64(0.0);
+    float64x2_t sum = vdupq_n_f64(0.0);
+    size_t at = 0;
+    for (; at + 2 <= n; at += 2) {
+        float64x2_t x = vld1q_f64(a + at);
+        float64x2_t y = vld1q_f64(e + at);
+        uint64x2_t same = vceqq_f64(x, y);
+        float64x2_t gap = vreinterpretq_f64_u64(vbicq_u64(vreinterpretq_u64_f64(vabdq_f64(x, y)), same));
+        float64x2_t bound = vaddq_f64(least, vmulq_f64(scale, vabsq_f64(y)));
+        uint64x2_t inside = vorrq_u64(same, vcleq_f64(gap, bound));
+        gap = vbslq_f64(vceqq_f64(gap, gap), gap, infinity);
+        max = vmaxq_f64(max, gap);
+        sum = vaddq_f64(sum, gap);
+        out->failures += 2 - (size_t)vaddvq_u64(vshrq_n_u64(inside, 63));
+    }
+    double top = vmaxvq_f64(max);
+    out->max = top > out->max ? top : out->max;
+    out->sum += vaddvq_f64(sum);
+    return at;
+}
+#endif
+
+static void fossil_test_float_block(fossil_test_array_type_t type, const void *actual, const void *expected, size_t n,
+                                    const fossil_test_tolerance_t *tolerance, fossil_test_block_error_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (tolerance->kind == FOSSIL_TEST_TOLERANCE_ULP) {
+        if (type == FOSSIL_TEST_ARRAY_F32) {
+            fossil_test_ulp_block_f32((const float *)actual, (const float *)expected, n, tolerance->ulps, out);
+        } else {
+            fossil_test_ulp_block_f64((const double *)actual, (const double *)expected, n, tolerance->ulps, out);
+        }
+        return;
+    }
+
+    size_t at = 0;
+    if (type == FOSSIL_TEST_ARRAY_F32) {
+        const float *a = (const float *)actual;
+        const float *e = (const float *)expected;
+        float relative = (float)tolerance->relative;
+        float absolute = (float)tolerance->absolute;
+#ifdef FOSSIL_TEST_AVX2
+        if (fossil_test_cpu_avx2()) {
+            at = fossil_test_close_f32_avx2(a, e, n, relative, absolute, out);
+        }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+        at += fossil_test_close_f32_sse2(a + at, e + at, n - at, relative, absolute, out);
+#elif defined(FOSSIL_TEST_NEON)
+        at = fossil_test_close_f32_neon(a, e, n, relative, absolute, out);
+#endif
+        (void)a;
+        (void)e;
+        (void)relative;
+        (void)absolute;
+    } else {
+        const double *a = (const double *)actual;
+        const double *e = (const double *)expected;
+#ifdef FOSSIL_TEST_AVX2
+        if (fossil_test_cpu_avx2()) {
+            at = fossil_test_close_f64_avx2(a, e, n, tolerance->relative, tolerance->absolute, out);
+        }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+        at += fossil_test_close_f64_sse2(a + at, e + at, n - at, tolerance->relative, tolerance->absolute, out);
+#elif defined(FOSSIL_TEST_NEON)
+        at = fossil_test_close_f64_neon(a, e, n, tolerance->relative, tolerance->absolute, out);
+#endif
+        (void)a;
+        (void)e;
+    }
+    fossil_test_float_tail(type, actual, expected, at, n, tolerance, out);
+}
+
+static size_t fossil_test_memory_range(const fossil_test_memory_job_t *job, size_t start, size_t end) {
+    if (job->tile == xnullptr) {
+        return start + fossil_test_bytes_mismatch(job->data + start, job->expected + start, end - start);
+    }
+    while (start < end) {
+        size_t step = end - start < job->tile_size ? end - start : job->tile_size;
+        size_t index = fossil_test_bytes_mismatch(job->data + start, job->tile + start % job->pattern_size, step);
+        if (index < step) {
+            return start + index;
+        }
+        start += step;
+    }
+    return end;
+}
+
+static void* fossil_test_memory_worker(void *arg) {
+    fossil_test_memory_job_t *job = (fossil_test_memory_job_t *)arg;
+    for (;;) {
+        uint64_t start = fossil_atomic_fetch_add_u64(&job->next, FOSSIL_TEST_MEMORY_CHUNK);
+        // Chunks are handed out in order, so once one fails nothing after it
+        // can be the first difference.
+        if (start >= job->size || start > fossil_atomic_load_u64(&job->failing)) {
+            break;
+        }
+        size_t end = job->size - start > FOSSIL_TEST_MEMORY_CHUNK ? (size_t)start + FOSSIL_TEST_MEMORY_CHUNK : job->size;
+        uint64_t index = fossil_test_memory_range(job, (size_t)start, end);
+        if (index < end) {
+            uint64_t current = fossil_atomic_load_u64(&job->failing);
+            while (index < current && !fossil_atomic_compare_exchange_u64(&job->failing, &current, index)) {
+            }
+        }
+    }
+    return xnullptr;
+}
+
+static size_t fossil_test_memory_run(fossil_test_memory_job_t *job) {
+    if (job->size < FOSSIL_TEST_MEMORY_PARALLEL) {
+        return fossil_test_memory_range(job, 0, job->size);
+    }
+    job->next = 0;
+    job->failing = UINT64_MAX;
+
+    int32_t cpus = _fossil_test_get_num_cpus();
+    size_t thread_count = cpus > 0 ? (size_t)cpus : 1;
+    if (thread_count > FOSSIL_TEST_MEMORY_THREADS) {
+        thread_count = FOSSIL_TEST_MEMORY_THREADS;
+    }
+
+    // The calling thread works too, so one core needs no extra thread.
+    fossil_thread_t threads[FOSSIL_TEST_MEMORY_THREADS];
+    size_t started = 0;
+    for (size_t i = 1; i < thread_count; i++) {
+        if (fossil_thread_create(&threads[started], fossil_test_memory_worker, job) == 0) {
+            started++;
+        }
+    }
+    fossil_test_memory_worker(job);
+    for (size_t i = 0; i < started; i++) {
+        fossil_thread_join(threads[i]);
+    }
+    return job->failing < job->size ? (size_t)job->failing : job->size;
+}
+
+static uint8_t fossil_test_memory_expected(const fossil_test_memory_job_t *job, size_t at) {
+    return job->tile != xnullptr ? job->tile[at % job->pattern_size] : job->expected[at];
+}
+
+// Hexdump the rows from the first difference on, as long as they keep
+// differing, with the expected bytes below and a caret under every change.
+static size_t fossil_test_memory_dump(char *out, size_t capacity, const fossil_test_memory_job_t *job, size_t index) {
+    size_t used = 0;
+    size_t row = index - index % FOSSIL_TEST_MEMORY_ROW;
+    size_t rows = 0;
+    for (; row < job->size && rows < FOSSIL_TEST_MEMORY_ROWS; row += FOSSIL_TEST_MEMORY_ROW, rows++) {
+        size_t end = job->size - row > FOSSIL_TEST_MEMORY_ROW ? row + FOSSIL_TEST_MEMORY_ROW : job->size;
+        char actual[3 * FOSSIL_TEST_MEMORY_ROW + 1];
+        char expected[3 * FOSSIL_TEST_MEMORY_ROW + 1];
+        char marks[3 * FOSSIL_TEST_MEMORY_ROW + 1];
+        bool differs = false;
+        for (size_t at = row; at < end; at++) {
+            uint8_t have = job->data[at];
+            uint8_t want = fossil_test_memory_expected(job, at);
+            size_t column = 3 * (at - row);
+            snprintf(actual + column, 4, "%02x ", have);
+            snprintf(expected + column, 4, "%02x ", want);
+            memcpy(marks + column, have != want ? "^^ " : "   ", 3);
+            differs = differs || have != want;
+        }
+        size_t width = 3 * (end - row) - 1;
+        actual[width] = expected[width] = marks[width] = '\0';
+        while (width > 0 && marks[width - 1] == ' ') {
+            marks[--width] = '\0';
+        }
+        if (!differs) {
+            break;
+        }
+        if (used + 4 * sizeof(actual) >= capacity) {
+            break;
+        }
+        used += (size_t)snprintf(out + used, capacity - used, "\n    %08zx  - %s\n              + %s\n                %s",
+                                 row, actual, expected, marks);
+    }
+    if (row < job->size && used + 96 < capacity) {
+        fossil_test_memory_job_t rest = *job;
+        rest.data += row;
+        rest.size -= row;
+        if (rest.tile != xnullptr) {
+            rest.tile += row % rest.pattern_size;
+        } else {
+            rest.expected += row;
+        }
+        size_t next = fossil_test_memory_run(&rest);
+        if (next < rest.size) {
+            used += (size_t)snprintf(out + used, capacity - used, "\n    next difference at offset 0x%zx", row + next);
+        }
+    }
+    return used;
+}
+
+static void fossil_test_array_score(xassert_type_t behavior, bool passed, const char *message, const char *file, int line, const char *func) {
+    if (passed && !_ASSERT_INFO.should_fail) {
+        _fossil_test_pass_count++;
+        return;
+    }
+    _fossil_test_assert_class(passed, behavior, (char*)message, (char*)file, line, (char*)func);
+}
+
+static uint8_t* fossil_test_memory_tile(fossil_test_memory_job_t *job, const void *pattern, size_t pattern_size) {
+    size_t copies = FOSSIL_TEST_MEMORY_TILE / pattern_size + 1;
+    uint8_t *tile = (uint8_t *)malloc((copies + 2) * pattern_size);
+    if (tile == xnullptr) {
+        perror("Failed to allocate memory for pattern comparison");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < copies + 2; i++) {
+        memcpy(tile + i * pattern_size, pattern, pattern_size);
+    }
+    job->tile = tile;
+    job->pattern_size = pattern_size;
+    job->tile_size = copies * pattern_size;
+    return tile;
+}
+
+static void fossil_test_memory_check(xassert_type_t behavior, fossil_test_memory_job_t *job,
+                                     const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_array_message;
+    size_t index = fossil_test_memory_run(job);
+    if (index >= job->size) {
+        fossil_test_array_score(behavior, true, names, file, line, func);
+        return;
+    }
+
+    size_t used = (size_t)snprintf(message, sizeof(fossil_test_array_message),
+                                   "Expected %s, first difference at offset 0x%zx of %zu bytes", names, index, job->size);
+    if (used < sizeof(fossil_test_array_message)) {
+        fossil_test_memory_dump(message + used, sizeof(fossil_test_array_message) - used, job, index);
+    }
+    fossil_test_array_score(behavior, false, message, file, line, func);
+}
+
+//
+// public functions
+//
+
+size_t fossil_test_array_mismatch(fossil_test_array_type_t type, const void *actual, const void *expected, size_t count, double tolerance) {
+    if (type == FOSSIL_TEST_ARRAY_F32) {
+        return fossil_test_f32_mismatch((const float *)actual, (const float *)expected, count, (float)tolerance);
+    }
+    if (type == FOSSIL_TEST_ARRAY_F64) {
+        return fossil_test_f64_mismatch((const double *)actual, (const double *)expected, count, tolerance);
+    }
+    size_t width = fossil_test_array_width(type);
+    return fossil_test_bytes_mismatch((const uint8_t *)actual, (const uint8_t *)expected, count * width) / width;
+}
+
+size_t fossil_test_array_unsorted(fossil_test_array_type_t type, const void *data, size_t count) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8:  return fossil_test_unsorted_i8((const int8_t *)data, count);
+        case FOSSIL_TEST_ARRAY_I16: return fossil_test_unsorted_i16((const int16_t *)data, count);
+        case FOSSIL_TEST_ARRAY_I32: return fossil_test_unsorted_i32((const int32_t *)data, count);
+        case FOSSIL_TEST_ARRAY_I64: return fossil_test_unsorted_i64((const int64_t *)data, count);
+        case FOSSIL_TEST_ARRAY_U8:  return fossil_test_unsorted_u8((const uint8_t *)data, count);
+        case FOSSIL_TEST_ARRAY_U16: return fossil_test_unsorted_u16((const uint16_t *)data, count);
+        case FOSSIL_TEST_ARRAY_U32: return fossil_test_unsorted_u32((const uint32_t *)data, count);
+        case FOSSIL_TEST_ARRAY_U64: return fossil_test_unsorted_u64((const uint64_t *)data, count);
+        case FOSSIL_TEST_ARRAY_F32: return fossil_test_unsorted_f32((const float *)data, count);
+        case FOSSIL_TEST_ARRAY_F64:
+        default:                    return fossil_test_unsorted_f64((const double *)data, count);
+    }
+}
+
+size_t fossil_test_array_outside(fossil_test_array_type_t type, const void *data, size_t count, fossil_test_scalar_t min, fossil_test_scalar_t max) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8:  return fossil_test_outside_i8((const int8_t *)data, count, min.i, max.i);
+        case FOSSIL_TEST_ARRAY_I16: return fossil_test_outside_i16((const int16_t *)data, count, min.i, max.i);
+        case FOSSIL_TEST_ARRAY_I32: return fossil_test_outside_i32((const int32_t *)data, count, min.i, max.i);
+        case FOSSIL_TEST_ARRAY_I64: return fossil_test_outside_i64((const int64_t *)data, count, min.i, max.i);
+        case FOSSIL_TEST_ARRAY_U8:  return fossil_test_outside_u8((const uint8_t *)data, count, min.u, max.u);
+        case FOSSIL_TEST_ARRAY_U16: return fossil_test_outside_u16((const uint16_t *)data, count, min.u, max.u);
+        case FOSSIL_TEST_ARRAY_U32: return fossil_test_outside_u32((const uint32_t *)data, count, min.u, max.u);
+        case FOSSIL_TEST_ARRAY_U64: return fossil_test_outside_u64((const uint64_t *)data, count, min.u, max.u);
+        case FOSSIL_TEST_ARRAY_F32: return fossil_test_outside_f32((const float *)data, count, min.f, max.f);
+        case FOSSIL_TEST_ARRAY_F64:
+        default:                    return fossil_test_outside_f64((const double *)data, count, min.f, max.f);
+    }
+}
+
+void _fossil_test_array_equal(xassert_type_t behavior, fossil_test_array_type_t type, const void *actual, const void *expected,
+                              size_t count, double tolerance, const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_array_message;
+    if (count > 0 && (actual == xnullptr || expected == xnullptr)) {
+        snprintf(message, sizeof(fossil_test_array_message), "Expected %s, but an array is xnull", names);
+        fossil_test_array_score(behavior, false, message, file, line, func);
+        return;
+    }
+    size_t index = count > 0 ? fossil_test_array_mismatch(type, actual, expected, count, tolerance) : 0;
+    if (index >= count) {
+        fossil_test_array_score(behavior, true, names, file, line, func);
+        return;
+    }
+
+    char value[48];
+    char reference[48];
+    fossil_test_array_format(type, actual, index, value, sizeof(value));
+    fossil_test_array_format(type, expected, index, reference, sizeof(reference));
+    size_t used = (size_t)snprintf(message, sizeof(fossil_test_array_message),
+                                   "Expected %s, first mismatch at index %zu of %zu: %s != %s",
+                                   names, index, count, value, reference);
+    if (used < sizeof(fossil_test_array_message)) {
+        fossil_test_array_window(message + used, sizeof(fossil_test_array_message) - used, type, actual, expected, count, index);
+    }
+    fossil_test_array_score(behavior, false, message, file, line, func);
+}
+
+void _fossil_test_array_sorted(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count,
+                               const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_array_message;
+    if (count > 0 && data == xnullptr) {
+        snprintf(message, sizeof(fossil_test_array_message), "Expected %s, but the array is xnull", names);
+        fossil_test_array_score(behavior, false, message, file, line, func);
+        return;
+    }
+    size_t index = fossil_test_array_unsorted(type, data, count);
+    if (index >= count) {
+        fossil_test_array_score(behavior, true, names, file, line, func);
+        return;
+    }
+
+    size_t used = (size_t)snprintf(message, sizeof(fossil_test_array_message),
+                                   "Expected %s, index %zu of %zu is smaller than the element before it", names, index, count);
+    if (used < sizeof(fossil_test_array_message)) {
+        fossil_test_array_window(message + used, sizeof(fossil_test_array_message) - used, type, data, xnullptr, count, index);
+    }
+    fossil_test_array_score(behavior, false, message, file, line, func);
+}
+
+void _fossil_test_array_within(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count,
+                               fossil_test_scalar_t min, fossil_test_scalar_t max, const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_array_message;
+    if (count > 0 && data == xnullptr) {
+        snprintf(message, sizeof(fossil_test_array_message), "Expected %s, but the array is xnull", names);
+        fossil_test_array_score(behavior, false, message, file, line, func);
+        return;
+    }
+    size_t index = fossil_test_array_outside(type, data, count, min, max);
+    if (index >= count) {
+        fossil_test_array_score(behavior, true, names, file, line, func);
+        return;
+    }
+
+    char value[48];
+    char low[48];
+    char high[48];
+    fossil_test_array_format(type, data, index, value, sizeof(value));
+    fossil_test_scalar_format(type, min, low, sizeof(low));
+    fossil_test_scalar_format(type, max, high, sizeof(high));
+    size_t used = (size_t)snprintf(message, sizeof(fossil_test_array_message),
+                                   "Expected %s, index %zu of %zu holds %s outside [%s, %s]", names, index, count, value, low, high);
+    if (used < sizeof(fossil_test_array_message)) {
+        fossil_test_array_window(message + used, sizeof(fossil_test_array_message) - used, type, data, xnullptr, count, index);
+    }
+    fossil_test_array_score(behavior, false, message, file, line, func);
+}
+
+void fossil_test_float_measure(fossil_test_array_type_t type, const void *actual, size_t actual_stride,
+                               const void *expected, size_t expected_stride, size_t rows, size_t columns,
+                               const fossil_test_tolerance_t *tolerance, fossil_test_float_error_t *error) {
+    memset(error, 0, sizeof(*error));
+    size_t width = fossil_test_array_width(type);
+    double sum = 0.0;
+    double worst = -1.0;
+    size_t worst_start = 0;
+    size_t worst_count = 0;
+
+    // Blocks only report their largest error, the block holding the overall
+    // largest is walked again at the end to find the element.
+    for (size_t row = 0; row < rows; row++) {
+        const uint8_t *a = (const uint8_t *)actual + row * actual_stride * width;
+        const uint8_t *e = (const uint8_t *)expected + row * expected_stride * width;
+        for (size_t start = 0; start < columns; start += FOSSIL_TEST_ARRAY_BLOCK) {
+            size_t n = columns - start > FOSSIL_TEST_ARRAY_BLOCK ? FOSSIL_TEST_ARRAY_BLOCK : columns - start;
+            fossil_test_block_error_t block;
+            fossil_test_float_block(type, a + start * width, e + start * width, n, tolerance, &block);
+            sum += block.sum;
+            error->failures += block.failures;
+            if (block.max > worst) {
+                worst = block.max;
+                error->worst_row = row;
+                worst_start = start;
+                worst_count = n;
+            }
+        }
+    }
+    error->count = rows * columns;
+    if (error->count == 0) {
+        return;
+    }
+
+    const uint8_t *a = (const uint8_t *)actual + error->worst_row * actual_stride * width + worst_start * width;
+    const uint8_t *e = (const uint8_t *)expected + error->worst_row * expected_stride * width + worst_start * width;
+    error->max_error = -1.0;
+    for (size_t at = 0; at < worst_count; at++) {
+        bool failed;
+        double value = fossil_test_float_error(type, a, e, at, tolerance, &failed);
+        if (value > error->max_error) {
+            error->max_error = value;
+            error->worst_column = worst_start + at;
+        }
+    }
+    error->mean_error = sum / (double)error->count;
+}
+
+void _fossil_test_float_check(xassert_type_t behavior, fossil_test_array_type_t type, const void *actual, size_t actual_stride,
+                              const void *expected, size_t expected_stride, size_t rows, size_t columns,
+                              fossil_test_tolerance_t tolerance, const char *names, const char *file, int line, const char *func) {
+    char *message = fossil_test_array_message;
+    if (rows * columns > 0 && (actual == xnullptr || expected == xnullptr)) {
+        snprintf(message, sizeof(fossil_test_array_message), "Expected %s, but an array is xnull", names);
+        fossil_test_array_score(behavior, false, message, file, line, func);
+        return;
+    }
+    fossil_test_float_error_t error;
+    fossil_test_float_measure(type, actual, actual_stride, expected, expected_stride, rows, columns, &tolerance, &error);
+    if (error.failures == 0) {
+        fossil_test_array_score(behavior, true, names, file, line, func);
+        return;
+    }
+
+    size_t width = fossil_test_array_width(type);
+    const void *have = (const uint8_t *)actual + error.worst_row * actual_stride * width;
+    const void *want = (const uint8_t *)expected + error.worst_row * expected_stride * width;
+    char value[48];
+    char reference[48];
+    char where[48];
+    fossil_test_array_format(type, have, error.worst_column, value, sizeof(value));
+    fossil_test_array_format(type, want, error.worst_column, reference, sizeof(reference));
+    if (rows > 1) {
+        snprintf(where, sizeof(where), "[%zu][%zu]", error.worst_row, error.worst_column);
+    } else {
+        snprintf(where, sizeof(where), "[%zu]", error.worst_column);
+    }
+    const char *unit = tolerance.kind == FOSSIL_TEST_TOLERANCE_ULP ? " ULP" : "";
+    snprintf(message, sizeof(fossil_test_array_message),
+             "Expected %s, %zu of %zu elements are outside the tolerance\n"
+             "    max error %.6g%s at %s: %s != %s\n"
+             "    mean error %.6g%s",
+             names, error.failures, error.count, error.max_error, unit, where, value, reference, error.mean_error, unit);
+    fossil_test_array_score(behavior, false, message, file, line, func);
+}
+
+size_t fossil_test_memory_mismatch(const void *actual, const void *expected, size_t size) {
+    fossil_test_memory_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.data = (const uint8_t *)actual;
+    job.expected = (const uint8_t *)expected;
+    job.size = size;
+    return fossil_test_memory_run(&job);
+}
+
+size_t fossil_test_memory_unlike(const void *data, size_t size, const void *pattern, size_t pattern_size) {
+    if (pattern == xnullptr || pattern_size == 0) {
+        return 0;
+    }
+    fossil_test_memory_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.data = (const uint8_t *)data;
+    job.size = size;
+    uint8_t *tile = fossil_test_memory_tile(&job, pattern, pattern_size);
+    size_t index = fossil_test_memory_run(&job);
+    free(tile);
+    return index;
+}
+
+size_t fossil_test_memory_find(const void *data, size_t size, const void *needle, size_t needle_size) {
+    if (needle_size == 0) {
+        return 0;
+    }
+    if (data == xnullptr || needle == xnullptr || needle_size > size) {
+        return size;
+    }
+    return fossil_test_bytes_find((const uint8_t *)data, size, (const uint8_t *)needle, needle_size);
+}
+
+void _fossil_test_memory_equal(xassert_type_t behavior, const void *actual, const void *expected, size_t size,
+                               const char *names, const char *file, int line, const char *func) {
+    if (size > 0 && (actual == xnullptr || expected == xnullptr)) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message), "Expected %s, but a buffer is xnull", names);
+        fossil_test_array_score(behavior, false, fossil_test_array_message, file, line, func);
+        return;
+    }
+    fossil_test_memory_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.data = (const uint8_t *)actual;
+    job.expected = (const uint8_t *)expected;
+    job.size = size;
+    fossil_test_memory_check(behavior, &job, names, file, line, func);
+}
+
+void _fossil_test_memory_pattern(xassert_type_t behavior, const void *data, size_t size, const void *pattern, size_t pattern_size,
+                                 const char *names, const char *file, int line, const char *func) {
+    if ((size > 0 && data == xnullptr) || pattern == xnullptr || pattern_size == 0) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message), "Expected %s, but the buffer or pattern is empty", names);
+        fossil_test_array_score(behavior, false, fossil_test_array_message, file, line, func);
+        return;
+    }
+    fossil_test_memory_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.data = (const uint8_t *)data;
+    job.size = size;
+    uint8_t *tile = fossil_test_memory_tile(&job, pattern, pattern_size);
+    fossil_test_memory_check(behavior, &job, names, file, line, func);
+    free(tile);
+}
+
+//
+// statistical checks
+//
+
+#define FOSSIL_TEST_WIDEN(ctype) \
+    for (size_t i = 0; i < count; i++) { \
+        buffer[i] = (double)((const ctype *)data)[at + i]; \
+    } \
+    break
+
+// Elements at through at + count of a sample as doubles, F64 samples are
+// used in place and everything else is widened into buffer.
+static const double* fossil_test_stat_widen(fossil_test_array_type_t type, const void *data, size_t at, size_t count, double *buffer) {
+    switch (type) {
+        case FOSSIL_TEST_ARRAY_I8: FOSSIL_TEST_WIDEN(int8_t);
+        case FOSSIL_TEST_ARRAY_I16: FOSSIL_TEST_WIDEN(int16_t);
+        case FOSSIL_TEST_ARRAY_I32: FOSSIL_TEST_WIDEN(int32_t);
+        case FOSSIL_TEST_ARRAY_I64: FOSSIL_TEST_WIDEN(int64_t);
+        case FOSSIL_TEST_ARRAY_U8: FOSSIL_TEST_WIDEN(uint8_t);
+        case FOSSIL_TEST_ARRAY_U16: FOSSIL_TEST_WIDEN(uint16_t);
+        case FOSSIL_TEST_ARRAY_U32: FOSSIL_TEST_WIDEN(uint32_t);
+        case FOSSIL_TEST_ARRAY_U64: FOSSIL_TEST_WIDEN(uint64_t);
+        case FOSSIL_TEST_ARRAY_F32: FOSSIL_TEST_WIDEN(float);
+        case FOSSIL_TEST_ARRAY_F64:
+        default:
+            return (const double *)data + at;
+    }
+    return buffer;
+}
+
+#undef FOSSIL_TEST_WIDEN
+
+// Sum, smallest and largest element of a block.
+static double fossil_test_block_sum_scalar(const double *x, size_t count, size_t at, double sum, double *low, double *high) {
+    for (; at < count; at++) {
+        sum += x[at];
+        *low = x[at] < *low ? x[at] : *low;
+        *high = x[at] > *high ? x[at] : *high;
+    }
+    return sum;
+}
+
+static double fossil_test_block_m2_scalar(const double *x, size_t count, size_t at, double mean) {
+    double lanes[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (; at + 4 <= count; at += 4) {
+        for (size_t lane = 0; lane < 4; lane++) {
+            double delta = x[at + lane] - mean;
+            lanes[lane] += delta * delta;
+        }
+    }
+    for (; at < count; at++) {
+        lanes[0] += (x[at] - mean) * (x[at] - mean);
+    }
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+#ifdef FOSSIL_TEST_AVX2
+FOSSIL_TEST_TARGET_AVX2 static double fossil_test_block_sum_avx2(const double *x, size_t count, double *low, double *high) {
+    __m256d sum = _mm256_setzero_pd();
+    __m256d least = _mm256_set1_pd(*low);
+    __m256d most = _mm256_set1_pd(*high);
+    size_t at = 0;
+    for (; at + 4 <= count; at += 4) {
+        __m256d value = _mm256_loadu_pd(x + at);
+        sum = _mm256_add_pd(sum, value);
+        least = _mm256_min_pd(least, value);
+        most = _mm256_max_pd(most, value);
+    }
+    double lanes[4];
+    double lows[4];
+    double highs[4];
+    _mm256_storeu_pd(lanes, sum);
+    _mm256_storeu_pd(lows, least);
+    _mm256_storeu_pd(highs, most);
+    for (size_t lane = 0; lane < 4; lane++) {
+        *low = lows[lane] < *low ? lows[lane] : *low;
+        *high = highs[lane] > *high ? highs[lane] : *high;
+    }
+    return fossil_test_block_sum_scalar(x, count, at, (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]), low, high);
+}
+
+FOSSIL_TEST_TARGET_AVX2 static double fossil_test_block_m2_avx2(const double *x, size_t count, double mean) {
+    const __m256d center = _mm256_set1_pd(mean);
+    __m256d m2 = _mm256_setzero_pd();
+    size_t at = 0;
+    for (; at + 4 <= count; at += 4) {
+        __m256d delta = _mm256_sub_pd(_mm256_loadu_pd(x + at), center);
+        m2 = _mm256_add_pd(m2, _mm256_mul_pd(delta, delta));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, m2);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + fossil_test_block_m2_scalar(x, count, at, mean);
+}
+#endif
+
+#ifdef FOSSIL_TEST_SSE2
+static double fossil_test_block_sum_sse2(const double *x, size_t count, double *low, double *high) {
+    __m128d sum = _mm_setzero_pd();
+    __m128d least = _mm_set1_pd(*low);
+    __m128d most = _mm_set1_pd(*high);
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        __m128d value = _mm_loadu_pd(x + at);
+        sum = _mm_add_pd(sum, value);
+        least = _mm_min_pd(least, value);
+        most = _mm_max_pd(most, value);
+    }
+    double lanes[2];
+    double lows[2];
+    double highs[2];
+    _mm_storeu_pd(lanes, sum);
+    _mm_storeu_pd(lows, least);
+    _mm_storeu_pd(highs, most);
+    for (size_t lane = 0; lane < 2; lane++) {
+        *low = lows[lane] < *low ? lows[lane] : *low;
+        *high = highs[lane] > *high ? highs[lane] : *high;
+    }
+    return fossil_test_block_sum_scalar(x, count, at, lanes[0] + lanes[1], low, high);
+}
+
+static double fossil_test_block_m2_sse2(const double *x, size_t count, double mean) {
+    const __m128d center = _mm_set1_pd(mean);
+    __m128d m2 = _mm_setzero_pd();
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        __m128d delta = _mm_sub_pd(_mm_loadu_pd(x + at), center);
+        m2 = _mm_add_pd(m2, _mm_mul_pd(delta, delta));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, m2);
+    return lanes[0] + lanes[1] + fossil_test_block_m2_scalar(x, count, at, mean);
+}
+#endif
+
+#ifdef FOSSIL_TEST_NEON
+static double fossil_test_block_sum_neon(const double *x, size_t count, double *low, double *high) {
+    float64x2_t sum = vdupq_n_f64(0.0);
+    float64x2_t least = vdupq_n_f64(*low);
+    float64x2_t most = vdupq_n_f64(*high);
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        float64x2_t value = vld1q_f64(x + at);
+        sum = vaddq_f64(sum, value);
+        least = vminq_f64(least, value);
+        most = vmaxq_f64(most, value);
+    }
+    *low = vminvq_f64(least);
+    *high = vmaxvq_f64(most);
+    return fossil_test_block_sum_scalar(x, count, at, vaddvq_f64(sum), low, high);
+}
+
+static double fossil_test_block_m2_neon(const double *x, size_t count, double mean) {
+    const float64x2_t center = vdupq_n_f64(mean);
+    float64x2_t m2 = vdupq_n_f64(0.0);
+    size_t at = 0;
+    for (; at + 2 <= count; at += 2) {
+        float64x2_t delta = vsubq_f64(vld1q_f64(x + at), center);
+        m2 = vfmaq_f64(m2, delta, delta);
+    }
+    return vaddvq_f64(m2) + fossil_test_block_m2_scalar(x, count, at, mean);
+}
+#endif
+
+// Mean and squared deviations of one block, it is read twice while it is
+// still in cache.
+static void fossil_test_block_moments(const double *x, size_t count, double *mean, double *m2, double *low, double *high) {
+    double sum;
+#if defined(FOSSIL_TEST_AVX2)
+    if (fossil_test_cpu_avx2()) {
+        sum = fossil_test_block_sum_avx2(x, count, low, high);
+        *mean = sum / (double)count;
+        *m2 = fossil_test_block_m2_avx2(x, count, *mean);
+        return;
+    }
+#endif
+#if defined(FOSSIL_TEST_SSE2)
+    sum = fossil_test_block_sum_sse2(x, count, low, high);
+    *mean = sum / (double)count;
+    *m2 = fossil_test_block_m2_sse2(x, count, *mean);
+#elif defined(FOSSIL_TEST_NEON)
+    sum = fossil_test_block_sum_neon(x, count, low, high);
+    *mean = sum / (double)count;
+    *m2 = fossil_test_block_m2_neon(x, count, *mean);
+#else
+    sum = fossil_test_block_sum_scalar(x, count, 0, 0.0, low, high);
+    *mean = sum / (double)count;
+    *m2 = fossil_test_block_m2_scalar(x, count, 0, *mean);
+#endif
+}
+
+// A widened copy of a sample, or xnull when it holds NaN.
+static double* fossil_test_stat_copy(fossil_test_array_type_t type, const void *data, size_t count) {
+    double *copy = (double *)malloc((count > 0 ? count : 1) * sizeof(double));
+    if (copy == xnullptr) {
+        perror("Failed to allocate memory for sample");
+        exit(EXIT_FAILURE);
+    }
+    bool clean = true;
+    for (size_t at = 0; at < count; at += FOSSIL_TEST_ARRAY_BLOCK) {
+        size_t length = count - at < FOSSIL_TEST_ARRAY_BLOCK ? count - at : FOSSIL_TEST_ARRAY_BLOCK;
+        const double *block = fossil_test_stat_widen(type, data, at, length, copy + at);
+        if (block != copy + at) {
+            memcpy(copy + at, block, length * sizeof(double));
+        }
+        for (size_t i = 0; i < length; i++) {
+            clean = clean && copy[at + i] == copy[at + i];
+        }
+    }
+    if (!clean) {
+        free(copy);
+        return xnullptr;
+    }
+    return copy;
+}
+
+// Hoare partitioning around a median of three until the k-th smallest value
+// is in place, everything after it is no smaller.
+static double fossil_test_stat_select(double *values, size_t count, size_t k) {
+    ptrdiff_t low = 0;
+    ptrdiff_t high = (ptrdiff_t)count - 1;
+    while (low < high) {
+        ptrdiff_t middle = low + (high - low) / 2;
+        double a = values[low];
+        double b = values[middle];
+        double c = values[high];
+        double pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+        ptrdiff_t i = low;
+        ptrdiff_t j = high;
+        while (i <= j) {
+            while (values[i] < pivot) {
+                i++;
+            }
+            while (values[j] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                double swap = values[i];
+                values[i] = values[j];
+                values[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        if ((ptrdiff_t)k <= j) {
+            high = j;
+        } else if ((ptrdiff_t)k >= i) {
+            low = i;
+        } else {
+            break;
+        }
+    }
+    return values[k];
+}
+
+static int fossil_test_stat_order(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Probability that the Kolmogorov distribution exceeds lambda.
+static double fossil_test_stat_kolmogorov(double lambda) {
+    double exponent = -2.0 * lambda * lambda;
+    double sign = 2.0;
+    double sum = 0.0;
+    double previous = 0.0;
+    for (int j = 1; j <= 100; j++) {
+        double term = sign * exp(exponent * j * j);
+        sum += term;
+        if (fabs(term) <= 0.001 * previous || fabs(term) <= 1.0e-8 * sum) {
+            return sum < 0.0 ? 0.0 : (sum > 1.0 ? 1.0 : sum);
+        }
+        sign = -sign;
+        previous = fabs(term);
+    }
+    return 1.0;
+}
+
+void fossil_test_array_moments(fossil_test_array_type_t type, const void *data, size_t count, fossil_test_moments_t *moments) {
+    double buffer[FOSSIL_TEST_ARRAY_BLOCK];
+    double mean = 0.0;
+    double m2 = 0.0;
+    double low = INFINITY;
+    double high = -INFINITY;
+    size_t seen = 0;
+    for (size_t at = 0; data != xnullptr && at < count; at += FOSSIL_TEST_ARRAY_BLOCK) {
+        size_t length = count - at < FOSSIL_TEST_ARRAY_BLOCK ? count - at : FOSSIL_TEST_ARRAY_BLOCK;
+        const double *block = fossil_test_stat_widen(type, data, at, length, buffer);
+        double block_mean;
+        double block_m2;
+        fossil_test_block_moments(block, length, &block_mean, &block_m2, &low, &high);
+
+        // Chan's update merges the block into the running totals.
+        size_t total = seen + length;
+        double delta = block_mean - mean;
+        mean += delta * ((double)length / (double)total);
+        m2 += block_m2 + delta * delta * ((double)seen * (double)length / (double)total);
+        seen = total;
+    }
+    moments->count = seen;
+    moments->mean = seen > 0 ? mean : NAN;
+    moments->variance = seen > 1 ? m2 / (double)(seen - 1) : (seen == 1 ? 0.0 : NAN);
+    moments->min = seen > 0 ? low : NAN;
+    moments->max = seen > 0 ? high : NAN;
+}
+
+double fossil_test_array_percentile(fossil_test_array_type_t type, const void *data, size_t count, double percentile) {
+    if (data == xnullptr || count == 0 || !(percentile >= 0.0 && percentile <= 100.0)) {
+        return NAN;
+    }
+    double *values = fossil_test_stat_copy(type, data, count);
+    if (values == xnullptr) {
+        return NAN;
+    }
+    double rank = (double)(count - 1) * percentile / 100.0;
+    size_t k = (size_t)rank;
+    double fraction = rank - (double)k;
+    double result = fossil_test_stat_select(values, count, k);
+    if (fraction > 0.0 && k + 1 < count) {
+        double next = values[k + 1];
+        for (size_t at = k + 2; at < count; at++) {
+            next = values[at] < next ? values[at] : next;
+        }
+        result += fraction * (next - result);
+    }
+    free(values);
+    return result;
+}
+
+double fossil_test_array_ks(fossil_test_array_type_t type, const void *a, size_t a_count, const void *b, size_t b_count, double *p_value) {
+    if (p_value != xnullptr) {
+        *p_value = NAN;
+    }
+    if (a == xnullptr || b == xnullptr || a_count == 0 || b_count == 0) {
+        return NAN;
+    }
+    double *x = fossil_test_stat_copy(type, a, a_count);
+    double *y = fossil_test_stat_copy(type, b, b_count);
+    if (x == xnullptr || y == xnullptr) {
+        free(x);
+        free(y);
+        return NAN;
+    }
+    qsort(x, a_count, sizeof(double), fossil_test_stat_order);
+    qsort(y, b_count, sizeof(double), fossil_test_stat_order);
+
+    // Step both empirical distributions past each distinct value in turn.
+    double distance = 0.0;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a_count && j < b_count) {
+        double value = x[i] < y[j] ? x[i] : y[j];
+        while (i < a_count && x[i] == value) {
+            i++;
+        }
+        while (j < b_count && y[j] == value) {
+            j++;
+        }
+        double gap = fabs((double)i / (double)a_count - (double)j / (double)b_count);
+        distance = gap > distance ? gap : distance;
+    }
+    free(x);
+    free(y);
+
+    if (p_value != xnullptr) {
+        double effective = sqrt((double)a_count * (double)b_count / ((double)a_count + (double)b_count));
+        *p_value = fossil_test_stat_kolmogorov((effective + 0.12 + 0.11 / effective) * distance);
+    }
+    return distance;
+}
+
+void _fossil_test_stat_mean(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double min, double max,
+                            const char *names, const char *file, int line, const char *func) {
+    fossil_test_moments_t moments;
+    fossil_test_array_moments(type, data, count, &moments);
+    bool passed = moments.count > 0 && moments.mean >= min && moments.mean <= max;
+    if (!passed) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but the mean of %zu values is %.6g (standard deviation %.6g, values from %.6g to %.6g)",
+                 names, moments.count, moments.mean, sqrt(moments.variance), moments.min, moments.max);
+    }
+    fossil_test_array_score(behavior, passed, passed ? names : fossil_test_array_message, file, line, func);
+}
+
+void _fossil_test_stat_stddev(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double limit,
+                              const char *names, const char *file, int line, const char *func) {
+    fossil_test_moments_t moments;
+    fossil_test_array_moments(type, data, count, &moments);
+    double deviation = sqrt(moments.variance);
+    bool passed = moments.count > 0 && deviation <= limit;
+    if (!passed) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but the standard deviation of %zu values is %.6g (mean %.6g, values from %.6g to %.6g)",
+                 names, moments.count, deviation, moments.mean, moments.min, moments.max);
+    }
+    fossil_test_array_score(behavior, passed, passed ? names : fossil_test_array_message, file, line, func);
+}
+
+void _fossil_test_stat_percentile(xassert_type_t behavior, fossil_test_array_type_t type, const void *data, size_t count, double percentile,
+                                  double limit, const char *names, const char *file, int line, const char *func) {
+    double value = fossil_test_array_percentile(type, data, count, percentile);
+    bool passed = value <= limit;
+    if (!passed && !(percentile >= 0.0 && percentile <= 100.0)) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but the percentile %.6g is not between 0 and 100", names, percentile);
+    } else if (!passed && value != value) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but the sample of %zu values is empty or holds NaN", names, data != xnullptr ? count : 0);
+    } else if (!passed) {
+        double median = fossil_test_array_percentile(type, data, count, 50.0);
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but it is %.6g over %zu values (median %.6g)", names, value, count, median);
+    }
+    fossil_test_array_score(behavior, passed, passed ? names : fossil_test_array_message, file, line, func);
+}
+
+void _fossil_test_stat_same(xassert_type_t behavior, fossil_test_array_type_t type, const void *a, size_t a_count, const void *b, size_t b_count,
+                            double alpha, const char *names, const char *file, int line, const char *func) {
+    double p_value;
+    double distance = fossil_test_array_ks(type, a, a_count, b, b_count, &p_value);
+    bool passed = p_value >= alpha;
+    if (!passed && distance != distance) {
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but a sample is empty or holds NaN", names);
+    } else if (!passed) {
+        fossil_test_moments_t first;
+        fossil_test_moments_t second;
+        fossil_test_array_moments(type, a, a_count, &first);
+        fossil_test_array_moments(type, b, b_count, &second);
+        snprintf(fossil_test_array_message, sizeof(fossil_test_array_message),
+                 "Expected %s, but the Kolmogorov-Smirnov distance is %.4g with p-value %.3g\n"
+                 "    first  %zu values, mean %.6g, standard deviation %.6g\n"
+                 "    second %zu values, mean %.6g, standard deviation %.6g",
+                 names, distance, p_value, first.count, first.mean, sqrt(first.variance),
+                 second.count, second.mean, sqrt(second.variance));
+    }
+    fossil_test_array_score(behavior, passed, passed ? names : fossil_test_array_message, file, line, func);
+}
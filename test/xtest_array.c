@@ -0,0 +1,373 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Odd sizes leave a tail after every vector width.
+#define ARRAY_LENGTH 1027
+
+static int32_t first_i32[ARRAY_LENGTH];
+static int32_t second_i32[ARRAY_LENGTH];
+static double first_f64[ARRAY_LENGTH];
+static double second_f64[ARRAY_LENGTH];
+
+// splitmix64 turned into a uniform double in [0, 1).
+static double uniform(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (double)((z ^ (z >> 31)) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void fill_arrays(void) {
+    for (int32_t i = 0; i < ARRAY_LENGTH; i++) {
+        first_i32[i] = second_i32[i] = i * 3 - 500;
+        first_f64[i] = second_f64[i] = (double)i * 0.25;
+    }
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(xassume_run_of_array_equal) {
+    fill_arrays();
+    uint8_t bytes[ARRAY_LENGTH];
+    uint64_t words[ARRAY_LENGTH];
+    float singles[ARRAY_LENGTH];
+    for (size_t i = 0; i < ARRAY_LENGTH; i++) {
+        bytes[i] = (uint8_t)i;
+        words[i] = (uint64_t)i << 40;
+        singles[i] = (float)i / 3.0f;
+    }
+
+    ASSUME_ARRAY_EQUAL_I32(first_i32, second_i32, ARRAY_LENGTH);
+    ASSUME_ARRAY_EQUAL_U8(bytes, bytes, ARRAY_LENGTH);
+    ASSUME_ARRAY_EQUAL_U64(words, words, ARRAY_LENGTH);
+    ASSUME_ARRAY_EQUAL_F32(singles, singles, ARRAY_LENGTH, 0.0);
+    ASSUME_ARRAY_EQUAL_F64(first_f64, second_f64, ARRAY_LENGTH, 0.0);
+    ASSUME_ARRAY_EQUAL_I32(first_i32, second_i32, 0);
+}
+
+FOSSIL_TEST(xassume_run_of_array_first_mismatch) {
+    fill_arrays();
+    int16_t shorts[ARRAY_LENGTH];
+    int16_t other[ARRAY_LENGTH];
+    for (size_t i = 0; i < ARRAY_LENGTH; i++) {
+        shorts[i] = other[i] = (int16_t)i;
+    }
+
+    // Every position, in and after the vector blocks, is found exactly
+    bool found = true;
+    for (size_t at = 0; at < ARRAY_LENGTH; at++) {
+        second_i32[at] += 1;
+        other[at] = (int16_t)(other[at] ^ 0x0100);
+        second_f64[at] += 1.0;
+        found = found && fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_I32, first_i32, second_i32, ARRAY_LENGTH, 0) == at;
+        found = found && fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_I16, shorts, other, ARRAY_LENGTH, 0) == at;
+        found = found && fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_F64, first_f64, second_f64, ARRAY_LENGTH, 0.5) == at;
+        second_i32[at] -= 1;
+        other[at] = shorts[at];
+        second_f64[at] -= 1.0;
+    }
+    ASSUME_ITS_TRUE(found);
+
+    // Only the first of several mismatches is reported
+    second_i32[700] = 0;
+    second_i32[90] = 0;
+    ASSUME_ITS_EQUAL_SIZE(90, fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_I32, first_i32, second_i32, ARRAY_LENGTH, 0));
+    ASSUME_ITS_EQUAL_SIZE(90, fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_U32, first_i32, second_i32, ARRAY_LENGTH, 0));
+}
+
+FOSSIL_TEST(xassume_run_of_array_float_tolerance) {
+    float a[37];
+    float b[37];
+    for (size_t i = 0; i < 37; i++) {
+        a[i] = (float)i;
+        b[i] = (float)i + 0.001f;
+    }
+    ASSUME_ARRAY_EQUAL_F32(a, b, 37, 0.01);
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_F32, a, b, 37, 0.0));
+
+    // NaN never matches, not even itself, while infinities match themselves
+    a[20] = b[20] = INFINITY;
+    ASSUME_ARRAY_EQUAL_F32(a, b, 37, 0.01);
+    a[33] = b[33] = NAN;
+    ASSUME_ITS_EQUAL_SIZE(33, fossil_test_array_mismatch(FOSSIL_TEST_ARRAY_F32, a, b, 37, 1.0));
+}
+
+FOSSIL_TEST(xassume_run_of_array_sorted) {
+    fill_arrays();
+    ASSUME_ARRAY_SORTED_I32(first_i32, ARRAY_LENGTH);
+    ASSUME_ARRAY_SORTED_F64(first_f64, ARRAY_LENGTH);
+
+    uint8_t flat[100];
+    memset(flat, 7, sizeof(flat));
+    ASSUME_ARRAY_SORTED_U8(flat, sizeof(flat));
+
+    first_i32[513] = -1000;
+    ASSUME_ITS_EQUAL_SIZE(513, fossil_test_array_unsorted(FOSSIL_TEST_ARRAY_I32, first_i32, ARRAY_LENGTH));
+    first_f64[64] = NAN;
+    ASSUME_ITS_EQUAL_SIZE(64, fossil_test_array_unsorted(FOSSIL_TEST_ARRAY_F64, first_f64, ARRAY_LENGTH));
+}
+
+FOSSIL_TEST(xassume_run_of_array_within_range) {
+    fill_arrays();
+    ASSUME_ARRAY_WITHIN_RANGE_I32(first_i32, ARRAY_LENGTH, -500, 3 * ARRAY_LENGTH);
+    ASSUME_ARRAY_WITHIN_RANGE_F64(first_f64, ARRAY_LENGTH, 0.0, ARRAY_LENGTH);
+
+    uint64_t large[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, UINT64_MAX};
+    ASSUME_ARRAY_WITHIN_RANGE_U64(large, 10, 0, UINT64_MAX);
+
+    fossil_test_scalar_t min = { .i = -500 };
+    fossil_test_scalar_t max = { .i = 0 };
+    ASSUME_ITS_EQUAL_SIZE(167, fossil_test_array_outside(FOSSIL_TEST_ARRAY_I32, first_i32, ARRAY_LENGTH, min, max));
+    fossil_test_scalar_t top = { .u = 8 };
+    fossil_test_scalar_t bottom = { .u = 0 };
+    ASSUME_ITS_EQUAL_SIZE(9, fossil_test_array_outside(FOSSIL_TEST_ARRAY_U64, large, 10, bottom, top));
+}
+
+FOSSIL_TEST(xassume_run_of_array_ulp_distance) {
+    float singles[67];
+    float nudged[67];
+    for (size_t i = 0; i < 67; i++) {
+        singles[i] = nudged[i] = (float)i * 1e6f - 3e7f;
+    }
+    nudged[40] = nextafterf(nextafterf(singles[40], INFINITY), INFINITY);
+    ASSUME_ARRAY_ULP_F32(nudged, singles, 67, 2);
+
+    fossil_test_tolerance_t tolerance = { FOSSIL_TEST_TOLERANCE_ULP, 1, 0.0, 0.0 };
+    fossil_test_float_error_t error;
+    fossil_test_float_measure(FOSSIL_TEST_ARRAY_F32, nudged, 0, singles, 0, 1, 67, &tolerance, &error);
+    ASSUME_ITS_EQUAL_SIZE(1, error.failures);
+    ASSUME_ITS_EQUAL_SIZE(40, error.worst_column);
+    ASSUME_ITS_EQUAL_F64(2.0, error.max_error, 0.0);
+    ASSUME_ITS_EQUAL_F64(2.0 / 67.0, error.mean_error, 1e-12);
+
+    // Both zeroes are the same value, across zero counts every step
+    double zeroes[2] = {0.0, -0.0};
+    double other[2] = {-0.0, 0.0};
+    ASSUME_ARRAY_ULP_F64(zeroes, other, 2, 0);
+    double tiny[1] = {-4.9406564584124654e-324};
+    double positive[1] = {4.9406564584124654e-324};
+    fossil_test_float_measure(FOSSIL_TEST_ARRAY_F64, tiny, 0, positive, 0, 1, 1, &tolerance, &error);
+    ASSUME_ITS_EQUAL_F64(2.0, error.max_error, 0.0);
+
+    // Large magnitudes pass on ULPs where an absolute epsilon would not
+    double large[3] = {1e300, 2e300, 3e300};
+    double near[3] = {nextafter(1e300, 0.0), 2e300, nextafter(3e300, INFINITY)};
+    ASSUME_ARRAY_ULP_F64(large, near, 3, 1);
+}
+
+FOSSIL_TEST(xassume_run_of_array_relative_and_absolute) {
+    double values[101];
+    double reference[101];
+    for (size_t i = 0; i < 101; i++) {
+        reference[i] = (double)i * 1000.0;
+        values[i] = reference[i] * (1.0 + 1e-7);
+    }
+    ASSUME_ARRAY_CLOSE_F64(values, reference, 101, 1e-6, 1e-12);
+
+    values[77] = reference[77] + 1.0;
+    values[12] = NAN;
+    fossil_test_tolerance_t tolerance = { FOSSIL_TEST_TOLERANCE_CLOSE, 0, 1e-6, 1e-12 };
+    fossil_test_float_error_t error;
+    fossil_test_float_measure(FOSSIL_TEST_ARRAY_F64, values, 0, reference, 0, 1, 101, &tolerance, &error);
+    ASSUME_ITS_EQUAL_SIZE(2, error.failures);
+    ASSUME_ITS_EQUAL_SIZE(12, error.worst_column);
+    ASSUME_ITS_TRUE(isinf(error.max_error) && isinf(error.mean_error));
+
+    // Infinities match themselves and the absolute term covers zero
+    float edges[3] = {INFINITY, 0.0f, 1e-9f};
+    float target[3] = {INFINITY, 1e-9f, 0.0f};
+    ASSUME_ARRAY_CLOSE_F32(edges, target, 3, 0.0, 1e-8);
+}
+
+FOSSIL_TEST(xassume_run_of_matrix_with_stride) {
+    // A 3 x 70 view into rows of 80, the padding is never read
+    static float actual[3][80];
+    static float expected[3][72];
+    for (size_t r = 0; r < 3; r++) {
+        for (size_t c = 0; c < 80; c++) {
+            actual[r][c] = c < 70 ? (float)(r * 100 + c) : NAN;
+        }
+        for (size_t c = 0; c < 72; c++) {
+            expected[r][c] = c < 70 ? (float)(r * 100 + c) : -1.0f;
+        }
+    }
+    ASSUME_MATRIX_CLOSE_F32(&actual[0][0], 80, &expected[0][0], 72, 3, 70, 0.0, 0.0);
+    ASSUME_MATRIX_ULP_F32(&actual[0][0], 80, &expected[0][0], 72, 3, 70, 0);
+
+    actual[2][69] += 0.5f;
+    actual[1][3] += 0.25f;
+    fossil_test_tolerance_t tolerance = { FOSSIL_TEST_TOLERANCE_CLOSE, 0, 0.0, 0.1 };
+    fossil_test_float_error_t error;
+    fossil_test_float_measure(FOSSIL_TEST_ARRAY_F32, &actual[0][0], 80, &expected[0][0], 72, 3, 70, &tolerance, &error);
+    ASSUME_ITS_EQUAL_SIZE(210, error.count);
+    ASSUME_ITS_EQUAL_SIZE(2, error.failures);
+    ASSUME_ITS_EQUAL_SIZE(2, error.worst_row);
+    ASSUME_ITS_EQUAL_SIZE(69, error.worst_column);
+    ASSUME_ITS_EQUAL_F64(0.5, error.max_error, 1e-6);
+}
+
+FOSSIL_TEST(xassume_run_of_memory_equal) {
+    size_t size = 100003;
+    uint8_t *first = (uint8_t *)malloc(size);
+    uint8_t *second = (uint8_t *)malloc(size);
+    for (size_t i = 0; i < size; i++) {
+        first[i] = second[i] = (uint8_t)(i * 7);
+    }
+    ASSUME_MEM_EQUAL(first, second, size);
+
+    second[size - 1] ^= 1;
+    ASSUME_ITS_EQUAL_SIZE(size - 1, fossil_test_memory_mismatch(first, second, size));
+    second[4099] ^= 0x80;
+    ASSUME_ITS_EQUAL_SIZE(4099, fossil_test_memory_mismatch(first, second, size));
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_memory_mismatch(first, second, 0));
+
+    free(first);
+    free(second);
+}
+
+FOSSIL_TEST(xassume_run_of_memory_large_buffers_in_parallel) {
+    size_t size = FOSSIL_TEST_MEMORY_PARALLEL + 12345;
+    uint8_t *first = (uint8_t *)calloc(size, 1);
+    uint8_t *second = (uint8_t *)calloc(size, 1);
+    ASSUME_MEM_EQUAL(first, second, size);
+    ASSUME_MEM_ZERO(first, size);
+
+    // The lowest difference wins whichever thread finds it
+    second[size - 5] = 1;
+    second[size / 2 + 3] = 1;
+    first[size / 3] = 1;
+    ASSUME_ITS_EQUAL_SIZE(size / 3, fossil_test_memory_mismatch(first, second, size));
+    ASSUME_ITS_EQUAL_SIZE(size / 2 + 3, fossil_test_memory_unlike(second, size, "", 1));
+
+    free(first);
+    free(second);
+}
+
+FOSSIL_TEST(xassume_run_of_memory_pattern) {
+    uint8_t frame[9000];
+    const uint8_t pixel[3] = {0x10, 0x80, 0xf0};
+    for (size_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = pixel[i % 3];
+    }
+    ASSUME_MEM_PATTERN(frame, sizeof(frame), pixel, sizeof(pixel));
+    ASSUME_MEM_PATTERN(frame, 7, pixel, sizeof(pixel));
+
+    frame[8191] = 0;
+    ASSUME_ITS_EQUAL_SIZE(8191, fossil_test_memory_unlike(frame, sizeof(frame), pixel, sizeof(pixel)));
+    ASSUME_ITS_EQUAL_SIZE(1, fossil_test_memory_unlike(frame, sizeof(frame), "\x10\x10", 2));
+}
+
+FOSSIL_TEST(xassume_run_of_sample_moments) {
+    uint32_t counts[1000];
+    for (uint32_t i = 0; i < 1000; i++) {
+        counts[i] = i + 1;
+    }
+    fossil_test_moments_t moments;
+    fossil_test_array_moments(FOSSIL_TEST_ARRAY_U32, counts, 1000, &moments);
+    ASSUME_ITS_EQUAL_SIZE(1000, moments.count);
+    ASSUME_ITS_TRUE(fabs(moments.mean - 500.5) < 1e-9);
+    ASSUME_ITS_TRUE(fabs(moments.variance - 1000.0 * 1001.0 / 12.0) < 1e-6);
+    ASSUME_ITS_TRUE(moments.min == 1.0 && moments.max == 1000.0);
+    ASSUME_MEAN_WITHIN_U32(counts, 1000, 500, 501);
+    ASSUME_STDDEV_BELOW_U32(counts, 1000, 289);
+
+    // A large offset does not swallow a small spread
+    double shifted[ARRAY_LENGTH];
+    const double offsets[4] = { 4.0, 7.0, 13.0, 16.0 };
+    for (size_t i = 0; i < ARRAY_LENGTH - 3; i++) {
+        shifted[i] = 1e9 + offsets[i % 4];
+    }
+    fossil_test_array_moments(FOSSIL_TEST_ARRAY_F64, shifted, ARRAY_LENGTH - 3, &moments);
+    ASSUME_ITS_TRUE(fabs(moments.mean - (1e9 + 10.0)) < 1e-6);
+    ASSUME_ITS_TRUE(fabs(moments.variance - 22.5 * 1024.0 / 1023.0) < 1e-6);
+}
+
+FOSSIL_TEST(xassume_run_of_sample_percentiles) {
+    int32_t values[101];
+    for (int32_t i = 0; i < 101; i++) {
+        values[i] = (i * 37) % 101;   // 0 to 100 shuffled
+    }
+    ASSUME_ITS_TRUE(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_I32, values, 101, 50.0) == 50.0);
+    ASSUME_ITS_TRUE(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_I32, values, 101, 0.0) == 0.0);
+    ASSUME_ITS_TRUE(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_I32, values, 101, 100.0) == 100.0);
+    ASSUME_ITS_TRUE(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_I32, values, 101, 99.5) == 99.5);
+    ASSUME_PERCENTILE_BELOW_I32(values, 101, 90, 90);
+
+    float timings[64];
+    for (int i = 0; i < 64; i++) {
+        timings[i] = i == 7 ? NAN : 1.0f;
+    }
+    ASSUME_ITS_TRUE(isnan(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_F32, timings, 64, 50.0)));
+    ASSUME_ITS_TRUE(isnan(fossil_test_array_percentile(FOSSIL_TEST_ARRAY_F32, timings, 64, 101.0)));
+}
+
+FOSSIL_TEST(xassume_run_of_sample_distributions) {
+    static double first[4000];
+    static double second[3000];
+    static double later[3000];
+    uint64_t state = 42;
+    for (size_t i = 0; i < 4000; i++) {
+        first[i] = uniform(&state);
+    }
+    for (size_t i = 0; i < 3000; i++) {
+        second[i] = uniform(&state);
+        later[i] = uniform(&state) + 0.1;
+    }
+    ASSUME_SAME_DISTRIBUTION_F64(first, 4000, second, 3000, 0.001);
+
+    double p_value = 1.0;
+    double distance = fossil_test_array_ks(FOSSIL_TEST_ARRAY_F64, first, 4000, later, 3000, &p_value);
+    ASSUME_ITS_TRUE(distance > 0.08 && distance < 0.14);
+    ASSUME_ITS_TRUE(p_value < 1e-9);
+
+    // Identical samples are at distance zero
+    distance = fossil_test_array_ks(FOSSIL_TEST_ARRAY_F64, first, 4000, first, 4000, &p_value);
+    ASSUME_ITS_TRUE(distance == 0.0 && p_value == 1.0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(array_test_group) {
+    ADD_TEST(xassume_run_of_array_equal);
+    ADD_TEST(xassume_run_of_array_first_mismatch);
+    ADD_TEST(xassume_run_of_array_float_tolerance);
+    ADD_TEST(xassume_run_of_array_sorted);
+    ADD_TEST(xassume_run_of_array_within_range);
+    ADD_TEST(xassume_run_of_array_ulp_distance);
+    ADD_TEST(xassume_run_of_array_relative_and_absolute);
+    ADD_TEST(xassume_run_of_matrix_with_stride);
+    ADD_TEST(xassume_run_of_memory_equal);
+    ADD_TEST(xassume_run_of_memory_large_buffers_in_parallel);
+    ADD_TEST(xassume_run_of_memory_pattern);
+    ADD_TEST(xassume_run_of_sample_moments);
+    ADD_TEST(xassume_run_of_sample_percentiles);
+    ADD_TEST(xassume_run_of_sample_distributions);
+} // end of fixture
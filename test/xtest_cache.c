@@ -0,0 +1,178 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static void cache_body(void) {
+}
+
+static fossil_test_t cache_case(const char *name) {
+    fossil_test_t test;
+    memset(&test, 0, sizeof(test));
+    test.name = name;
+    test.test_function = cache_body;
+    test.tags = "fossil";
+    test.marks = "fossil";
+    return test;
+}
+
+// Writes an index of two objects: "cached" runs code of both, "other" only
+// of the second one.
+static void cache_write_index(void) {
+    FILE *file = fopen("xtest_cache.index", "w");
+    if (file != xnullptr) {
+        fputs("fossil-impact 1\n"
+              "object xtest_cache_first.gcda\n"
+              "object xtest_cache_second.gcda\n"
+              "case cached\n"
+              "touch 0 1 2\n"
+              "touch 1 1\n"
+              "case other\n"
+              "touch 1 4\n"
+              "case renamed\n"
+              "touch 0 1\n", file);
+        fclose(file);
+    }
+}
+
+static void cache_write_object(const char *path, const char *code) {
+    FILE *file = fopen(path, "wb");
+    if (file != xnullptr) {
+        fputs(code, file);
+        fclose(file);
+    }
+}
+
+static void cache_remove_index(void) {
+    remove("xtest_cache.index");
+    remove("xtest_cache_first.o");
+    remove("xtest_cache_second.o");
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(cache_key_follows_the_objects_a_case_ran) {
+    char path[FILENAME_MAX];
+    ASSUME_ITS_TRUE(fossil_test_cache_object_path("build/xcli.p/parser.c.gcda", path, sizeof(path)));
+    ASSUME_ITS_EQUAL_CSTR("build/xcli.p/parser.c.o", path);
+    ASSUME_ITS_FALSE(fossil_test_cache_object_path("parser.c.o", path, sizeof(path)));
+
+    cache_write_index();
+    cache_write_object("xtest_cache_first.o", "first object");
+    cache_write_object("xtest_cache_second.o", "second object");
+    fossil_test_impact_t *impact = fossil_test_impact_load("xtest_cache.index");
+    ASSUME_NOT_CNULL(impact);
+    if (impact == xnullptr) {
+        cache_remove_index();
+        return;
+    }
+    fossil_test_t cached = cache_case("cached");
+    fossil_test_t other = cache_case("other");
+    uint64_t before[2];
+    uint64_t after[2];
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &cached, &before[0]));
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &other, &before[1]));
+
+    // A recompiled object only misses for the cases that ran it
+    cache_write_object("xtest_cache_first.o", "first object, rebuilt");
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &cached, &after[0]));
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &other, &after[1]));
+    ASSUME_NOT_EQUAL_U64(before[0], after[0]);
+    ASSUME_ITS_EQUAL_U64(before[1], after[1]);
+
+    // Cases the index has not seen and objects that are gone always run
+    fossil_test_t unseen = cache_case("unseen");
+    ASSUME_ITS_FALSE(fossil_test_cache_key(impact, &unseen, &after[0]));
+    ASSUME_ITS_FALSE(fossil_test_cache_key(xnullptr, &cached, &after[0]));
+    remove("xtest_cache_second.o");
+    ASSUME_ITS_FALSE(fossil_test_cache_key(impact, &other, &after[1]));
+
+    fossil_test_impact_erase(impact);
+    cache_remove_index();
+}
+
+FOSSIL_TEST(cache_key_follows_the_case) {
+    cache_write_index();
+    cache_write_object("xtest_cache_first.o", "first object");
+    cache_write_object("xtest_cache_second.o", "second object");
+    fossil_test_impact_t *impact = fossil_test_impact_load("xtest_cache.index");
+    ASSUME_NOT_CNULL(impact);
+    if (impact == xnullptr) {
+        cache_remove_index();
+        return;
+    }
+    fossil_test_t one = cache_case("cached");
+    fossil_test_t same = cache_case("cached");
+    fossil_test_t renamed = cache_case("renamed");
+    fossil_test_t marked = cache_case("cached");
+    marked.marks = "fail";
+    uint64_t keys[4];
+
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &one, &keys[0]));
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &same, &keys[1]));
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &renamed, &keys[2]));
+    ASSUME_ITS_TRUE(fossil_test_cache_key(impact, &marked, &keys[3]));
+    ASSUME_ITS_EQUAL_U64(keys[0], keys[1]);
+    ASSUME_NOT_EQUAL_U64(keys[0], keys[2]);
+    ASSUME_NOT_EQUAL_U64(keys[0], keys[3]);
+
+    // Tables read their rows at run time, they always run
+    one.table.kind = FOSSIL_TEST_TABLE_INLINE;
+    ASSUME_ITS_FALSE(fossil_test_cache_key(impact, &one, &keys[0]));
+
+    fossil_test_impact_erase(impact);
+    cache_remove_index();
+}
+
+FOSSIL_TEST(cache_remembers_stored_keys) {
+    const char *directory = "xtest_cache";
+    char path[FILENAME_MAX];
+    snprintf(path, sizeof(path), "%s/%016llx", directory, 0x1234abcdULL);
+
+    ASSUME_ITS_FALSE(fossil_test_cache_hit(directory, 0x1234abcd));
+    ASSUME_ITS_TRUE(fossil_test_cache_store(directory, 0x1234abcd, "cache_remembers_stored_keys"));
+    ASSUME_ITS_TRUE(fossil_test_cache_hit(directory, 0x1234abcd));
+    ASSUME_ITS_FALSE(fossil_test_cache_hit(directory, 0x1234abce));
+
+    remove(path);
+#ifndef _WIN32
+    rmdir(directory);
+#endif
+    ASSUME_ITS_FALSE(fossil_test_cache_hit(directory, 0x1234abcd));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cache_test_group) {
+    ADD_TEST(cache_key_follows_the_objects_a_case_ran);
+    ADD_TEST(cache_key_follows_the_case);
+    ADD_TEST(cache_remembers_stored_keys);
+} // end of fixture
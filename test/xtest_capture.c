@@ -0,0 +1,99 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/capture.h> // library under test
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// placeholder
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_capture_stdout) {
+    fossil_mockup_capture_t *capture = fossil_mockup_capture_start(1);
+    ASSUME_NOT_CNULL(capture);
+
+    printf("first line\n");
+    printf("value=%d\n", 42);
+    fossil_mockup_capture_stop(capture);
+
+    ASSUME_ITS_EQUAL_CSTR("first line\nvalue=42\n", fossil_mockup_capture_data(capture, NULL));
+    ASSUME_ITS_EQUAL_SIZE(2, fossil_mockup_capture_line_count(capture));
+    ASSUME_ITS_TRUE(fossil_mockup_capture_contains_line(capture, "value=42"));
+    ASSUME_ITS_FALSE(fossil_mockup_capture_contains_line(capture, "value"));
+
+    fossil_mockup_capture_erase(capture);
+}
+
+FOSSIL_TEST(fossil_mockup_try_capture_stderr_match) {
+    fossil_mockup_capture_t *capture = fossil_mockup_capture_start(2);
+
+    fprintf(stderr, "warning: disk at 91%%\n");
+    fprintf(stderr, "took 17 ms\n");
+
+    ASSUME_ITS_TRUE(fossil_mockup_capture_match(capture, "^took [0-9]+ ms$"));
+    ASSUME_ITS_FALSE(fossil_mockup_capture_match(capture, "^disk"));
+    ASSUME_ITS_TRUE(fossil_mockup_capture_contains(capture, "disk at 91"));
+
+    fossil_mockup_capture_erase(capture);
+}
+
+FOSSIL_TEST(fossil_mockup_try_capture_large_output) {
+    fossil_mockup_capture_t *capture = fossil_mockup_capture_start(1);
+
+    for (int i = 0; i < 100000; i++) {
+        printf("log entry %d\n", i);
+    }
+    fossil_mockup_capture_stop(capture);
+
+    ASSUME_ITS_EQUAL_SIZE(100000, fossil_mockup_capture_line_count(capture));
+    ASSUME_ITS_TRUE(fossil_mockup_capture_contains_line(capture, "log entry 99999"));
+
+    fossil_mockup_capture_erase(capture);
+}
+
+FOSSIL_TEST(fossil_mockup_try_capture_reset) {
+    fossil_mockup_capture_t *capture = fossil_mockup_capture_start(1);
+
+    printf("discarded\n");
+    fossil_mockup_capture_reset(capture);
+    printf("kept\n");
+    fossil_mockup_capture_stop(capture);
+
+    ASSUME_ITS_EQUAL_CSTR("kept\n", fossil_mockup_capture_data(capture, NULL));
+
+    fossil_mockup_capture_erase(capture);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_capture_group) {
+    ADD_TEST(fossil_mockup_try_capture_stdout);
+    ADD_TEST(fossil_mockup_try_capture_stderr_match);
+    ADD_TEST(fossil_mockup_try_capture_large_output);
+    ADD_TEST(fossil_mockup_try_capture_reset);
+} // end of fixture
@@ -0,0 +1,119 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <signal.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static void write_through_bad_pointer(void *context) {
+    // The address comes from the caller so the write cannot be folded away.
+    volatile int *pointer = (volatile int *)context;
+    *pointer = 42;
+}
+
+static void raise_signal(void *context) {
+    raise(*(int *)context);
+}
+
+static void count_call(void *context) {
+    (*(int *)context)++;
+}
+
+static void crash_inside_crash_run(void *context) {
+    fossil_test_crash_t *inner = (fossil_test_crash_t *)context;
+    int number = SIGFPE;
+    if (fossil_test_crash_run(raise_signal, &number, inner)) {
+        // Still running after the inner crash, now crash the outer run.
+        number = SIGILL;
+        raise_signal(&number);
+    }
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(crash_bad_pointer_is_caught) {
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    fossil_test_crash_t crash;
+    memset(&crash, 0, sizeof(crash));
+    volatile uintptr_t address = 16;
+
+    ASSUME_ITS_TRUE(fossil_test_crash_run(write_through_bad_pointer, (void *)address, &crash));
+    ASSUME_ITS_TRUE(crash.signal == SIGSEGV || crash.signal == SIGBUS);
+#ifdef FOSSIL_TEST_HAS_BACKTRACE
+    ASSUME_ITS_TRUE(crash.frame_count > 1);
+#endif
+    // Nothing is left over for the runner to report
+    ASSUME_ITS_FALSE(fossil_test_crash_take(NULL));
+#else
+    ASSUME_ITS_TRUE(true);
+#endif
+}
+
+FOSSIL_TEST(crash_handlers_stay_installed) {
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    fossil_test_crash_t crash;
+    int number = SIGFPE;
+
+    // The signal mask is restored on the way out, so the same signal is
+    // caught again.
+    for (int32_t i = 0; i < 3; i++) {
+        memset(&crash, 0, sizeof(crash));
+        ASSUME_ITS_TRUE(fossil_test_crash_run(raise_signal, &number, &crash));
+        ASSUME_ITS_EQUAL_I32(SIGFPE, crash.signal);
+    }
+    ASSUME_ITS_EQUAL_CSTR("SIGFPE, arithmetic exception", fossil_test_crash_name(crash.signal));
+
+    int calls = 0;
+    ASSUME_ITS_FALSE(fossil_test_crash_run(count_call, &calls, &crash));
+    ASSUME_ITS_EQUAL_I32(1, calls);
+#else
+    ASSUME_ITS_TRUE(true);
+#endif
+}
+
+FOSSIL_TEST(crash_nested_runs_return_to_the_innermost) {
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    fossil_test_crash_t inner;
+    fossil_test_crash_t outer;
+    memset(&inner, 0, sizeof(inner));
+    memset(&outer, 0, sizeof(outer));
+
+    ASSUME_ITS_TRUE(fossil_test_crash_run(crash_inside_crash_run, &inner, &outer));
+    ASSUME_ITS_EQUAL_I32(SIGFPE, inner.signal);
+    ASSUME_ITS_EQUAL_I32(SIGILL, outer.signal);
+#else
+    ASSUME_ITS_TRUE(true);
+#endif
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(crash_test_group) {
+    ADD_TEST(crash_bad_pointer_is_caught);
+    ADD_TEST(crash_handlers_stay_installed);
+    ADD_TEST(crash_nested_runs_return_to_the_innermost);
+} // end of fixture
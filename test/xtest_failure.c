@@ -0,0 +1,182 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+#include <fossil/xassert.h>
+
+#include <fossil/unittest/commands.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static xassert_info failed_at(int32_t line, char *message) {
+    xassert_info info;
+    memset(&info, 0, sizeof(info));
+    info.file = (char *)__FILE__;
+    info.func = (char *)"failed_at";
+    info.line = line;
+    info.row = -1;
+    info.message = message;
+    info.kind = FOSSIL_TEST_OPERAND_NONE;
+    return info;
+}
+
+static size_t kept_failures(void) {
+    size_t kept = 0;
+    for (const fossil_test_failure_t *failure = fossil_test_failure_first(); failure != NULL; failure = failure->next) {
+        kept++;
+    }
+    return kept;
+}
+
+static bool abort_reached_end = false;
+
+FOSSIL_FIXTURE(abort_fixture);
+
+FOSSIL_SETUP(abort_fixture) {
+    abort_reached_end = false;
+}
+
+FOSSIL_TEARDOWN(abort_fixture) {
+    // Teardown still runs once the fatal assertion ended the case
+    _ASSERT_INFO.should_fail = false;
+    ASSUME_ITS_FALSE(abort_reached_end);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(failure_formats_operands_when_reported) {
+    char text[256];
+    xassert_info info = failed_at(1, (char *)"Expected x to be equal to y");
+
+    info.kind = FOSSIL_TEST_OPERAND_SIGNED;
+    info.actual.u = (uint64_t)(int64_t)-3;
+    info.expected.u = 4;
+    fossil_test_failure_format(&info, text, sizeof(text));
+    ASSUME_ITS_EQUAL_CSTR("Expected x to be equal to y (actual -3, expected 4)", text);
+
+    info.kind = FOSSIL_TEST_OPERAND_HEX;
+    info.actual.u = 0xff;
+    info.expected.u = 0x10;
+    fossil_test_failure_format(&info, text, sizeof(text));
+    ASSUME_ITS_EQUAL_CSTR("Expected x to be equal to y (actual 0xff, expected 0x10)", text);
+
+    info.kind = FOSSIL_TEST_OPERAND_OCTAL;
+    info.actual.u = 8;
+    info.expected.u = 7;
+    fossil_test_failure_format(&info, text, sizeof(text));
+    ASSUME_ITS_EQUAL_CSTR("Expected x to be equal to y (actual 010, expected 07)", text);
+
+    info.kind = FOSSIL_TEST_OPERAND_NEAR;
+    info.actual.f = 1.5;
+    info.expected.f = 1.0;
+    info.tolerance.f = 0.25;
+    fossil_test_failure_format(&info, text, sizeof(text));
+    ASSUME_ITS_EQUAL_CSTR("Expected x to be equal to y (actual 1.5, expected 1, difference 0.5, tolerance 0.25)", text);
+
+    // Operands are evaluated exactly once
+    int32_t count = 0;
+    ASSUME_ITS_EQUAL_I32(count++, 0);
+    ASSUME_ITS_EQUAL_F64(count++ * 0.5, 0.5, 0.0);
+    ASSUME_ITS_EQUAL_I32(2, count);
+}
+
+FOSSIL_TEST(failure_keeps_every_failure_in_order) {
+    char message[32];
+    fossil_test_failure_reset();
+
+    for (int32_t i = 0; i < 3; i++) {
+        snprintf(message, sizeof(message), "failure %d", (int)i);
+        xassert_info info = failed_at(10 + i, message);
+        fossil_test_failure_add(&info);
+    }
+    // The messages were copied, the buffer is free again
+    strcpy(message, "overwritten");
+
+    const fossil_test_failure_t *failure = fossil_test_failure_first();
+    ASSUME_NOT_CNULL(failure);
+    ASSUME_ITS_EQUAL_CSTR("failure 0", failure->info.message);
+    ASSUME_ITS_EQUAL_I32(10, failure->info.line);
+    failure = failure->next;
+    ASSUME_ITS_EQUAL_CSTR("failure 1", failure->info.message);
+    ASSUME_ITS_EQUAL_CSTR("failure 2", failure->next->info.message);
+    ASSUME_ITS_CNULL(failure->next->next);
+    ASSUME_ITS_EQUAL_U64(3, fossil_test_failure_count());
+
+    // Resetting rewinds the arena for the next case
+    fossil_test_failure_reset();
+    ASSUME_ITS_CNULL(fossil_test_failure_first());
+    ASSUME_ITS_EQUAL_U64(0, fossil_test_failure_count());
+}
+
+FOSSIL_TEST(failure_limit_counts_the_rest) {
+    uint32_t limit = _CLI.failure_limit;
+    _CLI.failure_limit = 5;
+    fossil_test_failure_reset();
+
+    // Enough long messages to spill over several arena chunks
+    char *message = (char *)malloc(4096);
+    ASSUME_NOT_CNULL(message);
+    memset(message, 'x', 4095);
+    message[4095] = '\0';
+    for (int32_t i = 0; i < 1000; i++) {
+        xassert_info info = failed_at(i, message);
+        fossil_test_failure_add(&info);
+    }
+    ASSUME_ITS_EQUAL_SIZE(5, kept_failures());
+    ASSUME_ITS_EQUAL_U64(1000, fossil_test_failure_count());
+
+    _CLI.failure_limit = 0;
+    fossil_test_failure_reset();
+    for (int32_t i = 0; i < 100; i++) {
+        xassert_info info = failed_at(i, message);
+        fossil_test_failure_add(&info);
+    }
+    ASSUME_ITS_EQUAL_SIZE(100, kept_failures());
+    const fossil_test_failure_t *last = fossil_test_failure_first();
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    ASSUME_ITS_EQUAL_I32(99, last->info.line);
+
+    free(message);
+    fossil_test_failure_reset();
+    _CLI.failure_limit = limit;
+}
+
+FOSSIL_TEST(failure_assert_ends_the_case) {
+    // Stand in for a case marked to fail, so the failure is the expected outcome
+    _ASSERT_INFO.should_fail = true;
+    ASSERT_ITS_TRUE(false);
+    abort_reached_end = true;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(failure_test_group) {
+    ADD_TEST(failure_formats_operands_when_reported);
+    ADD_TEST(failure_keeps_every_failure_in_order);
+    ADD_TEST(failure_limit_counts_the_rest);
+    ADD_TESTF(failure_assert_ends_the_case, abort_fixture);
+} // end of fixture
@@ -0,0 +1,201 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/fault.h> // library under test
+#include <fossil/mockup/file.h>
+#include <fossil/mockup/network.h>
+#include <errno.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static fossil_mockup_fault_t* rough_fault(uint64_t seed) {
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(seed);
+    fossil_mockup_fault_set_latency(fault, FOSSIL_MOCKUP_LATENCY_UNIFORM, 100, 900);
+    fossil_mockup_fault_set_short_io(fault, 0.5, 0);
+    fossil_mockup_fault_set_errors(fault, 0.2, 0.2, 0.0);
+    fossil_mockup_fault_set_virtual_clock(fault, true);
+    return fault;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_fault_replays_from_seed) {
+    fossil_mockup_fault_t *first = rough_fault(7);
+    fossil_mockup_fault_t *second = rough_fault(7);
+    fossil_mockup_fault_action_t actions[64];
+    size_t allowed[64];
+
+    bool same = true;
+    for (int i = 0; i < 64; i++) {
+        size_t other = 0;
+        actions[i] = fossil_mockup_fault_next(first, 100, &allowed[i]);
+        same = same && fossil_mockup_fault_next(second, 100, &other) == actions[i] && other == allowed[i];
+    }
+    ASSUME_ITS_TRUE(same);
+    ASSUME_ITS_TRUE(first->again_count > 0 && first->interrupt_count > 0 && first->short_count > 0);
+    ASSUME_ITS_EQUAL_U64(fossil_mockup_fault_now(first), fossil_mockup_fault_now(second));
+
+    // Reset rewinds the run
+    uint64_t elapsed = fossil_mockup_fault_now(first);
+    fossil_mockup_fault_reset(first);
+    for (int i = 0; i < 64; i++) {
+        size_t again = 0;
+        same = same && fossil_mockup_fault_next(first, 100, &again) == actions[i] && again == allowed[i];
+    }
+    ASSUME_ITS_TRUE(same);
+    ASSUME_ITS_EQUAL_U64(elapsed, fossil_mockup_fault_now(first));
+
+    fossil_mockup_fault_erase(first);
+    fossil_mockup_fault_erase(second);
+}
+
+FOSSIL_TEST(fossil_mockup_try_fault_latency_and_bandwidth) {
+    size_t allowed = 0;
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(1);
+    fossil_mockup_fault_set_virtual_clock(fault, true);
+    fossil_mockup_fault_set_latency(fault, FOSSIL_MOCKUP_LATENCY_FIXED, 250, 0);
+    fossil_mockup_fault_set_bandwidth(fault, 1000);
+    fossil_mockup_fault_set_short_io(fault, 0.0, 100);
+
+    ASSUME_ITS_EQUAL_I32(FOSSIL_MOCKUP_FAULT_PASS, fossil_mockup_fault_next(fault, 400, &allowed));
+    ASSUME_ITS_EQUAL_SIZE(100, allowed);
+    // 250us latency plus 100 bytes at 1000 bytes per second
+    ASSUME_ITS_EQUAL_U64(100250, fossil_mockup_fault_now(fault));
+
+    fossil_mockup_fault_set_latency(fault, FOSSIL_MOCKUP_LATENCY_NORMAL, 1000, 100);
+    fossil_mockup_fault_set_bandwidth(fault, 0);
+    fossil_mockup_fault_reset(fault);
+    for (int i = 0; i < 100; i++) {
+        fossil_mockup_fault_next(fault, 1, &allowed);
+    }
+    uint64_t mean = fossil_mockup_fault_now(fault) / 100;
+    ASSUME_ITS_TRUE(mean > 950 && mean < 1050);
+
+    fossil_mockup_fault_erase(fault);
+}
+
+FOSSIL_TEST(fossil_mockup_try_fault_file_short_reads) {
+    char data[256];
+    char copy[256];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)('a' + i % 26);
+    }
+    fossil_mockup_file_t *file = fossil_mockup_file_create_from_buffer("input.bin", data, sizeof(data));
+    fossil_mockup_fault_t *fault = rough_fault(99);
+    fossil_mockup_file_set_fault(file, fault);
+
+    // A reader that retries EAGAIN and EINTR still sees every byte in order
+    size_t total = 0;
+    int failures = 0;
+    while (total < sizeof(copy)) {
+        errno = 0;
+        size_t count = fossil_mockup_file_read(copy + total, 1, sizeof(copy) - total, file);
+        if (count == 0) {
+            ASSUME_ITS_TRUE(errno == EAGAIN || errno == EINTR);
+            failures++;
+        }
+        total += count;
+    }
+    ASSUME_ITS_TRUE(memcmp(data, copy, sizeof(data)) == 0);
+    ASSUME_ITS_TRUE(failures > 0 && fault->short_count > 0);
+
+    // Element reads stay whole
+    fossil_mockup_fault_set_errors(fault, 0.0, 0.0, 0.0);
+    fossil_mockup_file_reset(file);
+    size_t elements = fossil_mockup_file_read(copy, 16, 16, file);
+    ASSUME_ITS_TRUE(elements >= 1 && elements <= 16);
+    ASSUME_ITS_EQUAL_SIZE(16 * elements, file->position);
+
+    fossil_mockup_file_erase(file);
+    fossil_mockup_fault_erase(fault);
+}
+
+FOSSIL_TEST(fossil_mockup_try_fault_partial_element_at_end) {
+    char copy[128];
+    fossil_mockup_file_t *file = fossil_mockup_file_create_from_buffer("tail.bin", "0123456789", 10);
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(5);
+    fossil_mockup_fault_set_virtual_clock(fault, true);
+    fossil_mockup_fault_set_short_io(fault, 0.0, 3);
+    fossil_mockup_file_set_fault(file, fault);
+
+    // Six bytes are left, less than one element, and the fault allows three
+    file->position = 4;
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_mockup_file_read(copy, sizeof(copy), 1, file));
+    ASSUME_ITS_TRUE(file->position <= file->size);
+
+    // An element that still fits moves whole
+    file->position = 4;
+    ASSUME_ITS_EQUAL_SIZE(1, fossil_mockup_file_read(copy, 4, 2, file));
+    ASSUME_ITS_EQUAL_SIZE(8, file->position);
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_mockup_file_read(copy, 4, 1, file));
+    ASSUME_ITS_EQUAL_SIZE(10, file->position);
+
+    fossil_mockup_file_erase(file);
+    fossil_mockup_fault_erase(fault);
+}
+
+FOSSIL_TEST(fossil_mockup_try_fault_network_packets_and_drop) {
+    char reply[64] = {0};
+    fossil_mockup_network_t *network = fossil_mockup_network_create("svc", "GET", "0123456789");
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(3);
+    fossil_mockup_fault_set_virtual_clock(fault, true);
+    fossil_mockup_fault_set_short_io(fault, 0.0, 3);
+    fossil_mockup_network_set_fault(network, fault);
+
+    ASSUME_ITS_EQUAL_CSTR("0123456789", fossil_mockup_network_request(network, "GET"));
+    size_t total = 0;
+    int packets = 0;
+    int64_t count;
+    while ((count = fossil_mockup_network_receive(network, reply + total, sizeof(reply) - 1 - total)) > 0) {
+        total += (size_t)count;
+        packets++;
+    }
+    ASSUME_ITS_EQUAL_CSTR("0123456789", reply);
+    ASSUME_ITS_EQUAL_I32(4, packets);
+
+    // A dropped connection stays dropped
+    fossil_mockup_fault_set_errors(fault, 0.0, 0.0, 1.0);
+    errno = 0;
+    ASSUME_ITS_TRUE(fossil_mockup_network_request(network, "GET") == NULL);
+    ASSUME_ITS_EQUAL_I32(ECONNRESET, errno);
+    fossil_mockup_fault_set_errors(fault, 0.0, 0.0, 0.0);
+    ASSUME_ITS_EQUAL_I64(-1, fossil_mockup_network_receive(network, reply, sizeof(reply)));
+    ASSUME_ITS_EQUAL_U64(1, fault->drop_count);
+
+    fossil_mockup_network_erase(network);
+    fossil_mockup_fault_erase(fault);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_fault_group) {
+    ADD_TEST(fossil_mockup_try_fault_replays_from_seed);
+    ADD_TEST(fossil_mockup_try_fault_latency_and_bandwidth);
+    ADD_TEST(fossil_mockup_try_fault_file_short_reads);
+    ADD_TEST(fossil_mockup_try_fault_partial_element_at_end);
+    ADD_TEST(fossil_mockup_try_fault_network_packets_and_drop);
+} // end of fixture
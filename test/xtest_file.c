@@ -125,6 +125,77 @@ FOSSIL_TEST(fossil_mockup_try_file_reset) {
     fossil_mockup_file_erase(file);
 }
 
+FOSSIL_TEST(fossil_mockup_try_file_binary_append) {
+    fossil_mockup_file_t *file = fossil_mockup_file_create("log.bin", "");
+    const char record[4] = {'a', '\0', 'b', '\n'};
+
+    for (int i = 0; i < 100000; i++) {
+        fossil_mockup_file_write(record, 1, sizeof(record), file);
+    }
+    ASSUME_ITS_EQUAL_SIZE(400000, file->size);
+    ASSUME_ITS_TRUE(file->capacity > file->size);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(file->content + 399996, record, sizeof(record)));
+
+    fossil_mockup_file_erase(file);
+}
+
+FOSSIL_TEST(fossil_mockup_try_file_from_buffer) {
+    static const char data[] = {'x', '\0', 'y', 'z'};
+    fossil_mockup_file_t *file = fossil_mockup_file_create_from_buffer("data.bin", data, sizeof(data));
+
+    ASSUME_ITS_TRUE(file->content == data);
+    ASSUME_ITS_EQUAL_SIZE(4, file->size);
+
+    // The first write takes a private copy and leaves the caller's buffer alone
+    fossil_mockup_file_seek(file, 3, SEEK_SET);
+    fossil_mockup_file_write("!", 1, 1, file);
+    ASSUME_ITS_FALSE(file->content == data);
+    ASSUME_ITS_EQUAL_I32('z', data[3]);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(file->content, "x\0y!", 4));
+
+    fossil_mockup_file_erase(file);
+}
+
+FOSSIL_TEST(fossil_mockup_try_file_read_view) {
+    fossil_mockup_file_t *file = fossil_mockup_file_create("view.txt", "Hello, World!");
+    size_t length;
+
+    const char *view = fossil_mockup_file_read_view(file, 5, &length);
+    ASSUME_ITS_TRUE(view == file->content);
+    ASSUME_ITS_EQUAL_SIZE(5, length);
+
+    view = fossil_mockup_file_read_view(file, 100, &length);
+    ASSUME_ITS_EQUAL_SIZE(8, length);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(view, ", World!", length));
+
+    fossil_mockup_file_read_view(file, 100, &length);
+    ASSUME_ITS_EQUAL_SIZE(0, length);
+
+    fossil_mockup_file_erase(file);
+}
+
+FOSSIL_TEST(fossil_mockup_try_file_from_fixture) {
+    const char *path = "fossil_file_fixture.bin";
+    FILE *fixture = fopen(path, "wb");
+    ASSUME_NOT_CNULL(fixture);
+    fwrite("fix\0ture", 1, 8, fixture);
+    fclose(fixture);
+
+    fossil_mockup_file_t *file = fossil_mockup_file_create_from_fixture(path);
+    ASSUME_NOT_CNULL(file);
+    ASSUME_ITS_EQUAL_SIZE(8, file->size);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(file->content, "fix\0ture", 8));
+
+    fossil_mockup_file_seek(file, 0, SEEK_END);
+    fossil_mockup_file_write("s", 1, 1, file);
+    ASSUME_ITS_EQUAL_CSTR("tures", file->content + 4);
+
+    fossil_mockup_file_erase(file);
+    remove(path);
+
+    ASSUME_ITS_CNULL(fossil_mockup_file_create_from_fixture("fossil_missing_fixture.bin"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -134,4 +205,8 @@ FOSSIL_TEST_GROUP(fossil_mockup_file_group) {
     ADD_TEST(fossil_mockup_try_file_write);
     ADD_TEST(fossil_mockup_try_file_seek_and_read);
     ADD_TEST(fossil_mockup_try_file_reset);
+    ADD_TEST(fossil_mockup_try_file_binary_append);
+    ADD_TEST(fossil_mockup_try_file_from_buffer);
+    ADD_TEST(fossil_mockup_try_file_read_view);
+    ADD_TEST(fossil_mockup_try_file_from_fixture);
 } // end of fixture
@@ -0,0 +1,202 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+#include <fossil/xassert.h> // fatal asserts
+#include <signal.h>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Decodes records of a one byte length followed by that many bytes, returns
+// the number of records or -1 when a record runs past the end.
+static int32_t fuzz_count_records(const uint8_t *data, size_t size, size_t *consumed) {
+    int32_t records = 0;
+    size_t at = 0;
+    while (at < size) {
+        size_t length = data[at];
+        if (length > size - at - 1) {
+            *consumed = at;
+            return -1;
+        }
+        at += 1 + length;
+        records++;
+    }
+    *consumed = at;
+    return records;
+}
+
+// Removes a scratch corpus directory and the inputs written into it.
+static void fuzz_remove_corpus(const char *directory) {
+#ifndef _WIN32
+    char path[FILENAME_MAX];
+    DIR *listing = opendir(directory);
+    if (listing == NULL) {
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(listing)) != NULL) {
+        if (entry->d_name[0] != '.' && (size_t)snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name) < sizeof(path)) {
+            remove(path);
+        }
+    }
+    closedir(listing);
+    rmdir(directory);
+#else
+    (void)directory;
+#endif
+}
+
+typedef struct {
+    const void *data;
+    size_t size;
+} fuzz_seed;
+
+static const uint8_t fuzz_one_record[] = {3, 'a', 'b', 'c'};
+static const uint8_t fuzz_truncated[] = {2, 0xff, 9, 'z'};
+static const fuzz_seed fuzz_record_seeds[] = {
+    {fuzz_one_record, sizeof(fuzz_one_record)},
+    {fuzz_truncated, sizeof(fuzz_truncated)},
+};
+
+// Runs a target over its seeds in a scratch corpus, which it then removes,
+// so inputs the loop finds never become rows of the next run.
+static bool fuzz_loop_scratch(fossil_test_t *target, const fuzz_seed *seeds, size_t count, uint64_t runs, fossil_fuzz_stats_t *stats) {
+    fossil_test_t scratch = *target;
+    scratch.table.path = "xtest_fuzz_scratch";
+    fuzz_remove_corpus(scratch.table.path);
+    for (size_t i = 0; i < count; i++) {
+        fossil_fuzz_corpus_add(&scratch, seeds[i].data, seeds[i].size);
+    }
+    bool passed = fossil_fuzz_loop(&scratch, runs, stats);
+    fuzz_remove_corpus(scratch.table.path);
+    return passed;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_FUZZ(fuzz_record_decoder, data, size) {
+    size_t consumed = 0;
+    int32_t records = fuzz_count_records(data, size, &consumed);
+    ASSUME_ITS_TRUE(consumed <= size);
+    ASSUME_ITS_TRUE(records < 0 || consumed == size);
+    ASSUME_ITS_TRUE(records <= (int32_t)size);
+}
+
+// Only used through the loop, neither is added to the group.
+FOSSIL_FUZZ(fuzz_asserts_short_inputs, data, size) {
+    (void)data;
+    ASSERT_ITS_TRUE(size < 3);
+}
+
+FOSSIL_FUZZ(fuzz_crashes_on_long_inputs, data, size) {
+    (void)data;
+    if (size >= 3) {
+        raise(SIGSEGV);
+    }
+}
+
+FOSSIL_TEST(fuzz_loop_runs_within_budget) {
+    fossil_fuzz_stats_t stats;
+    ASSUME_ITS_TRUE(fuzz_loop_scratch(&fuzz_record_decoder, fuzz_record_seeds, 2, 2000, &stats));
+    ASSUME_ITS_EQUAL_U64(2000, stats.runs);
+    ASSUME_ITS_TRUE(stats.corpus_size >= 2);
+    ASSUME_ITS_FALSE(stats.failed);
+
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    // The runner's crash handler is back, alternate stack and all
+    struct sigaction action;
+    sigaction(SIGSEGV, xnullptr, &action);
+    ASSUME_ITS_TRUE((action.sa_flags & SA_SIGINFO) != 0);
+    ASSUME_ITS_TRUE((action.sa_flags & SA_ONSTACK) != 0);
+#endif
+}
+
+FOSSIL_TEST(fuzz_loop_ends_failing_inputs) {
+    fossil_fuzz_stats_t stats;
+
+    // A failed ASSERT ends the input and the loop returns
+    const fuzz_seed long_input = {"long", 4};
+    ASSUME_ITS_FALSE(fuzz_loop_scratch(&fuzz_asserts_short_inputs, &long_input, 1, 100, &stats));
+    ASSUME_ITS_TRUE(stats.failed);
+    ASSUME_ITS_EQUAL_U64(1, stats.runs);
+    ASSUME_ITS_EQUAL_U64(1, fossil_test_failure_count());
+    fossil_test_failure_reset();
+
+    // So does a crash, which is noted for the case
+    ASSUME_ITS_FALSE(fuzz_loop_scratch(&fuzz_crashes_on_long_inputs, &long_input, 1, 100, &stats));
+    ASSUME_ITS_TRUE(stats.failed);
+    fossil_test_crash_t crash;
+    ASSUME_ITS_TRUE(fossil_test_crash_take(&crash));
+    ASSUME_ITS_EQUAL_I32(SIGSEGV, crash.signal);
+
+#ifdef FOSSIL_TEST_HAS_CRASH_HANDLER
+    struct sigaction action;
+    sigaction(SIGSEGV, xnullptr, &action);
+    ASSUME_ITS_TRUE((action.sa_flags & SA_SIGINFO) != 0);
+#endif
+    _TEST_ENV.rule.should_pass = true;
+}
+
+FOSSIL_TEST(fuzz_loop_rejects_plain_tests) {
+    fossil_fuzz_stats_t stats;
+    bool passing = _TEST_ENV.rule.should_pass;
+    ASSUME_ITS_FALSE(fossil_fuzz_loop(&fuzz_loop_rejects_plain_tests, 10, &stats));
+    ASSUME_ITS_TRUE(stats.failed);
+    ASSUME_ITS_EQUAL_U64(0, stats.runs);
+    ASSUME_ITS_FALSE(fossil_fuzz_corpus_add(&fuzz_loop_rejects_plain_tests, "x", 1));
+    ASSUME_ITS_TRUE(passing == _TEST_ENV.rule.should_pass);
+}
+
+// Seeds are written while the group registers, before any row runs.
+static void fuzz_remove_seeds(void) {
+    fuzz_remove_corpus(fuzz_record_decoder.table.path);
+#ifndef _WIN32
+    rmdir(FOSSIL_FUZZ_CORPUS);
+#endif
+}
+
+static void fuzz_write_seeds(void) {
+    for (size_t i = 0; i < sizeof(fuzz_record_seeds) / sizeof(fuzz_record_seeds[0]); i++) {
+        fossil_fuzz_corpus_add(&fuzz_record_decoder, fuzz_record_seeds[i].data, fuzz_record_seeds[i].size);
+    }
+    atexit(fuzz_remove_seeds);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fuzz_test_group) {
+    // Seeds for the corpus, replayed as cases of their own
+    fuzz_write_seeds();
+
+    ADD_TEST(fuzz_record_decoder);
+    ADD_TEST(fuzz_loop_runs_within_budget);
+    ADD_TEST(fuzz_loop_ends_failing_inputs);
+    ADD_TEST(fuzz_loop_rejects_plain_tests);
+} // end of fixture
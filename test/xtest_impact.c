@@ -0,0 +1,170 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Counters of the pretend program, dumped the way GCC 12 writes .gcda data.
+static uint64_t parse_calls = 0;
+static uint64_t lex_calls = 0;
+
+static void emit_words(void *impact, const uint32_t *words, unsigned count) {
+    fossil_test_impact_data(words, count * 4, impact);
+}
+
+static void emit_function(void *impact, uint32_t ident, uint64_t count) {
+    const uint32_t function[] = { 0x01000000, 12, ident, 0x1234, 0x5678 };
+    emit_words(impact, function, 5);
+    if (count == 0) {
+        const uint32_t zero[] = { 0x01a10000, (uint32_t)-16 };
+        emit_words(impact, zero, 2);
+    } else {
+        const uint32_t arcs[] = { 0x01a10000, 16, (uint32_t)count, (uint32_t)(count >> 32), 1, 0 };
+        emit_words(impact, arcs, 6);
+    }
+}
+
+static void fake_collect(void *impact) {
+    const uint32_t header[] = { 0x67636461, 0x4232322a, 0xabcdef, 0x11 };
+    const uint32_t end[] = { 0 };
+
+    fossil_test_impact_filename("/build/test/xcli.p/parser.c.gcda", impact);
+    emit_words(impact, header, 4);
+    emit_function(impact, 1, parse_calls);
+    emit_function(impact, 2, 0);
+    emit_words(impact, end, 1);
+
+    fossil_test_impact_filename("/build/lib/libx.a.p/src_lexer.c.gcda", impact);
+    emit_words(impact, header, 4);
+    emit_function(impact, 7, lex_calls);
+    emit_words(impact, end, 1);
+}
+
+static fossil_test_impact_t* recorded_index(void) {
+    parse_calls = 0;
+    lex_calls = 0;
+    fossil_test_impact_t *impact = fossil_test_impact_create(fake_collect);
+    fossil_test_impact_collect(impact, xnullptr);
+    parse_calls += 3;
+    fossil_test_impact_collect(impact, "parses");
+    lex_calls += 1;
+    fossil_test_impact_collect(impact, "lexes");
+    parse_calls += 1;
+    lex_calls += 1;
+    fossil_test_impact_collect(impact, "both");
+    fossil_test_impact_collect(impact, "neither");
+    return impact;
+}
+
+static fossil_test_impact_t* reloaded(const fossil_test_impact_t *impact, const char *changed) {
+    const char *path = "xtest_impact.index";
+    if (!fossil_test_impact_save(impact, path)) {
+        return xnullptr;
+    }
+    fossil_test_impact_t *loaded = fossil_test_impact_load(path);
+    remove(path);
+    if (loaded != xnullptr) {
+        fossil_test_impact_change(loaded, changed);
+    }
+    return loaded;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(impact_charges_functions_that_ran) {
+    fossil_test_impact_t *impact = recorded_index();
+
+    ASSUME_ITS_EQUAL_SIZE(2, impact->object_count);
+    ASSUME_ITS_EQUAL_SIZE(4, impact->case_count);
+    ASSUME_ITS_EQUAL_CSTR("parses", impact->cases[0].name);
+    ASSUME_ITS_EQUAL_SIZE(1, impact->cases[0].count);
+    ASSUME_ITS_EQUAL_U64(1, impact->cases[0].touches[0]);
+    ASSUME_ITS_EQUAL_SIZE(1, impact->cases[1].count);
+    ASSUME_ITS_EQUAL_U64((UINT64_C(1) << 32) | 7, impact->cases[1].touches[0]);
+    ASSUME_ITS_EQUAL_SIZE(2, impact->cases[2].count);
+    ASSUME_ITS_EQUAL_SIZE(0, impact->cases[3].count);
+
+    // Rows of a table add to the same case
+    parse_calls++;
+    fossil_test_impact_collect(impact, "lexes");
+    ASSUME_ITS_EQUAL_SIZE(4, impact->case_count);
+    ASSUME_ITS_EQUAL_SIZE(2, impact->cases[1].count);
+
+    fossil_test_impact_erase(impact);
+}
+
+FOSSIL_TEST(impact_selects_cases_of_changed_sources) {
+    fossil_test_impact_t *impact = recorded_index();
+
+    fossil_test_impact_t *loaded = reloaded(impact, "src/parser.c");
+    ASSUME_NOT_CNULL(loaded);
+    ASSUME_ITS_FALSE(loaded->select_all);
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "parses"));
+    ASSUME_ITS_FALSE(fossil_test_impact_selects(loaded, "lexes"));
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "both"));
+    ASSUME_ITS_FALSE(fossil_test_impact_selects(loaded, "neither"));
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "added_later"));
+    fossil_test_impact_erase(loaded);
+
+    // Objects named after their directory still match
+    loaded = reloaded(impact, " docs/guide.md , src/lexer.c ");
+    ASSUME_NOT_CNULL(loaded);
+    ASSUME_ITS_FALSE(fossil_test_impact_selects(loaded, "parses"));
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "lexes"));
+    fossil_test_impact_erase(loaded);
+
+    fossil_test_impact_erase(impact);
+}
+
+FOSSIL_TEST(impact_runs_everything_when_unsure) {
+    fossil_test_impact_t *impact = recorded_index();
+
+    fossil_test_impact_t *loaded = reloaded(impact, "include/parser.h");
+    ASSUME_NOT_CNULL(loaded);
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "neither"));
+    fossil_test_impact_erase(loaded);
+
+    loaded = reloaded(impact, "src/emitter.c");
+    ASSUME_NOT_CNULL(loaded);
+    ASSUME_ITS_TRUE(fossil_test_impact_selects(loaded, "neither"));
+    fossil_test_impact_erase(loaded);
+
+    loaded = reloaded(impact, "README.md");
+    ASSUME_NOT_CNULL(loaded);
+    ASSUME_ITS_FALSE(fossil_test_impact_selects(loaded, "both"));
+    fossil_test_impact_erase(loaded);
+
+    ASSUME_ITS_CNULL(fossil_test_impact_load("xtest_impact.missing"));
+    fossil_test_impact_erase(impact);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(impact_test_group) {
+    ADD_TEST(impact_charges_functions_that_ran);
+    ADD_TEST(impact_selects_cases_of_changed_sources);
+    ADD_TEST(impact_runs_everything_when_unsure);
+} // end of fixture
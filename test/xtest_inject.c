@@ -14,6 +14,7 @@ Description:
 #include <fossil/xassume.h> // extra asserts
 
 #include <fossil/mockup/inject.h> // library under test
+#include <fossil/mockup/fault.h>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilites
@@ -22,7 +23,11 @@ Description:
 // mock objects are set here.
 // * * * * * * * * * * * * * * * * * * * * * * * *
 
-// placeholder
+// Stands in for a library function the code under test calls directly.
+static uint64_t fake_fault_now(const fossil_mockup_fault_t *fault) {
+    (void)fault;
+    return 1234;
+}
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Cases
@@ -60,10 +65,50 @@ FOSSIL_TEST(fossil_mockup_try_inject_get_replacement) {
     fossil_mockup_inject_erase(inject);
 }
 
+FOSSIL_TEST(fossil_mockup_try_inject_patch_and_restore) {
+#if defined(__ELF__) && defined(__linux__)
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(1);
+    fossil_mockup_inject_t *inject = fossil_mockup_inject_create_function("fossil_mockup_fault_now", (fossil_mockup_function_t)fake_fault_now);
+
+    // The call below is an ordinary call into the mock library. Linked
+    // statically it is a direct call with no GOT entry, nothing to patch.
+    if (!fossil_mockup_inject_patch(inject)) {
+        ASSUME_ITS_FALSE(inject->patched);
+        fossil_mockup_inject_erase(inject);
+        fossil_mockup_fault_erase(fault);
+        return;
+    }
+    ASSUME_ITS_EQUAL_U64(1234, fossil_mockup_fault_now(fault));
+    uint64_t (*original)(const fossil_mockup_fault_t *) = (uint64_t (*)(const fossil_mockup_fault_t *))fossil_mockup_inject_get_original(inject);
+    ASSUME_ITS_TRUE(original != NULL && original != fake_fault_now);
+    if (original != NULL) {
+        ASSUME_ITS_EQUAL_U64(0, original(fault));
+    }
+
+    fossil_mockup_inject_restore(inject);
+    ASSUME_ITS_EQUAL_U64(0, fossil_mockup_fault_now(fault));
+
+    // Erasing a patched dependency restores it too
+    ASSUME_ITS_TRUE(fossil_mockup_inject_patch(inject));
+    fossil_mockup_inject_erase(inject);
+    ASSUME_ITS_EQUAL_U64(0, fossil_mockup_fault_now(fault));
+    fossil_mockup_fault_erase(fault);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_inject_patch_unknown) {
+    fossil_mockup_inject_t *inject = fossil_mockup_inject_create_function("fossil_no_such_function", (fossil_mockup_function_t)fake_fault_now);
+    ASSUME_ITS_FALSE(fossil_mockup_inject_patch(inject));
+    ASSUME_ITS_FALSE(inject->patched);
+    fossil_mockup_inject_erase(inject);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
 FOSSIL_TEST_GROUP(fossil_mockup_inject_group) {
     ADD_TEST(fossil_mockup_try_inject_create_and_erase);
     ADD_TEST(fossil_mockup_try_inject_get_replacement);
+    ADD_TEST(fossil_mockup_try_inject_patch_and_restore);
+    ADD_TEST(fossil_mockup_try_inject_patch_unknown);
 } // end of fixture
@@ -22,7 +22,15 @@ Description:
 // mock objects are set here.
 // * * * * * * * * * * * * * * * * * * * * * * * *
 
-// placeholder
+static bool even_numbers(void *context, uint64_t index, void **value) {
+    int64_t *slot = (int64_t *)context;
+    if (index >= 1000000) {
+        return false;
+    }
+    *slot = (int64_t)index * 2;
+    *value = slot;
+    return true;
+}
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Cases
@@ -109,6 +117,78 @@ FOSSIL_TEST(fossil_mockup_try_input_reset) {
     fossil_mockup_input_erase(input);
 }
 
+FOSSIL_TEST(fossil_mockup_try_input_generator) {
+    int64_t slot = 0;
+    fossil_mockup_input_t *input = fossil_mockup_input_create("test_function");
+    fossil_mockup_input_set_generator(input, even_numbers, &slot);
+    ASSUME_ITS_EQUAL_I64(-1, fossil_mockup_input_count(input));
+
+    // A million values without a million allocations
+    bool in_order = true;
+    for (int64_t i = 0; i < 1000000; i++) {
+        int64_t *value = (int64_t *)fossil_mockup_input_get(input);
+        in_order = in_order && value == &slot && *value == i * 2;
+    }
+    ASSUME_ITS_TRUE(in_order);
+    ASSUME_ITS_CNULL(fossil_mockup_input_get(input));
+    ASSUME_ITS_CNULL(fossil_mockup_input_get(input));
+    ASSUME_ITS_TRUE(fossil_mockup_input_verify_call_count(input, 1000000));
+
+    fossil_mockup_input_reset(input);
+    ASSUME_ITS_EQUAL_I64(0, *(int64_t *)fossil_mockup_input_get(input));
+
+    fossil_mockup_input_erase(input);
+}
+
+FOSSIL_TEST(fossil_mockup_try_input_range) {
+    fossil_mockup_input_t *input = fossil_mockup_input_create("test_function");
+    fossil_mockup_input_set_range(input, 10, 0, -3);
+    ASSUME_ITS_EQUAL_I64(4, fossil_mockup_input_count(input));
+
+    int64_t expected[] = {10, 7, 4, 1, 10};
+    for (int i = 0; i < 5; i++) {
+        ASSUME_ITS_EQUAL_I64(expected[i], *(int64_t *)fossil_mockup_input_get(input));
+    }
+    ASSUME_ITS_EQUAL_SIZE(sizeof(int64_t), fossil_mockup_input_length(input));
+
+    fossil_mockup_input_set_range(input, 5, 5, 1);
+    ASSUME_ITS_CNULL(fossil_mockup_input_get(input));
+
+    fossil_mockup_input_erase(input);
+}
+
+FOSSIL_TEST(fossil_mockup_try_input_lines_and_records) {
+    const char *path = "fossil_input_fixture.txt";
+    FILE *fixture = fopen(path, "wb");
+    ASSUME_NOT_CNULL(fixture);
+    fputs("alpha\r\n\nomega", fixture);
+    fclose(fixture);
+
+    fossil_mockup_input_t *input = fossil_mockup_input_create("test_function");
+    ASSUME_ITS_TRUE(fossil_mockup_input_set_lines(input, path));
+    ASSUME_ITS_EQUAL_I64(3, fossil_mockup_input_count(input));
+    ASSUME_ITS_EQUAL_CSTR("alpha", (const char *)fossil_mockup_input_get(input));
+    ASSUME_ITS_EQUAL_CSTR("", (const char *)fossil_mockup_input_get(input));
+    ASSUME_ITS_EQUAL_CSTR("omega", (const char *)fossil_mockup_input_get(input));
+    ASSUME_ITS_EQUAL_SIZE(5, fossil_mockup_input_length(input));
+    ASSUME_ITS_EQUAL_CSTR("alpha", (const char *)fossil_mockup_input_get(input));
+
+    // Records point into the fixture, the partial tail is skipped
+    ASSUME_ITS_TRUE(fossil_mockup_input_set_records(input, path, 4));
+    ASSUME_ITS_EQUAL_I64(3, fossil_mockup_input_count(input));
+    fossil_mockup_input_reset(input);
+    ASSUME_ITS_TRUE(memcmp("alph", fossil_mockup_input_get(input), 4) == 0);
+    fossil_mockup_input_get(input);
+    ASSUME_ITS_TRUE(memcmp("omeg", fossil_mockup_input_get(input), 4) == 0);
+    ASSUME_ITS_TRUE(memcmp("alph", fossil_mockup_input_get(input), 4) == 0);
+
+    ASSUME_ITS_FALSE(fossil_mockup_input_set_lines(input, "fossil_missing_fixture.txt"));
+    ASSUME_ITS_FALSE(fossil_mockup_input_set_records(input, path, 0));
+
+    fossil_mockup_input_erase(input);
+    remove(path);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -117,4 +197,7 @@ FOSSIL_TEST_GROUP(fossil_mockup_input_group) {
     ADD_TEST(fossil_mockup_try_input_set_and_get);
     ADD_TEST(fossil_mockup_try_input_verify_call_count);
     ADD_TEST(fossil_mockup_try_input_reset);
+    ADD_TEST(fossil_mockup_try_input_generator);
+    ADD_TEST(fossil_mockup_try_input_range);
+    ADD_TEST(fossil_mockup_try_input_lines_and_records);
 } // end of fixture
@@ -0,0 +1,153 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+#include <fossil/xassert.h> // fatal asserts
+
+#include <fossil/_common/atomic.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static size_t property_reverse(char *out, const char *text) {
+    size_t length = strlen(text);
+    for (size_t i = 0; i < length; i++) {
+        out[i] = text[length - 1 - i];
+    }
+    out[length] = '\0';
+    return length;
+}
+
+// Counts cases that went on past a failure, which must never happen.
+static volatile uint64_t property_ran_past_failure = 0;
+
+static void property_expect_small(fossil_property_t *prop, int64_t value) {
+    FOSSIL_PROPERTY_CHECK(value < 90);
+}
+
+static void property_check_in_helper(fossil_property_t *prop) {
+    int64_t value = fossil_property_i64(prop, "value", 0, 100);
+    property_expect_small(prop, value);
+    if (value >= 90) {
+        fossil_atomic_fetch_add_u64(&property_ran_past_failure, 1);
+    }
+}
+
+static void property_assert_in_body(fossil_property_t *prop) {
+    int64_t value = fossil_property_i64(prop, "value", 0, 100);
+    ASSUME_ITS_TRUE(value < 90);
+    if (value >= 90) {
+        fossil_atomic_fetch_add_u64(&property_ran_past_failure, 1);
+    }
+}
+
+static void property_assert_passes(fossil_property_t *prop) {
+    int64_t value = fossil_property_i64(prop, "value", 0, 100);
+    ASSUME_ITS_TRUE(value <= 100);
+    ASSERT_ITS_TRUE(value >= 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_PROPERTY(property_integers_stay_in_range, 2000) {
+    int64_t a = fossil_property_i64(prop, "a", -50, 50);
+    uint64_t b = fossil_property_u64(prop, "b", 10, 20);
+    int64_t c = fossil_property_i64(prop, "c", INT64_MIN, INT64_MAX);
+    FOSSIL_PROPERTY_CHECK(a >= -50 && a <= 50);
+    FOSSIL_PROPERTY_CHECK(b >= 10 && b <= 20);
+    FOSSIL_PROPERTY_CHECK(c / 2 * 2 + c % 2 == c);
+}
+
+FOSSIL_PROPERTY(property_addition_commutes, 2000) {
+    int64_t a = fossil_property_i64(prop, "a", INT32_MIN, INT32_MAX);
+    int64_t b = fossil_property_i64(prop, "b", INT32_MIN, INT32_MAX);
+    FOSSIL_PROPERTY_CHECK(a + b == b + a);
+}
+
+FOSSIL_PROPERTY(property_doubles_stay_in_range, 2000) {
+    double x = fossil_property_f64(prop, "x", -1.5, 3.0);
+    double any = fossil_property_f64_any(prop, "any");
+    FOSSIL_PROPERTY_CHECK(x >= -1.5 && x <= 3.0);
+    FOSSIL_PROPERTY_CHECK(any != any || any == any * 1.0);
+}
+
+FOSSIL_PROPERTY(property_reverse_twice_is_identity, 1000) {
+    char once[65];
+    char twice[65];
+    const char *text = fossil_property_cstr(prop, "text", 64, xnullptr);
+    FOSSIL_PROPERTY_CHECK(strlen(text) <= 64);
+    property_reverse(once, text);
+    property_reverse(twice, once);
+    FOSSIL_PROPERTY_CHECK(strcmp(text, twice) == 0);
+}
+
+FOSSIL_PROPERTY(property_alphabet_is_respected, 1000) {
+    const char *text = fossil_property_cstr(prop, "text", 32, "ab");
+    FOSSIL_PROPERTY_CHECK(strspn(text, "ab") == strlen(text));
+}
+
+FOSSIL_PROPERTY(property_bytes_fit_buffer, 1000) {
+    unsigned char buffer[48];
+    size_t length = fossil_property_bytes(prop, "buffer", buffer, sizeof(buffer));
+    FOSSIL_PROPERTY_CHECK(length <= sizeof(buffer));
+}
+
+FOSSIL_PROPERTY(property_require_discards_cases, 1000) {
+    int64_t divisor = fossil_property_i64(prop, "divisor", -8, 8);
+    bool negate = fossil_property_bool(prop, "negate");
+    FOSSIL_PROPERTY_REQUIRE(divisor != 0);
+    int64_t value = negate ? -divisor * 3 : divisor * 3;
+    FOSSIL_PROPERTY_CHECK(value % divisor == 0);
+}
+
+FOSSIL_TEST(property_failures_end_the_case) {
+    static const fossil_property_spec_t helper = { "helper", property_check_in_helper, 2000 };
+    static const fossil_property_spec_t asserting = { "asserting", property_assert_in_body, 2000 };
+    static const fossil_property_spec_t passing = { "passing", property_assert_passes, 2000 };
+    uint64_t index = 0;
+    uint64_t discarded = 0;
+
+    // Checks in helpers and plain assertions both end the case on its own
+    // worker and leave the scoreboard of this test alone.
+    ASSUME_ITS_TRUE(fossil_property_falsified(&helper, &index, &discarded));
+    ASSUME_ITS_TRUE(index < 2000);
+    ASSUME_ITS_TRUE(fossil_property_falsified(&asserting, &index, &discarded));
+    ASSUME_ITS_EQUAL_U64(0, discarded);
+    ASSUME_ITS_EQUAL_U64(0, fossil_atomic_load_u64(&property_ran_past_failure));
+    ASSUME_ITS_FALSE(fossil_property_falsified(&passing, &index, &discarded));
+    ASSUME_ITS_EQUAL_U64(UINT64_MAX, index);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(property_test_group) {
+    ADD_TEST(property_integers_stay_in_range);
+    ADD_TEST(property_addition_commutes);
+    ADD_TEST(property_doubles_stay_in_range);
+    ADD_TEST(property_reverse_twice_is_identity);
+    ADD_TEST(property_alphabet_is_respected);
+    ADD_TEST(property_bytes_fit_buffer);
+    ADD_TEST(property_require_discards_cases);
+    ADD_TEST(property_failures_end_the_case);
+} // end of fixture
@@ -0,0 +1,200 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/route.h> // library under test
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static const char* route_body(const fossil_mockup_route_match_t *match) {
+    return fossil_mockup_response_body(match->response, NULL);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_route_precedence) {
+    fossil_mockup_route_match_t match;
+    fossil_mockup_route_table_t *table = fossil_mockup_route_table_create();
+    fossil_mockup_response_t *exact = fossil_mockup_response_create("exact");
+    fossil_mockup_response_t *pattern = fossil_mockup_response_create("pattern");
+    fossil_mockup_response_t *prefix = fossil_mockup_response_create("prefix");
+    fossil_mockup_response_t *longer = fossil_mockup_response_create("longer");
+
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_EXACT, "api", "GET", "/users/me", exact));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "api", "GET", "/users/:id", pattern));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PREFIX, "api", "GET", "/users/", prefix));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PREFIX, "api", "GET", "/users/7/", longer));
+    ASSUME_ITS_FALSE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_EXACT, "api", "GET", "/users/me", prefix));
+    ASSUME_ITS_EQUAL_SIZE(4, fossil_mockup_route_count(table));
+
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "api", "GET", "/users/me", 9, &match));
+    ASSUME_ITS_EQUAL_CSTR("exact", route_body(&match));
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "api", "GET", "/users/42", 9, &match));
+    ASSUME_ITS_EQUAL_CSTR("pattern", route_body(&match));
+    ASSUME_ITS_EQUAL_I32(1, match.capture_count);
+    ASSUME_ITS_TRUE(match.captures[0].value_length == 2 && memcmp(match.captures[0].value, "42", 2) == 0);
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "api", "GET", "/users/42/posts", 15, &match));
+    ASSUME_ITS_EQUAL_CSTR("prefix", route_body(&match));
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "api", "GET", "/users/7/posts", 14, &match));
+    ASSUME_ITS_EQUAL_CSTR("longer", route_body(&match));
+
+    // Method and host are part of the key
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "api", "POST", "/users/me", 9, &match));
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "web", "GET", "/users/me", 9, &match));
+
+    fossil_mockup_response_release(exact);
+    fossil_mockup_response_release(pattern);
+    fossil_mockup_response_release(prefix);
+    fossil_mockup_response_release(longer);
+    fossil_mockup_route_table_erase(table);
+}
+
+FOSSIL_TEST(fossil_mockup_try_route_patterns_and_wildcard_host) {
+    fossil_mockup_route_match_t match;
+    fossil_mockup_route_table_t *table = fossil_mockup_route_table_create();
+    fossil_mockup_response_t *any = fossil_mockup_response_create("any");
+    fossil_mockup_response_t *own = fossil_mockup_response_create("own");
+
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "*", "GET", "/files/*/raw/**", any));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "cdn", "GET", "/files/*/raw/**", own));
+    ASSUME_ITS_FALSE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "*", "GET", "/**/tail", any));
+
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "web", "GET", "/files/a/raw/b/c", 16, &match));
+    ASSUME_ITS_EQUAL_CSTR("any", route_body(&match));
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "cdn", "GET", "/files/a/raw", 12, &match));
+    ASSUME_ITS_EQUAL_CSTR("own", route_body(&match));
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "web", "GET", "/files/a/cooked/b", 17, &match));
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "web", "GET", "/files", 6, &match));
+
+    fossil_mockup_response_release(any);
+    fossil_mockup_response_release(own);
+    fossil_mockup_route_table_erase(table);
+}
+
+FOSSIL_TEST(fossil_mockup_try_route_template) {
+    char buffer[64];
+    fossil_mockup_route_match_t match;
+    fossil_mockup_route_table_t *table = fossil_mockup_route_table_create();
+    fossil_mockup_response_t *user = fossil_mockup_response_template("{\"org\": \"{org}\", \"id\": {id}{missing}}");
+    ASSUME_ITS_TRUE(fossil_mockup_response_is_template(user));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "*", "GET", "/orgs/:org/users/:id", user));
+    fossil_mockup_response_release(user);
+
+    const char *request = "GET /orgs/fossil/users/7 HTTP/1.1\r\nHost: api\r\n";
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup_request(table, "api", request, strlen(request), &match));
+    ASSUME_ITS_EQUAL_I32(2, match.capture_count);
+    size_t length = fossil_mockup_response_render(match.response, &match, buffer, sizeof(buffer));
+    ASSUME_ITS_EQUAL_SIZE(strlen("{\"org\": \"fossil\", \"id\": 7}"), length);
+    buffer[length] = '\0';
+    ASSUME_ITS_EQUAL_CSTR("{\"org\": \"fossil\", \"id\": 7}", buffer);
+
+    // A short buffer reports the full length like snprintf
+    ASSUME_ITS_EQUAL_SIZE(length, fossil_mockup_response_render(match.response, &match, buffer, 4));
+    ASSUME_ITS_TRUE(memcmp(buffer, "{\"or", 4) == 0);
+
+    fossil_mockup_route_table_erase(table);
+}
+
+FOSSIL_TEST(fossil_mockup_try_route_many_shared) {
+    enum { ROUTES = 5000 };
+    char path[64];
+    fossil_mockup_route_match_t match;
+    fossil_mockup_route_table_t *table = fossil_mockup_route_table_create();
+    fossil_mockup_response_t *ok = fossil_mockup_response_borrow("200 OK", 6);
+    for (int i = 0; i < ROUTES; i++) {
+        snprintf(path, sizeof(path), "/service/%d", i);
+        fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_EXACT, "svc", "GET", path, ok);
+        snprintf(path, sizeof(path), "/assets/%d/", i);
+        fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PREFIX, "svc", "GET", path, ok);
+    }
+    fossil_mockup_response_release(ok);
+    ASSUME_ITS_EQUAL_SIZE(2 * ROUTES, fossil_mockup_route_count(table));
+
+    bool all_found = true;
+    for (int i = 0; i < ROUTES; i++) {
+        int length = snprintf(path, sizeof(path), "/service/%d", i);
+        all_found = all_found && fossil_mockup_route_lookup(table, "svc", "GET", path, (size_t)length, &match) &&
+                    match.kind == FOSSIL_MOCKUP_ROUTE_EXACT && match.response == ok;
+        length = snprintf(path, sizeof(path), "/assets/%d/app.js", i);
+        all_found = all_found && fossil_mockup_route_lookup(table, "svc", "GET", path, (size_t)length, &match) &&
+                    match.kind == FOSSIL_MOCKUP_ROUTE_PREFIX && match.response == ok;
+    }
+    ASSUME_ITS_TRUE(all_found);
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "svc", "GET", "/service/5000", 13, &match));
+
+    fossil_mockup_route_table_erase(table);
+}
+
+FOSSIL_TEST(fossil_mockup_try_route_many_patterns) {
+    enum { ROUTES = 2000 };
+    char path[64];
+    fossil_mockup_route_match_t match;
+    fossil_mockup_route_table_t *table = fossil_mockup_route_table_create();
+    fossil_mockup_response_t *first = fossil_mockup_response_create("first");
+    fossil_mockup_response_t *param = fossil_mockup_response_create("param");
+    fossil_mockup_response_t *late = fossil_mockup_response_create("late");
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "svc", "GET", "/item0/:id/pinned", first));
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "svc", "GET", "/:kind/:id/pinned", param));
+    for (int i = 0; i < ROUTES; i++) {
+        snprintf(path, sizeof(path), "/item%d/:id", i);
+        fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "svc", "GET", path, first);
+    }
+    ASSUME_ITS_TRUE(fossil_mockup_route_add(table, FOSSIL_MOCKUP_ROUTE_PATTERN, "svc", "GET", "/item1/:id/pinned", late));
+    fossil_mockup_response_release(first);
+    fossil_mockup_response_release(param);
+    fossil_mockup_response_release(late);
+
+    bool all_found = true;
+    for (int i = 0; i < ROUTES; i++) {
+        int length = snprintf(path, sizeof(path), "/item%d/%d", i, i);
+        all_found = all_found && fossil_mockup_route_lookup(table, "svc", "GET", path, (size_t)length, &match) &&
+                    match.kind == FOSSIL_MOCKUP_ROUTE_PATTERN && match.capture_count == 1 &&
+                    strcmp(route_body(&match), "first") == 0;
+    }
+    ASSUME_ITS_TRUE(all_found);
+
+    // Patterns keep the order they were added in across the index
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "svc", "GET", "/item0/7/pinned", 15, &match));
+    ASSUME_ITS_EQUAL_CSTR("first", route_body(&match));
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "svc", "GET", "/item1/7/pinned", 15, &match));
+    ASSUME_ITS_EQUAL_CSTR("param", route_body(&match));
+    ASSUME_ITS_EQUAL_I32(2, match.capture_count);
+    ASSUME_ITS_TRUE(fossil_mockup_route_lookup(table, "svc", "GET", "/other/7/pinned", 15, &match));
+    ASSUME_ITS_EQUAL_CSTR("param", route_body(&match));
+    ASSUME_ITS_FALSE(fossil_mockup_route_lookup(table, "svc", "GET", "/other/7", 8, &match));
+
+    fossil_mockup_route_table_erase(table);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_route_group) {
+    ADD_TEST(fossil_mockup_try_route_precedence);
+    ADD_TEST(fossil_mockup_try_route_patterns_and_wildcard_host);
+    ADD_TEST(fossil_mockup_try_route_template);
+    ADD_TEST(fossil_mockup_try_route_many_shared);
+    ADD_TEST(fossil_mockup_try_route_many_patterns);
+} // end of fixture
@@ -0,0 +1,160 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup.h> // library under test
+#include <fossil/_common/thread.h>
+#include <stdio.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_FIXTURE(sequence_fixture);
+
+FOSSIL_SETUP(sequence_fixture) {
+    fossil_mockup_sequence_start(0);
+} // end of setup
+
+FOSSIL_TEARDOWN(sequence_fixture) {
+    fossil_mockup_sequence_erase();
+} // end of teardown
+
+// Registers enough new names to grow the registry several times over.
+static void *sequence_register_many(void *arg) {
+    (void)arg;
+    char name[32];
+    for (int i = 0; i < 1024; i++) {
+        snprintf(name, sizeof(name), "sequence_grow_%d", i);
+        fossil_mockup_sequence_register(name);
+    }
+    return NULL;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_sequence_register) {
+    int32_t first = fossil_mockup_sequence_register("sequence_open");
+    int32_t again = fossil_mockup_sequence_register("sequence_open");
+    int32_t other = fossil_mockup_sequence_register("sequence_close");
+
+    ASSUME_ITS_EQUAL_I32(first, again);
+    ASSUME_NOT_EQUAL_I32(first, other);
+    ASSUME_ITS_EQUAL_CSTR("sequence_close", fossil_mockup_sequence_name(other));
+}
+
+FOSSIL_TEST(fossil_mockup_try_sequence_name_while_registering) {
+    int32_t anchor = fossil_mockup_sequence_register("sequence_anchor");
+    fossil_thread_t thread;
+    ASSUME_ITS_EQUAL_I32(0, fossil_thread_create(&thread, sequence_register_many, NULL));
+
+    bool stable = true;
+    for (int i = 0; i < 4096; i++) {
+        const char *name = fossil_mockup_sequence_name(anchor);
+        if (name == NULL || strcmp(name, "sequence_anchor") != 0) {
+            stable = false;
+        }
+    }
+    ASSUME_ITS_EQUAL_I32(0, fossil_thread_join(thread));
+    ASSUME_ITS_TRUE(stable);
+    ASSUME_ITS_EQUAL_CSTR("sequence_grow_1023",
+        fossil_mockup_sequence_name(fossil_mockup_sequence_register("sequence_grow_1023")));
+}
+
+FOSSIL_TEST(fossil_mockup_try_sequence_across_mocks) {
+    fossil_mockup_t *open = fossil_mockup_create("open", 0);
+    fossil_mockup_spy_t *write = fossil_mockup_spy_create("write", 0);
+    fossil_mockup_stub_t *close = fossil_mockup_stub_create("close");
+
+    fossil_mockup_sequence_expect_order(3, "open", "write", "close");
+    fossil_mockup_sequence_expect_before("write", "close");
+    fossil_mockup_sequence_expect_count("write", 3);
+
+    fossil_mockup_call(open);
+    for (int i = 0; i < 3; i++) {
+        fossil_mockup_spy_record_call(write);
+    }
+    fossil_mockup_stub_call(close);
+
+    ASSUME_ITS_EQUAL_SIZE(5, fossil_mockup_sequence_count());
+    ASSUME_ITS_EQUAL_I32(open->sequence_id, fossil_mockup_sequence_event(0)->mock_id);
+    ASSUME_ITS_EQUAL_I32(close->sequence_id, fossil_mockup_sequence_event(4)->mock_id);
+    ASSUME_ITS_TRUE(fossil_mockup_sequence_verify());
+
+    fossil_mockup_erase(open);
+    fossil_mockup_spy_erase(write);
+    fossil_mockup_stub_erase(close);
+}
+
+FOSSIL_TEST(fossil_mockup_try_sequence_out_of_order) {
+    fossil_mockup_spy_t *write = fossil_mockup_spy_create("write", 0);
+    fossil_mockup_stub_t *close = fossil_mockup_stub_create("close");
+
+    fossil_mockup_sequence_expect_before("write", "close");
+
+    fossil_mockup_spy_record_call(write);
+    fossil_mockup_stub_call(close);
+    fossil_mockup_spy_record_call(write);
+
+    ASSUME_ITS_FALSE(fossil_mockup_sequence_verify());
+
+    fossil_mockup_spy_erase(write);
+    fossil_mockup_stub_erase(close);
+}
+
+FOSSIL_TEST(fossil_mockup_try_sequence_overflow) {
+    fossil_mockup_stub_t *tick = fossil_mockup_stub_create("tick");
+    fossil_mockup_sequence_start(2);
+
+    for (int i = 0; i < 4; i++) {
+        fossil_mockup_stub_call(tick);
+    }
+
+    ASSUME_ITS_EQUAL_SIZE(2, fossil_mockup_sequence_count());
+    ASSUME_ITS_EQUAL_SIZE(2, fossil_mockup_sequence_dropped());
+    ASSUME_ITS_FALSE(fossil_mockup_sequence_verify());
+
+    fossil_mockup_stub_erase(tick);
+}
+
+FOSSIL_TEST(fossil_mockup_try_sequence_stopped) {
+    fossil_mockup_stub_t *tick = fossil_mockup_stub_create("tick");
+    fossil_mockup_sequence_stop();
+
+    fossil_mockup_stub_call(tick);
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_mockup_sequence_count());
+
+    fossil_mockup_stub_erase(tick);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_sequence_group) {
+    ADD_TEST(fossil_mockup_try_sequence_register);
+    ADD_TEST(fossil_mockup_try_sequence_name_while_registering);
+    ADD_TESTF(fossil_mockup_try_sequence_across_mocks, sequence_fixture);
+    ADD_TESTF(fossil_mockup_try_sequence_out_of_order, sequence_fixture);
+    ADD_TESTF(fossil_mockup_try_sequence_overflow, sequence_fixture);
+    ADD_TESTF(fossil_mockup_try_sequence_stopped, sequence_fixture);
+} // end of fixture
@@ -0,0 +1,265 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/server.h> // library under test
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+#ifndef _WIN32
+static int connect_loopback(int type, uint16_t port) {
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int fd = socket(AF_INET, type, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool read_reply(int fd, char *buffer, size_t length) {
+    size_t received = 0;
+    while (received < length) {
+        ssize_t count = recv(fd, buffer + received, length - received, 0);
+        if (count <= 0) {
+            return false;
+        }
+        received += (size_t)count;
+    }
+    buffer[received] = '\0';
+    return true;
+}
+#endif
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_server_tcp_pipelined) {
+#ifndef _WIN32
+    char reply[32];
+    fossil_mockup_server_t *server = fossil_mockup_server_create("svc", FOSSIL_MOCKUP_SERVER_TCP, NULL);
+    fossil_mockup_server_add(server, fossil_mockup_network_create("svc", "PING", "PONG\n"));
+    fossil_mockup_server_add(server, fossil_mockup_network_create("*", "STATUS", "OK\n"));
+    fossil_mockup_server_add(server, fossil_mockup_network_create("other", "SECRET", "NO\n"));
+    ASSUME_ITS_TRUE(fossil_mockup_server_start(server));
+    ASSUME_NOT_EQUAL_U16(0, fossil_mockup_server_port(server));
+
+    int fd = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+    ASSUME_ITS_TRUE(fd >= 0);
+    const char *requests = "PING\nSECRET\nSTATUS\nPI";
+    send(fd, requests, strlen(requests), 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, 8));
+    ASSUME_ITS_EQUAL_CSTR("PONG\nOK\n", reply);
+
+    // The rest of a split request arrives later
+    send(fd, "NG\n", 3, 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, 5));
+    ASSUME_ITS_EQUAL_CSTR("PONG\n", reply);
+    close(fd);
+
+    fossil_mockup_server_stop(server);
+    ASSUME_ITS_EQUAL_U64(3, fossil_mockup_server_request_count(server));
+    ASSUME_ITS_EQUAL_U64(1, fossil_mockup_server_unmatched_count(server));
+    fossil_mockup_server_erase(server);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_default_and_delimiter) {
+#ifndef _WIN32
+    char reply[64];
+    const char *not_found = "HTTP/1.1 404 Not Found\r\n\r\n";
+    fossil_mockup_server_t *server = fossil_mockup_server_create("web", FOSSIL_MOCKUP_SERVER_TCP, "127.0.0.1:0");
+    fossil_mockup_server_set_delimiter(server, "\r\n\r\n");
+    fossil_mockup_server_set_default(server, not_found);
+    fossil_mockup_server_start(server);
+
+    int fd = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+    const char *request = "GET /missing HTTP/1.1\r\nHost: web\r\n\r\n";
+    send(fd, request, strlen(request), 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, strlen(not_found)));
+    ASSUME_ITS_EQUAL_CSTR(not_found, reply);
+    close(fd);
+
+    fossil_mockup_server_erase(server);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_udp) {
+#ifndef _WIN32
+    char reply[16] = {0};
+    fossil_mockup_server_t *server = fossil_mockup_server_create("dns", FOSSIL_MOCKUP_SERVER_UDP, NULL);
+    fossil_mockup_server_add(server, fossil_mockup_network_create("dns", "A example", "1.2.3.4"));
+    ASSUME_ITS_TRUE(fossil_mockup_server_start(server));
+
+    int fd = connect_loopback(SOCK_DGRAM, fossil_mockup_server_port(server));
+    send(fd, "A example\n", 10, 0);
+    ASSUME_ITS_EQUAL_I64(7, (int64_t)recv(fd, reply, sizeof(reply) - 1, 0));
+    ASSUME_ITS_EQUAL_CSTR("1.2.3.4", reply);
+    close(fd);
+
+    fossil_mockup_server_erase(server);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_unix) {
+#ifndef _WIN32
+    char reply[16];
+    char path[64];
+    snprintf(path, sizeof(path), "fossil_mock_%d.sock", (int)getpid());
+    fossil_mockup_server_t *server = fossil_mockup_server_create("ipc", FOSSIL_MOCKUP_SERVER_UNIX, path);
+    fossil_mockup_server_add(server, fossil_mockup_network_create("ipc", "hello", "world\n"));
+    ASSUME_ITS_TRUE(fossil_mockup_server_start(server));
+    ASSUME_ITS_EQUAL_CSTR(path, fossil_mockup_server_path(server));
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSUME_ITS_EQUAL_I32(0, connect(fd, (struct sockaddr *)&address, sizeof(address)));
+    send(fd, "hello\n", 6, 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, 6));
+    ASSUME_ITS_EQUAL_CSTR("world\n", reply);
+    close(fd);
+
+    fossil_mockup_server_erase(server);
+    ASSUME_ITS_FALSE(access(path, F_OK) == 0);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_many_connections) {
+#ifndef _WIN32
+    enum { CLIENTS = 256 };
+    int fds[CLIENTS];
+    char reply[16];
+    fossil_mockup_server_t *server = fossil_mockup_server_create("pool", FOSSIL_MOCKUP_SERVER_TCP, NULL);
+    fossil_mockup_server_add(server, fossil_mockup_network_create("pool", "GET", "VAL\n"));
+    fossil_mockup_server_start(server);
+
+    for (int i = 0; i < CLIENTS; i++) {
+        fds[i] = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+        ASSUME_ITS_TRUE(fds[i] >= 0);
+    }
+    for (int i = 0; i < CLIENTS; i++) {
+        send(fds[i], "GET\nGET\n", 8, 0);
+    }
+    bool all_answered = true;
+    for (int i = 0; i < CLIENTS; i++) {
+        all_answered = all_answered && read_reply(fds[i], reply, 8) && strcmp(reply, "VAL\nVAL\n") == 0;
+        close(fds[i]);
+    }
+    ASSUME_ITS_TRUE(all_answered);
+
+    fossil_mockup_server_stop(server);
+    ASSUME_ITS_EQUAL_U64(CLIENTS, fossil_mockup_server_connection_count(server));
+    ASSUME_ITS_EQUAL_U64(2 * CLIENTS, fossil_mockup_server_request_count(server));
+    fossil_mockup_server_erase(server);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_routes) {
+#ifndef _WIN32
+    char reply[64];
+    fossil_mockup_server_t *server = fossil_mockup_server_create("api", FOSSIL_MOCKUP_SERVER_TCP, NULL);
+    fossil_mockup_route_table_t *routes = fossil_mockup_server_routes(server);
+    fossil_mockup_response_t *user = fossil_mockup_response_template("user {id}\n");
+    fossil_mockup_response_t *asset = fossil_mockup_response_create("asset\n");
+    fossil_mockup_route_add(routes, FOSSIL_MOCKUP_ROUTE_PATTERN, "api", "GET", "/users/:id", user);
+    fossil_mockup_route_add(routes, FOSSIL_MOCKUP_ROUTE_PREFIX, "*", "GET", "/static/", asset);
+    fossil_mockup_response_release(user);
+    fossil_mockup_response_release(asset);
+    ASSUME_ITS_TRUE(fossil_mockup_server_start(server));
+
+    int fd = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+    const char *requests = "GET /users/42 HTTP/1.1\nGET /static/app.js HTTP/1.1\nPOST /users/42 HTTP/1.1\n";
+    send(fd, requests, strlen(requests), 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, 14));
+    ASSUME_ITS_EQUAL_CSTR("user 42\nasset\n", reply);
+    close(fd);
+
+    fossil_mockup_server_stop(server);
+    ASSUME_ITS_EQUAL_U64(2, fossil_mockup_server_request_count(server));
+    ASSUME_ITS_EQUAL_U64(1, fossil_mockup_server_unmatched_count(server));
+    fossil_mockup_server_erase(server);
+#endif
+}
+
+FOSSIL_TEST(fossil_mockup_try_server_fault) {
+#ifndef _WIN32
+    char reply[32];
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(11);
+    fossil_mockup_fault_set_latency(fault, FOSSIL_MOCKUP_LATENCY_FIXED, 200, 0);
+    fossil_mockup_fault_set_short_io(fault, 0.5, 4);
+    fossil_mockup_fault_set_errors(fault, 0.3, 0.3, 0.0);
+    fossil_mockup_server_t *server = fossil_mockup_server_create("slow", FOSSIL_MOCKUP_SERVER_TCP, NULL);
+    fossil_mockup_server_add(server, fossil_mockup_network_create("slow", "GET", "a rather long reply\n"));
+    fossil_mockup_server_set_fault(server, fault);
+    ASSUME_ITS_TRUE(fossil_mockup_server_start(server));
+
+    // Partial packets, deferred writes and delays still deliver the reply
+    int fd = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+    send(fd, "GET\n", 4, 0);
+    ASSUME_ITS_TRUE(read_reply(fd, reply, 20));
+    ASSUME_ITS_EQUAL_CSTR("a rather long reply\n", reply);
+    close(fd);
+    fossil_mockup_server_stop(server);
+    ASSUME_ITS_TRUE(fault->short_count >= 4);
+
+    // A dropped connection is closed without a reply
+    fossil_mockup_fault_set_errors(fault, 0.0, 0.0, 1.0);
+    fossil_mockup_server_start(server);
+    fd = connect_loopback(SOCK_STREAM, fossil_mockup_server_port(server));
+    send(fd, "GET\n", 4, 0);
+    ASSUME_ITS_FALSE(read_reply(fd, reply, 1));
+    close(fd);
+
+    fossil_mockup_server_erase(server);
+    fossil_mockup_fault_erase(fault);
+#endif
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_server_group) {
+    ADD_TEST(fossil_mockup_try_server_tcp_pipelined);
+    ADD_TEST(fossil_mockup_try_server_default_and_delimiter);
+    ADD_TEST(fossil_mockup_try_server_udp);
+    ADD_TEST(fossil_mockup_try_server_unix);
+    ADD_TEST(fossil_mockup_try_server_many_connections);
+    ADD_TEST(fossil_mockup_try_server_routes);
+    ADD_TEST(fossil_mockup_try_server_fault);
+} // end of fixture
@@ -0,0 +1,156 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/unittest/commands.h>
+#include <sys/stat.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static char path[FILENAME_MAX];
+
+static const char* snapshot_path(const char *name, const char *suffix) {
+    snprintf(path, sizeof(path), "%s/xtest_snapshot/%s%s", _CLI.snapshot_dir, name, suffix);
+    return path;
+}
+
+static void snapshot_remove(const char *name) {
+    remove(snapshot_path(name, ""));
+    remove(snapshot_path(name, ".hash"));
+    remove(snapshot_path(name, ".new"));
+}
+
+static void snapshot_cleanup(void) {
+    char directory[FILENAME_MAX];
+    snapshot_remove("greeting");
+    snapshot_remove("table.bin");
+    snprintf(directory, sizeof(directory), "%s/xtest_snapshot", _CLI.snapshot_dir);
+    rmdir(directory);
+    rmdir(_CLI.snapshot_dir);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(xassume_run_of_snapshot_streaming_hash) {
+    uint8_t data[1000];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 131 + 7);
+    }
+    // Reference values of xxHash64 with seed 0
+    ASSUME_ITS_EQUAL_U64(UINT64_C(0xEF46DB3751D8E999), fossil_snapshot_hash("", 0));
+    ASSUME_ITS_EQUAL_U64(UINT64_C(0x44BC2CF5AD770999), fossil_snapshot_hash("abc", 3));
+
+    // Any split gives the one call result
+    uint64_t whole = fossil_snapshot_hash(data, sizeof(data));
+    bool same = true;
+    for (size_t piece = 1; piece <= 67; piece += 3) {
+        fossil_snapshot_hash_t hash;
+        fossil_snapshot_hash_init(&hash);
+        for (size_t at = 0; at < sizeof(data); at += piece) {
+            fossil_snapshot_hash_update(&hash, data + at, sizeof(data) - at < piece ? sizeof(data) - at : piece);
+        }
+        same = same && fossil_snapshot_hash_final(&hash) == whole;
+    }
+    ASSUME_ITS_TRUE(same);
+    ASSUME_ITS_TRUE(whole != fossil_snapshot_hash(data, sizeof(data) - 1));
+}
+
+FOSSIL_TEST(xassume_run_of_snapshot_text_golden_file) {
+    const char *greeting = "hello\nsnapshot\n";
+    ASSUME_ITS_TRUE(fossil_snapshot_write("xtest_snapshot/greeting", greeting, strlen(greeting)));
+    ASSUME_SNAPSHOT("xtest_snapshot/greeting", greeting, strlen(greeting));
+
+    // A stale hash falls back to comparing the golden file itself
+    FILE *file = fopen(snapshot_path("greeting", ".hash"), "w");
+    ASSUME_NOT_CNULL(file);
+    fputs("0000000000000000 15 0\n", file);
+    fclose(file);
+    ASSUME_SNAPSHOT("xtest_snapshot/greeting", greeting, strlen(greeting));
+
+    snapshot_cleanup();
+}
+
+FOSSIL_TEST(xassume_run_of_snapshot_binary_golden_file) {
+    uint8_t table[4096];
+    for (size_t i = 0; i < sizeof(table); i++) {
+        table[i] = (uint8_t)(i % 251);
+    }
+    ASSUME_ITS_TRUE(fossil_snapshot_write("xtest_snapshot/table.bin", table, sizeof(table)));
+    ASSUME_SNAPSHOT("xtest_snapshot/table.bin", table, sizeof(table));
+
+    // The hash file records the hash, the length and the golden file's time
+    unsigned long long hash = 0;
+    unsigned long long size = 0;
+    long long modified = 0;
+    struct stat status;
+    FILE *file = fopen(snapshot_path("table.bin", ".hash"), "r");
+    ASSUME_NOT_CNULL(file);
+    ASSUME_ITS_EQUAL_I32(3, fscanf(file, "%llx %llu %lld", &hash, &size, &modified));
+    fclose(file);
+    ASSUME_ITS_EQUAL_U64(fossil_snapshot_hash(table, sizeof(table)), hash);
+    ASSUME_ITS_EQUAL_U64(sizeof(table), size);
+    ASSUME_ITS_EQUAL_I32(0, stat(snapshot_path("table.bin", ""), &status));
+    ASSUME_ITS_EQUAL_I64((long long)status.st_mtime, modified);
+
+    snapshot_cleanup();
+}
+
+FOSSIL_TEST(xassume_run_of_snapshot_edited_golden_file) {
+    const char *greeting = "hello\nsnapshot\n";
+    ASSUME_ITS_TRUE(fossil_snapshot_write("xtest_snapshot/greeting", greeting, strlen(greeting)));
+    ASSUME_ITS_TRUE(fossil_snapshot_matches("xtest_snapshot/greeting", greeting, strlen(greeting)));
+
+    // An edit behind the hash file's back is caught by the golden file's size
+    FILE *file = fopen(snapshot_path("greeting", ""), "wb");
+    ASSUME_NOT_CNULL(file);
+    fputs("hello\nedited snapshot\n", file);
+    fclose(file);
+    ASSUME_ITS_FALSE(fossil_snapshot_matches("xtest_snapshot/greeting", greeting, strlen(greeting)));
+    ASSUME_ITS_TRUE(fossil_snapshot_matches("xtest_snapshot/greeting", "hello\nedited snapshot\n", 22));
+
+    // and by its time when the size stayed the same
+    ASSUME_ITS_TRUE(fossil_snapshot_write("xtest_snapshot/greeting", greeting, strlen(greeting)));
+    file = fopen(snapshot_path("greeting", ".hash"), "w");
+    ASSUME_NOT_CNULL(file);
+    fprintf(file, "%016llx %zu 1\n", (unsigned long long)fossil_snapshot_hash(greeting, strlen(greeting)), strlen(greeting));
+    fclose(file);
+    file = fopen(snapshot_path("greeting", ""), "wb");
+    ASSUME_NOT_CNULL(file);
+    fputs("HELLO\nsnapshot\n", file);
+    fclose(file);
+    ASSUME_ITS_FALSE(fossil_snapshot_matches("xtest_snapshot/greeting", greeting, strlen(greeting)));
+
+    snapshot_cleanup();
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(snapshot_test_group) {
+    ADD_TEST(xassume_run_of_snapshot_streaming_hash);
+    ADD_TEST(xassume_run_of_snapshot_text_golden_file);
+    ADD_TEST(xassume_run_of_snapshot_binary_golden_file);
+    ADD_TEST(xassume_run_of_snapshot_edited_golden_file);
+} // end of fixture
@@ -0,0 +1,167 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+#define TABLE_CSV_PATH "fossil_table_vectors.csv"
+#define TABLE_BIN_PATH "fossil_table_vectors.bin"
+
+typedef struct {
+    const char *text;
+    int32_t value;
+} table_vector;
+
+static const table_vector table_vectors[] = {
+    {"0", 0}, {"17", 17}, {"-5", -5}, {"0x10", 16}, {"2147483647", 2147483647}
+};
+
+typedef struct {
+    int32_t left;
+    int32_t right;
+    int32_t sum;
+} table_record;
+
+// Data files are written while the group registers, before any row runs.
+static void table_remove_data(void) {
+    remove(TABLE_CSV_PATH);
+    remove(TABLE_BIN_PATH);
+}
+
+static void table_write_data(void) {
+    FILE *csv = fopen(TABLE_CSV_PATH, "wb");
+    FILE *bin = fopen(TABLE_BIN_PATH, "wb");
+    if (csv == NULL || bin == NULL) {
+        return;
+    }
+    fputs("# index,square,label\r\n", csv);
+    for (int32_t i = 0; i < 100; i++) {
+        fprintf(csv, "%d,%d,\"row \"\"%d\"\", squared\"\n", i, i * i, i);
+        table_record record = { i, 1000 - i, 1000 };
+        fwrite(&record, sizeof(record), 1, bin);
+    }
+    fputs("\n", csv);
+    fclose(csv);
+    fclose(bin);
+    atexit(table_remove_data);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST_TABLE(xtable_inline_rows, table_vector, table_vectors) {
+    ASSUME_ITS_EQUAL_I64(row->value, strtol(row->text, NULL, 0));
+}
+
+FOSSIL_TEST_CSV(xtable_csv_rows, TABLE_CSV_PATH) {
+    char label[32];
+    char expected[32];
+    int64_t index = fossil_test_row_i64(row, 0);
+    ASSUME_ITS_EQUAL_I64((int64_t)row->index, index);
+    ASSUME_ITS_EQUAL_I64(index * index, fossil_test_row_i64(row, 1));
+
+    snprintf(expected, sizeof(expected), "row \"%d\", squared", (int)index);
+    ASSUME_ITS_TRUE(fossil_test_row_copy(row, 2, label, sizeof(label)));
+    ASSUME_ITS_EQUAL_CSTR(expected, label);
+    ASSUME_ITS_TRUE(fossil_test_row_equal(row, 2, expected));
+}
+
+FOSSIL_TEST_RECORDS(xtable_binary_records, table_record, TABLE_BIN_PATH) {
+    ASSUME_ITS_EQUAL_I32(row->sum, row->left + row->right);
+}
+
+FOSSIL_TEST(xtable_row_fields) {
+    const char *line = "alpha,,\"x,y\",42";
+    fossil_test_row_t row = { line, strlen(line), 0 };
+    const char *field;
+    char buffer[4];
+
+    ASSUME_ITS_EQUAL_SIZE(5, fossil_test_row_field(&row, 0, &field));
+    ASSUME_ITS_TRUE(memcmp(field, "alpha", 5) == 0);
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_row_field(&row, 1, &field));
+    ASSUME_NOT_CNULL(field);
+    ASSUME_ITS_TRUE(fossil_test_row_equal(&row, 2, "x,y"));
+    ASSUME_ITS_EQUAL_I64(42, fossil_test_row_i64(&row, 3));
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_row_field(&row, 4, &field));
+    ASSUME_ITS_CNULL(field);
+
+    // Truncation is reported but the buffer stays terminated
+    ASSUME_ITS_FALSE(fossil_test_row_copy(&row, 0, buffer, sizeof(buffer)));
+    ASSUME_ITS_EQUAL_CSTR("alp", buffer);
+    ASSUME_ITS_FALSE(fossil_test_row_copy(&row, 9, buffer, sizeof(buffer)));
+}
+
+FOSSIL_TEST(xtable_cursor_walks_lazily) {
+    fossil_test_table_t table = { FOSSIL_TEST_TABLE_CSV, NULL, 0, 0, TABLE_CSV_PATH, NULL };
+    fossil_test_table_cursor_t cursor;
+    fossil_test_row_t row;
+
+    ASSUME_ITS_TRUE(fossil_test_table_open(&table, &cursor));
+    size_t rows = 0;
+    while (fossil_test_table_next(&cursor, &row)) {
+        rows++;
+    }
+    ASSUME_ITS_EQUAL_SIZE(100, rows);
+    fossil_test_table_close(&cursor);
+
+    table.path = "fossil_missing_table.csv";
+    ASSUME_ITS_FALSE(fossil_test_table_open(&table, &cursor));
+}
+
+FOSSIL_TEST(xtable_shards_split_exactly) {
+    const char *names[] = { "alpha", "beta", "gamma", "delta" };
+    size_t owned[3] = { 0, 0, 0 };
+
+    // Each case and row belongs to exactly one shard, whatever the order.
+    for (size_t n = 0; n < 4; n++) {
+        for (uint64_t row = 0; row < 300; row++) {
+            int owners = 0;
+            for (int shard = 0; shard < 3; shard++) {
+                if (fossil_test_shard_owns(names[n], row, shard, 3)) {
+                    owners++;
+                    owned[shard]++;
+                }
+            }
+            ASSUME_ITS_EQUAL_I32(1, owners);
+        }
+    }
+    for (int shard = 0; shard < 3; shard++) {
+        ASSUME_ITS_TRUE(owned[shard] > 300 && owned[shard] < 500);
+    }
+    ASSUME_ITS_TRUE(fossil_test_shard_owns("alpha", 7, 0, 1));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(table_test_group) {
+    table_write_data();
+
+    ADD_TEST(xtable_inline_rows);
+    ADD_TEST(xtable_csv_rows);
+    ADD_TEST(xtable_binary_records);
+    ADD_TEST(xtable_row_fields);
+    ADD_TEST(xtable_cursor_walks_lazily);
+    ADD_TEST(xtable_shards_split_exactly);
+} // end of fixture
@@ -89,6 +89,18 @@ FOSSIL_TEST(xassert_run_of_int64) {
     TEST_ASSERT((int64_t)y <= (int64_t)x, "Should have passed the test case");
 } // end case
 
+FOSSIL_TEST(xassert_run_in_tight_loop) {
+    uint64_t before = _fossil_test_pass_count;
+    int64_t sum = 0;
+
+    // Passing assertions stay inline and only count themselves
+    for (int32_t i = 0; i < 1000000; i++) {
+        sum += i;
+        TEST_ASSERT(sum >= i, "Should have passed the test case");
+    }
+    TEST_ASSERT(_fossil_test_pass_count - before == 1000000, "Should have counted every pass");
+} // end case
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -98,4 +110,5 @@ FOSSIL_TEST_GROUP(tdd_test_group) {
     ADD_TEST(xassert_run_of_int16);
     ADD_TEST(xassert_run_of_int32);
     ADD_TEST(xassert_run_of_int64);
+    ADD_TEST(xassert_run_in_tight_loop);
 } // end of group
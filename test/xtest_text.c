@@ -0,0 +1,164 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+static char diff[8192];
+
+static char* numbered_lines(size_t count, size_t changed) {
+    char *text = (char *)malloc(count * 16 + 1);
+    size_t used = 0;
+    for (size_t i = 1; i <= count; i++) {
+        used += (size_t)sprintf(text + used, i == changed ? "LINE %zu\n" : "line %zu\n", i);
+    }
+    return text;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(xassume_run_of_text_large_equal) {
+    char *first = numbered_lines(100000, 0);
+    char *second = numbered_lines(100000, 0);
+    ASSUME_ITS_EQUAL_CSTR(first, second);
+    ASSUME_ITS_EQUAL_BSTR(first, second);
+    ASSUME_ITS_EQUAL_TEXT(first, strlen(first), second, strlen(second));
+
+    second[strlen(second) - 3] = 'X';
+    ASSUME_ITS_EQUAL_SIZE(strlen(first) - 3, fossil_test_text_mismatch(first, strlen(first), second, strlen(second)));
+    ASSUME_ITS_EQUAL_SIZE(5, fossil_test_text_mismatch("abcde", 5, "abcdef", 6));
+
+    free(first);
+    free(second);
+}
+
+FOSSIL_TEST(xassume_run_of_text_unified_diff) {
+    char *actual = numbered_lines(2000, 0);
+    char *expected = numbered_lines(2000, 1500);
+    ASSUME_ITS_TRUE(fossil_test_text_diff(actual, strlen(actual), expected, strlen(expected), diff, sizeof(diff)) > 0);
+    ASSUME_ITS_TRUE(strstr(diff, "--- expected\n    +++ actual") != NULL);
+    ASSUME_ITS_TRUE(strstr(diff, "@@ -1497,7 +1497,7 @@") != NULL);
+    ASSUME_ITS_TRUE(strstr(diff, "\n    -LINE 1500\n    +line 1500\n") != NULL);
+    ASSUME_ITS_TRUE(strstr(diff, "line 1400") == NULL);
+
+    // Inserted and removed lines line up around the unchanged ones
+    const char *old_text = "a\nb\nc\nd\n";
+    const char *new_text = "a\nc\nd\ne\n";
+    fossil_test_text_diff(new_text, strlen(new_text), old_text, strlen(old_text), diff, sizeof(diff));
+    ASSUME_ITS_TRUE(strstr(diff, "@@ -1,4 +1,4 @@\n     a\n    -b\n     c\n     d\n    +e") != NULL);
+
+    // Equal texts have no diff
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_text_diff(old_text, 8, old_text, 8, diff, sizeof(diff)));
+    free(actual);
+    free(expected);
+}
+
+FOSSIL_TEST(xassume_run_of_text_diff_is_bounded) {
+    // Every line differs, far past the edit budget
+    size_t count = 3000;
+    char *actual = (char *)malloc(count * 16);
+    char *expected = (char *)malloc(count * 16);
+    size_t a = 0;
+    size_t e = 0;
+    for (size_t i = 0; i < count; i++) {
+        a += (size_t)sprintf(actual + a, "new %zu\n", i);
+        e += (size_t)sprintf(expected + e, "old %zu\n", i);
+    }
+    size_t written = fossil_test_text_diff(actual, a, expected, e, diff, sizeof(diff));
+    ASSUME_ITS_TRUE(written < sizeof(diff));
+    ASSUME_ITS_TRUE(strstr(diff, "-old 0\n") != NULL && strstr(diff, "+new 0\n") != NULL);
+    ASSUME_ITS_TRUE(strstr(diff, "longer than shown") != NULL);
+
+    // Output is cut to the buffer
+    char small[64];
+    ASSUME_ITS_TRUE(fossil_test_text_diff(actual, a, expected, e, small, sizeof(small)) < sizeof(small));
+    free(actual);
+    free(expected);
+}
+
+FOSSIL_TEST(xassume_run_of_text_embedded_nul_and_newline) {
+    ASSUME_ITS_EQUAL_TEXT("ab\0cd", 5, "ab\0cd", 5);
+    ASSUME_ITS_EQUAL_SIZE(3, fossil_test_text_mismatch("ab\0cd", 5, "ab\0xd", 5));
+
+    fossil_test_text_diff("last", 4, "last\n", 5, diff, sizeof(diff));
+    ASSUME_ITS_TRUE(strstr(diff, "-last\n    +last\n    \\ No newline at end of text") != NULL);
+}
+
+FOSSIL_TEST(xassume_run_of_text_wide_and_null) {
+    ASSUME_ITS_EQUAL_WSTR(L"wide text", L"wide text");
+    ASSUME_ITS_EQUAL_CSTR((const char *)NULL, (const char *)NULL);
+}
+
+FOSSIL_TEST(xassume_run_of_text_contains_large_log) {
+    char *log = numbered_lines(50000, 31337);
+    ASSUME_CONTAINS(log, "line 49999\n");
+    ASSUME_CONTAINS(log, "LINE 31337");
+    ASSUME_NOT_CONTAINS(log, "LINE 31338");
+    ASSUME_CONTAINS_COUNT(log, "LINE", 1);
+    ASSUME_CONTAINS_COUNT(log, "line 4999", 11);
+    ASSUME_STARTS_WITH(log, "line 1\nline 2\n");
+    ASSUME_ENDS_WITH(log, "line 50000\n");
+    ASSUME_CONTAINS(log, "");
+
+    size_t length = strlen(log);
+    ASSUME_ITS_EQUAL_SIZE(length - 11, fossil_test_text_find(log, length, "line 50000\n", 11));
+    ASSUME_ITS_EQUAL_SIZE(length, fossil_test_text_find(log, length, "line 50001", 10));
+    ASSUME_ITS_EQUAL_SIZE(2, fossil_test_text_count("aaaaa", 5, "aa", 2));
+    free(log);
+}
+
+FOSSIL_TEST(xassume_run_of_text_matches_per_line) {
+    char *log = numbered_lines(2000, 1234);
+    ASSUME_MATCHES(log, "^LINE [0-9]+$");
+    ASSUME_NOT_MATCHES(log, "^line 1234$");
+    ASSUME_MATCHES_COUNT(log, "^line 1[0-9]{3}$", 999);
+    ASSUME_MATCHES_COUNT("a-b-c", "-", 2);
+    ASSUME_MATCHES_COUNT("", "x*", 1);
+
+    // The call site keeps its pattern, a different one compiles on the side
+    const char *patterns[] = { "^line 7$", "^line 7$", "^line 8$" };
+    for (size_t i = 0; i < 3; i++) {
+        ASSUME_MATCHES(log, patterns[i]);
+    }
+    size_t offset = 0;
+    ASSUME_ITS_TRUE(fossil_test_pattern_find(NULL, "^line 2$", log, &offset));
+    ASSUME_ITS_EQUAL_SIZE(7, offset);
+    ASSUME_ITS_FALSE(fossil_test_pattern_find(NULL, "(unbalanced", log, &offset));
+    ASSUME_ITS_EQUAL_SIZE(0, fossil_test_pattern_count(NULL, "(unbalanced", log));
+    free(log);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(text_test_group) {
+    ADD_TEST(xassume_run_of_text_large_equal);
+    ADD_TEST(xassume_run_of_text_unified_diff);
+    ADD_TEST(xassume_run_of_text_diff_is_bounded);
+    ADD_TEST(xassume_run_of_text_embedded_nul_and_newline);
+    ADD_TEST(xassume_run_of_text_wide_and_null);
+    ADD_TEST(xassume_run_of_text_contains_large_log);
+    ADD_TEST(xassume_run_of_text_matches_per_line);
+} // end of fixture
@@ -0,0 +1,202 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/vfs.h> // library under test
+#include <errno.h>
+#include <fcntl.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_FIXTURE(vfs_fixture);
+
+FOSSIL_SETUP(vfs_fixture) {
+    fossil_mockup_vfs_mount("/vfs");
+} // end of setup
+
+FOSSIL_TEARDOWN(vfs_fixture) {
+    fossil_mockup_vfs_erase();
+} // end of teardown
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_vfs_add_and_read) {
+    char buffer[16] = {0};
+
+    ASSUME_NOT_CNULL(fossil_mockup_vfs_add_file("/vfs/etc/app.conf", "threads=4"));
+    ASSUME_ITS_TRUE(fossil_mockup_vfs_owns("/vfs//etc/./app.conf"));
+    ASSUME_ITS_FALSE(fossil_mockup_vfs_owns("/vfsx/app.conf"));
+    ASSUME_ITS_TRUE(fossil_mockup_vfs_lookup("/vfs/etc")->is_directory);
+
+    int fd = fossil_mockup_vfs_open("/vfs/etc/../etc/app.conf", O_RDONLY, 0);
+    ASSUME_ITS_TRUE(fossil_mockup_vfs_is_fd(fd));
+    ASSUME_ITS_EQUAL_I64(7, fossil_mockup_vfs_read(fd, buffer, 7));
+    ASSUME_ITS_EQUAL_CSTR("threads", buffer);
+    ASSUME_ITS_EQUAL_I64(2, fossil_mockup_vfs_read(fd, buffer, sizeof(buffer)));
+    ASSUME_ITS_EQUAL_I64(0, fossil_mockup_vfs_read(fd, buffer, sizeof(buffer)));
+    ASSUME_ITS_EQUAL_I64(-1, fossil_mockup_vfs_write(fd, "x", 1));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_close(fd));
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_open_flags) {
+    fossil_mockup_vfs_stat_t info;
+
+    ASSUME_ITS_EQUAL_I32(-1, fossil_mockup_vfs_open("/vfs/missing/log.txt", O_WRONLY | O_CREAT, 0644));
+    int fd = fossil_mockup_vfs_open("/vfs/log.txt", O_WRONLY | O_CREAT | O_EXCL, 0600);
+    ASSUME_ITS_TRUE(fd >= FOSSIL_MOCKUP_VFS_FD_BASE);
+    ASSUME_ITS_EQUAL_I32(-1, fossil_mockup_vfs_open("/vfs/log.txt", O_WRONLY | O_CREAT | O_EXCL, 0600));
+
+    fossil_mockup_vfs_write(fd, "abc", 3);
+    ASSUME_ITS_EQUAL_I64(6, fossil_mockup_vfs_lseek(fd, 6, SEEK_SET));
+    fossil_mockup_vfs_write(fd, "z", 1);
+    fossil_mockup_vfs_close(fd);
+
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_stat("/vfs/log.txt", &info));
+    ASSUME_ITS_EQUAL_U64(7, info.size);
+    ASSUME_ITS_EQUAL_U32(0600, info.mode);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(fossil_mockup_vfs_lookup("/vfs/log.txt")->file->content, "abc\0\0\0z", 7));
+
+    fd = fossil_mockup_vfs_open("/vfs/log.txt", O_WRONLY | O_APPEND, 0);
+    fossil_mockup_vfs_lseek(fd, 0, SEEK_SET);
+    fossil_mockup_vfs_write(fd, "!", 1);
+    fossil_mockup_vfs_fstat(fd, &info);
+    ASSUME_ITS_EQUAL_U64(8, info.size);
+    fossil_mockup_vfs_close(fd);
+
+    fd = fossil_mockup_vfs_open("/vfs/log.txt", O_RDWR | O_TRUNC, 0);
+    fossil_mockup_vfs_fstat(fd, &info);
+    ASSUME_ITS_EQUAL_U64(0, info.size);
+    fossil_mockup_vfs_close(fd);
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_directories) {
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_mkdir("/vfs/data", 0755));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_mockup_vfs_mkdir("/vfs/data", 0755));
+    fossil_mockup_vfs_add_file("/vfs/data/a.bin", "a");
+    fossil_mockup_vfs_add_file("/vfs/data/b.bin", "b");
+
+    int entries = 0;
+    for (fossil_mockup_vfs_node_t *child = fossil_mockup_vfs_lookup("/vfs/data")->children; child != NULL; child = child->sibling) {
+        entries++;
+    }
+    ASSUME_ITS_EQUAL_I32(2, entries);
+
+    ASSUME_ITS_EQUAL_I32(-1, fossil_mockup_vfs_unlink("/vfs/data"));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_unlink("/vfs/data/a.bin"));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_unlink("/vfs/data/b.bin"));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_unlink("/vfs/data"));
+    ASSUME_ITS_CNULL(fossil_mockup_vfs_lookup("/vfs/data"));
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_unlink_while_open) {
+    char buffer[8] = {0};
+    fossil_mockup_vfs_add_file("/vfs/tmp.txt", "still here");
+
+    int fd = fossil_mockup_vfs_open("/vfs/tmp.txt", O_RDONLY, 0);
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_unlink("/vfs/tmp.txt"));
+    ASSUME_ITS_CNULL(fossil_mockup_vfs_lookup("/vfs/tmp.txt"));
+    ASSUME_ITS_EQUAL_I64(5, fossil_mockup_vfs_read(fd, buffer, 5));
+    ASSUME_ITS_EQUAL_CSTR("still", buffer);
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_close(fd));
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_mmap) {
+    fossil_mockup_file_t *file = fossil_mockup_vfs_add_file("/vfs/blob", "0123456789");
+    int fd = fossil_mockup_vfs_open("/vfs/blob", O_RDWR, 0);
+
+    char *shared = (char *)fossil_mockup_vfs_mmap(fd, 4, 2, false);
+    ASSUME_ITS_TRUE(shared == file->content + 2);
+    shared[0] = 'X';
+    ASSUME_ITS_EQUAL_CSTR("01X3456789", file->content);
+
+    char *copy = (char *)fossil_mockup_vfs_mmap(fd, 4, 2, true);
+    copy[0] = 'Y';
+    ASSUME_ITS_EQUAL_CSTR("01X3456789", file->content);
+
+    ASSUME_ITS_CNULL(fossil_mockup_vfs_mmap(fd, 20, 0, false));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_munmap(shared));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_munmap(copy));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_mockup_vfs_munmap(copy));
+    fossil_mockup_vfs_close(fd);
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_mmap_pins_content) {
+    char tail[256];
+    memset(tail, 'z', sizeof(tail));
+    fossil_mockup_vfs_add_file("/vfs/pinned", "0123456789");
+    int fd = fossil_mockup_vfs_open("/vfs/pinned", O_RDWR, 0);
+
+    const char *shared = (const char *)fossil_mockup_vfs_mmap(fd, 10, 0, false);
+    ASSUME_NOT_CNULL(shared);
+    // Growing the file would move its content, so the write is refused.
+    ASSUME_ITS_EQUAL_I64(-1, fossil_mockup_vfs_pwrite(fd, tail, sizeof(tail), 10));
+    ASSUME_ITS_EQUAL_I32(ENOSPC, errno);
+    ASSUME_ITS_EQUAL_I64(2, fossil_mockup_vfs_pwrite(fd, "ab", 2, 0));
+    ASSUME_ITS_EQUAL_I32(0, memcmp(shared, "ab23456789", 10));
+
+    // Unlinked files stay readable through the mapping until it goes away.
+    fossil_mockup_vfs_close(fd);
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_unlink("/vfs/pinned"));
+    ASSUME_ITS_EQUAL_I32(0, memcmp(shared, "ab23456789", 10));
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_munmap((void *)shared));
+
+    fossil_mockup_vfs_add_file("/vfs/pinned", "0123456789");
+    fd = fossil_mockup_vfs_open("/vfs/pinned", O_RDWR, 0);
+    shared = (const char *)fossil_mockup_vfs_mmap(fd, 10, 0, false);
+    ASSUME_ITS_EQUAL_I32(0, fossil_mockup_vfs_munmap((void *)shared));
+    ASSUME_ITS_EQUAL_I64(sizeof(tail), fossil_mockup_vfs_pwrite(fd, tail, sizeof(tail), 10));
+    fossil_mockup_vfs_close(fd);
+}
+
+FOSSIL_TEST(fossil_mockup_try_vfs_fopen) {
+#if defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+    char line[32] = {0};
+
+    FILE *stream = fossil_mockup_vfs_fopen("/vfs/report.txt", "w");
+    ASSUME_NOT_CNULL(stream);
+    fprintf(stream, "total=%d\n", 12);
+    fclose(stream);
+
+    stream = fossil_mockup_vfs_fopen("/vfs/report.txt", "r");
+    ASSUME_NOT_CNULL(stream);
+    ASSUME_NOT_CNULL(fgets(line, sizeof(line), stream));
+    ASSUME_ITS_EQUAL_CSTR("total=12\n", line);
+    fclose(stream);
+#endif
+    ASSUME_ITS_CNULL(fossil_mockup_vfs_fopen("/vfs/absent.txt", "r"));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_vfs_group) {
+    ADD_TESTF(fossil_mockup_try_vfs_add_and_read, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_open_flags, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_directories, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_unlink_while_open, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_mmap, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_mmap_pins_content, vfs_fixture);
+    ADD_TESTF(fossil_mockup_try_vfs_fopen, vfs_fixture);
+} // end of fixture
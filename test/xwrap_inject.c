@@ -0,0 +1,106 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/inject.h> // library under test
+#include <fossil/mockup/fault.h>
+
+// This program is linked with --wrap for the two fault functions below, so
+// every call it makes to them lands in the trampolines defined here.
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_MOCK_WRAP(uint64_t, fossil_mockup_fault_now, (const fossil_mockup_fault_t *fault), (fault))
+FOSSIL_MOCK_WRAP_VOID(fossil_mockup_fault_reset, (fossil_mockup_fault_t *fault), (fault))
+
+static int32_t wrap_reset_calls = 0;
+
+static uint64_t wrap_fake_now(const fossil_mockup_fault_t *fault) {
+    (void)fault;
+    return 1234;
+}
+
+static void wrap_fake_reset(fossil_mockup_fault_t *fault) {
+    (void)fault;
+    wrap_reset_calls++;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_wrap_set_and_reset) {
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(1);
+    fault->now_us = 77;
+
+    // With no replacement the trampoline forwards to the real function
+    ASSUME_ITS_EQUAL_U64(77, fossil_mockup_fault_now(fault));
+
+    FOSSIL_MOCK_WRAP_SET(fossil_mockup_fault_now, wrap_fake_now);
+    ASSUME_ITS_EQUAL_U64(1234, fossil_mockup_fault_now(fault));
+    ASSUME_ITS_EQUAL_U64(77, __real_fossil_mockup_fault_now(fault));
+
+    FOSSIL_MOCK_WRAP_RESET(fossil_mockup_fault_now);
+    ASSUME_ITS_EQUAL_U64(77, fossil_mockup_fault_now(fault));
+    fossil_mockup_fault_erase(fault);
+}
+
+FOSSIL_TEST(fossil_mockup_try_wrap_void) {
+    fossil_mockup_fault_t *fault = fossil_mockup_fault_create(1);
+    fault->now_us = 77;
+    wrap_reset_calls = 0;
+
+    FOSSIL_MOCK_WRAP_SET(fossil_mockup_fault_reset, wrap_fake_reset);
+    fossil_mockup_fault_reset(fault);
+    ASSUME_ITS_EQUAL_I32(1, wrap_reset_calls);
+    ASSUME_ITS_EQUAL_U64(77, fault->now_us);
+
+    // The real function stays reachable while a replacement is set
+    __real_fossil_mockup_fault_reset(fault);
+    ASSUME_ITS_EQUAL_U64(0, fault->now_us);
+
+    FOSSIL_MOCK_WRAP_RESET(fossil_mockup_fault_reset);
+    fault->now_us = 77;
+    fossil_mockup_fault_reset(fault);
+    ASSUME_ITS_EQUAL_I32(1, wrap_reset_calls);
+    ASSUME_ITS_EQUAL_U64(0, fault->now_us);
+    fossil_mockup_fault_erase(fault);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_wrap_inject_group) {
+    ADD_TEST(fossil_mockup_try_wrap_set_and_reset);
+    ADD_TEST(fossil_mockup_try_wrap_void);
+} // end of fixture
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Runner
+// * * * * * * * * * * * * * * * * * * * * * * * *
+int main(int argc, char **argv) {
+    FOSSIL_TEST_CREATE(argc, argv);
+    FOSSIL_TEST_IMPORT(fossil_mockup_wrap_inject_group);
+    FOSSIL_TEST_RUN();
+    return FOSSIL_TEST_ERASE();
+} // end of func
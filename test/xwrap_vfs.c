@@ -0,0 +1,144 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/unittest.h>   // basic test tools
+#include <fossil/xassume.h> // extra asserts
+
+#include <fossil/mockup/vfs.h> // library under test
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// This program is linked with fossil_mock_wrap_dep, so the plain C library
+// calls below go through the VFS interposition. It is built more than once,
+// with and without large file offsets and _FORTIFY_SOURCE, as each of those
+// changes which symbol the calls resolve to.
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilites
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_FIXTURE(wrap_fixture);
+
+FOSSIL_SETUP(wrap_fixture) {
+    fossil_mockup_vfs_mount("/vfs");
+    fossil_mockup_vfs_add_file("/vfs/data.txt", "hello wrapped world");
+} // end of setup
+
+FOSSIL_TEARDOWN(wrap_fixture) {
+    fossil_mockup_vfs_erase();
+} // end of teardown
+
+// Counts and flags the compiler cannot see through, so fortified builds
+// take the checked __read_chk and __open_2 paths instead of folding them.
+static volatile size_t wrap_count = 5;
+static volatile int wrap_flags = O_RDONLY;
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(fossil_mockup_try_wrap_open_read) {
+    char buffer[32] = {0};
+
+    int fd = open("/vfs/data.txt", wrap_flags);
+    ASSUME_ITS_TRUE(fossil_mockup_vfs_is_fd(fd));
+    ASSUME_ITS_EQUAL_I64(5, read(fd, buffer, wrap_count));
+    ASSUME_ITS_EQUAL_CSTR("hello", buffer);
+    ASSUME_ITS_EQUAL_I64(14, lseek(fd, -5, SEEK_END));
+    ASSUME_ITS_EQUAL_I64(5, read(fd, buffer, wrap_count));
+    ASSUME_ITS_EQUAL_CSTR("world", buffer);
+    ASSUME_ITS_EQUAL_I64(5, pread(fd, buffer, wrap_count, 6));
+    ASSUME_ITS_EQUAL_I32(0, memcmp(buffer, "wrapp", 5));
+    ASSUME_ITS_EQUAL_I32(0, close(fd));
+}
+
+FOSSIL_TEST(fossil_mockup_try_wrap_write_stat) {
+    struct stat info;
+
+    int fd = open("/vfs/out.txt", O_RDWR | O_CREAT | O_TRUNC, 0640);
+    ASSUME_ITS_TRUE(fossil_mockup_vfs_is_fd(fd));
+    ASSUME_ITS_EQUAL_I64(3, write(fd, "abc", 3));
+    ASSUME_ITS_EQUAL_I64(2, pwrite(fd, "yz", 2, 6));
+    ASSUME_ITS_EQUAL_I32(0, fstat(fd, &info));
+    ASSUME_ITS_EQUAL_I64(8, info.st_size);
+    ASSUME_ITS_TRUE(S_ISREG(info.st_mode));
+    ASSUME_ITS_EQUAL_I32(0, close(fd));
+
+    ASSUME_ITS_EQUAL_I32(0, stat("/vfs/out.txt", &info));
+    ASSUME_ITS_EQUAL_U32(0640, info.st_mode & 07777);
+    ASSUME_ITS_EQUAL_I32(0, stat("/vfs", &info));
+    ASSUME_ITS_TRUE(S_ISDIR(info.st_mode));
+    ASSUME_ITS_EQUAL_I32(0, unlink("/vfs/out.txt"));
+    ASSUME_ITS_EQUAL_I32(-1, stat("/vfs/out.txt", &info));
+}
+
+FOSSIL_TEST(fossil_mockup_try_wrap_fopen) {
+    char line[32] = {0};
+
+    FILE *stream = fopen("/vfs/data.txt", "r");
+    ASSUME_NOT_CNULL(stream);
+    ASSUME_NOT_CNULL(fgets(line, sizeof(line), stream));
+    ASSUME_ITS_EQUAL_CSTR("hello wrapped world", line);
+    fclose(stream);
+    ASSUME_ITS_CNULL(fopen("/vfs/absent.txt", "r"));
+}
+
+FOSSIL_TEST(fossil_mockup_try_wrap_mmap) {
+    int fd = open("/vfs/data.txt", O_RDONLY);
+    const char *mapped = (const char *)mmap(NULL, 19, PROT_READ, MAP_SHARED, fd, 0);
+    ASSUME_ITS_TRUE(mapped != MAP_FAILED);
+    ASSUME_ITS_EQUAL_I32(0, memcmp(mapped, "hello wrapped world", 19));
+    ASSUME_ITS_EQUAL_I32(0, munmap((void *)mapped, 19));
+    close(fd);
+}
+
+FOSSIL_TEST(fossil_mockup_try_wrap_passes_through) {
+    struct stat info;
+
+    // Paths outside the mount still reach the real filesystem.
+    ASSUME_ITS_EQUAL_I32(0, stat("/", &info));
+    ASSUME_ITS_TRUE(S_ISDIR(info.st_mode));
+    int fd = open("/", O_RDONLY);
+    ASSUME_ITS_TRUE(fd >= 0);
+    ASSUME_ITS_FALSE(fossil_mockup_vfs_is_fd(fd));
+    close(fd);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(fossil_mockup_wrap_group) {
+    ADD_TESTF(fossil_mockup_try_wrap_open_read, wrap_fixture);
+    ADD_TESTF(fossil_mockup_try_wrap_write_stat, wrap_fixture);
+    ADD_TESTF(fossil_mockup_try_wrap_fopen, wrap_fixture);
+    ADD_TESTF(fossil_mockup_try_wrap_mmap, wrap_fixture);
+    ADD_TESTF(fossil_mockup_try_wrap_passes_through, wrap_fixture);
+} // end of fixture
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Runner
+// * * * * * * * * * * * * * * * * * * * * * * * *
+int main(int argc, char **argv) {
+    FOSSIL_TEST_CREATE(argc, argv);
+    FOSSIL_TEST_IMPORT(fossil_mockup_wrap_group);
+    FOSSIL_TEST_RUN();
+    return FOSSIL_TEST_ERASE();
+} // end of func